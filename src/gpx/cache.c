@@ -0,0 +1,443 @@
+//  cache.c
+//
+//  Parsed gcode kept on disk so converting the same input again skips the
+//  text parser
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "cache.h"
+
+// A cache file is a header, the records and then the strings.  Each line of
+// the input is one record: a 32 bit word with the command's flag bits, then
+// the line number when the line has one, the value of each parameter and
+// command the flag bits mark, in the order of the table below, and the offset
+// of the comment and the argument in the strings.  Lines the parser has more
+// to say about, with a macro or a warning, are kept as text instead and go
+// back through the parser.  The records are in the byte order of the machine
+// that wrote them, one with the other order sees the wrong version and
+// writes the cache again.
+
+#define CACHE_MAGIC "GPXCACHE"
+#define CACHE_VERSION 1
+
+typedef struct tCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t hash;          // of the input
+    uint64_t length;        // of the input
+    uint64_t recordsLength;
+    uint64_t stringsLength;
+} CacheHeader;
+
+static const struct {
+    int flag;
+    size_t offset;
+} doubleFields[] = {
+    {X_IS_SET, offsetof(Command, x)},
+    {Y_IS_SET, offsetof(Command, y)},
+    {Z_IS_SET, offsetof(Command, z)},
+    {A_IS_SET, offsetof(Command, a)},
+    {B_IS_SET, offsetof(Command, b)},
+    {E_IS_SET, offsetof(Command, e)},
+    {F_IS_SET, offsetof(Command, f)},
+    {I_IS_SET, offsetof(Command, i)},
+    {J_IS_SET, offsetof(Command, j)},
+    {K_IS_SET, offsetof(Command, k)},
+    {P_IS_SET, offsetof(Command, p)},
+    {R_IS_SET, offsetof(Command, r)},
+    {S_IS_SET, offsetof(Command, s)},
+};
+
+static const struct {
+    int flag;
+    size_t offset;
+} unsignedFields[] = {
+    {G_IS_SET, offsetof(Command, g)},
+    {M_IS_SET, offsetof(Command, m)},
+    {T_IS_SET, offsetof(Command, t)},
+};
+
+#define FIELD_COUNT(fields) (sizeof(fields) / sizeof(fields[0]))
+#define DOUBLE_FIELDS (X_IS_SET | Y_IS_SET | Z_IS_SET | A_IS_SET | B_IS_SET | E_IS_SET | F_IS_SET \
+                       | I_IS_SET | J_IS_SET | K_IS_SET | P_IS_SET | R_IS_SET | S_IS_SET)
+#define UNSIGNED_FIELDS (G_IS_SET | M_IS_SET | T_IS_SET)
+#define RECORD_FLAGS (DOUBLE_FIELDS | UNSIGNED_FIELDS | COMMENT_IS_SET | ARG_IS_SET | CACHE_LINE_NUMBER)
+
+// the largest record, the flag word, the line number, every field and both
+// strings
+#define RECORD_MAX (4 + 4 + FIELD_COUNT(doubleFields) * 8 + FIELD_COUNT(unsignedFields) * 4 + 2 * 4)
+
+void cache_init(Cache *cache)
+{
+    memset(cache, 0, sizeof(Cache));
+}
+
+void cache_free(Cache *cache)
+{
+    if(cache->map != NULL) {
+#if !defined(_WIN32) && !defined(_WIN64)
+        munmap(cache->map, cache->mapLength);
+#else
+        free(cache->map);
+#endif
+    }
+    else {
+        free(cache->records);
+        free(cache->strings);
+    }
+    free(cache->index);
+    cache_init(cache);
+}
+
+// FNV-1a a word at a time, with the top half folded down after each multiply
+// so every bit of the word reaches every bit of the hash, each step is a
+// bijection so a change to any one word always shows
+
+uint64_t cache_hash(const char *data, size_t length)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    uint64_t word;
+    size_t i;
+
+    for(i = 0; i + 8 <= length; i += 8) {
+        memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 1099511628211ULL;
+        hash ^= hash >> 32;
+    }
+    for(; i < length; i++) {
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t string_hash(const char *s)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    while(*s) hash = (hash ^ (unsigned char)*s++) * 1099511628211ULL;
+    return hash;
+}
+
+// grow a buffer to hold at least more bytes past length
+
+static int reserve(void **buffer, size_t *size, size_t length, size_t more)
+{
+    size_t newSize = *size ? *size : 0x10000;
+    void *p;
+
+    if(length + more <= *size) return SUCCESS;
+    while(newSize < length + more) newSize *= 2;
+    if((p = realloc(*buffer, newSize)) == NULL) return ERROR;
+    *buffer = p;
+    *size = newSize;
+    return SUCCESS;
+}
+
+// the offset of s in the strings, adding it the first time it's seen
+
+static int intern(Cache *cache, const char *s, uint32_t *offset)
+{
+    size_t length = strlen(s) + 1;
+    size_t mask, i;
+
+    if(cache->indexCount * 2 >= cache->indexSize) {
+        size_t size = cache->indexSize ? cache->indexSize * 2 : 0x1000;
+        uint32_t *index = calloc(size, sizeof(uint32_t));
+        if(index == NULL) return ERROR;
+        for(i = 0; i < cache->indexSize; i++) {
+            uint32_t entry = cache->index[i];
+            if(entry) {
+                size_t j = (size_t)string_hash(cache->strings + entry - 1) & (size - 1);
+                while(index[j]) j = (j + 1) & (size - 1);
+                index[j] = entry;
+            }
+        }
+        free(cache->index);
+        cache->index = index;
+        cache->indexSize = size;
+    }
+    mask = cache->indexSize - 1;
+    for(i = (size_t)string_hash(s) & mask; cache->index[i]; i = (i + 1) & mask) {
+        if(strcmp(cache->strings + cache->index[i] - 1, s) == 0) {
+            *offset = cache->index[i] - 1;
+            return SUCCESS;
+        }
+    }
+    // the offsets have to fit in a record
+    if(cache->stringsLength + length >= UINT32_MAX) return ERROR;
+    if(reserve((void **)&cache->strings, &cache->stringsSize, cache->stringsLength, length)) return ERROR;
+    memcpy(cache->strings + cache->stringsLength, s, length);
+    *offset = (uint32_t)cache->stringsLength;
+    cache->index[i] = *offset + 1;
+    cache->indexCount++;
+    cache->stringsLength += length;
+    return SUCCESS;
+}
+
+int cache_add_command(Cache *cache, const Command *command, int numbered, int lineNumber)
+{
+    uint32_t flag = (uint32_t)(command->flag & RECORD_FLAGS) | (numbered ? CACHE_LINE_NUMBER : 0);
+    unsigned char *p;
+    uint32_t comment = 0, arg = 0;
+    size_t i;
+
+    if(flag & COMMENT_IS_SET && intern(cache, command->comment, &comment)) return ERROR;
+    if(flag & ARG_IS_SET && intern(cache, command->arg, &arg)) return ERROR;
+    if(reserve((void **)&cache->records, &cache->recordsSize, cache->recordsLength, RECORD_MAX)) return ERROR;
+    p = cache->records + cache->recordsLength;
+    memcpy(p, &flag, 4);
+    p += 4;
+    if(numbered) {
+        int32_t n = lineNumber;
+        memcpy(p, &n, 4);
+        p += 4;
+    }
+    if(flag & DOUBLE_FIELDS) {
+        for(i = 0; i < FIELD_COUNT(doubleFields); i++) {
+            if(flag & doubleFields[i].flag) {
+                memcpy(p, (const char *)command + doubleFields[i].offset, 8);
+                p += 8;
+            }
+        }
+    }
+    if(flag & UNSIGNED_FIELDS) {
+        for(i = 0; i < FIELD_COUNT(unsignedFields); i++) {
+            if(flag & unsignedFields[i].flag) {
+                uint32_t u = *(const unsigned *)((const char *)command + unsignedFields[i].offset);
+                memcpy(p, &u, 4);
+                p += 4;
+            }
+        }
+    }
+    if(flag & COMMENT_IS_SET) {
+        memcpy(p, &comment, 4);
+        p += 4;
+    }
+    if(flag & ARG_IS_SET) {
+        memcpy(p, &arg, 4);
+        p += 4;
+    }
+    cache->recordsLength = p - cache->records;
+    return SUCCESS;
+}
+
+int cache_add_text(Cache *cache, const char *line)
+{
+    uint32_t flag = CACHE_TEXT;
+    uint32_t text;
+
+    if(intern(cache, line, &text)) return ERROR;
+    if(reserve((void **)&cache->records, &cache->recordsSize, cache->recordsLength, 8)) return ERROR;
+    memcpy(cache->records + cache->recordsLength, &flag, 4);
+    memcpy(cache->records + cache->recordsLength + 4, &text, 4);
+    cache->recordsLength += 8;
+    return SUCCESS;
+}
+
+int cache_read(const Cache *cache, size_t *position, Command *command, int *lineNumber, const char **text)
+{
+    const unsigned char *p = cache->records + *position;
+    uint32_t flag, offset;
+    size_t i;
+
+    if(*position >= cache->recordsLength) return CACHE_END;
+    memcpy(&flag, p, 4);
+    p += 4;
+    if(flag & CACHE_TEXT) {
+        memcpy(&offset, p, 4);
+        *text = cache->strings + offset;
+        *position += 8;
+        return CACHE_TEXT;
+    }
+    command->flag = (int)(flag & ~CACHE_LINE_NUMBER);
+    if(flag & CACHE_LINE_NUMBER) {
+        int32_t n;
+        memcpy(&n, p, 4);
+        *lineNumber = n;
+        p += 4;
+    }
+    if(flag & DOUBLE_FIELDS) {
+        for(i = 0; i < FIELD_COUNT(doubleFields); i++) {
+            if(flag & doubleFields[i].flag) {
+                memcpy((char *)command + doubleFields[i].offset, p, 8);
+                p += 8;
+            }
+        }
+    }
+    if(flag & UNSIGNED_FIELDS) {
+        for(i = 0; i < FIELD_COUNT(unsignedFields); i++) {
+            if(flag & unsignedFields[i].flag) {
+                uint32_t u;
+                memcpy(&u, p, 4);
+                *(unsigned *)((char *)command + unsignedFields[i].offset) = u;
+                p += 4;
+            }
+        }
+    }
+    if(flag & COMMENT_IS_SET) {
+        memcpy(&offset, p, 4);
+        command->comment = cache->strings + offset;
+        p += 4;
+    }
+    if(flag & ARG_IS_SET) {
+        memcpy(&offset, p, 4);
+        command->arg = cache->strings + offset;
+        p += 4;
+    }
+    *position = p - cache->records;
+    return (int)(flag & CACHE_LINE_NUMBER);
+}
+
+// walk the records of a loaded file once so a damaged one is written again
+// instead of being read past its end
+
+static int check_records(const Cache *cache)
+{
+    size_t position = 0;
+    uint32_t flag, offset;
+    size_t i, length;
+
+    if(cache->stringsLength && cache->strings[cache->stringsLength - 1] != '\0') return ERROR;
+    while(position < cache->recordsLength) {
+        const unsigned char *p = cache->records + position;
+        if(cache->recordsLength - position < 4) return ERROR;
+        memcpy(&flag, p, 4);
+        if(flag & CACHE_TEXT) {
+            if(flag != CACHE_TEXT || cache->recordsLength - position < 8) return ERROR;
+            memcpy(&offset, p + 4, 4);
+            if(offset >= cache->stringsLength) return ERROR;
+            position += 8;
+            continue;
+        }
+        if(flag & ~RECORD_FLAGS) return ERROR;
+        length = 4;
+        if(flag & CACHE_LINE_NUMBER) length += 4;
+        for(i = 0; i < FIELD_COUNT(doubleFields); i++) {
+            if(flag & doubleFields[i].flag) length += 8;
+        }
+        for(i = 0; i < FIELD_COUNT(unsignedFields); i++) {
+            if(flag & unsignedFields[i].flag) length += 4;
+        }
+        if(flag & COMMENT_IS_SET) length += 4;
+        if(flag & ARG_IS_SET) length += 4;
+        if(cache->recordsLength - position < length) return ERROR;
+        // the strings come last
+        for(i = (flag & COMMENT_IS_SET ? 1 : 0) + (flag & ARG_IS_SET ? 1 : 0); i > 0; i--) {
+            memcpy(&offset, p + length - 4 * i, 4);
+            if(offset >= cache->stringsLength) return ERROR;
+        }
+        position += length;
+    }
+    return SUCCESS;
+}
+
+int cache_load(Cache *cache, const char *path, uint64_t hash, uint64_t length)
+{
+    CacheHeader header;
+    FILE *in = fopen(path, "rb");
+    unsigned char *map = NULL;
+    size_t mapLength = 0;
+
+    cache_free(cache);
+    if(in == NULL) return ERROR;
+    if(fread(&header, sizeof(header), 1, in) != 1
+       || memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0
+       || header.version != CACHE_VERSION
+       || header.hash != hash
+       || header.length != length
+       || header.recordsLength > SIZE_MAX - sizeof(header) - header.stringsLength) {
+        fclose(in);
+        return ERROR;
+    }
+    mapLength = sizeof(header) + (size_t)header.recordsLength + (size_t)header.stringsLength;
+#if !defined(_WIN32) && !defined(_WIN64)
+    struct stat st;
+    if(fstat(fileno(in), &st) == 0 && (uint64_t)st.st_size == mapLength) {
+        // the records are only read, so the pages stay shared with the page cache
+        map = mmap(NULL, mapLength, PROT_READ, MAP_PRIVATE, fileno(in), 0);
+        if(map == MAP_FAILED) map = NULL;
+    }
+#else
+    if((map = malloc(mapLength)) != NULL) {
+        fseek(in, 0L, SEEK_SET);
+        if(fread(map, 1, mapLength, in) != mapLength || fgetc(in) != EOF) {
+            free(map);
+            map = NULL;
+        }
+    }
+#endif
+    fclose(in);
+    if(map == NULL) return ERROR;
+    cache->map = map;
+    cache->mapLength = mapLength;
+    cache->records = map + sizeof(header);
+    cache->recordsLength = (size_t)header.recordsLength;
+    cache->strings = (char *)cache->records + cache->recordsLength;
+    cache->stringsLength = (size_t)header.stringsLength;
+    if(check_records(cache)) {
+        cache_free(cache);
+        return ERROR;
+    }
+    return SUCCESS;
+}
+
+// written next to the cache file and renamed over it, so a conversion that
+// reads it at the same time sees the old one or the new one
+
+int cache_save(Cache *cache, const char *path, uint64_t hash, uint64_t length)
+{
+    CacheHeader header;
+    size_t pathLength = strlen(path);
+    char *temp = malloc(pathLength + 5);
+    FILE *out;
+    int rval = SUCCESS;
+
+    if(temp == NULL) return ERROR;
+    memcpy(temp, path, pathLength);
+    memcpy(temp + pathLength, ".tmp", 5);
+    if((out = fopen(temp, "wb")) == NULL) {
+        free(temp);
+        return ERROR;
+    }
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.hash = hash;
+    header.length = length;
+    header.recordsLength = cache->recordsLength;
+    header.stringsLength = cache->stringsLength;
+    if(fwrite(&header, sizeof(header), 1, out) != 1
+       || fwrite(cache->records, 1, cache->recordsLength, out) != cache->recordsLength
+       || fwrite(cache->strings, 1, cache->stringsLength, out) != cache->stringsLength)
+        rval = ERROR;
+    if(fclose(out)) rval = ERROR;
+#if defined(_WIN32) || defined(_WIN64)
+    // rename won't replace a file on windows
+    if(rval == SUCCESS) remove(path);
+#endif
+    if(rval == SUCCESS && rename(temp, path)) rval = ERROR;
+    if(rval != SUCCESS) remove(temp);
+    free(temp);
+    return rval;
+}
@@ -0,0 +1,72 @@
+//  cache.h
+//
+//  Parsed gcode kept on disk so converting the same input again skips the
+//  text parser
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef __cache_h__
+#define __cache_h__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gpx.h"
+
+// bits of a record besides the command's own flag bits
+#define CACHE_LINE_NUMBER 0x20000000    // the line starts with an N word
+#define CACHE_TEXT 0x40000000           // the line is kept as text
+
+// cache_read at the end of the records
+#define CACHE_END -1
+
+// the records are built in memory, or mapped from a cache file, the strings
+// they refer to are interned so each comment is stored once
+typedef struct tCache {
+    unsigned char *records;
+    size_t recordsLength;
+    size_t recordsSize;
+    char *strings;
+    size_t stringsLength;
+    size_t stringsSize;
+    uint32_t *index;        // interned string offsets plus one, by hash
+    size_t indexSize;
+    size_t indexCount;
+    void *map;              // the cache file, when the records came from one
+    size_t mapLength;
+} Cache;
+
+void cache_init(Cache *cache);
+void cache_free(Cache *cache);
+
+// the key a cache file is checked against
+uint64_t cache_hash(const char *data, size_t length);
+
+// append a parsed command, or a line that has to go back through the parser,
+// return SUCCESS or ERROR when out of memory
+int cache_add_command(Cache *cache, const Command *command, int numbered, int lineNumber);
+int cache_add_text(Cache *cache, const char *line);
+
+// the records of a cache file written for input with the given hash and
+// length, return SUCCESS or ERROR when there is no such file or it's stale
+int cache_load(Cache *cache, const char *path, uint64_t hash, uint64_t length);
+int cache_save(Cache *cache, const char *path, uint64_t hash, uint64_t length);
+
+// decode the record at position and step past it, returns CACHE_END or the
+// record's CACHE_ bits, a command record sets the command's flag and the
+// fields it marks, a text record points text at the line
+int cache_read(const Cache *cache, size_t *position, Command *command, int *lineNumber, const char **text);
+
+#endif /* __cache_h__ */
@@ -0,0 +1,126 @@
+//  crc-test.c
+//
+//  Check the table driven x3g CRC against the bitwise loop it replaced, or
+//  with -b time them
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "crc.h"
+
+#define LENGTH_MAX 512
+#define RANDOM_ROUNDS 200
+#define BENCH_BYTES 200000000L
+
+// the 8-bit iButton/Maxim/Dallas CRC a bit at a time, as gpx used to
+
+static unsigned char bitwise_crc(const unsigned char *addr, long len)
+{
+    unsigned char data, crc = 0;
+    int i;
+    while(len--) {
+        data = *addr++;
+        crc = crc ^ data;
+        for(i = 0; i < 8; i++) {
+            if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
+            else crc >>= 1;
+        }
+    }
+    return crc;
+}
+
+static unsigned char random_byte(uint64_t *seed)
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (unsigned char)(*seed >> 56);
+}
+
+static int check(void)
+{
+    unsigned char buffer[LENGTH_MAX];
+    unsigned long failures = 0, checked = 0;
+    uint64_t seed = 1;
+    long length;
+    int i;
+
+    // every one and two byte payload
+    for(i = 0; i < 0x10000; i++) {
+        buffer[0] = (unsigned char)i;
+        buffer[1] = (unsigned char)(i >> 8);
+        if(calculate_crc(buffer, 1) != bitwise_crc(buffer, 1)) failures++;
+        if(calculate_crc(buffer, 2) != bitwise_crc(buffer, 2)) failures++;
+        checked += 2;
+    }
+
+    // and random payloads of every length, so each tail of the sliced loop
+    // is covered
+    for(i = 0; i < RANDOM_ROUNDS; i++) {
+        for(length = 0; length < LENGTH_MAX; length++)
+            buffer[length] = random_byte(&seed);
+        for(length = 0; length <= LENGTH_MAX; length++) {
+            if(calculate_crc(buffer, length) != bitwise_crc(buffer, length)) failures++;
+            checked++;
+        }
+    }
+
+    printf("%lu of %lu payloads differ from the bitwise CRC\n", failures, checked);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static volatile unsigned char sink;
+
+static void bench(const char *name, unsigned char (*crc)(const unsigned char *, long), const unsigned char *buffer, long length)
+{
+    long i, rounds = BENCH_BYTES / length;
+    unsigned char sum = 0;
+    clock_t t = clock();
+    for(i = 0; i < rounds; i++)
+        sum ^= crc(buffer, length - (i & 1));
+    t = clock() - t;
+    sink = sum;
+    printf("%-8s %3ld byte payload: %6.1f ns/packet %6.2f ns/byte\n", name, length,
+           (double)t * 1e9 / CLOCKS_PER_SEC / rounds,
+           (double)t * 1e9 / CLOCKS_PER_SEC / rounds / length);
+}
+
+static int benchmark(void)
+{
+    // a typical queued point is about 30 bytes, eeprom writes and sd captures
+    // run up to the 255 byte limit
+    static const long lengths[] = {6, 30, 128, 255};
+    unsigned char buffer[256];
+    uint64_t seed = 1;
+    unsigned i;
+
+    for(i = 0; i < sizeof(buffer); i++)
+        buffer[i] = random_byte(&seed);
+    for(i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        bench("bitwise", bitwise_crc, buffer, lengths[i]);
+        bench("table", calculate_crc, buffer, lengths[i]);
+    }
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc > 1 && strcmp(argv[1], "-b") == 0)
+        return benchmark();
+    return check();
+}
@@ -0,0 +1,175 @@
+//  decimal-test.c
+//
+//  Round trip the gcode number parser against strtod, or with -b time them
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "decimal.h"
+
+#define MANTISSA_MAX 1000000
+#define FRACTION_MAX 6
+#define RANDOM_COUNT 1000000
+#define BENCH_COUNT 1000000
+#define BENCH_ROUNDS 20
+
+static unsigned long failures = 0;
+static unsigned long checked = 0;
+
+// compare the parsed value with what strtod makes of the normalized word, bit
+// for bit, so a zero of the wrong sign is a failure too
+
+static void check(const char *word)
+{
+    char buffer[128];
+    double value, expected;
+    strncpy(buffer, word, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = 0;
+    normalize_word(buffer, &value);
+    expected = strtod(buffer, NULL);
+    checked++;
+    if(memcmp(&value, &expected, sizeof(double))) {
+        if(failures++ < 20)
+            fprintf(stderr, "%s: parsed %.17g, strtod %.17g\n", word, value, expected);
+    }
+}
+
+// format mantissa as a decimal with the given number of fraction digits
+
+static void format(char *buffer, const char *prefix, unsigned long mantissa, int fraction)
+{
+    unsigned long scale = 1;
+    int i;
+    for(i = 0; i < fraction; i++) scale *= 10;
+    if(fraction)
+        sprintf(buffer, "%s%lu.%0*lu", prefix, mantissa / scale, fraction, mantissa % scale);
+    else
+        sprintf(buffer, "%s%lu", prefix, mantissa);
+}
+
+static unsigned long lcg(uint64_t *seed)
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (unsigned long)(*seed >> 33);
+}
+
+static int round_trip(void)
+{
+    static const char *odd[] = {
+        "X", "X-", "X+", "X.", "X-.", "X.5", "X-.5", "X5.", "X+12.5", "X-0",
+        "X-0.000", "X 1 2 . 5", "X\t-3.25", "X0000000000000000000001.5",
+        "X1234567890123456", "X123456789012345.6", "X0.00000000000000000000001",
+        "X0.000000000000000000000001", "X9007199254740993", "X1.7976931348623157",
+        "X99999999999999999999999999", "X0.1000000000000000055511151231257827",
+    };
+    char buffer[128];
+    unsigned long mantissa;
+    uint64_t seed = 1;
+    unsigned i;
+    int fraction;
+
+    for(i = 0; i < sizeof(odd) / sizeof(odd[0]); i++)
+        check(odd[i]);
+
+    // every decimal with up to 6 digits and up to 6 of them after the point
+    for(fraction = 0; fraction <= FRACTION_MAX; fraction++) {
+        for(mantissa = 0; mantissa < MANTISSA_MAX; mantissa++) {
+            format(buffer, "X", mantissa, fraction);
+            check(buffer);
+            format(buffer, "E-", mantissa, fraction);
+            check(buffer);
+        }
+    }
+
+    // and a spread of the longer coordinates slicers write
+    for(i = 0; i < RANDOM_COUNT; i++) {
+        unsigned long integer = lcg(&seed) % 10000;
+        unsigned long scale = 1;
+        int j;
+        fraction = 1 + (int)(lcg(&seed) % FRACTION_MAX);
+        for(j = 0; j < fraction; j++) scale *= 10;
+        sprintf(buffer, "%s%lu.%0*lu", i & 1 ? "Y-" : "Y", integer, fraction, lcg(&seed) % scale);
+        check(buffer);
+    }
+
+    printf("%lu of %lu words differ from strtod\n", failures, checked);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// time the parser on typical words against the scan followed by strtod that
+// gpx used before
+
+static volatile double sink;
+
+static int benchmark(void)
+{
+    char (*words)[16] = malloc(BENCH_COUNT * sizeof(*words));
+    char buffer[16];
+    uint64_t seed = 1;
+    double value, sum;
+    clock_t t;
+    unsigned i, round;
+
+    if(words == NULL) return EXIT_FAILURE;
+    for(i = 0; i < BENCH_COUNT; i++) {
+        switch(i % 4) {
+            case 0: format(words[i], "X", lcg(&seed) % 300000, 3); break;
+            case 1: format(words[i], "Y", lcg(&seed) % 300000, 3); break;
+            case 2: format(words[i], "E", lcg(&seed) % 10000000, 5); break;
+            case 3: format(words[i], "F", lcg(&seed) % 9000, 0); break;
+        }
+    }
+
+    sum = 0.0;
+    t = clock();
+    for(round = 0; round < BENCH_ROUNDS; round++) {
+        for(i = 0; i < BENCH_COUNT; i++) {
+            memcpy(buffer, words[i], sizeof(buffer));
+            normalize_word(buffer, &value);
+            sum += value;
+        }
+    }
+    t = clock() - t;
+    sink = sum;
+    printf("normalize_word:          %.1f ns/word\n", (double)t * 1e9 / CLOCKS_PER_SEC / BENCH_COUNT / BENCH_ROUNDS);
+
+    sum = 0.0;
+    t = clock();
+    for(round = 0; round < BENCH_ROUNDS; round++) {
+        for(i = 0; i < BENCH_COUNT; i++) {
+            memcpy(buffer, words[i], sizeof(buffer));
+            normalize_word(buffer, &value);
+            sum += strtod(buffer, NULL);
+        }
+    }
+    t = clock() - t;
+    sink = sum;
+    printf("normalize_word + strtod: %.1f ns/word\n", (double)t * 1e9 / CLOCKS_PER_SEC / BENCH_COUNT / BENCH_ROUNDS);
+
+    free(words);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc > 1 && strcmp(argv[1], "-b") == 0)
+        return benchmark();
+    return round_trip();
+}
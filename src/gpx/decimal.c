@@ -0,0 +1,103 @@
+//  decimal.c
+//
+//  Locale independent parsing of gcode numbers
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "decimal.h"
+
+// a decimal with no more than 15 significant digits is an integer that a
+// double holds exactly, and so is a power of ten up to 1e22, so dividing one by
+// the other gives the correctly rounded value, the same as strtod, slicers
+// never come close, anything longer goes to strtod
+#define EXACT_DIGITS 15
+#define EXACT_FRACTION 22
+
+static const double power_of_ten[EXACT_FRACTION + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+char *normalize_word(char *p, double *value)
+{
+    // we expect a letter followed by a digit
+    // [ a-zA-Z] [ +-]? [ 0-9]+ ('.' [ 0-9]*)?
+    char *s = p + 1;
+    char *e = p;
+    uint64_t mantissa = 0;
+    int digits = 0;     // significant digits in the mantissa
+    int fraction = 0;   // digits after the decimal point
+    int negative = 0;
+    int empty = 1;
+    while(isspace(*s)) s++;
+    if(*s == '+' || *s == '-') {
+        negative = *s == '-';
+        *e++ = *s++;
+    }
+    while(1) {
+        // skip spaces
+        if(isspace(*s)) {
+            s++;
+        }
+        // append digits
+        else if(isdigit(*s)) {
+            if(mantissa || *s != '0') digits++;
+            mantissa = mantissa * 10 + (*s - '0');
+            empty = 0;
+            *e++ = *s++;
+        }
+        else {
+            break;
+        }
+    }
+    if(*s == '.') {
+        *e++ = *s++;
+        while(1) {
+            // skip spaces
+            if(isspace(*s)) {
+                s++;
+            }
+            // append digits
+            else if(isdigit(*s)) {
+                if(mantissa || *s != '0') digits++;
+                mantissa = mantissa * 10 + (*s - '0');
+                fraction++;
+                empty = 0;
+                *e++ = *s++;
+            }
+            else {
+                break;
+            }
+        }
+    }
+    *e = 0;
+    if(empty) {
+        // no digits at all, which strtod reads as a positive zero
+        *value = 0.0;
+    }
+    else if(digits <= EXACT_DIGITS && fraction <= EXACT_FRACTION) {
+        double d = (double)mantissa;
+        if(fraction) d /= power_of_ten[fraction];
+        *value = negative ? -d : d;
+    }
+    else {
+        *value = strtod(p, NULL);
+    }
+    return s;
+}
@@ -0,0 +1,22 @@
+//  decimal.h
+//
+//  Locale independent parsing of gcode numbers
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+// normalize the gcode word at p in place, leaving the number that follows the
+// letter at p without any embedded spaces, and return its value in *value
+// returns a pointer to the remainder of the line
+char *normalize_word(char *p, double *value);
@@ -84,6 +84,8 @@ static void exit_handler(void)
     }
 }
 
+#define DAEMON_MAX 16    // printers one gpx can serve in daemon mode
+
 // display usage
 
 static void usage(int err)
@@ -123,20 +125,25 @@ static void usage(int err)
     fputs("GNU General Public License for more details." EOL, fp);
 
     fputs(EOL "Usage:" EOL, fp);
-    fputs("gpx [-CFIdgilpqr" SERIAL_MSG1 "tvw] " SERIAL_MSG2 "[-L LOGFILE] [-D NEWPORT] [-E EXISTINGPORT] [-c CONFIG] [-e EEPROM] [-f DIAMETER] [-m MACHINE] [-N h|t|ht] [-n SCALE] [-x X] [-y Y] [-z Z] [-W S] IN [OUT]" EOL, fp);
+    fputs("gpx [-CFISdgilpqr" SERIAL_MSG1 "tvw] " SERIAL_MSG2 "[-L LOGFILE] [-K CACHE] [-D NEWPORT] [-E EXISTINGPORT] [-c CONFIG] [-e EEPROM] [-f DIAMETER] [-j THREADS] [-m MACHINE] [-N h|t|ht] [-n SCALE] [-x X] [-y Y] [-z Z] [-W S] IN [OUT]" EOL, fp);
     fputs(EOL "Options:" EOL, fp);
     fputs("\t-C\tcreate temporary file with a copy of the machine configuration" EOL, fp);
     fputs("\t-D\trun in daemon mode and create the named virtual port" EOL, fp);
     fputs("\t-E\trun in daemon mode and open the named psuedo-terminal" EOL, fp);
+    fputs("\t  \t-D and -E may be repeated, one for each printer port" EOL, fp);
     fputs("\t-F\twrite X3G on-wire framing data to output file" EOL, fp);
     fputs("\t-I\tignore default .ini files" EOL, fp);
+    fputs("\t-K\tkeep the parsed input in the named CACHE file and convert" EOL, fp);
+    fputs("\t  \tfrom it for as long as the input doesn't change" EOL, fp);
     fputs("\t-N\tdisable writing of the X3G header (start build notice)," EOL, fp);
     fputs("\t  \ttail (end build notice), or both" EOL, fp);
+    fputs("\t-S\tsingle-pass conversion, patch the build percentage into the output" EOL, fp);
 	fputs("\t-W\twait S seconds after opening the serial connection" EOL, fp);
 	fputs("\t  \tbefore reading or writing (default is 2 seconds)" EOL, fp);
     fputs("\t-d\tsimulated ditto printing" EOL, fp);
     fputs("\t-g\tMakerbot/ReplicatorG GCODE flavor" EOL, fp);
     fputs("\t-i\tenable stdin and stdout support for command line pipes" EOL, fp);
+    fputs("\t-j\tconvert with THREADS threads, implies -S" EOL, fp);
     fputs("\t-l\tlog to file" EOL, fp);
     fputs("\t-L\tlog to named [LOGFILE] file" EOL, fp);
     fputs("\t-p\toverride build percentage" EOL, fp);
@@ -154,6 +161,7 @@ static void usage(int err)
     fputs("CONFIG: the filename of a custom machine definition (ini file)" EOL, fp);
     fputs("EEPROM: the filename of an eeprom settings definition (ini file)" EOL, fp);
     fputs("DIAMETER: the actual filament diameter in the printer" EOL, fp);
+    fputs("THREADS: the number of threads to convert with" EOL, fp);
     fputs(EOL "MACHINE: the predefined machine type" EOL, fp);
     fputs("\tsome machine definitions have been updated with corrected steps per mm" EOL, fp);
     fputs("\tthe original can be selected by prefixing o to the machine id" EOL, fp);
@@ -202,7 +210,7 @@ int gpx_sio_open(Gpx *gpx, const char *filename, speed_t baud_rate,
     if(sio_port)
 	 *sio_port = -1;
 
-    fprintf(gpx->log, "Opening port: %s.\n", filename);
+    gpx_log(gpx, "Opening port: %s.\n", filename);
     // open and configure the serial port
     if((port = open(filename, O_RDWR | O_NOCTTY | O_NONBLOCK)) < 0) {
         perror("Error opening port");
@@ -254,11 +262,10 @@ int gpx_sio_open(Gpx *gpx, const char *filename, speed_t baud_rate,
     // cfsetispeed(&tp, baud_rate);
     // cfsetospeed(&tp, baud_rate);
 
-    // let's ask the i/o system to block for up to a tenth of a second
-    // waiting for at least 255 bytes or whatever we asked for (whichever
-    // is least).
-    tp.c_cc[VMIN] = 255;
-    tp.c_cc[VTIME] = 1;
+    // reads come after a select says there's something to read, so let
+    // them return whatever has arrived rather than wait for more
+    tp.c_cc[VMIN] = 1;
+    tp.c_cc[VTIME] = 0;
 
     if(tcsetattr(port, TCSANOW, &tp) < 0) {
         perror("Error setting port attributes");
@@ -273,7 +280,7 @@ int gpx_sio_open(Gpx *gpx, const char *filename, speed_t baud_rate,
 	return 0;
     }
 
-    if(gpx->flag.verboseMode) fprintf(gpx->log, "Communicating via: %s" EOL, filename);
+    if(gpx->flag.verboseMode) gpx_log(gpx, "Communicating via: %s" EOL, filename);
     if(sio_port)
 	 *sio_port = port;
 
@@ -348,7 +355,9 @@ int main(int argc, char * const argv[])
     int standard_io = 0;
     int serial_io = 0;
     int truncate_filename = 0;
-    char *daemon_port = NULL;
+    char *daemon_port[DAEMON_MAX];
+    int create_daemon_port[DAEMON_MAX];
+    int daemon_count = 0;
     char *config = NULL;
     char *eeprom = NULL;
     double filament_diameter = 0;
@@ -357,7 +366,6 @@ int main(int argc, char * const argv[])
     char *filename;
     speed_t baud_rate = B115200;
     int make_temp_config = 0;
-    int create_daemon_port = 0;
 
     // Blank the temporary config file name.  If it isn't blank
     //   on exit and an error has occurred, then it is deleted
@@ -377,7 +385,7 @@ int main(int argc, char * const argv[])
     // the ini file from the default locations and whether to be verbose about it
     // we need to load the ini file before parsing the rest so that the command line
     // overrides the default ini in the standard case
-    while ((c = getopt(argc, argv, "CD:E:FIL:N:W:b:c:de:gf:ilm:n:pqrstu:vwx:y:z:?")) != -1) {
+    while ((c = getopt(argc, argv, "CD:E:FIK:L:N:SW:b:c:de:gf:ij:lm:n:pqrstu:vwx:y:z:?")) != -1) {
         switch (c) {
             case 'I':
                 ignore_default_ini = 1;
@@ -414,7 +422,7 @@ int main(int argc, char * const argv[])
     // error message should they be attempted when the code
     // is compiled without serial I/O support.
 
-    while ((c = getopt(argc, argv, "CD:E:FIL:N:W:b:c:de:gf:ilm:n:pqrstu:vwx:y:z:?")) != -1) {
+    while ((c = getopt(argc, argv, "CD:E:FIK:L:N:SW:b:c:de:gf:ij:lm:n:pqrstu:vwx:y:z:?")) != -1) {
         switch (c) {
 	    case 'C':
 		 // Write config data to a temp file
@@ -422,15 +430,19 @@ int main(int argc, char * const argv[])
 		 make_temp_config = 1;
 		 break;
             case 'D':
-                 create_daemon_port = 1;
-                 // fallthrough
             case 'E':
                  //
                  // Run in daemon mode - implies serial mode to the printer and
                  // then gcode input and reprap responses to other processes are
                  // via a two-way pipe to emulate a RepRap printer on the specified
-                 // port
-                 daemon_port = optarg;
+                 // port, once for each printer port
+                 if(daemon_count == DAEMON_MAX) {
+                     fprintf(stderr, "Command line error: daemon mode serves at most %d printers" EOL, DAEMON_MAX);
+                     usage(1);
+                     goto done;
+                 }
+                 create_daemon_port[daemon_count] = c == 'D';
+                 daemon_port[daemon_count++] = optarg;
 #if !defined(SERIAL_SUPPORT)
                  fprintf(stderr, NO_SERIAL_SUPPORT_MSG EOL);
                  usage(1);
@@ -445,6 +457,9 @@ int main(int argc, char * const argv[])
 		 break;
             case 'I':
                  break; // handled in first getopt loop
+            case 'K':
+                gpx.cachePath = optarg;
+                break;
             case 'L':
                 logname = optarg;
                 break;
@@ -454,6 +469,9 @@ int main(int argc, char * const argv[])
 		 if(optarg[0] == 't' || optarg[1] == 't')
 		      gpx_set_end(&gpx, 0);
 		 break;
+            case 'S':
+                gpx.flag.singlePass = 1;
+                break;
 	    case 'b':
 #if !defined(SERIAL_SUPPORT)
 		fprintf(stderr, NO_SERIAL_SUPPORT_MSG EOL);
@@ -530,6 +548,9 @@ int main(int argc, char * const argv[])
             case 'i':
                 standard_io = 1;
                 break;
+            case 'j':
+                gpx.threads = atoi(optarg);
+                break;
             case 'l':
                 break; // handled in first getopt loop
             case 'm':
@@ -670,7 +691,7 @@ int main(int argc, char * const argv[])
 
     // OPEN FILES AND PORTS FOR INPUT AND OUTPUT
 
-    if(daemon_port != NULL) {
+    if(daemon_count > 0) {
         if(standard_io) {
             fprintf(stderr, "Command line error: daemon mode incompatible with standard i/o\n");
             usage(1);
@@ -681,14 +702,19 @@ int main(int argc, char * const argv[])
             usage(1);
             goto done;
         }
+        if(argc != daemon_count) {
+            fprintf(stderr, "Command line error: daemon mode needs one printer port for each -D or -E\n");
+            usage(1);
+            goto done;
+        }
 
         // create the bi-directional virtual port for other processes
         // and read and write from there until somebody tells us to quit
-        gpx_daemon(&gpx, create_daemon_port, daemon_port, argv[0], baud_rate);
+        gpx_daemon(&gpx, daemon_count, create_daemon_port, daemon_port, argv, baud_rate);
         goto done;
     }
     else if(standard_io) {
-        if(daemon_port != NULL) {
+        if(daemon_count > 0) {
             fprintf(stderr, "Using standard in/out is incompatible with daemon mode\n");
             usage(1);
             goto done;
@@ -792,7 +818,8 @@ int main(int argc, char * const argv[])
         }
         else {
 	    if(filename[0] != '-' || filename[1] != '-' || filename[2] != '\0') {
-              if((file_out = fopen(filename, "wb")) == NULL) {
+              // single-pass reads the output back to splice in the build progress
+              if((file_out = fopen(filename, gpx.flag.singlePass || gpx.threads > 1 ? "w+b" : "wb")) == NULL) {
                   perror("Error creating output");
 		  goto done;
               }
@@ -823,7 +850,7 @@ int main(int argc, char * const argv[])
 
                   free(leaf);
 
-                  file_out2 = fopen(gpx.buffer.out, "wb");
+                  file_out2 = fopen(gpx.buffer.out, gpx.flag.singlePass || gpx.threads > 1 ? "w+b" : "wb");
                   if(file_out2 && gpx.flag.verboseMode) fprintf(gpx.log, "Writing to: %s" EOL, gpx.buffer.out);
               }
 	   }
@@ -32,14 +32,23 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <time.h>
+#include <sys/time.h>
 #include <stdint.h>
 
 #include <libgen.h>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/mman.h>
+#include <pthread.h>
+#endif
 
 #include "portable_endian.h"
 #include "gpx.h"
+#include "decimal.h"
+#include "crc.h"
+#include "cache.h"
 
 #define A 0
 #define B 1
@@ -81,6 +90,36 @@ void long_sleep(time_t sec)
 #endif
 }
 
+// seconds on a clock that only goes forward
+
+double host_time(void)
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+#endif
+}
+
+// log a line for gpx's printer, the daemon's printers share one log so their
+// lines start with the port they're for
+
+int gpx_log(Gpx *gpx, const char *fmt, ...)
+{
+    int result = 0;
+    va_list args;
+
+    if(gpx->tio != NULL && gpx->tio->printerPort != NULL)
+        result = fprintf(gpx->log, "%s: ", gpx->tio->printerPort);
+    va_start(args, fmt);
+    result += vfprintf(gpx->log, fmt, args);
+    va_end(args);
+    return result;
+}
 
 // send a result to the result handler or log it if there isn't one
 int gcodeResult(Gpx *gpx, const char *fmt, ...)
@@ -92,7 +131,8 @@ int gcodeResult(Gpx *gpx, const char *fmt, ...)
     if(gpx->resultHandler != NULL) {
         result = gpx->resultHandler(gpx, gpx->callbackData, fmt, args);
     }
-    else if(gpx->flag.logMessages) {
+    // the second pass repeats what the first pass already reported
+    else if(gpx->flag.logMessages && (!gpx->flag.repeatPass || gpx->flag.verboseMode)) {
         result = vfprintf(gpx->log, fmt, args);
     }
     va_end(args);
@@ -191,8 +231,11 @@ int gpx_set_machine(Gpx *gpx, const char *machine_type, int init)
         VERBOSE( fputs(EOL, gpx->log) );
     }
 
-    // update known position mask
-    gpx->axis.mask = gpx->machine.extruder_count == 1 ? (XYZ_BIT_MASK | A_IS_SET) : AXES_BIT_MASK;;
+    // update known position mask, an extruder the machine didn't have before
+    // starts out at zero like the one it had
+    unsigned mask = gpx->machine.extruder_count == 1 ? (XYZ_BIT_MASK | A_IS_SET) : AXES_BIT_MASK;
+    gpx->axis.positionKnown |= mask & ~gpx->axis.mask & (A_IS_SET | B_IS_SET);
+    gpx->axis.mask = mask;
     return SUCCESS;
 }
 
@@ -200,6 +243,11 @@ int gpx_set_machine(Gpx *gpx, const char *machine_type, int init)
 
 static double get_home_feedrate(Gpx *gpx, int flag);
 static int pause_at_zpos(Gpx *gpx, float z_positon);
+static void accumulate(Gpx *gpx, double time, double a, double b);
+static void stop_moves(Gpx *gpx);
+static void reset_excess(Gpx *gpx);
+static void log_extruder_steps(Gpx *gpx, Ptr5d mm);
+static int log_build_progress(Gpx *gpx, unsigned type, unsigned percent);
 
 // initialization of global variables
 
@@ -210,7 +258,6 @@ char buffer_size_query[] = {
     2,      // query command
     0       // crc
 };
-static unsigned char calculate_crc(unsigned char *addr, long len);
 
 void gpx_initialize(Gpx *gpx, int firstTime)
 {
@@ -273,6 +320,7 @@ void gpx_initialize(Gpx *gpx, int firstTime)
     gpx->current.offset = 0;
     gpx->current.percent = 0;
     gpx->current.speed_factor = 100;
+    gpx->current.plane = 17;
 
     // actually, gpx doesn't know A and B except that at the start of an SD
     // print they're always reset to zero.  The first absolute move already
@@ -284,6 +332,8 @@ void gpx_initialize(Gpx *gpx, int firstTime)
     // initialize the accumulated rounding error
     gpx->excess.a = 0.0;
     gpx->excess.b = 0.0;
+    memset(&gpx->held, 0, sizeof(gpx->held));
+    planner_reset(&gpx->planner);
 
     // initialize the G10 offsets
     for(i = 0; i < 7; i++) {
@@ -336,12 +386,24 @@ void gpx_initialize(Gpx *gpx, int firstTime)
     if(firstTime) {
         gpx->sdCardPath = NULL;
         gpx->iniPath = NULL;
+        gpx->cachePath = NULL;
+        gpx->threads = 0;
+        gpx->serialWindow = SIO_WINDOW;
+        gpx->serialGather = 2;
+        gpx->coalesce.angle = 2.0;
+        gpx->coalesce.extrusion = 5.0;
+        gpx->coalesce.feedrate = 1.0;
+        gpx->coalesce.length = 5.0;
+        gpx->arc.tolerance = 0.01;
+        gpx->arc.segment = 0.5;
         gpx->buildName = NULL;
         gpx->selectedFilename = NULL;
 	gpx->preamble = NULL;
 	gpx->nostart = 0;
 	gpx->noend = 0;
         gpx->eepromMappingVector = NULL;
+        gpx->progressMarkVector = NULL;
+        gpx->chunk = NULL;
     }
 
     if(gpx->eepromMappingVector != NULL) {
@@ -363,6 +425,8 @@ void gpx_initialize(Gpx *gpx, int firstTime)
         gpx->flag.sioConnected = 0;
         gpx->flag.M106AlwaysValve = 0;
         gpx->flag.onlyExplicitToolChange = 0;
+        gpx->flag.singlePass = 0;
+        gpx->flag.coalesceMoves = 0;
     }
 
     // STATE
@@ -371,9 +435,11 @@ void gpx_initialize(Gpx *gpx, int firstTime)
     gpx->flag.doPauseAtZPos = 0;
     gpx->flag.pausePending = 0;
     gpx->flag.macrosEnabled = 0;
+    gpx->flag.deferProgress = 0;
     if(firstTime) {
         gpx->flag.loadMacros = 1;
         gpx->flag.runMacros = 1;
+        gpx->flag.repeatPass = 0;
         gpx->flag.ignoreAbsoluteMoves = 0;
     }
 
@@ -404,6 +470,7 @@ void gpx_initialize(Gpx *gpx, int firstTime)
     gpx->callbackData = NULL;
     gpx->resultHandler = NULL;
     gpx->sio = NULL;
+    if(firstTime) gpx->tio = NULL;
 
     // LOGGING
 
@@ -413,6 +480,65 @@ void gpx_initialize(Gpx *gpx, int firstTime)
     buffer_size_query[3] = calculate_crc((unsigned char *)buffer_size_query + 2, 1);
 }
 
+// start another context from gpx's settings, for another printer, the machine
+// definition and eeprom maps are shared tables, what gpx allocated isn't shared,
+// the clone gets its own copy of the eeprom mappings from the ini's macros
+
+int gpx_clone(Gpx *clone, Gpx *gpx)
+{
+    memcpy(clone, gpx, sizeof(Gpx));
+    clone->buffer.ptr = clone->buffer.out + (gpx->buffer.ptr - gpx->buffer.out);
+    clone->command.comment = "";
+    clone->eepromMappingVector = NULL;
+    clone->progressMarkVector = NULL;
+    clone->chunk = NULL;
+    clone->tio = NULL;
+    clone->buildName = NULL;
+    clone->selectedFilename = NULL;
+    if(gpx->buildName && (clone->buildName = strdup(gpx->buildName)) == NULL)
+        goto fail;
+    if(gpx->selectedFilename && (clone->selectedFilename = strdup(gpx->selectedFilename)) == NULL)
+        goto fail;
+    if(gpx->eepromMappingVector != NULL) {
+        vector *pv = gpx->eepromMappingVector;
+        int iem;
+        if((clone->eepromMappingVector = vector_create(pv->cb, pv->c, pv->cChunk)) == NULL)
+            goto fail;
+        for(iem = 0; iem < pv->c; iem++) {
+            EepromMapping em = *(EepromMapping *)vector_get(pv, iem);
+            if((em.id = strdup(em.id)) == NULL)
+                goto fail;
+            if(vector_append(clone->eepromMappingVector, &em) < 0) {
+                free((char *)em.id);
+                goto fail;
+            }
+        }
+    }
+    return SUCCESS;
+
+fail:
+    gpx_clone_cleanup(clone);
+    return ERROR;
+}
+
+// free what gpx_clone allocated, the clone can't be used after this
+
+void gpx_clone_cleanup(Gpx *clone)
+{
+    free(clone->buildName);
+    free(clone->selectedFilename);
+    clone->buildName = NULL;
+    clone->selectedFilename = NULL;
+    if(clone->eepromMappingVector != NULL) {
+        vector *pv = clone->eepromMappingVector;
+        int iem;
+        for(iem = 0; iem < pv->c; iem++)
+            free((char *)((EepromMapping *)vector_get(pv, iem))->id);
+        vector_free(pv);
+        clone->eepromMappingVector = NULL;
+    }
+}
+
 // PRINT STATE
 
 #define start_program() gpx->flag.programState = RUNNING_STATE
@@ -555,50 +681,192 @@ static long write_string(Gpx *gpx, const char *string, long length)
     return length;
 }
 
-// FRAMING
+// LINE READER
 
-static unsigned char calculate_crc(unsigned char *addr, long len)
-{
-    unsigned char data, crc = 0;
-    while(len--) {
-        data = *addr++;
-        // 8-bit iButton/Maxim/Dallas CRC loop unrolled
-        crc = crc ^ data;
-        // 1
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+// hands out the input a line at a time with the newline replaced by a null,
+// regular files are mapped copy-on-write and the lines are parsed in place,
+// anything else (pipes, terminals) is read in blocks into a buffer that grows
+// to fit the longest line, so there's no limit on the length of a line
 
-        // 2
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+typedef struct tReader {
+    FILE *in;
+    char *map;          // private mapping of a regular file
+    size_t mapLength;
+    size_t released;    // the mapping before this offset has been unmapped
+    size_t previous;    // offset of the line handed out before the current one
+    char *buffer;       // block buffer, or the unterminated last line of a map
+    size_t bufferSize;
+    size_t start;       // offset of the next line in the map or buffer
+    size_t end;         // end of the data read into the buffer
+    size_t scanned;     // the buffer before this offset has no newline
+    int eof;
+} Reader;
+
+#define READER_BLOCK 0x10000
+#define READER_RELEASE 0x1000000
+
+static void reader_open(Reader *reader, FILE *in)
+{
+    reader->in = in;
+    reader->map = NULL;
+    reader->mapLength = 0;
+    reader->released = 0;
+    reader->previous = 0;
+    reader->buffer = NULL;
+    reader->bufferSize = 0;
+    reader->start = 0;
+    reader->end = 0;
+    reader->scanned = 0;
+    reader->eof = 0;
+#if !defined(_WIN32) && !defined(_WIN64)
+    struct stat st;
+    long offset = ftell(in);
+    if(offset >= 0 && fstat(fileno(in), &st) == 0 && S_ISREG(st.st_mode)
+       && st.st_size > offset && (uint64_t)st.st_size <= SIZE_MAX) {
+        // the parser writes into the line, so the mapping is private and
+        // writable, the pages it touches are copied on write
+        char *map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(in), 0);
+        if(map != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+            madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+            reader->map = map;
+            reader->mapLength = (size_t)st.st_size;
+            reader->start = reader->previous = (size_t)offset;
+        }
+    }
+#endif
+}
 
-        // 3
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+static void reader_close(Reader *reader)
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+    if(reader->map != NULL) {
+        // leave the stream where the reader stopped
+        fseek(reader->in, (long)reader->start, SEEK_SET);
+        munmap(reader->map + reader->released, reader->mapLength - reader->released);
+        reader->map = NULL;
+    }
+#endif
+    if(reader->buffer != NULL) {
+        free(reader->buffer);
+        reader->buffer = NULL;
+    }
+}
 
-        // 4
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+// start over from the beginning of the input, remapping a file throws away
+// what the parser wrote into it
 
-        // 5
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+static void reader_rewind(Reader *reader)
+{
+    FILE *in = reader->in;
+    reader_close(reader);
+    fseek(in, 0L, SEEK_SET);
+    reader_open(reader, in);
+}
 
-        // 6
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+// return the next line and its length or NULL at the end of the input, the
+// line is valid until the next call
 
-        // 7
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+static char *reader_next_line(Reader *reader, size_t *length)
+{
+    char *line, *eol;
+    size_t remaining;
 
-        // 8
-        if (crc & 0x01) crc = (crc >> 1) ^ 0x8C;
-        else crc >>= 1;
+    if(reader->map != NULL) {
+        if(reader->start >= reader->mapLength) return NULL;
+#if !defined(_WIN32) && !defined(_WIN64)
+        // give back the copied pages well behind us, the previous line may
+        // still be referenced so only what's before it goes
+        if(reader->previous - reader->released >= READER_RELEASE) {
+            size_t page = (size_t)sysconf(_SC_PAGESIZE);
+            size_t offset = reader->previous / page * page;
+            if(offset > reader->released
+               && munmap(reader->map + reader->released, offset - reader->released) == 0)
+                reader->released = offset;
+        }
+#endif
+        reader->previous = reader->start;
+        line = reader->map + reader->start;
+        remaining = reader->mapLength - reader->start;
+        eol = memchr(line, '\n', remaining);
+        if(eol != NULL) {
+            *eol = '\0';
+            *length = eol - line;
+            reader->start += *length + 1;
+            return line;
+        }
+        // there's no room to terminate the last line in the mapping
+        if(reader->bufferSize < remaining + 1) {
+            char *buffer = realloc(reader->buffer, remaining + 1);
+            if(buffer == NULL) return NULL;
+            reader->buffer = buffer;
+            reader->bufferSize = remaining + 1;
+        }
+        memcpy(reader->buffer, line, remaining);
+        reader->buffer[remaining] = '\0';
+        reader->start = reader->mapLength;
+        *length = remaining;
+        return reader->buffer;
     }
-    return crc;
+
+    for(;;) {
+        line = reader->buffer + reader->start;
+        eol = NULL;
+        if(reader->scanned < reader->end)
+            eol = memchr(reader->buffer + reader->scanned, '\n', reader->end - reader->scanned);
+        if(eol != NULL) {
+            *eol = '\0';
+            *length = eol - line;
+            reader->start = reader->scanned = eol + 1 - reader->buffer;
+            return line;
+        }
+        reader->scanned = reader->end;
+        remaining = reader->end - reader->start;
+        if(reader->eof) {
+            if(remaining == 0) return NULL;
+            line[remaining] = '\0';
+            *length = remaining;
+            reader->start = reader->end;
+            return line;
+        }
+        // move the partial line to the front and make room for another block
+        // plus the terminating null
+        if(reader->start > 0) {
+            memmove(reader->buffer, line, remaining);
+            reader->start = 0;
+            reader->end = reader->scanned = remaining;
+        }
+        if(reader->bufferSize - reader->end < READER_BLOCK + 1) {
+            size_t size = reader->bufferSize ? reader->bufferSize * 2 : READER_BLOCK + 1;
+            while(size - reader->end < READER_BLOCK + 1) size *= 2;
+            char *buffer = realloc(reader->buffer, size);
+            if(buffer == NULL) return NULL;
+            reader->buffer = buffer;
+            reader->bufferSize = size;
+        }
+        // read() rather than fread() so a line typed or piped in is handed
+        // out as soon as it arrives rather than when the block fills
+        ssize_t bytes = read(fileno(reader->in), reader->buffer + reader->end, reader->bufferSize - reader->end - 1);
+        if(bytes > 0)
+            reader->end += bytes;
+        else if(bytes == 0 || errno != EINTR)
+            reader->eof = 1;
+    }
+}
+
+// whether the next line is already at hand, so reading it won't wait on the
+// input
+
+static int reader_ready(Reader *reader)
+{
+    if(reader->map != NULL || reader->eof) return 1;
+    return reader->scanned < reader->end
+        && memchr(reader->buffer + reader->scanned, '\n', reader->end - reader->scanned) != NULL;
 }
 
+// FRAMING
+
 static void begin_frame(Gpx *gpx)
 {
     gpx->buffer.ptr = gpx->buffer.out;
@@ -608,7 +876,7 @@ static void begin_frame(Gpx *gpx)
     }
 }
 
-static int end_frame(Gpx *gpx)
+static size_t close_frame(Gpx *gpx)
 {
     if(gpx->flag.framingEnabled) {
         unsigned char *start = (unsigned char *)gpx->buffer.out + 2;
@@ -617,7 +885,35 @@ static int end_frame(Gpx *gpx)
         gpx->buffer.out[1] = (unsigned char)payload_length;
         *gpx->buffer.ptr++ = calculate_crc(start, payload_length);
     }
-    size_t length = gpx->buffer.ptr - gpx->buffer.out;
+    return gpx->buffer.ptr - gpx->buffer.out;
+}
+
+// write out the move held back for merging, if there is one
+
+static int release_held_move(Gpx *gpx)
+{
+    char packet[sizeof(gpx->held.packet)];
+    size_t length = gpx->held.length;
+
+    if(gpx->held.count == 0) return SUCCESS;
+    memcpy(packet, gpx->held.packet, length);
+    memset(&gpx->held, 0, sizeof(gpx->held));
+    gpx->accumulated.bytes += length;
+    if(gpx->callbackHandler) {
+        return gpx->callbackHandler(gpx, gpx->callbackData, packet, length);
+    }
+    return SUCCESS;
+}
+
+static int end_frame(Gpx *gpx)
+{
+    int rval;
+    size_t length = close_frame(gpx);
+    // a build progress update goes out ahead of the held move, which is where
+    // the single-pass converter patches it in
+    if(gpx->held.count && (unsigned char)gpx->buffer.out[gpx->flag.framingEnabled ? 2 : 0] != 150) {
+        CALL( release_held_move(gpx) );
+    }
     gpx->accumulated.bytes += length;
     if(gpx->callbackHandler) {
         return gpx->callbackHandler(gpx, gpx->callbackData, gpx->buffer.out, length);
@@ -625,6 +921,14 @@ static int end_frame(Gpx *gpx)
     return SUCCESS;
 }
 
+// keep the frame as the held move rather than write it out
+
+static void hold_frame(Gpx *gpx)
+{
+    gpx->held.length = close_frame(gpx);
+    memcpy(gpx->held.packet, gpx->buffer.out, gpx->held.length);
+}
+
 // no x3g to emit, but the callback might want to look at the parsed command
 static int empty_frame(Gpx *gpx)
 {
@@ -796,28 +1100,32 @@ static double get_safe_feedrate(Gpx *gpx, int flag, Ptr5d delta) {
     return feedrate;
 }
 
+// round extruder mm to steps, carrying the rounding remainder in excess
+
+static double extruder_steps(double mm, double steps_per_mm, double *excess)
+{
+    // accumulate rounding remainder
+    double value = (mm * steps_per_mm) + *excess;
+    double result = round(value);
+    // changes to excess
+    *excess = value - result;
+    return result;
+}
+
 // convert mm to steps using the current machine definition
 
 // IMPORTANT: this command changes the global excess value which accumulates the rounding remainder
 
 static Point5d mm_to_steps(Gpx *gpx, Ptr5d mm, Ptr2d excess)
 {
-    double value;
     Point5d result;
     result.x = round(mm->x * gpx->machine.x.steps_per_mm);
     result.y = round(mm->y * gpx->machine.y.steps_per_mm);
     result.z = round(mm->z * gpx->machine.z.steps_per_mm);
     if(excess) {
-        // accumulate rounding remainder
-        value = (mm->a * gpx->machine.a.steps_per_mm) + excess->a;
-        result.a = round(value);
-        // changes to excess
-        excess->a = value - result.a;
-
-        value = (mm->b * gpx->machine.b.steps_per_mm) + excess->b;
-        result.b = round(value);
-        // changes to excess
-        excess->b = value - result.b;
+        if(gpx->chunk) log_extruder_steps(gpx, mm);
+        result.a = extruder_steps(mm->a, gpx->machine.a.steps_per_mm, &excess->a);
+        result.b = extruder_steps(mm->b, gpx->machine.b.steps_per_mm, &excess->b);
     }
     else {
         result.a = round(mm->a * gpx->machine.a.steps_per_mm);
@@ -920,8 +1228,7 @@ int clear_buffer(Gpx *gpx)
 {
     begin_frame(gpx);
     set_unknown_axes(gpx, gpx->axis.mask);
-    gpx->excess.a = 0;
-    gpx->excess.b = 0;
+    reset_excess(gpx);
 
     write_8(gpx, 3);
 
@@ -934,8 +1241,7 @@ int abort_immediately(Gpx *gpx)
 {
     begin_frame(gpx);
     set_unknown_axes(gpx, gpx->axis.mask);
-    gpx->excess.a = 0;
-    gpx->excess.b = 0;
+    reset_excess(gpx);
 
     write_8(gpx, 7);
 
@@ -1157,7 +1463,7 @@ int is_ready(Gpx *gpx)
 
 int read_eeprom(Gpx *gpx, unsigned address, unsigned length)
 {
-    SHOW( fprintf(gpx->log, "Reading EEPROM address %u length %u\n", address, length) );
+    SHOW( gpx_log(gpx, "Reading EEPROM address %u length %u\n", address, length) );
 
     begin_frame(gpx);
 
@@ -1176,7 +1482,7 @@ int read_eeprom(Gpx *gpx, unsigned address, unsigned length)
 
 int write_eeprom(Gpx *gpx, unsigned address, char *data, unsigned length)
 {
-    SHOW( fprintf(gpx->log, "Writing EEPROM address %u length %u\n", address, length) );
+    SHOW( gpx_log(gpx, "Writing EEPROM address %u length %u\n", address, length) );
 
     begin_frame(gpx);
 
@@ -1255,8 +1561,7 @@ static int reset(Gpx *gpx)
 {
     begin_frame(gpx);
     set_unknown_axes(gpx->axis.mask);
-    gpx->excess.a = 0;
-    gpx->excess.b = 0;
+    reset_excess(gpx);
 
     write_8(gpx, 17);
 
@@ -1310,8 +1615,7 @@ int extended_stop(Gpx *gpx, unsigned halt_steppers, unsigned clear_queue)
     if(halt_steppers) flag |= 0x1;
     if(clear_queue) flag |= 0x2;
     set_unknown_axes(gpx, gpx->axis.mask);
-    gpx->excess.a = 0;
-    gpx->excess.b = 0;
+    reset_excess(gpx);
 
     begin_frame(gpx);
 
@@ -1417,7 +1721,8 @@ static int home_axes(Gpx *gpx, unsigned axes, unsigned direction)
     // time between steps for longest axis = microseconds / longestStep
     unsigned step_delay = (unsigned)round(microseconds / longestAxis);
 
-    gpx->accumulated.time += distance / feedrate * 60;
+    stop_moves(gpx);
+    accumulate(gpx, distance / feedrate * 60, 0.0, 0.0);
 
     begin_frame(gpx);
 
@@ -1439,6 +1744,7 @@ static int home_axes(Gpx *gpx, unsigned axes, unsigned direction)
 
 int delay(Gpx *gpx, unsigned milliseconds)
 {
+    stop_moves(gpx);
     begin_frame(gpx);
 
     write_8(gpx, 133);
@@ -1474,6 +1780,7 @@ static int wait_for_extruder(Gpx *gpx, unsigned extruder_id, unsigned timeout)
 {
     assert(extruder_id < gpx->machine.extruder_count);
 
+    stop_moves(gpx);
     begin_frame(gpx);
 
     write_8(gpx, 135);
@@ -1500,7 +1807,7 @@ int set_nozzle_temperature(Gpx *gpx, unsigned extruder_id, unsigned temperature)
 
     double tDelta = (double)temperature - (double)gpx->tool[extruder_id].nozzle_temperature - AMBIENT_TEMP;
     if(tDelta > 0.0) {
-        gpx->accumulated.time += tDelta * NOZZLE_TIME;
+        accumulate(gpx, tDelta * NOZZLE_TIME, 0.0, 0.0);
     }
 
     begin_frame(gpx);
@@ -1635,7 +1942,7 @@ int set_build_platform_temperature(Gpx *gpx, unsigned extruder_id, unsigned temp
 
     double tDelta = (double)temperature - (double)gpx->tool[extruder_id].build_platform_temperature - AMBIENT_TEMP;
     if(tDelta > 0.0) {
-        gpx->accumulated.time += tDelta * HBP_TIME;
+        accumulate(gpx, tDelta * HBP_TIME, 0.0, 0.0);
     }
 
     begin_frame(gpx);
@@ -1680,8 +1987,13 @@ static int set_steppers(Gpx *gpx, unsigned axes, unsigned state)
 
 static int queue_absolute_point(Gpx *gpx)
 {
+    int rval;
     double feedrate;
     long longestDDA = gpx->longestDDA ? gpx->longestDDA : get_longest_dda(gpx);
+    // the steps are logged at the offset the packet goes to
+    CALL( release_held_move(gpx) );
+    // the firmware doesn't plan moves given as a DDA
+    stop_moves(gpx);
     Point5d steps = mm_to_steps(gpx, &gpx->target.position, &gpx->excess);
 
     feedrate = gpx->current.feedrate * ((double)gpx->current.speed_factor / 100);
@@ -1754,6 +2066,7 @@ int set_position(Gpx *gpx)
 {
     Point5d steps = mm_to_steps(gpx, &gpx->current.position, NULL);
 
+    stop_moves(gpx);
     begin_frame(gpx);
 
     write_8(gpx, 140);
@@ -1782,6 +2095,7 @@ static int wait_for_build_platform(Gpx *gpx, unsigned extruder_id, int timeout)
 {
     assert(extruder_id < gpx->machine.extruder_count);
 
+    stop_moves(gpx);
     begin_frame(gpx);
 
     write_8(gpx, 141);
@@ -1803,6 +2117,7 @@ static int wait_for_build_platform(Gpx *gpx, unsigned extruder_id, int timeout)
 #if ENABLE_SIMULATED_RPM
 static int queue_new_point(Gpx *gpx, unsigned milliseconds)
 {
+    int rval;
     Point5d target;
 
     // the function is only called by dwell, which is by definition stationary,
@@ -1825,7 +2140,7 @@ static int queue_new_point(Gpx *gpx, unsigned milliseconds)
         double mmPerRevolution = gpx->machine.a.motor_steps * (1 / gpx->machine.a.steps_per_mm);
         target.a = -(numRevolutions * mmPerRevolution);
         gpx->command.flag |= A_IS_SET;
-        gpx->accumulated.a += fabs(target.a);
+        accumulate(gpx, 0.0, fabs(target.a), 0.0);
     }
 
     if(gpx->tool[B].motor_enabled && gpx->tool[B].rpm) {
@@ -1838,12 +2153,14 @@ static int queue_new_point(Gpx *gpx, unsigned milliseconds)
         double mmPerRevolution = gpx->machine.b.motor_steps * (1 / gpx->machine.b.steps_per_mm);
         target.b = -(numRevolutions * mmPerRevolution);
         gpx->command.flag |= B_IS_SET;
-        gpx->accumulated.b += fabs(target.a);
+        accumulate(gpx, 0.0, 0.0, fabs(target.a));
     }
 
+    CALL( release_held_move(gpx) );
     Point5d steps = mm_to_steps(gpx, &target, &gpx->excess);
 
-    gpx->accumulated.time += (milliseconds / 1000.0) * ACCELERATION_TIME;
+    stop_moves(gpx);
+    accumulate(gpx, milliseconds / 1000.0, 0.0, 0.0);
 
     begin_frame(gpx);
 
@@ -2011,6 +2328,7 @@ static int set_beep(Gpx *gpx, unsigned frequency, unsigned milliseconds)
 #ifdef FUTURE
 static int wait_for_button(Gpx *gpx, int button, unsigned timeout, int button_options)
 {
+    stop_moves(gpx);
     begin_frame(gpx);
 
     write_8(gpx, 148);
@@ -2085,11 +2403,187 @@ static int display_message(Gpx *gpx, char *message, unsigned vPos, unsigned hPos
     return SUCCESS;
 }
 
+// SINGLE-PASS BUILD PROGRESS
+
+// The multi-pass converter knows the total print time before it writes any
+// output.  The single-pass converter doesn't, so it records each point where
+// the build progress could change and patches the packets in at the end.
+
+#define PROGRESS_SET 0      // set_build_progress already in the output
+#define PROGRESS_M73 1      // M73 Pn that depends on the total time
+#define PROGRESS_MOVE 2     // automatic progress after a move
+#define PROGRESS_START 3    // automatic progress before the program has started
+#define PROGRESS_NONE 4     // no progress check
+
+typedef struct tProgressMark {
+    unsigned long offset;   // output offset of the progress check
+    double time;            // accumulated time at the progress check
+    unsigned type;
+    unsigned percent;
+} ProgressMark;
+
+static int mark_build_progress(Gpx *gpx, unsigned type, unsigned percent)
+{
+    ProgressMark mark;
+
+    if(gpx->chunk) return log_build_progress(gpx, type, percent);
+    if(gpx->progressMarkVector == NULL) {
+        gpx->progressMarkVector = vector_create(sizeof(ProgressMark), 1024, 65536);
+        if(gpx->progressMarkVector == NULL) return ERROR;
+    }
+    else if(type == PROGRESS_MOVE && gpx->progressMarkVector->c > 1) {
+        // once the forced 1% is out of the way a command that took no time
+        // can't change the percentage
+        ProgressMark *last = vector_get(gpx->progressMarkVector, gpx->progressMarkVector->c - 1);
+        ProgressMark *previous = vector_get(gpx->progressMarkVector, gpx->progressMarkVector->c - 2);
+        if(last->type == PROGRESS_MOVE && last->time == gpx->accumulated.time
+           && previous->type == PROGRESS_MOVE && previous->time == gpx->accumulated.time) return SUCCESS;
+    }
+    mark.offset = gpx->accumulated.bytes;
+    mark.time = gpx->accumulated.time;
+    mark.type = type;
+    mark.percent = percent;
+    if(vector_append(gpx->progressMarkVector, &mark) < 0) return ERROR;
+    return SUCCESS;
+}
+
+// PARALLEL CONVERSION LOG
+
+// A worker of the parallel converter converts a chunk of the input starting
+// from a guess at the state.  What it adds to the statistics, the progress
+// checks and the extruder moves that depend on the rounding remainder carried
+// in from the previous chunk are logged, so once the chunks before it are done
+// the chunk can be checked against the real state and fixed up in order.
+
+typedef struct tChunkEvent {
+    unsigned long offset;   // chunk output offset of the progress check
+    double time;            // added to the statistics before the check
+    double a;
+    double b;
+    unsigned type;          // progress check type or PROGRESS_NONE
+    unsigned percent;
+} ChunkEvent;
+
+typedef struct tChunkSteps {
+    unsigned long offset;   // chunk output offset of the move
+    double a;               // extruder mm to be converted to steps
+    double b;
+} ChunkSteps;
+
+#define CHUNK_WAITING 0
+#define CHUNK_RUNNING 1
+#define CHUNK_DONE 2
+
+typedef struct tChunk {
+    size_t warmup;          // input offset of the lines that settle the state
+    size_t start;           // input offset of the first line of the chunk
+    size_t end;
+    unsigned long warmupLine;   // input lines before the warm up
+    unsigned long startLine;    // input lines before the chunk
+    int state;
+    int speculative;        // started from a guess rather than the real state
+    int rval;               // result of the last line converted
+    int failed;             // the worker ran out of memory
+    int logSteps;           // the excess hasn't been reset since the start
+    int shadowing;          // the shadow context is converting the chunk too
+    Gpx gpx;                // the worker's context, the state at the end
+    Gpx startState;         // the state at the start
+    struct tChunk *shadow;  // the shadow context's part
+    char *output;
+    size_t length;
+    size_t size;
+    vector *events;
+    vector *steps;
+    FILE *log;
+    long logStart;          // log offset of the start of the chunk
+} Chunk;
+
+// add to the statistics, the worker of a chunk can't add to the real totals
+// and each is added to in the same order as a serial conversion would
+
+static void accumulate(Gpx *gpx, double time, double a, double b)
+{
+    gpx->accumulated.time += time;
+    gpx->accumulated.a += a;
+    gpx->accumulated.b += b;
+    if(gpx->chunk) {
+        vector *events = gpx->chunk->events;
+        ChunkEvent *last = events->c ? vector_get(events, events->c - 1) : NULL;
+        if(last && last->type == PROGRESS_NONE
+           && (time == 0.0 || last->time == 0.0)
+           && (a == 0.0 || last->a == 0.0)
+           && (b == 0.0 || last->b == 0.0)) {
+            last->time += time;
+            last->a += a;
+            last->b += b;
+        }
+        else {
+            ChunkEvent event = {0, time, a, b, PROGRESS_NONE, 0};
+            if(vector_append(events, &event) < 0) gpx->chunk->failed = 1;
+        }
+    }
+}
+
+// a move is timed once the firmware's planner has settled how fast it leaves
+// it, which is when the planner moves on or has to stop
+
+static void accumulate_move(Gpx *gpx, Ptr5d deltaMM, double distance, double feedrate)
+{
+    double delta[PLANNER_AXES] = {deltaMM->x, deltaMM->y, deltaMM->z, deltaMM->a, deltaMM->b};
+    double time = planner_add(&gpx->planner, &gpx->machine, delta, distance, feedrate);
+    if(time > 0.0) accumulate(gpx, time, 0.0, 0.0);
+}
+
+static void stop_moves(Gpx *gpx)
+{
+    double time = planner_stop(&gpx->planner);
+    if(time > 0.0) accumulate(gpx, time, 0.0, 0.0);
+}
+
+static int log_build_progress(Gpx *gpx, unsigned type, unsigned percent)
+{
+    vector *events = gpx->chunk->events;
+    ChunkEvent *last = events->c ? vector_get(events, events->c - 1) : NULL;
+    if(last && last->type == PROGRESS_NONE) {
+        last->offset = gpx->accumulated.bytes;
+        last->type = type;
+        last->percent = percent;
+    }
+    else {
+        ChunkEvent event = {gpx->accumulated.bytes, 0.0, 0.0, 0.0, type, percent};
+        if(vector_append(events, &event) < 0) return ERROR;
+    }
+    return SUCCESS;
+}
+
+// the extruder steps of a move depend on the excess from every move before it
+// until something resets it
+
+static void log_extruder_steps(Gpx *gpx, Ptr5d mm)
+{
+    if(gpx->chunk->logSteps) {
+        ChunkSteps steps = {gpx->accumulated.bytes, mm->a, mm->b};
+        if(vector_append(gpx->chunk->steps, &steps) < 0) gpx->chunk->failed = 1;
+    }
+}
+
+static void reset_excess(Gpx *gpx)
+{
+    gpx->excess.a = 0;
+    gpx->excess.b = 0;
+    if(gpx->chunk) gpx->chunk->logSteps = 0;
+}
+
 // 150 - Set Build Percentage
 
 int set_build_progress(Gpx *gpx, unsigned percent)
 {
+    int rval;
+
     if(percent > 100) percent = 100;
+    if(gpx->flag.deferProgress) {
+        CALL( mark_build_progress(gpx, PROGRESS_SET, percent) );
+    }
     gpx->current.percent = percent;
 
     begin_frame(gpx);
@@ -2187,6 +2681,67 @@ int end_build(Gpx *gpx)
 
 // 155 - Queue extended point x3g
 
+// IMPORTANT: leaves the frame open, for the caller to end or hold
+
+static void write_ext_point(Gpx *gpx, Ptr5d steps, double dda_rate, unsigned relative, double distance, double feedrate)
+{
+    begin_frame(gpx);
+
+    write_8(gpx, 155);
+
+    // int32: X coordinate, in steps
+    write_32(gpx, (int)steps->x);
+
+    // int32: Y coordinate, in steps
+    write_32(gpx, (int)steps->y);
+
+    // int32: Z coordinate, in steps
+    write_32(gpx, (int)steps->z);
+
+    // int32: A coordinate, in steps
+    write_32(gpx, (int)steps->a);
+
+    // int32: B coordinate, in steps
+    write_32(gpx, (int)steps->b);
+
+    // uint32: DDA Feedrate, in steps/s
+    write_32(gpx, (unsigned)dda_rate);
+
+    // uint8: Axes bitfield to specify which axes are relative. Any axis with a bit set should make a relative movement.
+    write_8(gpx, relative);
+
+    // float (single precision, 32 bit): mm distance for this move.  normal of XYZ if any of these axes are active, and AB for extruder only moves
+    write_float(gpx, (float)distance);
+
+    // uint16: feedrate in mm/s, multiplied by 64 to assist fixed point calculation on the bot
+    write_16(gpx, (unsigned)(feedrate * 64.0));
+}
+
+// Slicers break curves into runs of short, nearly collinear moves that each
+// cost the firmware's planner a 155 packet.  With coalesce_moves set a move is
+// held back and the moves after it that keep to its direction, extrusion per
+// mm and feedrate are merged into it, up to coalesce_length mm.  The extruder
+// steps are the sum of the steps of each move, so the rounding remainder
+// carries on as if they were written one by one.  Anything else written to the
+// output first writes out the held move, except a build progress update.
+
+static int coalesce_move(Gpx *gpx, Ptr5d deltaMM, double distance, double feedrate)
+{
+    double cosine;
+
+    if(gpx->held.count == 0
+       || gpx->held.distance + distance > gpx->coalesce.length
+       || fabs(feedrate - gpx->held.feedrate) > gpx->held.feedrate * gpx->coalesce.feedrate / 100.0
+       || fabs(deltaMM->a / distance - gpx->held.extrusion.a) > fabs(gpx->held.extrusion.a) * gpx->coalesce.extrusion / 100.0
+       || fabs(deltaMM->b / distance - gpx->held.extrusion.b) > fabs(gpx->held.extrusion.b) * gpx->coalesce.extrusion / 100.0)
+        return 0;
+    cosine = (deltaMM->x * gpx->held.direction.x
+              + deltaMM->y * gpx->held.direction.y
+              + deltaMM->z * gpx->held.direction.z) / distance;
+    return cosine >= cos(gpx->coalesce.angle * M_PI / 180.0);
+}
+
+
 // IMPORTANT: this command updates the parser state
 
 static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
@@ -2197,8 +2752,13 @@ static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
     // Or if one of the unknown axes was not specified by this command in which
     // case we don't know where to tell 139 to go, so we'll use a 0 relative move on
     // those axes here (see markwal/GPX#1)
+    int rval;
     unsigned mask = gpx->command.flag & gpx->axis.mask;
     unsigned stillUnknown = (~(gpx->axis.positionKnown | mask)) & gpx->axis.mask;
+    // a layer change ends the run of merged moves, even when it doesn't move
+    if(gpx->command.flag & Z_IS_SET) {
+        CALL( release_held_move(gpx) );
+    }
     if((gpx->axis.positionKnown & mask) != mask && !relative && !stillUnknown) {
         return queue_absolute_point(gpx);
     }
@@ -2276,8 +2836,12 @@ static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
         target.a = -deltaMM.a;
         target.b = -deltaMM.b;
 
-        gpx->accumulated.a += deltaMM.a;
-        gpx->accumulated.b += deltaMM.b;
+        accumulate(gpx, 0.0, deltaMM.a, deltaMM.b);
+
+        // only absolute moves of the extruder across the bed are merged
+        int hold = gpx->flag.coalesceMoves && !gpx->flag.sioConnected
+            && !relative && !stillUnknown && distance > 0.0001;
+        Point5d moveMM = deltaMM;
 
         deltaMM.x = fabs(deltaMM.x);
         deltaMM.y = fabs(deltaMM.y);
@@ -2315,6 +2879,7 @@ static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
             deltaMM.a = numRevolutions * mmPerRevolution;
             deltaSteps.a = round(fabs(deltaMM.a) * gpx->machine.a.steps_per_mm);
             target.a = -deltaMM.a;
+            hold = 0;
         }
         else {
             // disable RPM as soon as we begin 5D printing
@@ -2331,6 +2896,7 @@ static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
             deltaMM.b = numRevolutions * mmPerRevolution;
             deltaSteps.b = round(fabs(deltaMM.b) * gpx->machine.b.steps_per_mm);
             target.b = -deltaMM.b;
+            hold = 0;
         }
         else {
             // disable RPM as soon as we begin 5D printing
@@ -2338,6 +2904,12 @@ static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
         }
 #endif
 
+        // the steps are logged at the offset the packet goes to
+        int merge = hold && coalesce_move(gpx, &moveMM, distance, feedrate);
+        if(!merge) {
+            CALL( release_held_move(gpx) );
+        }
+
         Point5d steps = mm_to_steps(gpx, &target, &gpx->excess);
 
 	// Total time required for the motion in units of microseconds
@@ -2352,39 +2924,48 @@ static int queue_ext_point(Gpx *gpx, double feedrate, Ptr5d delta, int relative)
 	// steps-per-microsecond * 1000000 us/s = 1000000 * (1 / dda_interval)
         double dda_rate = 1000000.0L / dda_interval;
 
-        gpx->accumulated.time += (minutes * 60) * ACCELERATION_TIME;
-
-        begin_frame(gpx);
-
-        write_8(gpx, 155);
-
-        // int32: X coordinate, in steps
-        write_32(gpx, (int)steps.x);
-
-        // int32: Y coordinate, in steps
-        write_32(gpx, (int)steps.y);
-
-        // int32: Z coordinate, in steps
-        write_32(gpx, (int)steps.z);
-
-        // int32: A coordinate, in steps
-        write_32(gpx, (int)steps.a);
-
-        // int32: B coordinate, in steps
-        write_32(gpx, (int)steps.b);
-
-        // uint32: DDA Feedrate, in steps/s
-        write_32(gpx, (unsigned)dda_rate);
-
-        // uint8: Axes bitfield to specify which axes are relative. Any axis with a bit set should make a relative movement.
-        write_8(gpx, relative ? AXES_BIT_MASK : stillUnknown|A_IS_SET|B_IS_SET);
-
-        // float (single precision, 32 bit): mm distance for this move.  normal of XYZ if any of these axes are active, and AB for extruder only moves
-        write_float(gpx, (float)distance);
-
-        // uint16: feedrate in mm/s, multiplied by 64 to assist fixed point calculation on the bot
-        write_16(gpx, (unsigned)(feedrate * 64.0));
-
+        accumulate_move(gpx, &moveMM, distance, feedrate);
+
+        if(merge) {
+            gpx->held.count++;
+            gpx->held.steps.x = steps.x;
+            gpx->held.steps.y = steps.y;
+            gpx->held.steps.z = steps.z;
+            gpx->held.steps.a += steps.a;
+            gpx->held.steps.b += steps.b;
+            gpx->held.deltaSteps.x += deltaSteps.x;
+            gpx->held.deltaSteps.y += deltaSteps.y;
+            gpx->held.deltaSteps.z += deltaSteps.z;
+            gpx->held.deltaSteps.a += deltaSteps.a;
+            gpx->held.deltaSteps.b += deltaSteps.b;
+            gpx->held.distance += distance;
+            gpx->held.minutes += minutes;
+            gpx->held.flag |= gpx->command.flag;
+            usec = 60000000.0L * gpx->held.minutes;
+            dda_interval = usec / largest_axis(gpx->held.flag, &gpx->held.deltaSteps);
+            dda_rate = 1000000.0L / dda_interval;
+            // the feedrate of the moves stayed close to the first one's
+            write_ext_point(gpx, &gpx->held.steps, dda_rate, A_IS_SET|B_IS_SET, gpx->held.distance, gpx->held.feedrate);
+            hold_frame(gpx);
+            return SUCCESS;
+        }
+        write_ext_point(gpx, &steps, dda_rate, relative ? AXES_BIT_MASK : stillUnknown|A_IS_SET|B_IS_SET, distance, feedrate);
+        if(hold) {
+            gpx->held.count = 1;
+            gpx->held.steps = steps;
+            gpx->held.deltaSteps = deltaSteps;
+            gpx->held.direction.x = moveMM.x / distance;
+            gpx->held.direction.y = moveMM.y / distance;
+            gpx->held.direction.z = moveMM.z / distance;
+            gpx->held.extrusion.a = moveMM.a / distance;
+            gpx->held.extrusion.b = moveMM.b / distance;
+            gpx->held.feedrate = feedrate;
+            gpx->held.distance = distance;
+            gpx->held.minutes = minutes;
+            gpx->held.flag = gpx->command.flag;
+            hold_frame(gpx);
+            return SUCCESS;
+        }
         return end_frame(gpx);
 	}
     return SUCCESS;
@@ -3194,21 +3775,172 @@ static int calculate_target_position(Gpx *gpx, Ptr5d delta, int *relative)
     return SUCCESS;
 }
 
-static void update_current_position(Gpx *gpx)
+static void update_layer_height(Gpx *gpx, double rise)
 {
-    // the current position to tracks where the print head currently is
-    if(gpx->target.position.z != gpx->current.position.z) {
+    if(rise != 0.0) {
         // calculate layer height
-        gpx->layerHeight = fabs(gpx->target.position.z - gpx->current.position.z);
+        gpx->layerHeight = fabs(rise);
         // check upper bounds
         if(gpx->layerHeight > (gpx->machine.nozzle_diameter * 0.85)) {
             gpx->layerHeight = gpx->machine.nozzle_diameter * 0.85;
         }
     }
+}
+
+static void update_current_position(Gpx *gpx)
+{
+    // the current position to tracks where the print head currently is
+    update_layer_height(gpx, gpx->target.position.z - gpx->current.position.z);
     gpx->current.position = gpx->target.position;
     if(!gpx->flag.relativeCoordinates) gpx->axis.positionKnown |= (gpx->command.flag & gpx->axis.mask);
 }
 
+// ARCS
+
+// the axes of the arc plane in a point, the third is the one a helix climbs
+
+static unsigned arc_axes(Gpx *gpx, Ptr5d point, double **axes)
+{
+    switch(gpx->current.plane) {
+        case 18:
+            axes[0] = &point->z;
+            axes[1] = &point->x;
+            axes[2] = &point->y;
+            return Z_IS_SET | X_IS_SET;
+        case 19:
+            axes[0] = &point->y;
+            axes[1] = &point->z;
+            axes[2] = &point->x;
+            return Y_IS_SET | Z_IS_SET;
+        default:
+            axes[0] = &point->x;
+            axes[1] = &point->y;
+            axes[2] = &point->z;
+            return X_IS_SET | Y_IS_SET;
+    }
+}
+
+// G2 and G3 are queued as chords of the arc, each as long as it can be and
+// stay within arc_tolerance mm of the arc, but no shorter than arc_min_segment
+// mm so the firmware isn't sent more moves than it can plan.  The helical
+// axis and the extruders move evenly along the chords.
+
+static int queue_arc(Gpx *gpx, int clockwise)
+{
+    int rval;
+    Point5d delta, start, end;
+    Point5d offset = {gpx->command.i, gpx->command.j, gpx->command.k, 0.0, 0.0};
+    double *s[3], *e[3], *o[3], *t[3];
+    unsigned mask = gpx->command.flag & gpx->axis.mask;
+    unsigned plane, given;
+    double scale = gpx->flag.macrosEnabled ? gpx->user.scale : 1.0;
+    double du, dv, cu, cv, radius, angle, step;
+    int relative;
+    unsigned i, segments;
+
+    CALL( calculate_target_position(gpx, &delta, &relative) );
+    start = gpx->current.position;
+    end = gpx->target.position;
+    plane = arc_axes(gpx, &start, s);
+    arc_axes(gpx, &end, e);
+    arc_axes(gpx, &offset, o);
+    given = ((gpx->command.flag & I_IS_SET) ? X_IS_SET : 0)
+        | ((gpx->command.flag & J_IS_SET) ? Y_IS_SET : 0)
+        | ((gpx->command.flag & K_IS_SET) ? Z_IS_SET : 0);
+    du = *e[0] - *s[0];
+    dv = *e[1] - *s[1];
+
+    if((gpx->axis.positionKnown & (plane | mask)) != (plane | mask)) {
+        gcodeResult(gpx, "(line %u) Semantic warning: G%u from an unknown position, moving in a straight line" EOL, gpx->lineNumber, gpx->command.g);
+        goto straight;
+    }
+    if(gpx->command.flag & R_IS_SET) {
+        double r = gpx->command.r * scale;
+        double d = sqrt(du * du + dv * dv);
+        double h = r * r - d * d / 4;
+        if(d < 0.000001) {
+            gcodeResult(gpx, "(line %u) Semantic warning: G%u R cannot describe a full circle" EOL, gpx->lineNumber, gpx->command.g);
+            goto straight;
+        }
+        // the centre is to the left of the chord going anticlockwise, and the
+        // other side for the long way round
+        h = h > 0.0 ? sqrt(h) : 0.0;
+        if(clockwise != (r < 0.0)) h = -h;
+        cu = du / 2 - h * dv / d;
+        cv = dv / 2 + h * du / d;
+    }
+    else if(given & plane) {
+        cu = *o[0] * scale;
+        cv = *o[1] * scale;
+    }
+    else {
+        gcodeResult(gpx, "(line %u) Semantic warning: G%u without a centre or radius for the plane, moving in a straight line" EOL, gpx->lineNumber, gpx->command.g);
+        goto straight;
+    }
+    radius = sqrt(cu * cu + cv * cv);
+    if(radius < 0.000001) {
+        gcodeResult(gpx, "(line %u) Semantic warning: G%u has no radius, moving in a straight line" EOL, gpx->lineNumber, gpx->command.g);
+        goto straight;
+    }
+
+    // the angle turned from the start to the end, all the way round when they
+    // are the same
+    angle = 0.0;
+    if(du * du + dv * dv >= 0.000001 * 0.000001) {
+        angle = atan2(-cu * (dv - cv) + cv * (du - cu), -cu * (du - cu) - cv * (dv - cv));
+    }
+    if(clockwise) {
+        if(angle >= 0.0) angle -= 2 * M_PI;
+    }
+    else {
+        if(angle <= 0.0) angle += 2 * M_PI;
+    }
+
+    step = M_PI / 2;
+    if(gpx->arc.tolerance > 0.0 && gpx->arc.tolerance < radius) {
+        step = 2 * acos(1 - gpx->arc.tolerance / radius);
+    }
+    if(step * radius < gpx->arc.segment) step = gpx->arc.segment / radius;
+    if(step > M_PI / 2) step = M_PI / 2;
+    segments = (unsigned)ceil(fabs(angle) / step);
+    if(segments == 0) segments = 1;
+
+    gpx->command.flag |= plane;
+    gpx->target.position = start;
+    arc_axes(gpx, &gpx->target.position, t);
+    for(i = 1; i <= segments; i++) {
+        if(i == segments) {
+            gpx->target.position = end;
+        }
+        else {
+            double fraction = (double)i / segments;
+            double c = cos(angle * fraction);
+            double sn = sin(angle * fraction);
+            *t[0] = *s[0] + cu - cu * c + cv * sn;
+            *t[1] = *s[1] + cv - cu * sn - cv * c;
+            *t[2] = *s[2] + (*e[2] - *s[2]) * fraction;
+            gpx->target.position.a = start.a + (end.a - start.a) * fraction;
+            gpx->target.position.b = start.b + (end.b - start.b) * fraction;
+        }
+        delta.x = gpx->target.position.x - gpx->current.position.x;
+        delta.y = gpx->target.position.y - gpx->current.position.y;
+        delta.z = gpx->target.position.z - gpx->current.position.z;
+        delta.a = gpx->target.position.a - gpx->current.position.a;
+        delta.b = gpx->target.position.b - gpx->current.position.b;
+        CALL( queue_ext_point(gpx, 0.0, &delta, relative) );
+        gpx->current.position = gpx->target.position;
+    }
+    // the layer height is the rise of the whole arc
+    update_layer_height(gpx, end.z - start.z);
+    update_current_position(gpx);
+    return SUCCESS;
+
+straight:
+    CALL( queue_ext_point(gpx, 0.0, &delta, relative) );
+    update_current_position(gpx);
+    return SUCCESS;
+}
+
 // TOOL CHANGE
 
 static int do_tool_change(Gpx *gpx, int timeout) {
@@ -3306,51 +4038,6 @@ static long get_filesize(FILE *file)
 }
 #endif // FUTURE
 
-// clean up the gcode command for processing
-
-static char *normalize_word(char* p)
-{
-    // we expect a letter followed by a digit
-    // [ a-zA-Z] [ +-]? [ 0-9]+ ('.' [ 0-9]*)?
-    char *s = p + 1;
-    char *e = p;
-    while(isspace(*s)) s++;
-    if(*s == '+' || *s == '-') {
-        *e++ = *s++;
-    }
-    while(1) {
-        // skip spaces
-        if(isspace(*s)) {
-            s++;
-        }
-        // append digits
-        else if(isdigit(*s)) {
-            *e++ = *s++;
-        }
-        else {
-            break;
-        }
-    }
-    if(*s == '.') {
-        *e++ = *s++;
-        while(1) {
-            // skip spaces
-            if(isspace(*s)) {
-                s++;
-            }
-            // append digits
-            else if(isdigit(*s)) {
-                *e++ = *s++;
-            }
-            else {
-                break;
-            }
-        }
-    }
-    *e = 0;
-    return s;
-}
-
 // clean up the gcode comment for processing
 
 static char *normalize_comment(char *p) {
@@ -3407,6 +4094,9 @@ static int parse_macro(Gpx *gpx, const char* macro, char *p)
     unsigned build_platform_temperature = 0;
     unsigned LED = 0;
 
+    // macros are loaded on the first pass of the multi-pass converter
+    if(gpx->flag.deferProgress) gpx->flag.singlePassFailed = 1;
+
     while(*p != 0) {
         // trim any leading white space
         while(isspace(*p)) p++;
@@ -3935,6 +4625,9 @@ static int ini_parse_file(Gpx* gpx, FILE* file, int (*handler)(Gpx*, const char*
     char section[INI_SECTION_MAX] = "";
     char prev_name[INI_NAME_MAX] = "";
 
+    Reader reader;
+    char* line;
+    size_t length;
     char* start;
     char* end;
     char* name;
@@ -3943,10 +4636,11 @@ static int ini_parse_file(Gpx* gpx, FILE* file, int (*handler)(Gpx*, const char*
     gpx->lineNumber = 0;
 
     /* Scan through file line by line */
-    while(fgets(gpx->buffer.in, BUFFER_MAX, file) != NULL) {
+    reader_open(&reader, file);
+    while((line = reader_next_line(&reader, &length)) != NULL) {
         gpx->lineNumber++;
 
-        start = gpx->buffer.in;
+        start = line;
 #if INI_ALLOW_BOM
         if(gpx->lineNumber == 1 && (unsigned char)start[0] == 0xEF &&
             (unsigned char)start[1] == 0xBB &&
@@ -3960,7 +4654,7 @@ static int ini_parse_file(Gpx* gpx, FILE* file, int (*handler)(Gpx*, const char*
             /* Per Python ConfigParser, allow '#' comments at start of line */
         }
 #if INI_ALLOW_MULTILINE
-        else if(*prev_name && *start && start > gpx->buffer.in) {
+        else if(*prev_name && *start && start > line) {
             /* Non-black line with leading whitespace, treat as continuation
              of previous name's value (as per Python ConfigParser). */
             if(handler(gpx, section, prev_name, start) && !error)
@@ -4006,6 +4700,7 @@ static int ini_parse_file(Gpx* gpx, FILE* file, int (*handler)(Gpx*, const char*
             }
         }
     }
+    reader_close(&reader);
     return error;
 }
 
@@ -4109,6 +4804,17 @@ int gpx_set_property_inner(Gpx *gpx, const char* section, const char* property,
     else if(SECTION_IS("printer") || SECTION_IS("slicer")) {
         if(PROPERTY_IS("ditto_printing")) gpx->flag.dittoPrinting = atoi(value);
         else if(PROPERTY_IS("build_progress")) gpx->flag.buildProgress = atoi(value);
+        else if(PROPERTY_IS("single_pass")) gpx->flag.singlePass = atoi(value);
+        else if(PROPERTY_IS("threads")) gpx->threads = atoi(value);
+        else if(PROPERTY_IS("serial_window")) gpx->serialWindow = atoi(value);
+        else if(PROPERTY_IS("serial_gather")) gpx->serialGather = atoi(value);
+        else if(PROPERTY_IS("coalesce_moves")) gpx->flag.coalesceMoves = atoi(value);
+        else if(PROPERTY_IS("coalesce_angle")) gpx->coalesce.angle = strtod(value, NULL);
+        else if(PROPERTY_IS("coalesce_extrusion")) gpx->coalesce.extrusion = strtod(value, NULL);
+        else if(PROPERTY_IS("coalesce_feedrate")) gpx->coalesce.feedrate = strtod(value, NULL);
+        else if(PROPERTY_IS("coalesce_length")) gpx->coalesce.length = strtod(value, NULL);
+        else if(PROPERTY_IS("arc_tolerance")) gpx->arc.tolerance = strtod(value, NULL);
+        else if(PROPERTY_IS("arc_min_segment")) gpx->arc.segment = strtod(value, NULL);
         else if(PROPERTY_IS("packing_density")) gpx->machine.nominal_packing_density = strtod(value, NULL);
         else if(PROPERTY_IS("recalculate_5d")) gpx->flag.rewrite5D = atoi(value);
         else if(PROPERTY_IS("nominal_filament_diameter")
@@ -4161,9 +4867,9 @@ int gpx_set_property_inner(Gpx *gpx, const char* section, const char* property,
         else if(PROPERTY_IS("home_feedrate")) gpx->machine.x.home_feedrate = strtod(value, NULL);
         else if(PROPERTY_IS("steps_per_mm")) gpx->machine.x.steps_per_mm = strtod(value, NULL);
         else if(PROPERTY_IS("endstop")) gpx->machine.x.endstop = atoi(value);
-		else if(PROPERTY_IS("max_acceleration") ||
-				PROPERTY_IS("max_speed_change") ||
-				PROPERTY_IS("length")) { }
+        else if(PROPERTY_IS("max_acceleration")) gpx->machine.x.max_accel = strtod(value, NULL);
+        else if(PROPERTY_IS("max_speed_change")) gpx->machine.x.max_speed_change = strtod(value, NULL);
+		else if(PROPERTY_IS("length")) { }
         else goto SECTION_ERROR;
     }
     else if(SECTION_IS("y")) {
@@ -4171,9 +4877,9 @@ int gpx_set_property_inner(Gpx *gpx, const char* section, const char* property,
         else if(PROPERTY_IS("home_feedrate")) gpx->machine.y.home_feedrate = strtod(value, NULL);
         else if(PROPERTY_IS("steps_per_mm")) gpx->machine.y.steps_per_mm = strtod(value, NULL);
         else if(PROPERTY_IS("endstop")) gpx->machine.y.endstop = atoi(value);
-		else if(PROPERTY_IS("max_acceleration") ||
-				PROPERTY_IS("max_speed_change") ||
-				PROPERTY_IS("length")) { }
+        else if(PROPERTY_IS("max_acceleration")) gpx->machine.y.max_accel = strtod(value, NULL);
+        else if(PROPERTY_IS("max_speed_change")) gpx->machine.y.max_speed_change = strtod(value, NULL);
+		else if(PROPERTY_IS("length")) { }
         else goto SECTION_ERROR;
     }
     else if(SECTION_IS("z")) {
@@ -4181,9 +4887,9 @@ int gpx_set_property_inner(Gpx *gpx, const char* section, const char* property,
         else if(PROPERTY_IS("home_feedrate")) gpx->machine.z.home_feedrate = strtod(value, NULL);
         else if(PROPERTY_IS("steps_per_mm")) gpx->machine.z.steps_per_mm = strtod(value, NULL);
         else if(PROPERTY_IS("endstop")) gpx->machine.z.endstop = atoi(value);
-		else if(PROPERTY_IS("max_acceleration") ||
-				PROPERTY_IS("max_speed_change") ||
-				PROPERTY_IS("length")) { }
+        else if(PROPERTY_IS("max_acceleration")) gpx->machine.z.max_accel = strtod(value, NULL);
+        else if(PROPERTY_IS("max_speed_change")) gpx->machine.z.max_speed_change = strtod(value, NULL);
+		else if(PROPERTY_IS("length")) { }
         else goto SECTION_ERROR;
     }
     else if(SECTION_IS("a")) {
@@ -4191,8 +4897,8 @@ int gpx_set_property_inner(Gpx *gpx, const char* section, const char* property,
         else if(PROPERTY_IS("steps_per_mm")) gpx->machine.a.steps_per_mm = strtod(value, NULL);
         else if(PROPERTY_IS("motor_steps")) gpx->machine.a.motor_steps = strtod(value, NULL);
         else if(PROPERTY_IS("has_heated_build_platform")) gpx->machine.a.has_heated_build_platform = atoi(value);
-		else if(PROPERTY_IS("max_acceleration") ||
-				PROPERTY_IS("max_speed_change")) { }
+        else if(PROPERTY_IS("max_acceleration")) gpx->machine.a.max_accel = strtod(value, NULL);
+        else if(PROPERTY_IS("max_speed_change")) gpx->machine.a.max_speed_change = strtod(value, NULL);
         else goto SECTION_ERROR;
     }
     else if(SECTION_IS("right")) {
@@ -4209,8 +4915,8 @@ int gpx_set_property_inner(Gpx *gpx, const char* section, const char* property,
         else if(PROPERTY_IS("steps_per_mm")) gpx->machine.b.steps_per_mm = strtod(value, NULL);
         else if(PROPERTY_IS("motor_steps")) gpx->machine.b.motor_steps = strtod(value, NULL);
         else if(PROPERTY_IS("has_heated_build_platform")) gpx->machine.b.has_heated_build_platform = atoi(value);
-		else if(PROPERTY_IS("max_acceleration") ||
-				PROPERTY_IS("max_speed_change")) { }
+        else if(PROPERTY_IS("max_acceleration")) gpx->machine.b.max_accel = strtod(value, NULL);
+        else if(PROPERTY_IS("max_speed_change")) gpx->machine.b.max_speed_change = strtod(value, NULL);
         else goto SECTION_ERROR;
     }
     else if(SECTION_IS("left")) {
@@ -4387,43 +5093,45 @@ static int get_extruder_temperature_extended(Gpx *gpx)
         CALL(get_build_platform_temperature(gpx, 1));
         CALL(get_build_platform_target_temperature(gpx, 1));
     }
-    empty_frame(gpx);
+    CALL(empty_frame(gpx));
     return SUCCESS;
 }
 
-int gpx_convert_line(Gpx *gpx, char *gcode_line)
+// parse a line of gcode into gpx->command, a line is plain when all there is
+// to it ends up in the command, the parse cache keeps the others, with a macro
+// or a warning, as text
+
+static int parse_line(Gpx *gpx, char *gcode_line, int *next_line, int *plain)
 {
-    int i, rval;
-    int next_line = 0;
-    int command_emitted = 0;
+    int rval;
 
     // reset flag state
     gpx->command.flag = 0;
-    char *digits;
+    *plain = 1;
+    double value;
     char *p = gcode_line; // current parser location
     while(isspace(*p)) p++;
     VERBOSESIO( if(gpx->flag.sioConnected) fprintf(gpx->log, "gcode_line: %s\n", gcode_line); )
     // check for line number
     if(*p == 'n' || *p == 'N') {
-        digits = p;
-        p = normalize_word(p);
+        p = normalize_word(p, &value);
         if(*p == 0) {
             gcodeResult(gpx, "(line %u) Syntax error: line number command word 'N' is missing digits" EOL, gpx->lineNumber);
-            next_line = gpx->lineNumber + 1;
+            *plain = 0;
+            *next_line = gpx->lineNumber + 1;
         }
         else {
-            next_line = gpx->lineNumber = atoi(digits);
+            *next_line = gpx->lineNumber = (int)value;
         }
     }
     else {
-        next_line = gpx->lineNumber + 1;
+        *next_line = gpx->lineNumber + 1;
     }
     // parse command words in command line
     while(*p != 0) {
         if(isalpha(*p)) {
             int c = *p;
-            digits = p;
-            p = normalize_word(p);
+            p = normalize_word(p, &value);
             switch(c) {
 
                     // PARAMETERS
@@ -4431,70 +5139,91 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                     // Xnnn	 X coordinate, usually to move to
                 case 'x':
                 case 'X':
-                    gpx->command.x = strtod(digits, NULL);
+                    gpx->command.x = value;
                     gpx->command.flag |= X_IS_SET;
                     break;
 
                     // Ynnn	 Y coordinate, usually to move to
                 case 'y':
                 case 'Y':
-                    gpx->command.y = strtod(digits, NULL);
+                    gpx->command.y = value;
                     gpx->command.flag |= Y_IS_SET;
                     break;
 
                     // Znnn	 Z coordinate, usually to move to
                 case 'z':
                 case 'Z':
-                    gpx->command.z = strtod(digits, NULL);
+                    gpx->command.z = value;
                     gpx->command.flag |= Z_IS_SET;
                     break;
 
                     // Annn	 Length of extrudate in mm.
                 case 'a':
                 case 'A':
-                    gpx->command.a = strtod(digits, NULL);
+                    gpx->command.a = value;
                     gpx->command.flag |= A_IS_SET;
                     break;
 
                     // Bnnn	 Length of extrudate in mm.
                 case 'b':
                 case 'B':
-                    gpx->command.b = strtod(digits, NULL);
+                    gpx->command.b = value;
                     gpx->command.flag |= B_IS_SET;
                     break;
 
                     // Ennn	 Length of extrudate in mm.
                 case 'e':
                 case 'E':
-                    gpx->command.e = strtod(digits, NULL);
+                    gpx->command.e = value;
                     gpx->command.flag |= E_IS_SET;
                     break;
 
                     // Fnnn	 Feedrate in mm per minute.
                 case 'f':
                 case 'F':
-                    gpx->command.f = strtod(digits, NULL);
+                    gpx->command.f = value;
                     gpx->command.flag |= F_IS_SET;
                     break;
 
+                    // Innn	 X offset of an arc centre
+                case 'i':
+                case 'I':
+                    gpx->command.i = value;
+                    gpx->command.flag |= I_IS_SET;
+                    break;
+
+                    // Jnnn	 Y offset of an arc centre
+                case 'j':
+                case 'J':
+                    gpx->command.j = value;
+                    gpx->command.flag |= J_IS_SET;
+                    break;
+
+                    // Knnn	 Z offset of an arc centre
+                case 'k':
+                case 'K':
+                    gpx->command.k = value;
+                    gpx->command.flag |= K_IS_SET;
+                    break;
+
                     // Pnnn	 Command parameter, such as a time in milliseconds
                 case 'p':
                 case 'P':
-                    gpx->command.p = strtod(digits, NULL);
+                    gpx->command.p = value;
                     gpx->command.flag |= P_IS_SET;
                     break;
 
                     // Rnnn	 Command Parameter, such as RPM
                 case 'r':
                 case 'R':
-                    gpx->command.r = strtod(digits, NULL);
+                    gpx->command.r = value;
                     gpx->command.flag |= R_IS_SET;
                     break;
 
                     // Snnn	 Command parameter, such as temperature
                 case 's':
                 case 'S':
-                    gpx->command.s = strtod(digits, NULL);
+                    gpx->command.s = value;
                     gpx->command.flag |= S_IS_SET;
                     break;
 
@@ -4503,13 +5232,13 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                     // Gnnn GCode command, such as move to a point
                 case 'g':
                 case 'G':
-                    gpx->command.g = atoi(digits);
+                    gpx->command.g = (int)value;
                     gpx->command.flag |= G_IS_SET;
                     break;
                     // Mnnn	 RepRap-defined command
                 case 'm':
                 case 'M':
-                    gpx->command.m = atoi(digits);
+                    gpx->command.m = (int)value;
                     gpx->command.flag |= M_IS_SET;
                     if(gpx->command.m == 23 || gpx->command.m == 28) {
                         char *s = p + 1;
@@ -4523,7 +5252,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                     // Tnnn	 Select extruder nnn.
                 case 't':
                 case 'T':
-                    gpx->command.t = atoi(digits);
+                    gpx->command.t = (int)value;
                     gpx->command.flag |= T_IS_SET;
                     break;
                     // Nnnn      Line number
@@ -4538,6 +5267,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
 
                 default:
                     gcodeResult(gpx, "(line %u) Syntax warning: unrecognised command word '%c'" EOL, gpx->lineNumber, c);
+                    *plain = 0;
             }
         }
         else if(*p == ';') {
@@ -4549,6 +5279,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                     while(*s && !isspace(*s)) s++;
                     // null terminate
                     if(*s) *s++ = 0;
+                    *plain = 0;
                     CALL( parse_macro(gpx, macro, normalize_comment(s)) );
                     *p = 0;
                     break;
@@ -4571,6 +5302,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                     // null terminate
                     if(*s) *s++ = 0;
                     if(e) *e = 0;
+                    *plain = 0;
                     CALL( parse_macro(gpx, macro, normalize_comment(s)) );
                     *p = 0;
                     break;
@@ -4582,6 +5314,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
             // check for nested comment
             if(s && e && s < e) {
                 gcodeResult(gpx, "(line %u) Syntax warning: nested comment detected" EOL, gpx->lineNumber);
+                *plain = 0;
                 e = strrchr(p + 1, ')');
             }
             if(e) {
@@ -4592,6 +5325,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
             }
             else {
                 gcodeResult(gpx, "(line %u) Syntax warning: comment is missing closing ')'" EOL, gpx->lineNumber);
+                *plain = 0;
                 gpx->command.comment = normalize_comment(p + 1);
                 gpx->command.flag |= COMMENT_IS_SET;
                 *p = 0;
@@ -4608,10 +5342,20 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
         }
         else {
             gcodeResult(gpx, "(line %u) Syntax error: unrecognised gcode '%s'" EOL, gpx->lineNumber, p);
+            *plain = 0;
             break;
         }
     }
-
+    return SUCCESS;
+}
+
+// carry out the command in gpx->command
+
+static int convert_command(Gpx *gpx, int next_line)
+{
+    int i, rval;
+    int command_emitted = 0;
+
     // revert tool selection to current extruder (Makerbot Tn is not sticky)
     if(!gpx->flag.reprapFlavor || gpx->flag.onlyExplicitToolChange) gpx->target.extruder = gpx->current.extruder;
 
@@ -4700,6 +5444,13 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
 
                 // G2 - Clockwise Arc
                 // G3 - Counter Clockwise Arc
+            case 2:
+            case 3:
+                if(!gpx->flag.relativeCoordinates && gpx->flag.ignoreAbsoluteMoves)
+                    break;
+                CALL( queue_arc(gpx, gpx->command.g == 2) );
+                command_emitted++;
+                break;
 
                 // G4 - Dwell
             case 4:
@@ -4766,6 +5517,15 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
             case 15:
                 break;  // yep, it's all we do, currently
 
+                // G17 - Select the XY plane for arcs
+                // G18 - Select the ZX plane for arcs
+                // G19 - Select the YZ plane for arcs
+            case 17:
+            case 18:
+            case 19:
+                gpx->current.plane = gpx->command.g;
+                break;
+
                 // G21 - Use Millimeters as Units (IGNORED)
                 // G71 - Use Millimeters as Units (IGNORED)
             case 21:
@@ -4825,8 +5585,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                 }
                 command_emitted++;
                 set_unknown_axes(gpx, gpx->command.flag);
-                gpx->excess.a = 0;
-                gpx->excess.b = 0;
+                reset_excess(gpx);
                 break;
             }
 
@@ -4931,8 +5690,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                 command_emitted++;
                 // clear homed axes
                 set_unknown_axes(gpx, gpx->command.flag);
-                gpx->excess.a = 0;
-                gpx->excess.b = 0;
+                reset_excess(gpx);
                 break;
                 // G162 - Home given axes to maximum
             case 162:
@@ -4941,8 +5699,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                 command_emitted++;
                 // clear homed axes
                 set_unknown_axes(gpx, gpx->command.flag);
-                gpx->excess.a = 0;
-                gpx->excess.b = 0;
+                reset_excess(gpx);
                 break;
             default:
                 gcodeResult(gpx, "(line %u) Syntax warning: unsupported gcode command 'G%u'" EOL, gpx->lineNumber, gpx->command.g);
@@ -5196,7 +5953,10 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                                 }
                                 gpx->flag.macrosEnabled = 1;
                             }
-                            if(gpx->current.percent < percent && (percent == 1 || gpx->total.time == 0.0 || gpx->flag.buildProgress == 0)) {
+                            if(gpx->flag.deferProgress && gpx->flag.buildProgress) {
+                                CALL( mark_build_progress(gpx, PROGRESS_M73, percent) );
+                            }
+                            else if(gpx->current.percent < percent && (percent == 1 || gpx->total.time == 0.0 || gpx->flag.buildProgress == 0)) {
                                 CALL( set_build_progress(gpx, percent) );
                             }
                         }
@@ -5583,8 +6343,7 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
                     command_emitted++;
                     // clear loaded axes
                     set_unknown_axes(gpx, gpx->command.flag);
-                    gpx->excess.a = 0;
-                    gpx->excess.b = 0;
+                    reset_excess(gpx);
 
                     // since we always emit relative extruder moves, let's pretend
                     // that M132 always returns 0 for the extruders, this will prevent
@@ -5832,7 +6591,13 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
         }
     }
     // update progress
-    if(gpx->total.time > 0.0001 && gpx->accumulated.time > 0.0001 && gpx->flag.buildProgress && command_emitted) {
+    if(gpx->flag.deferProgress) {
+        // a worker of the parallel converter doesn't know the time yet
+        if((gpx->chunk || gpx->accumulated.time > 0.0001) && gpx->flag.buildProgress && command_emitted && program_is_running()) {
+            CALL( mark_build_progress(gpx, program_is_ready() ? PROGRESS_START : PROGRESS_MOVE, 0) );
+        }
+    }
+    else if(gpx->total.time > 0.0001 && gpx->accumulated.time > 0.0001 && gpx->flag.buildProgress && command_emitted) {
         unsigned percent = (unsigned)round(100.0 * gpx->accumulated.time / gpx->total.time);
         if(percent > gpx->current.percent) {
             if(program_is_ready()) {
@@ -5860,15 +6625,83 @@ int gpx_convert_line(Gpx *gpx, char *gcode_line)
     return SUCCESS;
 }
 
+int gpx_convert_line(Gpx *gpx, char *gcode_line)
+{
+    int rval, next_line, plain;
+
+    CALL( parse_line(gpx, gcode_line, &next_line, &plain) );
+    return convert_command(gpx, next_line);
+}
+
 typedef struct tFile {
     FILE *in;
+    Reader reader;
     FILE *out;
     FILE *out2;
+    char *sink;         // packets collected to be written out in one go
+    size_t sinkLength;
+    char *spool;        // single-pass output held until the progress is patched
+    size_t spoolLength;
+    size_t spoolSize;
+    const char *cachePath;
+    Cache cache;        // the parsed input
+    int caching;        // what is done with the cache on this pass
+    size_t replay;      // the next record replayed
+    uint64_t hash;      // of the input
+    uint64_t length;
 } File;
 
+#define CACHE_OFF 0
+#define CACHE_RECORD 1
+#define CACHE_REPLAY 2
+
+#define SINK_SIZE 0x40000
+#define SPOOL_CHUNK 0x100000
+#define SPLICE_BLOCK 0x10000
+
+// write the collected packets to each output with a single fwrite, which
+// stdio hands straight to the system for a block this size
+
+static int flush_sink(File *file)
+{
+    size_t length = file->sinkLength;
+    if(length) {
+        file->sinkLength = 0;
+        if(fwrite(file->sink, 1, length, file->out) != length) return ERROR;
+        if(file->out2 && fwrite(file->sink, 1, length, file->out2) != length) return ERROR;
+    }
+    return SUCCESS;
+}
+
 static int file_handler(Gpx *gpx, File *file, char *buffer, size_t length)
 {
     if(length) {
+        if(file->spool) {
+            if(file->spoolLength + length > file->spoolSize) {
+                size_t size = file->spoolSize * 2;
+                char *spool = realloc(file->spool, size);
+                if(spool == NULL) return ERROR;
+                file->spool = spool;
+                file->spoolSize = size;
+            }
+            memcpy(file->spool + file->spoolLength, buffer, length);
+            file->spoolLength += length;
+            return SUCCESS;
+        }
+        if(file->sink) {
+            if(file->sinkLength + length > SINK_SIZE && flush_sink(file) != SUCCESS) return ERROR;
+            memcpy(file->sink + file->sinkLength, buffer, length);
+            file->sinkLength += length;
+            // a pause or the end of the build is written through so whatever
+            // is reading the output sees it right away
+            unsigned char command = (unsigned char)buffer[gpx->flag.framingEnabled ? 2 : 0];
+            if(command == 8 || command == 154) {
+                if(flush_sink(file) != SUCCESS
+                   || fflush(file->out)
+                   || (file->out2 && fflush(file->out2))) return ERROR;
+            }
+            return SUCCESS;
+        }
         ssize_t bytes = fwrite(buffer, 1, length, file->out);
         if(bytes != length) return ERROR;
         if(file->out2) {
@@ -5879,256 +6712,1405 @@ static int file_handler(Gpx *gpx, File *file, char *buffer, size_t length)
     return SUCCESS;
 }
 
-int gpx_convert(Gpx *gpx, FILE *file_in, FILE *file_out, FILE *file_out2)
-{
-    int i, rval;
-    File file;
-    file.in = stdin;
-    file.out = stdout;
-    file.out2 = NULL;
-    int logMessages = gpx->flag.logMessages;
+// the parsed lines are recorded while the whole input is converted and saved
+// at the end of it, a pass that stops short records again next time
 
-    if(file_in && file_in != stdin) {
-        // Multi-pass
-        file.in = file_in;
-        i = 0;
-        gpx->flag.runMacros = 0;
-        gpx->callbackHandler = NULL;
-        gpx->callbackData = NULL;
+static void record_line(Gpx *gpx, File *file, int rval, int next_line, int plain, const char *text)
+{
+    if(rval == SUCCESS) {
+        if(plain) rval = cache_add_command(&file->cache, &gpx->command, next_line == (int)gpx->lineNumber, next_line);
+        else rval = cache_add_text(&file->cache, text);
     }
-    else {
-        // Single-pass
-        i = 1;
-        gpx->callbackHandler = (int (*)(Gpx*, void*, char*, size_t))file_handler;;
-        gpx->callbackData = &file;
+    if(rval != SUCCESS) {
+        cache_free(&file->cache);
+        file->caching = CACHE_OFF;
     }
+}
 
-    if(file_out) {
-        file.out = file_out;
+static void save_cache(Gpx *gpx, File *file)
+{
+    if(cache_save(&file->cache, file->cachePath, file->hash, file->length) != SUCCESS) {
+        VERBOSE( fprintf(gpx->log, "Could not write the parse cache %s" EOL, file->cachePath) );
     }
+    file->caching = CACHE_REPLAY;
+}
 
-    file.out2 = file_out2;
-
-    for(;;) {
-        int overflow = 0;
-
-	if(gpx->preamble)
-	     start_build(gpx, gpx->preamble);
-
-        while(fgets(gpx->buffer.in, BUFFER_MAX, file.in) != NULL) {
-            // detect input buffer overflow and ignore overflow input
-            if(overflow) {
-                if(strlen(gpx->buffer.in) != BUFFER_MAX - 1) {
-                    overflow = 0;
-                }
-                continue;
-            }
-            if(strlen(gpx->buffer.in) == BUFFER_MAX - 1) {
-                overflow = 1;
-                // ignore run-on comments, this is actually a little too permissive
-                // since technically we should ignore ';' contained within a
-                // parenthetical comment
-                if(!strchr(gpx->buffer.in, ';'))
-                    gcodeResult(gpx, "(line %u) Buffer overflow: input exceeds %u character limit, remaining characters in line will be ignored" EOL, gpx->lineNumber, BUFFER_MAX);
-            }
-
-            rval = gpx_convert_line(gpx, gpx->buffer.in);
-            // normal exit
-            if(rval == END_OF_FILE) break;
-            // error
-            if(rval < 0) return rval;
-        }
+// convert the input up to end, feeding each line to the shadow context too
+// while there is one
 
-        if(program_is_running()) {
-            end_program();
-	    if(!gpx->noend) {
-		 CALL( set_build_progress(gpx, 100) );
-		 CALL( end_build(gpx) );
-	    }
+static int convert_lines(Gpx *gpx, File *file, Gpx **shadow, size_t end)
+{
+    int rval = SUCCESS;
+    int next_line, plain;
+    char *line;
+    size_t length;
+    // the parser writes into the line, so the shadow and the cache get their
+    // own copy
+    char *copy = NULL;
+    size_t copySize = 0;
+    int copied;
+
+    while(file->reader.start < end) {
+        if((line = reader_next_line(&file->reader, &length)) == NULL) {
+            if(file->caching == CACHE_RECORD) save_cache(gpx, file);
+            break;
         }
+        copied = *shadow || file->caching == CACHE_RECORD;
+        if(copied && length + 1 > copySize) {
+            char *p = realloc(copy, length + 1);
+            if(p == NULL) {
+                rval = ERROR;
+                break;
+            }
+            copy = p;
+            copySize = length + 1;
+        }
+        if(copied) memcpy(copy, line, length + 1);
+        rval = parse_line(gpx, line, &next_line, &plain);
+        if(file->caching == CACHE_RECORD) record_line(gpx, file, rval, next_line, plain, copy);
+        if(rval == SUCCESS) rval = convert_command(gpx, next_line);
+        // normal exit
+        if(rval == END_OF_FILE) break;
+        // error
+        if(rval < 0) break;
+        // no use going on, the multi-pass converter takes over
+        if(gpx->flag.deferProgress && gpx->flag.singlePassFailed) break;
+        if(*shadow) {
+            rval = gpx_convert_line(*shadow, copy);
+            if(rval == END_OF_FILE) *shadow = NULL;
+            else if(rval < 0) break;
+        }
+    }
+    free(copy);
+    return rval;
+}
 
-        // Ending gcode should disable the heaters and stepper motors
-	// This line of code here in GPX was making it such that people
-	// could not convert gcode utility scripts to x3g with GPX.  For
-	// instance, a script for build plate leveling which wanted to
-	// home the axes and then leave Z enabled
-
-        // CALL( set_steppers(gpx, AXES_BIT_MASK, 0) );
-
-        gpx->total.length = gpx->accumulated.a + gpx->accumulated.b;
-        gpx->total.time = gpx->accumulated.time;
-        gpx->total.bytes = gpx->accumulated.bytes;
+// convert the record at position, a line kept as text goes through the parser
+// from a copy, the records can be replayed again
 
-        if(++i > 1) break;
+static int replay_record(Gpx *gpx, Cache *cache, size_t *position, char **copy, size_t *copySize)
+{
+    const char *text;
+    int lineNumber;
+    int record = cache_read(cache, position, &gpx->command, &lineNumber, &text);
 
-        // rewind for second pass
-        fseek(file.in, 0L, SEEK_SET);
-        gpx_initialize(gpx, 0);
-        gpx->flag.loadMacros = 0;
-        gpx->flag.runMacros = 1;
-        gpx->flag.pausePending = (gpx->commandAtLength > 0);
-        //gpx->flag.logMessages = 0;
-        gpx->callbackHandler = (int (*)(Gpx*, void*, char*, size_t))file_handler;
-        gpx->callbackData = &file;
+    if(record == CACHE_TEXT) {
+        size_t length = strlen(text) + 1;
+        if(length > *copySize) {
+            char *p = realloc(*copy, length);
+            if(p == NULL) return ERROR;
+            *copy = p;
+            *copySize = length;
+        }
+        memcpy(*copy, text, length);
+        return gpx_convert_line(gpx, *copy);
     }
-    gpx->flag.logMessages = logMessages;;
-    return SUCCESS;
+    if(record == CACHE_LINE_NUMBER) {
+        gpx->lineNumber = lineNumber;
+        return convert_command(gpx, lineNumber);
+    }
+    return convert_command(gpx, gpx->lineNumber + 1);
 }
 
-char *sd_status[] = {
-    "operation successful",
-    "SD Card not present",
-    "SD Card initialization failed",
-    "partition table could not be read",
-    "filesystem could not be opened",
-    "root directory could not be opened",
-    "SD Card is locked",
-    "file not found",
-    "general error",
-    "changed working dir",
-    "volume too big",
-    "CRC failure",
-    "SD Card read error",
-    "SD operating at low speeds",
-    "unknown status"
-};
+// convert the parsed input from the cache, feeding each record to the shadow
+// context too while there is one
 
-char *get_sd_status(unsigned int status)
+static int replay_lines(Gpx *gpx, File *file, Gpx **shadow)
 {
-    return sd_status[status < 14 ? status : 14];
+    int rval = SUCCESS;
+    char *copy = NULL;
+    size_t copySize = 0;
+
+    while(file->replay < file->cache.recordsLength) {
+        size_t position = file->replay;
+        rval = replay_record(gpx, &file->cache, &file->replay, &copy, &copySize);
+        // normal exit
+        if(rval == END_OF_FILE) break;
+        // error
+        if(rval < 0) break;
+        // no use going on, the multi-pass converter takes over
+        if(gpx->flag.deferProgress && gpx->flag.singlePassFailed) break;
+        if(*shadow) {
+            rval = replay_record(*shadow, &file->cache, &position, &copy, &copySize);
+            if(rval == END_OF_FILE) *shadow = NULL;
+            else if(rval < 0) break;
+        }
+    }
+    free(copy);
+    return rval;
 }
 
-char *build_status[] = {
-    "no build initialized (boot state)",
-    "build running",
-    "build finished normally",
-    "build paused",
-    "build cancelled",
-    "build sleeping",
-    "unknown status"
-};
+// start over from the beginning of the input for another pass
 
-char *get_build_status(unsigned int status)
+static void rewind_input(File *file)
 {
-    return build_status[status < 6 ? status : 6];
+    reader_rewind(&file->reader);
+    file->replay = 0;
+    if(file->caching == CACHE_RECORD) {
+        cache_free(&file->cache);
+    }
 }
 
-static void read_extruder_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buffer)
+static int end_file(Gpx *gpx)
 {
-    unsigned extruder_id = buffer[EXTRUDER_ID_OFFSET];
+    int rval;
 
-    switch(command) {
-            // Query 00 - Query firmware version information
-        case 0:
-            // uint16: Firmware Version
-            sio->response.firmware.version = read_16(gpx);
-            VERBOSE( fprintf(gpx->log, "Extruder T%u firmware v%u.%u" EOL,
-                        extruder_id,
-                        sio->response.firmware.version / 100,
-                        sio->response.firmware.version % 100) );
-            break;
+    CALL( release_held_move(gpx) );
+    stop_moves(gpx);
+    if(program_is_running()) {
+        end_program();
+        if(!gpx->noend) {
+            CALL( set_build_progress(gpx, 100) );
+            CALL( end_build(gpx) );
+        }
+    }
 
-            // Query 02 - Get extruder temperature
-        case 2:
-            // int16: Current temperature, in Celsius
-            sio->response.temperature = read_16(gpx);
-            VERBOSE( fprintf(gpx->log, "Extruder T%u temperature: %uc" EOL,
-                        extruder_id,
-                        sio->response.temperature) );
-            break;
+    // Ending gcode should disable the heaters and stepper motors
+    // This line of code here in GPX was making it such that people
+    // could not convert gcode utility scripts to x3g with GPX.  For
+    // instance, a script for build plate leveling which wanted to
+    // home the axes and then leave Z enabled
 
-            // Query 22 - Is extruder ready
-        case 22:
-            // uint8: 1 if ready, 0 otherwise.
-            sio->response.isReady = read_8(gpx);
-            VERBOSE( fprintf(gpx->log, "Extruder T%u is%sready" EOL,
-                        extruder_id,
-                        sio->response.isReady ? " " : " not ") );
-            break;
+    // CALL( set_steppers(gpx, AXES_BIT_MASK, 0) );
 
-            // Query 30 - Get build platform temperature
-        case 30:
-            // int16: Current temperature, in Celsius
-            sio->response.temperature = read_16(gpx);
-            VERBOSE( fprintf(gpx->log, "Build platform T%u temperature: %uc" EOL,
-                        extruder_id,
-                        sio->response.temperature) );
-            break;
+    return SUCCESS;
+}
 
-            // Query 32 - Get extruder target temperature
-        case 32:
-            // int16: Current temperature, in Celsius
-            sio->response.temperature = read_16(gpx);
-            VERBOSE( fprintf(gpx->log, "Extruder T%u target temperature: %uc" EOL,
-                        extruder_id,
-                        sio->response.temperature) );
-            break;
+// convert the input to the end, feeding each line to the shadow context too
+// when there is one
 
-            // Query 33 - Get build platform target temperature
-        case 33:
-            // int16: Current temperature, in Celsius
-            sio->response.temperature = read_16(gpx);
-            VERBOSE( fprintf(gpx->log, "Build platform T%u target temperature: %uc" EOL,
-                        extruder_id,
-                        sio->response.temperature) );
-            break;
+static int convert_file(Gpx *gpx, File *file, Gpx *shadow)
+{
+    int rval;
 
-            // Query 35 - Is build platform ready?
-        case 35:
-            // uint8: 1 if ready, 0 otherwise.
-            sio->response.isReady = read_8(gpx);
-            VERBOSE( fprintf(gpx->log, "Build platform T%u is%sready" EOL,
-                        extruder_id,
-                        sio->response.isReady ? " " : " not ") );
-            break;
+    if(gpx->preamble)
+        start_build(gpx, gpx->preamble);
 
-            // Query 36 - Get extruder status
-        case 36:
-            // uint8: Bitfield containing status information
-            sio->response.extruder.bitfield = read_8(gpx);
+    if(file->caching == CACHE_REPLAY)
+        rval = replay_lines(gpx, file, &shadow);
+    else
+        rval = convert_lines(gpx, file, &shadow, SIZE_MAX);
+    if(rval < 0) return rval;
+    if(gpx->flag.deferProgress && gpx->flag.singlePassFailed) return SUCCESS;
+    return end_file(gpx);
+}
 
-            if(gpx->flag.verboseMode && gpx->flag.logMessages) {
-                fprintf(gpx->log, "Extruder T%u status" EOL, extruder_id);
-                if(sio->response.extruder.flag.ready) fputs("Target temperature reached" EOL, gpx->log);
-                if(sio->response.extruder.flag.notPluggedIn) fputs("The extruder or build plate is not plugged in" EOL, gpx->log);
-                if(sio->response.extruder.flag.softwareCutoff) fputs("Above maximum allowable temperature recorded: heater shutdown for safety" EOL, gpx->log);
-                if(sio->response.extruder.flag.temperatureDropping) fputs("Heater temperature dropped below target temperature" EOL, gpx->log);
-                if(sio->response.extruder.flag.buildPlateError) fputs("An error was detected with the build plate heater or sensor" EOL, gpx->log);
-                if(sio->response.extruder.flag.extruderError) fputs("An error was detected with the extruder heater or sensor" EOL, gpx->log);
-            }
-            break;
+// the multi-pass converter totals the time on a first pass that starts in the
+// caller's state and writes the output on a second pass that starts in the
+// reinitialized state, when they differ in anything that goes into the time of
+// a move the single-pass converter runs a shadow of the first pass alongside
 
-            // Query 37 - Get PID state
-        case 37:
-            // int16: Extruder heater error term
-            sio->response.pid.extruderError = read_16(gpx);
+static int same_move_state(Gpx *gpx, Gpx *saved)
+{
+    int i;
 
-            // int16: Extruder heater delta term
-            sio->response.pid.extruderDelta = read_16(gpx);
+    for(i = 0; i < 2; i++) {
+        if(gpx->override[i].filament_scale != saved->override[i].filament_scale
+           || gpx->override[i].extrusion_factor != saved->override[i].extrusion_factor)
+            return 0;
+        if(gpx->flag.rewrite5D
+           && (gpx->override[i].actual_filament_diameter != saved->override[i].actual_filament_diameter
+               || gpx->override[i].packing_density != saved->override[i].packing_density))
+            return 0;
+    }
+    return memcmp(&gpx->current, &saved->current, sizeof(gpx->current)) == 0
+        && memcmp(&gpx->target, &saved->target, sizeof(gpx->target)) == 0
+        && memcmp(&gpx->axis, &saved->axis, sizeof(gpx->axis)) == 0
+        && memcmp(&gpx->excess, &saved->excess, sizeof(gpx->excess)) == 0
+        && memcmp(gpx->offset, saved->offset, sizeof(gpx->offset)) == 0
+        && gpx->layerHeight == saved->layerHeight
+        && gpx->flag.relativeCoordinates == saved->flag.relativeCoordinates
+        && gpx->flag.extruderIsRelative == saved->flag.extruderIsRelative;
+}
+
+typedef struct tProgressPatch {
+    unsigned long offset;   // offset in the single-pass output
+    size_t length;
+    char packet[8];
+} ProgressPatch;
+
+// replay the recorded progress checks with the total time and collect the
+// set_build_progress packets the multi-pass converter would have written
+
+static int patch_build_progress(Gpx *gpx, vector *patches)
+{
+    int i, rval;
+    unsigned current = 0;
+    ProgressPatch patch;
+    vector *marks = gpx->progressMarkVector;
 
-            // int16: Extruder heater last output
-            sio->response.pid.extruderOutput = read_16(gpx);
+    if(marks == NULL) return SUCCESS;
+    gpx->callbackHandler = NULL;
+    for(i = 0; i < marks->c; i++) {
+        ProgressMark *mark = vector_get(marks, i);
+        unsigned percent = mark->percent;
+        switch(mark->type) {
+            case PROGRESS_SET:
+                current = percent;
+                continue;
 
-            // int16: Platform heater error term
-            sio->response.pid.buildPlateError = read_16(gpx);
+            case PROGRESS_M73:
+                if(current >= percent || (percent != 1 && gpx->total.time != 0.0)) continue;
+                break;
 
-            // int16: Platform heater delta term
-            sio->response.pid.buildPlateDelta = read_16(gpx);
+            case PROGRESS_MOVE:
+            case PROGRESS_START:
+                if(gpx->total.time <= 0.0001) continue;
+                percent = (unsigned)round(100.0 * mark->time / gpx->total.time);
+                if(percent <= current) continue;
+                // the multi-pass converter would have started the program here
+                if(mark->type == PROGRESS_START) {
+                    gpx->flag.singlePassFailed = 1;
+                    return SUCCESS;
+                }
+                if(percent >= 100) continue;
+                // force 1%
+                if(current == 0) percent = 1;
+                break;
+        }
+        CALL( set_build_progress(gpx, percent) );
+        current = percent;
+        patch.offset = mark->offset;
+        patch.length = gpx->buffer.ptr - gpx->buffer.out;
+        memcpy(patch.packet, gpx->buffer.out, patch.length);
+        if(vector_append(patches, &patch) < 0) return ERROR;
+    }
+    return SUCCESS;
+}
 
-            // int16: Platform heater last output
-            sio->response.pid.buildPlateOutput = read_16(gpx);
+// write the spooled output with the progress packets spliced in
 
-            break;
+static int write_spool(File *file, FILE *fp, vector *patches)
+{
+    int i;
+    size_t offset = 0;
 
-        default:
-            abort();
+    for(i = 0; i < patches->c; i++) {
+        ProgressPatch *patch = vector_get(patches, i);
+        size_t length = patch->offset - offset;
+        if(fwrite(file->spool + offset, 1, length, fp) != length) return ERROR;
+        if(fwrite(patch->packet, 1, patch->length, fp) != patch->length) return ERROR;
+        offset = patch->offset;
     }
+    if(fwrite(file->spool + offset, 1, file->spoolLength - offset, fp) != file->spoolLength - offset) return ERROR;
+    return SUCCESS;
 }
 
-void hexdump(FILE *out, char *p, size_t len)
+// splice the progress packets into length bytes of output written at base,
+// working back from the end of the file so nothing is overwritten before it
+// has been moved
+
+static int splice_file(FILE *fp, long base, unsigned long length, vector *patches)
 {
-    while (len--)
-        fprintf(out, "%02x ", (unsigned)(unsigned char)*p++);
+    int i;
+    unsigned long end = length;
+    unsigned long shift = 0;
+    char *block;
+
+    if(patches->c == 0) return SUCCESS;
+    if((block = malloc(SPLICE_BLOCK)) == NULL) return ERROR;
+    for(i = 0; i < patches->c; i++) {
+        ProgressPatch *patch = vector_get(patches, i);
+        shift += patch->length;
+    }
+    fflush(fp);
+    for(i = patches->c - 1; i >= 0; i--) {
+        ProgressPatch *patch = vector_get(patches, i);
+        unsigned long position = end;
+        while(position > patch->offset) {
+            size_t bytes = position - patch->offset < SPLICE_BLOCK ? position - patch->offset : SPLICE_BLOCK;
+            position -= bytes;
+            if(fseek(fp, base + position, SEEK_SET)
+               || fread(block, 1, bytes, fp) != bytes
+               || fseek(fp, base + position + shift, SEEK_SET)
+               || fwrite(block, 1, bytes, fp) != bytes) {
+                free(block);
+                return ERROR;
+            }
+        }
+        shift -= patch->length;
+        if(fseek(fp, base + patch->offset + shift, SEEK_SET)
+           || fwrite(patch->packet, 1, patch->length, fp) != patch->length) {
+            free(block);
+            return ERROR;
+        }
+        end = patch->offset;
+    }
+    free(block);
+    return fseek(fp, 0L, SEEK_END) ? ERROR : SUCCESS;
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+// PARALLEL CONVERSION
+
+// The input is split into chunks at layer changes.  Worker threads convert
+// the chunks ahead of the merge, each starting from the state at the end of the
+// last chunk merged and running the layer before its chunk to settle the
+// position, feedrate and extruder before it gets to the chunk.  The chunks are
+// merged in order: one that didn't start in the state the chunk before it
+// ended in is converted again from the real state, otherwise its extruder steps
+// are redone for the real rounding remainder and its statistics and progress
+// checks are replayed into the real totals, so the output is the same as the
+// serial converter's.  The shadow context of the single-pass converter, when
+// there is one, goes through each chunk alongside.
+
+#define CHUNK_SIZE_MIN 0x10000
+#define CHUNK_SIZE_MAX 0x1000000
+#define CHUNKS_PER_THREAD 8
+#define WARMUP_MIN 0x1000
+
+typedef struct tParallel {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    const char *map;
+    Chunk *chunk;
+    int chunkCount;
+    int next;               // the next chunk for a worker to convert
+    int limit;              // how far ahead of the merge the workers go
+    int stop;
+    Gpx *seed;              // the state at the end of the last chunk merged
+    Gpx *shadowSeed;        // and the shadow's, NULL without one
+    unsigned long seedLine; // input lines before the seed state
+} Parallel;
+
+// is the line a G0 or G1 that moves Z
+
+static int is_layer_change(const char *p, const char *end)
+{
+    unsigned code = 0;
+    int digits = 0;
+
+    while(p < end && isspace(*p)) p++;
+    if(p < end && (*p == 'n' || *p == 'N')) {
+        for(p++; p < end && (isdigit(*p) || isspace(*p)); p++);
+    }
+    if(p == end || (*p != 'g' && *p != 'G')) return 0;
+    for(p++; p < end && isdigit(*p); p++, digits++) code = code * 10 + *p - '0';
+    if(digits == 0 || digits > 2 || code > 1) return 0;
+    for(; p < end && *p != ';' && *p != '('; p++) {
+        if(*p == 'z' || *p == 'Z') return 1;
+    }
+    return 0;
+}
+
+// the offset of the first line that starts at or after offset
+
+static size_t line_after(const char *map, size_t offset, size_t end)
+{
+    const char *eol;
+    if(offset >= end) return end;
+    if(map[offset - 1] == '\n') return offset;
+    eol = memchr(map + offset, '\n', end - offset);
+    return eol ? (size_t)(eol + 1 - map) : end;
+}
+
+// the offset of the first layer change in the lines from offset up to limit,
+// or limit when there isn't one
+
+static size_t next_layer_change(const char *map, size_t offset, size_t limit)
+{
+    while(offset < limit) {
+        const char *eol = memchr(map + offset, '\n', limit - offset);
+        if(eol == NULL) break;
+        if(is_layer_change(map + offset, eol)) return offset;
+        offset = eol + 1 - map;
+    }
+    return limit;
+}
+
+// the offset of the last layer change in the lines from base up to offset, or
+// base when there isn't one
+
+static size_t last_layer_change(const char *map, size_t base, size_t offset)
+{
+    while(offset > base) {
+        size_t start = offset - 1;
+        while(start > base && map[start - 1] != '\n') start--;
+        if(is_layer_change(map + start, map + offset - 1)) return start;
+        offset = start;
+    }
+    return base;
+}
+
+static unsigned long count_lines(const char *p, const char *end)
+{
+    unsigned long lines = 0;
+    while(p < end && (p = memchr(p, '\n', end - p)) != NULL) {
+        lines++;
+        p++;
+    }
+    return lines;
+}
+
+// split the input from base to end into chunks that start at a layer change,
+// returns the number of chunks or -1 when out of memory
+
+static int split_input(Parallel *parallel, size_t base, size_t end, int threads)
+{
+    const char *map = parallel->map;
+    size_t chunkSize = (end - base) / ((size_t)threads * CHUNKS_PER_THREAD);
+    size_t offset = base;
+    int size = 0;
+
+    if(chunkSize < CHUNK_SIZE_MIN) chunkSize = CHUNK_SIZE_MIN;
+    if(chunkSize > CHUNK_SIZE_MAX) chunkSize = CHUNK_SIZE_MAX;
+    while(offset < end) {
+        size_t next = end;
+        Chunk *chunk;
+        if(end - offset > chunkSize + chunkSize / 2) {
+            size_t from = line_after(map, offset + chunkSize, end);
+            next = next_layer_change(map, from, line_after(map, from + chunkSize / 2, end));
+        }
+        if(parallel->chunkCount == size) {
+            chunk = realloc(parallel->chunk, (size += 64) * sizeof(Chunk));
+            if(chunk == NULL) return -1;
+            parallel->chunk = chunk;
+        }
+        chunk = parallel->chunk + parallel->chunkCount;
+        memset(chunk, 0, sizeof(Chunk));
+        chunk->warmup = chunk->start = offset;
+        chunk->end = next;
+        if(parallel->chunkCount > 0) {
+            // the warm up runs over a layer change in the chunk before, from the
+            // one before that so the layer height comes out right too
+            Chunk *previous = chunk - 1;
+            size_t last = offset - previous->start > WARMUP_MIN ? offset - WARMUP_MIN : previous->start;
+            last = last_layer_change(map, previous->start, line_after(map, last, offset));
+            chunk->warmup = last_layer_change(map, previous->start, last);
+            chunk->warmupLine = previous->startLine + count_lines(map + previous->start, map + chunk->warmup);
+            chunk->startLine = chunk->warmupLine + count_lines(map + chunk->warmup, map + offset);
+        }
+        parallel->chunkCount++;
+        offset = next;
+    }
+    return parallel->chunkCount;
+}
+
+static int chunk_handler(Gpx *gpx, Chunk *chunk, char *buffer, size_t length)
+{
+    if(chunk->length + length > chunk->size) {
+        size_t size = chunk->size ? chunk->size * 2 : SPOOL_CHUNK;
+        char *output;
+        while(size < chunk->length + length) size *= 2;
+        if((output = realloc(chunk->output, size)) == NULL) return ERROR;
+        chunk->output = output;
+        chunk->size = size;
+    }
+    memcpy(chunk->output + chunk->length, buffer, length);
+    chunk->length += length;
+    return SUCCESS;
+}
+
+// start the chunk's context from state, a worker can't share the eeprom
+// mappings, the context that converts the chunk from the real state takes them
+
+static void seed_context(Chunk *chunk, Gpx *state)
+{
+    Gpx *gpx = &chunk->gpx;
+
+    memcpy(gpx, state, sizeof(Gpx));
+    if(state->selectedFilename && (gpx->selectedFilename = strdup(state->selectedFilename)) == NULL)
+        chunk->failed = 1;
+    if(chunk->speculative) {
+        if(state->eepromMappingVector != NULL) chunk->failed = 1;
+        gpx->eepromMappingVector = NULL;
+    }
+    else {
+        state->eepromMappingVector = NULL;
+    }
+}
+
+static void seed_chunk(Chunk *chunk, Gpx *state, Gpx *shadowState)
+{
+    seed_context(chunk, state);
+    chunk->shadowing = shadowState != NULL;
+    if(chunk->shadowing) {
+        chunk->shadow->speculative = chunk->speculative;
+        chunk->shadow->failed = 0;
+        seed_context(chunk->shadow, shadowState);
+        if(chunk->shadow->failed) chunk->failed = 1;
+    }
+}
+
+// what the chunk's contexts own
+
+static void release_context(Chunk *chunk)
+{
+    free(chunk->gpx.selectedFilename);
+    if(chunk->gpx.eepromMappingVector != NULL) vector_free(chunk->gpx.eepromMappingVector);
+    chunk->gpx.selectedFilename = NULL;
+    chunk->gpx.eepromMappingVector = NULL;
+    if(chunk->events != NULL) vector_free(chunk->events);
+    if(chunk->steps != NULL) vector_free(chunk->steps);
+    chunk->events = chunk->steps = NULL;
+}
+
+static void release_chunk(Chunk *chunk)
+{
+    release_context(chunk);
+    if(chunk->shadow) release_context(chunk->shadow);
+    free(chunk->output);
+    chunk->output = NULL;
+    chunk->length = chunk->size = 0;
+    if(chunk->log != NULL) fclose(chunk->log);
+    chunk->log = NULL;
+}
+
+// the warm up is done, from here on the output, statistics and progress
+// checks count
+
+static void start_context(Chunk *chunk)
+{
+    Gpx *gpx = &chunk->gpx;
+
+    gpx->accumulated.a = 0.0;
+    gpx->accumulated.b = 0.0;
+    gpx->accumulated.time = 0.0;
+    gpx->accumulated.bytes = 0;
+    chunk->events->c = 0;
+    chunk->steps->c = 0;
+    chunk->logSteps = 1;
+    // the move held at the end of the warm up was written by the chunk before
+    memset(&gpx->held, 0, sizeof(gpx->held));
+    if(chunk->speculative) memcpy(&chunk->startState, gpx, sizeof(Gpx));
+}
+
+static void start_chunk(Chunk *chunk)
+{
+    chunk->gpx.callbackHandler = (int (*)(Gpx*, void*, char*, size_t))chunk_handler;
+    chunk->length = 0;
+    if(chunk->speculative) chunk->logStart = ftell(chunk->gpx.log);
+    start_context(chunk);
+    // only the real context's output goes anywhere
+    if(chunk->shadowing) {
+        start_context(chunk->shadow);
+        chunk->shadow->logSteps = 0;
+    }
+}
+
+static void prepare_context(Chunk *chunk, unsigned long lines, FILE *log)
+{
+    Gpx *gpx = &chunk->gpx;
+
+    gpx->lineNumber += lines;
+    gpx->buffer.ptr = gpx->buffer.out;
+    gpx->chunk = chunk;
+    gpx->callbackHandler = NULL;
+    gpx->callbackData = chunk;
+    gpx->progressMarkVector = NULL;
+    gpx->log = log;
+    chunk->logSteps = 0;
+    if(chunk->events == NULL) chunk->events = vector_create(sizeof(ChunkEvent), 4096, 65536);
+    if(chunk->steps == NULL) chunk->steps = vector_create(sizeof(ChunkSteps), 1024, 65536);
+    if(log == NULL || chunk->events == NULL || chunk->steps == NULL) chunk->failed = 1;
+}
+
+// convert the chunk in the contexts it was seeded with, a speculative chunk
+// runs the warm up first, seedLine is the number of input lines before the
+// seed state
+
+static void convert_chunk(Chunk *chunk, const char *map, unsigned long seedLine, FILE *log)
+{
+    size_t offset = chunk->speculative ? chunk->warmup : chunk->start;
+    unsigned long lines = (chunk->speculative ? chunk->warmupLine : chunk->startLine) - seedLine;
+    char *line = NULL;
+    size_t lineSize = 0;
+    int started = 0;
+
+    chunk->rval = SUCCESS;
+    prepare_context(chunk, lines, log);
+    if(chunk->shadowing) {
+        prepare_context(chunk->shadow, lines, log);
+        if(chunk->shadow->failed) chunk->failed = 1;
+    }
+
+    while(offset < chunk->end && !chunk->failed) {
+        const char *p = map + offset;
+        const char *eol = memchr(p, '\n', chunk->end - offset);
+        size_t length = eol ? (size_t)(eol - p) : chunk->end - offset;
+        if(!started && offset >= chunk->start) {
+            start_chunk(chunk);
+            started = 1;
+        }
+        // the input is shared and the parser writes into the line, the shadow
+        // gets a copy of its own
+        if(2 * (length + 1) > lineSize) {
+            char *buffer = realloc(line, 2 * (length + 1));
+            if(buffer == NULL) {
+                chunk->failed = 1;
+                break;
+            }
+            line = buffer;
+            lineSize = 2 * (length + 1);
+        }
+        memcpy(line, p, length);
+        line[length] = '\0';
+        if(chunk->shadowing) memcpy(line + length + 1, line, length + 1);
+        offset += length + 1;
+        chunk->rval = gpx_convert_line(&chunk->gpx, line);
+        if(chunk->rval == END_OF_FILE || chunk->rval < 0 || chunk->gpx.flag.singlePassFailed) break;
+        if(chunk->shadowing) {
+            int rval = gpx_convert_line(&chunk->shadow->gpx, line + length + 1);
+            if(rval == END_OF_FILE) chunk->shadowing = 0;
+            else if(rval < 0) {
+                chunk->rval = rval;
+                break;
+            }
+            if(chunk->shadow->failed) chunk->failed = 1;
+        }
+    }
+    free(line);
+    // the warm up didn't get as far as the chunk
+    if(!started) chunk->failed = 1;
+    // the layer change at the start of the next chunk writes out the held move
+    else if(chunk->rval == SUCCESS && !chunk->gpx.flag.singlePassFailed) {
+        if(release_held_move(&chunk->gpx) != SUCCESS) chunk->failed = 1;
+        if(chunk->shadowing && release_held_move(&chunk->shadow->gpx) != SUCCESS) chunk->failed = 1;
+    }
+}
+
+static void *chunk_worker(void *arg)
+{
+    Parallel *parallel = arg;
+
+    pthread_mutex_lock(&parallel->mutex);
+    for(;;) {
+        Chunk *chunk;
+        unsigned long seedLine;
+        while(!parallel->stop && (parallel->next >= parallel->limit || parallel->next >= parallel->chunkCount))
+            pthread_cond_wait(&parallel->cond, &parallel->mutex);
+        if(parallel->stop) break;
+        chunk = parallel->chunk + parallel->next++;
+        chunk->state = CHUNK_RUNNING;
+        chunk->speculative = 1;
+        seed_chunk(chunk, parallel->seed, parallel->shadowSeed);
+        seedLine = parallel->seedLine;
+        pthread_mutex_unlock(&parallel->mutex);
+
+        if(!chunk->failed) {
+            chunk->log = tmpfile();
+            convert_chunk(chunk, parallel->map, seedLine, chunk->log);
+        }
+
+        pthread_mutex_lock(&parallel->mutex);
+        chunk->state = CHUNK_DONE;
+        pthread_cond_broadcast(&parallel->cond);
+    }
+    pthread_mutex_unlock(&parallel->mutex);
+    return NULL;
+}
+
+// clear what a line doesn't carry on to the next one and what the merge
+// replaces before the states are compared
+
+static void clear_chunk_state(Gpx *gpx)
+{
+    memset(&gpx->buffer, 0, sizeof(gpx->buffer));
+    // the parser only looks at the words set on the line it is parsing
+    memset(&gpx->command, 0, sizeof(gpx->command));
+    gpx->excess.a = 0.0;
+    gpx->excess.b = 0.0;
+    memset(&gpx->accumulated, 0, sizeof(gpx->accumulated));
+    gpx->selectedFilename = NULL;
+    gpx->eepromMappingVector = NULL;
+    gpx->progressMarkVector = NULL;
+    gpx->chunk = NULL;
+    gpx->callbackHandler = NULL;
+    gpx->callbackData = NULL;
+    gpx->log = NULL;
+}
+
+static int same_chunk_state(Gpx *gpx, Gpx *state)
+{
+    int same = 0;
+    Gpx *copy;
+
+    if(gpx->eepromMappingVector != NULL) return 0;
+    if(gpx->selectedFilename != state->selectedFilename
+       && (gpx->selectedFilename == NULL || state->selectedFilename == NULL
+           || strcmp(gpx->selectedFilename, state->selectedFilename))) return 0;
+    if((copy = malloc(2 * sizeof(Gpx))) != NULL) {
+        memcpy(copy, gpx, sizeof(Gpx));
+        memcpy(copy + 1, state, sizeof(Gpx));
+        clear_chunk_state(copy);
+        clear_chunk_state(copy + 1);
+        same = memcmp(copy, copy + 1, sizeof(Gpx)) == 0;
+        free(copy);
+    }
+    return same;
+}
+
+// redo the extruder steps of the moves before the first reset of the excess
+// starting from the real excess, returns ERROR when a move needs converting
+// again
+
+static int fix_chunk_steps(Chunk *chunk, Point2d *excess)
+{
+    Gpx *gpx = &chunk->gpx;
+    size_t header = gpx->flag.framingEnabled ? 2 : 0;
+    int i;
+
+    for(i = 0; i < chunk->steps->c; i++) {
+        ChunkSteps *steps = vector_get(chunk->steps, i);
+        unsigned char *packet = (unsigned char *)chunk->output + steps->offset + header;
+        int a = (int)extruder_steps(steps->a, gpx->machine.a.steps_per_mm, &excess->a);
+        int b = (int)extruder_steps(steps->b, gpx->machine.b.steps_per_mm, &excess->b);
+        int32_t oldA, oldB;
+        uint32_t value;
+        // the moves merged into one packet
+        while(i + 1 < chunk->steps->c) {
+            ChunkSteps *next = vector_get(chunk->steps, i + 1);
+            if(next->offset != steps->offset) break;
+            a += (int)extruder_steps(next->a, gpx->machine.a.steps_per_mm, &excess->a);
+            b += (int)extruder_steps(next->b, gpx->machine.b.steps_per_mm, &excess->b);
+            i++;
+        }
+        if(steps->offset + header + 21 > chunk->length) return ERROR;
+        if(packet[0] != 139 && packet[0] != 142 && packet[0] != 155) return ERROR;
+        // a queue absolute point has the extruder positions negated
+        if(packet[0] == 139) {
+            a = -a;
+            b = -b;
+        }
+        memcpy(&value, packet + 13, 4);
+        oldA = (int32_t)le32toh(value);
+        memcpy(&value, packet + 17, 4);
+        oldB = (int32_t)le32toh(value);
+        if(a == oldA && b == oldB) continue;
+        // the feedrate of a queue absolute point depends on which axes move
+        if(packet[0] == 139 && (!a != !oldA || !b != !oldB)) return ERROR;
+        value = htole32((uint32_t)a);
+        memcpy(packet + 13, &value, 4);
+        value = htole32((uint32_t)b);
+        memcpy(packet + 17, &value, 4);
+        if(header) packet[packet[-1]] = calculate_crc(packet, packet[-1]);
+    }
+    return SUCCESS;
+}
+
+// is the chunk the real contexts would have converted
+
+static int check_chunk(Chunk *chunk, Gpx *gpx, Gpx *shadow)
+{
+    Point2d excess = gpx->excess;
+
+    if(chunk->failed
+       || !same_chunk_state(gpx, &chunk->startState)
+       || (shadow && !same_chunk_state(shadow, &chunk->shadow->startState))
+       || fix_chunk_steps(chunk, &excess) != SUCCESS) return 0;
+    // the excess was never reset
+    if(chunk->logSteps) chunk->gpx.excess = excess;
+    return 1;
+}
+
+static int write_chunk(File *file, Chunk *chunk)
+{
+    size_t length = chunk->length;
+
+    if(file->spool) {
+        if(file->spoolLength + length > file->spoolSize) {
+            size_t size = file->spoolSize * 2;
+            char *spool;
+            while(size < file->spoolLength + length) size *= 2;
+            if((spool = realloc(file->spool, size)) == NULL) return ERROR;
+            file->spool = spool;
+            file->spoolSize = size;
+        }
+        memcpy(file->spool + file->spoolLength, chunk->output, length);
+        file->spoolLength += length;
+        return SUCCESS;
+    }
+    if(flush_sink(file) != SUCCESS
+       || fwrite(chunk->output, 1, length, file->out) != length
+       || (file->out2 && fwrite(chunk->output, 1, length, file->out2) != length)) return ERROR;
+    return SUCCESS;
+}
+
+// replay the statistics and progress checks of a chunk's context into the
+// real totals
+
+static int replay_events(Gpx *gpx, Chunk *chunk, unsigned long base)
+{
+    int i, rval;
+
+    for(i = 0; i < chunk->events->c; i++) {
+        ChunkEvent *event = vector_get(chunk->events, i);
+        gpx->accumulated.time += event->time;
+        gpx->accumulated.a += event->a;
+        gpx->accumulated.b += event->b;
+        if(event->type == PROGRESS_NONE) continue;
+        // the checks the serial converter wouldn't have made
+        if((event->type == PROGRESS_MOVE || event->type == PROGRESS_START)
+           && gpx->accumulated.time <= 0.0001) continue;
+        gpx->accumulated.bytes = base + event->offset;
+        CALL( mark_build_progress(gpx, event->type, event->percent) );
+    }
+    return SUCCESS;
+}
+
+// copy out the chunk's log, replay it into the real contexts and write out its
+// output
+
+static int merge_chunk(Gpx *gpx, Gpx *shadow, File *file, Chunk *chunk)
+{
+    int rval;
+    unsigned long base = gpx->accumulated.bytes;
+
+    if(chunk->log != NULL && fseek(chunk->log, chunk->logStart, SEEK_SET) == 0) {
+        char block[4096];
+        size_t bytes;
+        while((bytes = fread(block, 1, sizeof(block), chunk->log)) > 0)
+            fwrite(block, 1, bytes, gpx->log);
+    }
+    CALL( replay_events(gpx, chunk, base) );
+    if(shadow) CALL( replay_events(shadow, chunk->shadow, shadow->accumulated.bytes) );
+    gpx->accumulated.bytes = base + chunk->length;
+    return write_chunk(file, chunk);
+}
+
+// carry on from the state at the end of the chunk
+
+static void take_context_state(Gpx *gpx, Chunk *chunk)
+{
+    Gpx *state = &chunk->gpx;
+
+    free(gpx->selectedFilename);
+    if(gpx->eepromMappingVector != NULL) vector_free(gpx->eepromMappingVector);
+    state->accumulated = gpx->accumulated;
+    state->progressMarkVector = gpx->progressMarkVector;
+    state->chunk = NULL;
+    state->callbackHandler = gpx->callbackHandler;
+    state->callbackData = gpx->callbackData;
+    state->log = gpx->log;
+    memcpy(gpx, state, sizeof(Gpx));
+    state->selectedFilename = NULL;
+    state->eepromMappingVector = NULL;
+}
+
+// convert the input in chunks with gpx->threads threads, the output and state
+// are the same as convert_file's
+
+static int convert_parallel(Gpx *gpx, File *file, Gpx *shadow)
+{
+    int i, rval = SUCCESS;
+    int threads = gpx->threads;
+    int workers = 0;
+    Reader *reader = &file->reader;
+    pthread_t *thread = NULL;
+    Chunk *shadowChunk = NULL;
+    Parallel parallel;
+
+    if(reader->map == NULL || gpx->resultHandler) return convert_file(gpx, file, shadow);
+    memset(&parallel, 0, sizeof(parallel));
+    parallel.map = reader->map;
+    if(split_input(&parallel, reader->start, reader->mapLength, threads) < 2) {
+        free(parallel.chunk);
+        return convert_file(gpx, file, shadow);
+    }
+
+    if(gpx->preamble)
+        start_build(gpx, gpx->preamble);
+
+    // the first chunk is converted as it is read and the workers start from
+    // the state it ends in, the input it leaves behind has been parsed in place
+    rval = convert_lines(gpx, file, &shadow, parallel.chunk[1].start);
+    parallel.chunk[1].warmup = parallel.chunk[1].start;
+    parallel.chunk[1].warmupLine = parallel.chunk[1].startLine;
+    if(rval != SUCCESS || gpx->flag.singlePassFailed) goto done;
+    // as each worker does at the end of its chunk
+    rval = release_held_move(gpx);
+    if(rval == SUCCESS && shadow) rval = release_held_move(shadow);
+    if(rval != SUCCESS) goto done;
+
+    thread = malloc(threads * sizeof(pthread_t));
+    parallel.seed = malloc(sizeof(Gpx));
+    if(shadow) {
+        parallel.shadowSeed = malloc(sizeof(Gpx));
+        shadowChunk = calloc(parallel.chunkCount, sizeof(Chunk));
+    }
+    if(thread == NULL || parallel.seed == NULL
+       || (shadow && (parallel.shadowSeed == NULL || shadowChunk == NULL))) {
+        rval = ERROR;
+        goto done;
+    }
+    for(i = 0; shadowChunk && i < parallel.chunkCount; i++) {
+        parallel.chunk[i].shadow = shadowChunk + i;
+    }
+    pthread_mutex_init(&parallel.mutex, NULL);
+    pthread_cond_init(&parallel.cond, NULL);
+    memcpy(parallel.seed, gpx, sizeof(Gpx));
+    if(shadow) memcpy(parallel.shadowSeed, shadow, sizeof(Gpx));
+    parallel.seedLine = parallel.chunk[1].startLine;
+    parallel.next = 1;
+    parallel.limit = 1 + 2 * threads;
+    for(workers = 0; workers < threads; workers++) {
+        if(pthread_create(thread + workers, NULL, chunk_worker, &parallel)) break;
+    }
+
+    for(i = 1; i < parallel.chunkCount; i++) {
+        Chunk *chunk = parallel.chunk + i;
+        int rerun = 0;
+        int chunkRval;
+
+        pthread_mutex_lock(&parallel.mutex);
+        if(chunk->state == CHUNK_WAITING) {
+            // no worker has got to it
+            chunk->state = CHUNK_RUNNING;
+            parallel.next = i + 1;
+            rerun = 1;
+        }
+        else {
+            while(chunk->state != CHUNK_DONE)
+                pthread_cond_wait(&parallel.cond, &parallel.mutex);
+        }
+        pthread_mutex_unlock(&parallel.mutex);
+
+        if(rerun || !check_chunk(chunk, gpx, shadow)) {
+            // convert it from the real state
+            release_chunk(chunk);
+            chunk->speculative = 0;
+            chunk->failed = 0;
+            seed_chunk(chunk, gpx, shadow);
+            if(!chunk->failed) convert_chunk(chunk, parallel.map, chunk->startLine, gpx->log);
+            if(chunk->failed) {
+                rval = ERROR;
+                break;
+            }
+        }
+
+        rval = merge_chunk(gpx, shadow, file, chunk);
+        chunkRval = chunk->rval;
+        pthread_mutex_lock(&parallel.mutex);
+        take_context_state(gpx, chunk);
+        memcpy(parallel.seed, gpx, sizeof(Gpx));
+        if(shadow && chunk->shadowing) {
+            take_context_state(shadow, chunk->shadow);
+            memcpy(parallel.shadowSeed, shadow, sizeof(Gpx));
+        }
+        else if(shadow) {
+            // the shadow has got to the end of the program
+            shadow = NULL;
+            free(parallel.shadowSeed);
+            parallel.shadowSeed = NULL;
+        }
+        parallel.seedLine = i + 1 < parallel.chunkCount ? chunk[1].startLine : 0;
+        parallel.limit = i + 1 + 2 * threads;
+        pthread_cond_broadcast(&parallel.cond);
+        pthread_mutex_unlock(&parallel.mutex);
+        release_chunk(chunk);
+
+        if(rval == SUCCESS) rval = chunkRval;
+        if(rval != SUCCESS || gpx->flag.singlePassFailed) break;
+    }
+    reader->start = i < parallel.chunkCount ? parallel.chunk[i].end : reader->mapLength;
+
+    pthread_mutex_lock(&parallel.mutex);
+    parallel.stop = 1;
+    pthread_cond_broadcast(&parallel.cond);
+    pthread_mutex_unlock(&parallel.mutex);
+    for(i = 0; i < workers; i++) pthread_join(thread[i], NULL);
+    for(i = 0; i < parallel.chunkCount; i++) release_chunk(parallel.chunk + i);
+    pthread_cond_destroy(&parallel.cond);
+    pthread_mutex_destroy(&parallel.mutex);
+
+done:
+    free(parallel.seed);
+    free(parallel.shadowSeed);
+    free(shadowChunk);
+    free(parallel.chunk);
+    free(thread);
+    if(rval < 0) return rval;
+    if(gpx->flag.singlePassFailed) return SUCCESS;
+    return end_file(gpx);
+}
+
+#else
+
+static int convert_parallel(Gpx *gpx, File *file, Gpx *shadow)
+{
+    return convert_file(gpx, file, shadow);
+}
+
+#endif
+
+// Single-pass conversion
+// Converts the input the way the second pass of the multi-pass converter would
+// and patches in the build progress afterwards.  Sets singlePassFailed, with the
+// output and state put back, when the input needs the first pass after all.
+
+static int convert_single_pass(Gpx *gpx, File *file)
+{
+    int rval = SUCCESS;
+    long base = 0;
+    long base2 = 0;
+    vector *patches = NULL;
+    vector *eepromMappingVector = gpx->eepromMappingVector;
+    Gpx *shadow = NULL;
+    Gpx *saved = malloc(sizeof(Gpx));
+
+    gpx->flag.singlePassFailed = 0;
+    if(saved == NULL) return ERROR;
+
+    // hold the output in memory when it can't be patched in place
+    if(file->out == stdout
+       || (base = ftell(file->out)) < 0
+       || (file->out2 && (base2 = ftell(file->out2)) < 0)) {
+        if((file->spool = malloc(SPOOL_CHUNK)) == NULL) {
+            free(saved);
+            return ERROR;
+        }
+        file->spoolLength = 0;
+        file->spoolSize = SPOOL_CHUNK;
+    }
+
+    // start where the second pass would, keeping the eeprom mappings for the
+    // first pass
+    gpx->eepromMappingVector = NULL;
+    *saved = *gpx;
+    gpx_initialize(gpx, 0);
+    gpx->flag.loadMacros = 0;
+    gpx->flag.runMacros = 1;
+    gpx->flag.pausePending = (gpx->commandAtLength > 0);
+    gpx->callbackHandler = (int (*)(Gpx*, void*, char*, size_t))file_handler;
+    gpx->callbackData = file;
+
+    if(eepromMappingVector != NULL || !same_move_state(gpx, saved)) {
+        if((shadow = malloc(sizeof(Gpx))) == NULL) {
+            rval = ERROR;
+            goto done;
+        }
+        *shadow = *saved;
+        shadow->eepromMappingVector = eepromMappingVector;
+        shadow->selectedFilename = NULL;
+        shadow->flag.logMessages = 0;
+    }
+
+    gpx->flag.deferProgress = 1;
+    if(gpx->threads > 1)
+        rval = convert_parallel(gpx, file, shadow);
+    else
+        rval = convert_file(gpx, file, shadow);
+    gpx->flag.deferProgress = 0;
+
+    if(rval == SUCCESS && !gpx->flag.singlePassFailed) {
+        unsigned long length = gpx->accumulated.bytes;
+        // the shadow doesn't get to the end of the file
+        if(shadow) stop_moves(shadow);
+        gpx->total.time = shadow ? shadow->accumulated.time : gpx->accumulated.time;
+        if((patches = vector_create(sizeof(ProgressPatch), 128, 128)) == NULL)
+            rval = ERROR;
+        else
+            rval = patch_build_progress(gpx, patches);
+        if(rval == SUCCESS && !gpx->flag.singlePassFailed) {
+            if(file->spool) {
+                rval = write_spool(file, file->out, patches);
+                if(rval == SUCCESS && file->out2)
+                    rval = write_spool(file, file->out2, patches);
+            }
+            else if((rval = flush_sink(file)) == SUCCESS) {
+                rval = splice_file(file->out, base, length, patches);
+                if(rval == SUCCESS && file->out2)
+                    rval = splice_file(file->out2, base2, length, patches);
+            }
+            gpx->total.length = gpx->accumulated.a + gpx->accumulated.b;
+            gpx->total.time = gpx->accumulated.time;
+            gpx->total.bytes = gpx->accumulated.bytes;
+        }
+    }
+
+    if(rval == SUCCESS && gpx->flag.singlePassFailed) {
+        // put the input, output and state back for the multi-pass converter
+        char *buildName = gpx->buildName;
+        char *selectedFilename = gpx->selectedFilename;
+        rewind_input(file);
+        if(!file->spool) {
+            file->sinkLength = 0;
+            fflush(file->out);
+            if(fseek(file->out, base, SEEK_SET) || ftruncate(fileno(file->out), base)) rval = ERROR;
+            if(file->out2) {
+                fflush(file->out2);
+                if(fseek(file->out2, base2, SEEK_SET) || ftruncate(fileno(file->out2), base2)) rval = ERROR;
+            }
+        }
+        if(gpx->eepromMappingVector != NULL) vector_free(gpx->eepromMappingVector);
+        if(gpx->progressMarkVector != NULL) vector_free(gpx->progressMarkVector);
+        *gpx = *saved;
+        gpx->buildName = buildName;
+        gpx->selectedFilename = selectedFilename;
+        gpx->eepromMappingVector = eepromMappingVector;
+        gpx->flag.singlePassFailed = 1;
+    }
+    else if(eepromMappingVector != NULL) {
+        // the second pass doesn't keep them
+        vector_free(eepromMappingVector);
+    }
+
+done:
+    if(gpx->progressMarkVector != NULL) {
+        vector_free(gpx->progressMarkVector);
+        gpx->progressMarkVector = NULL;
+    }
+    if(patches != NULL) vector_free(patches);
+    if(shadow != NULL) {
+        free(shadow->selectedFilename);
+        free(shadow);
+    }
+    if(file->spool != NULL) {
+        free(file->spool);
+        file->spool = NULL;
+    }
+    free(saved);
+    return rval;
+}
+
+int gpx_convert(Gpx *gpx, FILE *file_in, FILE *file_out, FILE *file_out2)
+{
+    int i, rval;
+    File file;
+    file.in = stdin;
+    file.out = stdout;
+    file.out2 = NULL;
+    file.sinkLength = 0;
+    file.spool = NULL;
+    int logMessages = gpx->flag.logMessages;
+
+    if(file_in && file_in != stdin) {
+        // Multi-pass
+        file.in = file_in;
+        i = 0;
+        gpx->flag.runMacros = 0;
+        gpx->callbackHandler = NULL;
+        gpx->callbackData = NULL;
+    }
+    else {
+        // Single-pass
+        i = 1;
+        gpx->callbackHandler = (int (*)(Gpx*, void*, char*, size_t))file_handler;;
+        gpx->callbackData = &file;
+    }
+
+    if(file_out) {
+        file.out = file_out;
+    }
+
+    file.out2 = file_out2;
+    // without the memory the packets are written one at a time
+    file.sink = malloc(SINK_SIZE);
+    reader_open(&file.reader, file.in);
+
+    // the parse cache is keyed by the input, so it takes a file the reader maps
+    file.cachePath = gpx->cachePath;
+    file.caching = CACHE_OFF;
+    file.replay = 0;
+    cache_init(&file.cache);
+    if(i == 0 && file.cachePath != NULL && gpx->threads <= 1 && file.reader.map != NULL) {
+        file.length = file.reader.mapLength - file.reader.start;
+        file.hash = cache_hash(file.reader.map + file.reader.start, file.length);
+        if(cache_load(&file.cache, file.cachePath, file.hash, file.length) == SUCCESS) {
+            VERBOSE( fprintf(gpx->log, "Converting from the parse cache %s" EOL, file.cachePath) );
+            file.caching = CACHE_REPLAY;
+        }
+        else {
+            file.caching = CACHE_RECORD;
+        }
+    }
+
+    // the parallel converter builds on the single-pass converter
+    if(i == 0 && (gpx->flag.singlePass || gpx->threads > 1)) {
+        rval = convert_single_pass(gpx, &file);
+        if(rval != SUCCESS || !gpx->flag.singlePassFailed) goto done;
+        VERBOSE( fputs("Single-pass conversion not possible, using multi-pass" EOL, gpx->log) );
+    }
+
+    for(;;) {
+        rval = convert_file(gpx, &file, NULL);
+        if(rval != SUCCESS) goto done;
+
+        gpx->total.length = gpx->accumulated.a + gpx->accumulated.b;
+        gpx->total.time = gpx->accumulated.time;
+        gpx->total.bytes = gpx->accumulated.bytes;
+
+        if(++i > 1) break;
+
+        // rewind for second pass
+        rewind_input(&file);
+        gpx_initialize(gpx, 0);
+        gpx->flag.loadMacros = 0;
+        gpx->flag.runMacros = 1;
+        gpx->flag.pausePending = (gpx->commandAtLength > 0);
+        gpx->flag.repeatPass = 1;
+        gpx->callbackHandler = (int (*)(Gpx*, void*, char*, size_t))file_handler;
+        gpx->callbackData = &file;
+    }
+
+done:
+    // what was converted before an error is written out too
+    if(file.sink != NULL) {
+        if(flush_sink(&file) != SUCCESS && rval == SUCCESS) rval = ERROR;
+        free(file.sink);
+    }
+    reader_close(&file.reader);
+    cache_free(&file.cache);
+    gpx->flag.logMessages = logMessages;;
+    gpx->flag.repeatPass = 0;
+    return rval;
+}
+
+char *sd_status[] = {
+    "operation successful",
+    "SD Card not present",
+    "SD Card initialization failed",
+    "partition table could not be read",
+    "filesystem could not be opened",
+    "root directory could not be opened",
+    "SD Card is locked",
+    "file not found",
+    "general error",
+    "changed working dir",
+    "volume too big",
+    "CRC failure",
+    "SD Card read error",
+    "SD operating at low speeds",
+    "unknown status"
+};
+
+char *get_sd_status(unsigned int status)
+{
+    return sd_status[status < 14 ? status : 14];
+}
+
+char *build_status[] = {
+    "no build initialized (boot state)",
+    "build running",
+    "build finished normally",
+    "build paused",
+    "build cancelled",
+    "build sleeping",
+    "unknown status"
+};
+
+char *get_build_status(unsigned int status)
+{
+    return build_status[status < 6 ? status : 6];
+}
+
+static void read_extruder_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buffer)
+{
+    unsigned extruder_id = buffer[EXTRUDER_ID_OFFSET];
+
+    switch(command) {
+            // Query 00 - Query firmware version information
+        case 0:
+            // uint16: Firmware Version
+            sio->response.firmware.version = read_16(gpx);
+            VERBOSE( gpx_log(gpx, "Extruder T%u firmware v%u.%u" EOL,
+                        extruder_id,
+                        sio->response.firmware.version / 100,
+                        sio->response.firmware.version % 100) );
+            break;
+
+            // Query 02 - Get extruder temperature
+        case 2:
+            // int16: Current temperature, in Celsius
+            sio->response.temperature = read_16(gpx);
+            VERBOSE( gpx_log(gpx, "Extruder T%u temperature: %uc" EOL,
+                        extruder_id,
+                        sio->response.temperature) );
+            break;
+
+            // Query 22 - Is extruder ready
+        case 22:
+            // uint8: 1 if ready, 0 otherwise.
+            sio->response.isReady = read_8(gpx);
+            VERBOSE( gpx_log(gpx, "Extruder T%u is%sready" EOL,
+                        extruder_id,
+                        sio->response.isReady ? " " : " not ") );
+            break;
+
+            // Query 30 - Get build platform temperature
+        case 30:
+            // int16: Current temperature, in Celsius
+            sio->response.temperature = read_16(gpx);
+            VERBOSE( gpx_log(gpx, "Build platform T%u temperature: %uc" EOL,
+                        extruder_id,
+                        sio->response.temperature) );
+            break;
+
+            // Query 32 - Get extruder target temperature
+        case 32:
+            // int16: Current temperature, in Celsius
+            sio->response.temperature = read_16(gpx);
+            VERBOSE( gpx_log(gpx, "Extruder T%u target temperature: %uc" EOL,
+                        extruder_id,
+                        sio->response.temperature) );
+            break;
+
+            // Query 33 - Get build platform target temperature
+        case 33:
+            // int16: Current temperature, in Celsius
+            sio->response.temperature = read_16(gpx);
+            VERBOSE( gpx_log(gpx, "Build platform T%u target temperature: %uc" EOL,
+                        extruder_id,
+                        sio->response.temperature) );
+            break;
+
+            // Query 35 - Is build platform ready?
+        case 35:
+            // uint8: 1 if ready, 0 otherwise.
+            sio->response.isReady = read_8(gpx);
+            VERBOSE( gpx_log(gpx, "Build platform T%u is%sready" EOL,
+                        extruder_id,
+                        sio->response.isReady ? " " : " not ") );
+            break;
+
+            // Query 36 - Get extruder status
+        case 36:
+            // uint8: Bitfield containing status information
+            sio->response.extruder.bitfield = read_8(gpx);
+
+            if(gpx->flag.verboseMode && gpx->flag.logMessages) {
+                gpx_log(gpx, "Extruder T%u status" EOL, extruder_id);
+                if(sio->response.extruder.flag.ready) gpx_log(gpx, "Target temperature reached" EOL);
+                if(sio->response.extruder.flag.notPluggedIn) gpx_log(gpx, "The extruder or build plate is not plugged in" EOL);
+                if(sio->response.extruder.flag.softwareCutoff) gpx_log(gpx, "Above maximum allowable temperature recorded: heater shutdown for safety" EOL);
+                if(sio->response.extruder.flag.temperatureDropping) gpx_log(gpx, "Heater temperature dropped below target temperature" EOL);
+                if(sio->response.extruder.flag.buildPlateError) gpx_log(gpx, "An error was detected with the build plate heater or sensor" EOL);
+                if(sio->response.extruder.flag.extruderError) gpx_log(gpx, "An error was detected with the extruder heater or sensor" EOL);
+            }
+            break;
+
+            // Query 37 - Get PID state
+        case 37:
+            // int16: Extruder heater error term
+            sio->response.pid.extruderError = read_16(gpx);
+
+            // int16: Extruder heater delta term
+            sio->response.pid.extruderDelta = read_16(gpx);
+
+            // int16: Extruder heater last output
+            sio->response.pid.extruderOutput = read_16(gpx);
+
+            // int16: Platform heater error term
+            sio->response.pid.buildPlateError = read_16(gpx);
+
+            // int16: Platform heater delta term
+            sio->response.pid.buildPlateDelta = read_16(gpx);
+
+            // int16: Platform heater last output
+            sio->response.pid.buildPlateOutput = read_16(gpx);
+
+            break;
+
+        default:
+            abort();
+    }
+}
+
+void hexdump(FILE *out, char *p, size_t len)
+{
+    while (len--)
+        fprintf(out, "%02x ", (unsigned)(unsigned char)*p++);
     fflush(out);
 }
 
@@ -6140,7 +8122,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 0:
             // uint16: Firmware Version
             sio->response.firmware.version = read_16(gpx);
-            VERBOSE( fprintf(gpx->log, "Motherboard firmware v%u.%u" EOL,
+            VERBOSE( gpx_log(gpx, "Motherboard firmware v%u.%u" EOL,
                         sio->response.firmware.version / 100, sio->response.firmware.version % 100) );
             break;
 
@@ -6161,7 +8143,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 11:
             // uint8: 1 if ready, 0 otherwise.
             sio->response.isReady = read_8(gpx);
-            VERBOSE( fprintf(gpx->log, "Printer is%sready" EOL,
+            VERBOSE( gpx_log(gpx, "Printer is%sready" EOL,
                              sio->response.isReady ? " " : " not ") );
             break;
 
@@ -6182,7 +8164,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 14:
             // uint8: SD response code
             sio->response.sd.status = read_8(gpx);
-            VERBOSE( fprintf(gpx->log, "Capture to file: %s" EOL,
+            VERBOSE( gpx_log(gpx, "Capture to file: %s" EOL,
                         get_sd_status(sio->response.sd.status)) );
             break;
 
@@ -6190,7 +8172,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 15:
             // uint32: Number of bytes captured to file.
             sio->response.sd.length = read_32(gpx);
-            VERBOSE( fprintf(gpx->log, "Capture to file ended: %u bytes written" EOL,
+            VERBOSE( gpx_log(gpx, "Capture to file ended: %u bytes written" EOL,
                         sio->response.sd.length) );
             break;
 
@@ -6198,7 +8180,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 16:
             // uint8: SD response code
             sio->response.sd.status = read_8(gpx);
-            VERBOSE( fprintf(gpx->log, "Play back captured file: %d, %s" EOL,
+            VERBOSE( gpx_log(gpx, "Play back captured file: %d, %s" EOL,
                         sio->response.sd.status, get_sd_status(sio->response.sd.status)) );
             break;
 
@@ -6209,7 +8191,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
             /* 1+N bytes: Name of the next file, in ASCII, terminated with a null character.
                           If the operation was unsuccessful, this will be a null character */
             strncpy0(sio->response.sd.filename, gpx->buffer.ptr, 65);
-            VERBOSE( fprintf(gpx->log, "Get next filename: '%s' %s" EOL,
+            VERBOSE( gpx_log(gpx, "Get next filename: '%s' %s" EOL,
                         sio->response.sd.filename,
                         get_sd_status(sio->response.sd.status)) );
             break;
@@ -6218,7 +8200,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 20:
             // 1+N bytes: A null terminated string representing the filename of the current build.
             strncpy0(sio->response.sd.filename, gpx->buffer.ptr, 65);
-            VERBOSE( fprintf(gpx->log, "Get build name: '%s'" EOL, sio->response.sd.filename) );
+            VERBOSE( gpx_log(gpx, "Get build name: '%s'" EOL, sio->response.sd.filename) );
             break;
 
             // 21 - Get extended position
@@ -6242,24 +8224,24 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
             sio->response.position.endstop.bitfield = read_16(gpx);
 
             if(gpx->flag.verboseMode && gpx->flag.logMessages) {
-                fputs("Current position" EOL, gpx->log);
-                fprintf(gpx->log, "X = %0.2fmm%s%s" EOL,
+                gpx_log(gpx, "Current position" EOL);
+                gpx_log(gpx, "X = %0.2fmm%s%s" EOL,
                         (double)sio->response.position.x / gpx->machine.x.steps_per_mm,
                         sio->response.position.endstop.flag.xMax ? ", at max endstop" : "",
                         sio->response.position.endstop.flag.xMin ? ", at min endstop" : "");
-                fprintf(gpx->log, "Y = %0.2fmm%s%s" EOL,
+                gpx_log(gpx, "Y = %0.2fmm%s%s" EOL,
                         (double)sio->response.position.y / gpx->machine.y.steps_per_mm,
                         sio->response.position.endstop.flag.yMax ? ", at max endstop" : "",
                         sio->response.position.endstop.flag.yMin ? ", at min endstop" : "");
-                fprintf(gpx->log, "Z = %0.2fmm%s%s" EOL,
+                gpx_log(gpx, "Z = %0.2fmm%s%s" EOL,
                         (double)sio->response.position.z / gpx->machine.z.steps_per_mm,
                         sio->response.position.endstop.flag.zMax ? ", at max endstop" : "",
                         sio->response.position.endstop.flag.zMin ? ", at min endstop" : "");
-                fprintf(gpx->log, "A = %0.2fmm%s%s" EOL,
+                gpx_log(gpx, "A = %0.2fmm%s%s" EOL,
                         (double)sio->response.position.a / gpx->machine.a.steps_per_mm,
                         sio->response.position.endstop.flag.aMax ? ", at max endstop" : "",
                         sio->response.position.endstop.flag.aMin ? ", at min endstop" : "");
-                fprintf(gpx->log, "B = %0.2fmm%s%s" EOL,
+                gpx_log(gpx, "B = %0.2fmm%s%s" EOL,
                         (double)sio->response.position.b / gpx->machine.b.steps_per_mm,
                         sio->response.position.endstop.flag.bMax ? ", at max endstop" : "",
                         sio->response.position.endstop.flag.bMin ? ", at min endstop" : "");
@@ -6270,7 +8252,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
         case 22:
             // int8: 0 (reserved for future use)
             read_8(gpx);
-            VERBOSE( fputs("Build stopped" EOL, gpx->log) );
+            VERBOSE( gpx_log(gpx, "Build stopped" EOL) );
             break;
 
             // 23 - Get motherboard status
@@ -6278,15 +8260,15 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
             // uint8: bitfield containing status information
             sio->response.motherboard.bitfield = read_8(gpx);
             if(gpx->flag.verboseMode && gpx->flag.logMessages) {
-                fputs("Motherboard status" EOL, gpx->log);
-                if(sio->response.motherboard.flag.preheat) fputs("Onboard preheat active" EOL, gpx->log);
-                if(sio->response.motherboard.flag.manualMode) fputs("Manual move active" EOL, gpx->log);
-                if(sio->response.motherboard.flag.onboardScript) fputs("Running onboard script" EOL, gpx->log);
-                if(sio->response.motherboard.flag.onboardProcess) fputs("Running onboard process" EOL, gpx->log);
-                if(sio->response.motherboard.flag.waitForButton) fputs("Waiting for buttons press" EOL, gpx->log);
-                if(sio->response.motherboard.flag.buildCancelling) fputs("Build cancelling" EOL, gpx->log);
-                if(sio->response.motherboard.flag.heatShutdown) fputs("Heaters were shutdown after 30 minutes of inactivity" EOL, gpx->log);
-                if(sio->response.motherboard.flag.powerError) fputs("Error detected in system power" EOL, gpx->log);
+                gpx_log(gpx, "Motherboard status" EOL);
+                if(sio->response.motherboard.flag.preheat) gpx_log(gpx, "Onboard preheat active" EOL);
+                if(sio->response.motherboard.flag.manualMode) gpx_log(gpx, "Manual move active" EOL);
+                if(sio->response.motherboard.flag.onboardScript) gpx_log(gpx, "Running onboard script" EOL);
+                if(sio->response.motherboard.flag.onboardProcess) gpx_log(gpx, "Running onboard process" EOL);
+                if(sio->response.motherboard.flag.waitForButton) gpx_log(gpx, "Waiting for buttons press" EOL);
+                if(sio->response.motherboard.flag.buildCancelling) gpx_log(gpx, "Build cancelling" EOL);
+                if(sio->response.motherboard.flag.heatShutdown) gpx_log(gpx, "Heaters were shutdown after 30 minutes of inactivity" EOL);
+                if(sio->response.motherboard.flag.powerError) gpx_log(gpx, "Error detected in system power" EOL);
             }
             break;
 
@@ -6307,7 +8289,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
             // uint32: Reserved for future use
             read_32(gpx);
 
-            VERBOSE( fprintf(gpx->log, "(line %u) Build status: %s, %u hours, %u minutes" EOL,
+            VERBOSE( gpx_log(gpx, "(line %u) Build status: %s, %u hours, %u minutes" EOL,
                         sio->response.build.lineNumber,
                         get_build_status(sio->response.build.status),
                         sio->response.build.hours,
@@ -6332,7 +8314,7 @@ static void read_query_response(Gpx *gpx, Sio *sio, unsigned command, char *buff
             read_16(gpx);
 
             if(gpx->flag.verboseMode && gpx->flag.logMessages) {
-                fprintf(gpx->log, "%s firmware v%u.%u" EOL, get_firmware_variant(sio->response.firmware.variant),
+                gpx_log(gpx, "%s firmware v%u.%u" EOL, get_firmware_variant(sio->response.firmware.variant),
                         sio->response.firmware.version / 100, sio->response.firmware.version % 100);
             }
             break;
@@ -6361,19 +8343,288 @@ size_t readport(int port, char *buffer, size_t bytes)
     if(rval <= 0)
         return rval;
 
-    // wait up to 1/10th intercharacter (from VTIME)
+    // whatever has arrived, up to bytes
     return read(port, buffer, bytes);
 }
 #endif
 
-int port_handler(Gpx *gpx, Sio *sio, char *buffer, size_t length)
+// read a response packet into gpx->buffer.in
+//
+// Whatever the port has is read into the receive buffer in one go, frames are
+// parsed from it, so a response usually takes one select and one read rather
+// than a pair for each of its start byte, length and payload.  Anything before
+// a start byte is skipped, a frame that fails its CRC is dropped whole.
+
+#define RECEIVE_BYTE(sio, i) ((sio)->receive.buffer[((sio)->receive.head + (i)) % SIO_RECEIVE])
+
+static int read_response(Gpx *gpx, Sio *sio)
+{
+    VERBOSESIO( gpx_log(gpx, EOL "port_handler read:" EOL) );
+    for(;;) {
+        unsigned available = sio->receive.tail - sio->receive.head;
+        size_t want = 1;
+        // skip to a start byte, a second start byte in place of the length
+        // starts the frame again
+        while(available && (RECEIVE_BYTE(sio, 0) != 0xD5 ||
+                            (available > 1 && RECEIVE_BYTE(sio, 1) == 0xD5))) {
+            sio->receive.head++;
+            available--;
+        }
+        if(available > 1) {
+            unsigned payload_length = RECEIVE_BYTE(sio, 1);
+            if(available >= payload_length + 3) {
+                unsigned i;
+                for(i = 0; i < payload_length + 3; i++) {
+                    gpx->buffer.in[i] = RECEIVE_BYTE(sio, i);
+                }
+                sio->receive.head += payload_length + 3;
+                VERBOSESIO( hexdump(gpx->log, gpx->buffer.in, payload_length + 3) );
+                VERBOSESIO( gpx_log(gpx, EOL) );
+                // check CRC
+                unsigned crc = (unsigned char)gpx->buffer.in[2 + payload_length];
+                if(crc != calculate_crc((unsigned char*)gpx->buffer.in + 2, payload_length)) {
+                    return ESIOCRC;
+                }
+                return SUCCESS;
+            }
+            want = payload_length + 3 - available;
+        }
+        else if(available) {
+            want = 2;
+        }
+
+        // fill the receive buffer up to the oldest unparsed byte
+        unsigned tail = sio->receive.tail % SIO_RECEIVE;
+        size_t room = SIO_RECEIVE - available;
+        if(room > SIO_RECEIVE - tail) room = SIO_RECEIVE - tail;
+#if defined(_WIN32) || defined(_WIN64)
+        // a read waits out its interval timeout for more than has arrived
+        if(room > want) room = want;
+#endif
+        ssize_t bytes = readport(sio->port, (char *)sio->receive.buffer + tail, room);
+        if(bytes == -1) {
+            return EOSERROR;
+        }
+        else if(bytes == 0) {
+            VERBOSESIO( gpx_log(gpx, EOL "want %u bytes = 0" EOL, (unsigned)want) );
+            return available ? ESIOREAD : ESIOTIMEOUT;
+        }
+        sio->receive.tail += (unsigned)bytes;
+        sio->bytes_in += (unsigned)bytes;
+    }
+}
+
+// The printer's buffer is modelled from the packets sent to it: each move
+// takes the time the move's packet gives, distance over feedrate for a 155, the
+// duration of a 142 or a delay, and packets run one after the other, so it's
+// known when enough of them are done to make room for the next.  The firmware
+// accelerates and decelerates, so the moves take longer than that, whenever
+// the printer is asked how much room it has the moves the model still holds
+// are taken to start over from then.  Homing, waits and moves given as a DDA
+// take as long as they take, the model can't see past them.
+
+#define QUEUE_SLOT(sio, i) (((sio)->queue.first + (i)) % SIO_QUEUE)
+#define QUEUE_CHECK 1.0     // seconds the model goes without asking the printer
+
+static uint32_t packet_32(const char *packet, unsigned offset)
+{
+    union {
+        uint32_t i;
+        unsigned char b[4];
+    } u;
+    memcpy(u.b, packet + COMMAND_OFFSET + offset, 4);
+    return le32toh(u.i);
+}
+
+// seconds the printer takes over an action packet
+
+static double packet_duration(const char *packet)
+{
+    switch((unsigned char)packet[COMMAND_OFFSET]) {
+        case 133:   // delay
+            return packet_32(packet, 1) / 1000.0;
+        case 142:   // move with a duration
+            return packet_32(packet, 21) / 1000000.0;
+        case 155: { // move with distance and feedrate
+            union {
+                uint32_t i;
+                float f;
+            } distance;
+            unsigned feedrate = (unsigned char)packet[COMMAND_OFFSET + 30]
+                | (unsigned char)packet[COMMAND_OFFSET + 31] << 8;
+            distance.i = packet_32(packet, 26);
+            if(feedrate == 0) return HUGE_VAL;
+            return distance.f * 64.0 / feedrate;
+        }
+        case 149:   // display message, waits when it asks for the button
+            return packet[COMMAND_OFFSET + 1] & 0x04 ? HUGE_VAL : 0.0;
+        case 131:   // find axes minimums
+        case 132:   // find axes maximums
+        case 135:   // wait for toolhead
+        case 139:   // move with a DDA
+        case 141:   // wait for platform
+        case 148:   // wait for button
+        case 152:   // reset to factory
+            return HUGE_VAL;
+    }
+    return 0.0;
+}
+
+static void queue_reset(Sio *sio)
+{
+    sio->queue.first = 0;
+    sio->queue.count = 0;
+    sio->queue.queued = 0;
+    sio->queue.capacity = -1;
+    sio->queue.room = 0;
+    sio->queue.start = 0.0;
+    sio->queue.checked = 0.0;
+}
+
+static void queue_pop(Sio *sio)
+{
+    unsigned slot = sio->queue.first;
+    sio->queue.start += sio->queue.duration[slot];
+    sio->queue.queued -= sio->queue.length[slot];
+    sio->queue.first = QUEUE_SLOT(sio, 1);
+    sio->queue.count--;
+}
+
+// drop the packets that are done by now
+
+static void queue_retire(Sio *sio, double now)
+{
+    while(sio->queue.count && sio->queue.start + sio->queue.duration[sio->queue.first] <= now) {
+        queue_pop(sio);
+    }
+}
+
+static void queue_push(Sio *sio, const char *packet, size_t length, double now)
+{
+    unsigned slot;
+    queue_retire(sio, now);
+    if(sio->queue.count == 0) {
+        sio->queue.start = now;
+    }
+    else if(sio->queue.count == SIO_QUEUE) {
+        queue_pop(sio);
+    }
+    slot = QUEUE_SLOT(sio, sio->queue.count);
+    sio->queue.length[slot] = (unsigned short)length;
+    sio->queue.duration[slot] = packet_duration(packet);
+    sio->queue.queued += (long)length;
+    sio->queue.room -= (long)length;
+    sio->queue.count++;
+}
+
+// the printer says it has room for free bytes
+
+static void queue_check(Sio *sio, long free, double now)
+{
+    // it's never seen with more room than its size
+    if(sio->queue.capacity < free) {
+        sio->queue.capacity = free;
+    }
+    // what it's done that the model hasn't
+    while(sio->queue.count && sio->queue.queued > sio->queue.capacity - free) {
+        queue_pop(sio);
+    }
+    sio->queue.start = now;
+    sio->queue.checked = now;
+    sio->queue.room = free;
+}
+
+// when there will be room for length bytes on the host clock, HUGE_VAL when
+// it can't be told
+
+static double queue_room(Sio *sio, size_t length, double now)
+{
+    double when = sio->queue.start;
+    long queued = sio->queue.queued;
+    unsigned i;
+
+    if(sio->queue.capacity < 0) return HUGE_VAL;
+    queue_retire(sio, now);
+    if(sio->queue.capacity - queued >= (long)length) return now;
+    for(i = 0; i < sio->queue.count; i++) {
+        unsigned slot = QUEUE_SLOT(sio, i);
+        when += sio->queue.duration[slot];
+        queued -= sio->queue.length[slot];
+        if(sio->queue.capacity - queued >= (long)length) break;
+    }
+    return i < sio->queue.count ? when : HUGE_VAL;
+}
+
+// sleep until when on the host clock, or for as long as the model goes
+// without asking the printer, returns the nanoseconds slept
+
+static long sleep_until(double when, double now)
+{
+    long nsec = 0;
+    if(when - now >= QUEUE_CHECK) {
+        nsec = (long)(QUEUE_CHECK * 1e9) - 1;
+    }
+    else if(when > now) {
+        nsec = (long)((when - now) * 1e9);
+    }
+    if(nsec) short_sleep(nsec);
+    return nsec;
+}
+
+// the printer turned a packet away for want of room, ask it how much it has
+// and wait for when the model says there will be enough
+
+static int wait_for_room(Gpx *gpx, Sio *sio, size_t length)
+{
+    int rval;
+    unsigned queries = 0;
+    long waited = 0;
+
+    for(;;) {
+        CALL( port_handler(gpx, sio, buffer_size_query, 4) );
+        queries++;
+        if(sio->response.bufferSize >= length) break;
+        if(sio->flag.shortRetryBufferOverflowOnly && waited >= 20 * NS_10MS) {
+            return 0x82;
+        }
+        double now = host_time();
+        double when = queue_room(sio, length, now);
+        if(when == HUGE_VAL) {
+            short_sleep(NS_100MS);
+            waited += NS_100MS;
+        }
+        else if(when - now < 0.01) {
+            // the printer is behind the model
+            short_sleep(NS_10MS);
+            waited += NS_10MS;
+        }
+        else {
+            waited += sleep_until(when, now);
+        }
+    }
+    VERBOSE( gpx_log(gpx, "(%u) Query buffer size: %u\n", queries, sio->response.bufferSize) );
+    return SUCCESS;
+}
+
+static void count_response(Sio *sio, double sent)
+{
+    double time = host_time() - sent;
+    sio->stats.responses++;
+    sio->stats.responseTime += time;
+    if(time > sio->stats.responseMax) sio->stats.responseMax = time;
+}
+
+// send a packet and wait for its response, retrying what the printer asks to
+// have sent again
+
+static int send_and_wait(Gpx *gpx, Sio *sio, char *buffer, size_t length)
 {
     int rval = SUCCESS;
     if(length) {
         size_t bytes;
         int retry_count = 0;
         do {
-            VERBOSESIO( fprintf(gpx->log, "port_handler write: %lu" EOL, (unsigned long)length) );
+            VERBOSESIO( gpx_log(gpx, "port_handler write: %lu" EOL, (unsigned long)length) );
             VERBOSESIO( hexdump(gpx->log, buffer, length) );
             // send the packet
             if((bytes = write(sio->port, buffer, length)) == -1) {
@@ -6383,59 +8634,23 @@ int port_handler(Gpx *gpx, Sio *sio, char *buffer, size_t length)
                 return ESIOWRITE;
             }
             sio->bytes_out += length;
-
-            VERBOSESIO( fprintf(gpx->log, EOL "port_handler read:" EOL) );
-            for(;;) {
-                // read start byte
-                if((bytes = readport(sio->port, gpx->buffer.in, 1)) == -1) {
-                    return EOSERROR;
-                }
-                else if(bytes != 1) {
-                    VERBOSESIO( fprintf(gpx->log, EOL "want 1 bytes = %u" EOL, (unsigned)bytes) );
-                    if(bytes == 0)
-                        return ESIOTIMEOUT;
-                    return ESIOREAD;
-                }
-                VERBOSESIO( hexdump(gpx->log, gpx->buffer.in, bytes) );
-                // loop until we get a valid start byte
-                if((unsigned char)gpx->buffer.in[0] == 0xD5) break;
-            }
-            size_t payload_length = 0;
-            do {
-                // read length
-                if((bytes = readport(sio->port, gpx->buffer.in + 1, 1)) == -1) {
-                    return EOSERROR;
-                }
-                else if(bytes != 1) {
-                    VERBOSESIO( fprintf(gpx->log, EOL "want 1 bytes = %u" EOL, (unsigned)bytes) );
-                    return ESIOREAD;
-                }
-                VERBOSESIO( hexdump(gpx->log, gpx->buffer.in, bytes) );
-                payload_length = gpx->buffer.in[1];
-            } while ((unsigned char)gpx->buffer.in[1] == 0xd5);
-            // recieve payload
-            if((bytes = readport(sio->port, gpx->buffer.in + 2, payload_length + 1)) == -1) {
-                return EOSERROR;
-            }
-            VERBOSESIO( hexdump(gpx->log, gpx->buffer.in + 2, bytes) );
-            VERBOSESIO( fprintf(gpx->log, EOL) );
-            if(bytes != payload_length + 1) {
-                VERBOSESIO( fprintf(gpx->log, EOL "want %u bytes = %u" EOL, (unsigned)payload_length + 1, (unsigned)bytes) );
-                return ESIOREAD;
-            }
-            // check CRC
-            unsigned crc = (unsigned char)gpx->buffer.in[2 + payload_length];
-            if(crc != calculate_crc((unsigned char*)gpx->buffer.in + 2, payload_length)) {
-                fprintf(gpx->log, "(retry %u) Input CRC mismatch: packet discarded" EOL, retry_count);
-                rval = ESIOCRC;
+            sio->stats.packets++;
+            sio->stats.writes++;
+            double sent = host_time();
+
+            rval = read_response(gpx, sio);
+            if(rval == SUCCESS || rval == ESIOCRC) count_response(sio, sent);
+            if(rval == ESIOCRC) {
+                gpx_log(gpx, "(retry %u) Input CRC mismatch: packet discarded" EOL, retry_count);
                 goto L_RETRY;
             }
+            if(rval != SUCCESS) return rval;
             // check response code
             rval = (int)(unsigned char)gpx->buffer.in[2];
             switch(rval) {
                     // 0x80 - Generic Packet error, packet discarded (retry)
                 case 0x80:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Generic Packet error: packet discarded" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Generic Packet error: packet discarded" EOL, retry_count) );
                     break;
 
                     // 0x81 - Success
@@ -6449,78 +8664,42 @@ int port_handler(Gpx *gpx, Sio *sio, char *buffer, size_t length)
 
                     // 0x82 - Action buffer overflow, entire packet discarded
                 case 0x82:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Action buffer overflow\n", retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Action buffer overflow\n", retry_count) );
                     if(!sio->flag.retryBufferOverflow)
                         goto L_ABORT;
 
-                    // first, harass the bot in a tight loop in case we're
-                    // doing lots of short movements. On the one hand, we're
-                    // making it worse by making the bot take time on serial
-                    // i/o. On the other hand we want to make sure we send the
-                    // next command into the buffer as soon as possible so we
-                    // don't get a zit because of a sleep on our side
-                    //
-                    // twenty times, check for room every 10ms
-                    int i;
-                    for(i = 0; i < 20; i++) {
-                        short_sleep(NS_10MS);
-
-                        // query buffer size
-                        CALL( port_handler(gpx, sio, buffer_size_query, 4) );
-
-                        // if we now have room, let's go again
-                        if (sio->response.bufferSize >= length)
-                            goto L_REPEATSEND;
-                    }
-
-                    if(sio->flag.shortRetryBufferOverflowOnly) {
-                        rval = 0x82; // recursion cleared it, put it back
-                        goto L_ABORT;
-                    }
-
-                    // now, wait until we've got room for the command, checking
-                    // every 1/10 second
-                    do {
-                        short_sleep(NS_100MS);
-                        // query buffer size
-                        buffer_size_query[3] = calculate_crc((unsigned char *)buffer_size_query + 2, 1);
-                        CALL( port_handler(gpx, sio, buffer_size_query, 4) );
-                        i++;
-                        // loop until buffer has space for the next command
-                    } while(sio->response.bufferSize < length);
-L_REPEATSEND:
-                    VERBOSE( fprintf(gpx->log, "(%u) Query buffer size: %u\n", i, sio->response.bufferSize) );
+                    CALL( wait_for_room(gpx, sio, length) );
                     // we just did all the waiting we needed, skip the 2 second timeout
                     continue;
 
                     // 0x83 - CRC mismatch, packet discarded. (retry)
                 case 0x83:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Output CRC mismatch: packet discarded" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Output CRC mismatch: packet discarded" EOL, retry_count) );
                     break;
 
                     // 0x84 - Query packet too big, packet discarded
                 case 0x84:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Query packet too big: packet discarded" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Query packet too big: packet discarded" EOL, retry_count) );
                     goto L_ABORT;
 
                     // 0x85 - Command not supported/recognized
                 case 0x85:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Command not supported or recognized" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Command not supported or recognized" EOL, retry_count) );
                     goto L_ABORT;
 
                     // 0x87 - Downstream timeout
                 case 0x87:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Downstream timeout" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Downstream timeout" EOL, retry_count) );
                     goto L_ABORT;
 
                     // 0x88 - Tool lock timeout (retry)
                 case 0x88:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Tool lock timeout" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Tool lock timeout" EOL, retry_count) );
                     break;
 
                     // 0x89 - Cancel build (retry)
                 case 0x89:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Cancel build" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Cancel build" EOL, retry_count) );
                     // I think this means the build was cancelled from the LCD
                     // panel or the bot overheated, we should bail out.  Is
                     // there a way to confirm the cancel?
@@ -6528,17 +8707,17 @@ L_REPEATSEND:
 
                     // 0x8A - Bot is building from SD
                 case 0x8A:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Bot is Building from SD card" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Bot is Building from SD card" EOL, retry_count) );
                     goto L_ABORT;
 
                     // 0x8B - Bot is shutdown due to overheating
                 case 0x8B:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Bot is shutdown due to overheating" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Bot is shutdown due to overheating" EOL, retry_count) );
                     goto L_ABORT;
 
                     // 0x8C - Packet timeout error, packet discarded (retry)
                 case 0x8C:
-                    VERBOSE( fprintf(gpx->log, "(retry %u) Packet timeout error: packet discarded" EOL, retry_count) );
+                    VERBOSE( gpx_log(gpx, "(retry %u) Packet timeout error: packet discarded" EOL, retry_count) );
                     break;
             }
 L_RETRY:
@@ -6551,6 +8730,435 @@ L_ABORT:
     return rval;
 }
 
+// Moves go out ahead of their responses, up to serialWindow of them and no
+// more bytes than the printer last said it had room for, so none are turned
+// away for want of room.  The printer answers each packet in turn,
+// anything other than a move waits for the moves ahead of it to be answered.
+// A move is held back for up to serialGather milliseconds while there's room
+// for more, so a run of them goes out in one write.
+
+#define WINDOW_SLOT(sio, i) (((sio)->window.first + (i)) % SIO_WINDOW)
+
+static int is_move_packet(const char *packet)
+{
+    unsigned command = (unsigned char)packet[COMMAND_OFFSET];
+    return command == 139 || command == 142 || command == 155;
+}
+
+static int is_retry_response(int rval)
+{
+    switch(rval) {
+        case ESIOCRC:
+        case 0x80:
+        case 0x82:
+        case 0x83:
+        case 0x88:
+        case 0x8C:
+            return 1;
+    }
+    return 0;
+}
+
+// the response to the i'th packet in flight
+
+static int window_response(Gpx *gpx, Sio *sio, unsigned i)
+{
+    int rval = read_response(gpx, sio);
+    if(rval == SUCCESS || rval == ESIOCRC) {
+        count_response(sio, sio->window.time[WINDOW_SLOT(sio, i)]);
+    }
+    if(rval == SUCCESS) rval = (int)(unsigned char)gpx->buffer.in[2];
+    return rval;
+}
+
+static void window_reset(Sio *sio)
+{
+    sio->window.first = 0;
+    sio->window.count = 0;
+    sio->window.sent = 0;
+}
+
+// write the packets held back in one go
+
+static int window_write(Gpx *gpx, Sio *sio)
+{
+    char data[SIO_WINDOW * SIO_PACKET_MAX];
+    size_t length = 0;
+    unsigned i;
+
+    if(sio->window.sent == sio->window.count) return SUCCESS;
+    for(i = sio->window.sent; i < sio->window.count; i++) {
+        unsigned slot = WINDOW_SLOT(sio, i);
+        memcpy(data + length, sio->window.packet[slot], sio->window.length[slot]);
+        length += sio->window.length[slot];
+    }
+    VERBOSESIO( gpx_log(gpx, "port_handler write: %lu in %u packets" EOL, (unsigned long)length, sio->window.count - sio->window.sent) );
+    VERBOSESIO( hexdump(gpx->log, data, length) );
+    ssize_t bytes = write(sio->port, data, length);
+    if(bytes != length) {
+        // what wasn't written isn't coming back, hear out what was
+        sio->window.count = sio->window.sent;
+        port_flush(gpx, sio);
+        return bytes == -1 ? EOSERROR : ESIOWRITE;
+    }
+    double now = host_time();
+    for(i = sio->window.sent; i < sio->window.count; i++) {
+        sio->window.time[WINDOW_SLOT(sio, i)] = now;
+    }
+    sio->bytes_out += length;
+    sio->stats.packets += sio->window.count - sio->window.sent;
+    sio->stats.writes++;
+    sio->window.sent = sio->window.count;
+    return SUCCESS;
+}
+
+void port_reset(Sio *sio)
+{
+    window_reset(sio);
+    queue_reset(sio);
+    sio->receive.head = 0;
+    sio->receive.tail = 0;
+    memset(&sio->stats, 0, sizeof(sio->stats));
+}
+
+// the oldest move in flight was turned away, the ones after it are heard out
+// and if the printer turned them all away too they're sent again in order.
+// If it took any of them it has gone past the one it turned away, that can't
+// be put right without changing the print, so the print is stopped.
+
+static int resend_window(Gpx *gpx, Sio *sio, int rval)
+{
+    unsigned i, count = sio->window.count;
+    unsigned taken = 0;     // the packets the printer took after the first it turned away
+
+    for(i = 1; i < count; i++) {
+        int response = window_response(gpx, sio, i);
+        if(response == 0x81) {
+            taken++;
+        }
+        else if(!is_retry_response(response)) {
+            if(response > 0) {
+                while(++i < count) window_response(gpx, sio, i);
+            }
+            window_reset(sio);
+            return response;
+        }
+    }
+    if(taken) {
+        gpx_log(gpx, "Error: the printer turned away a move (0x%02x) but took %u after it, stopping the print" EOL, rval & 0xFF, taken);
+        window_reset(sio);
+        return ESIOFRAME;
+    }
+    // the slots keep their packets until the next one is queued
+    sio->window.count = 0;
+    sio->window.sent = 0;
+    for(i = 0; i < count; i++) {
+        unsigned slot = WINDOW_SLOT(sio, i);
+        VERBOSE( gpx_log(gpx, "(retry) Resending packet turned away" EOL) );
+        CALL( send_and_wait(gpx, sio, sio->window.packet[slot], sio->window.length[slot]) );
+    }
+    sio->window.first = 0;
+    return SUCCESS;
+}
+
+// wait for the response to the oldest packet in flight
+
+static int collect_response(Gpx *gpx, Sio *sio)
+{
+    int rval;
+    unsigned i;
+
+    // the printer has nothing to say about what it hasn't been sent
+    CALL( window_write(gpx, sio) );
+    rval = window_response(gpx, sio, 0);
+    if(rval == 0x81) {
+        sio->window.first = WINDOW_SLOT(sio, 1);
+        sio->window.count--;
+        sio->window.sent--;
+        return SUCCESS;
+    }
+    if(is_retry_response(rval)) {
+        return resend_window(gpx, sio, rval);
+    }
+    // the printer isn't taking any more, hear out the rest if it can be heard
+    if(rval > 0) {
+        for(i = 1; i < sio->window.count; i++) window_response(gpx, sio, i);
+    }
+    window_reset(sio);
+    return rval;
+}
+
+// send a packet with none in flight, keeping the queue model up to date
+
+static int send_one(Gpx *gpx, Sio *sio, char *buffer, size_t length)
+{
+    int rval = send_and_wait(gpx, sio, buffer, length);
+
+    if(rval == SUCCESS) {
+        if(buffer[COMMAND_OFFSET] == 2) {
+            queue_check(sio, sio->response.bufferSize, host_time());
+        }
+        else if(buffer[COMMAND_OFFSET] & 0x80) {
+            queue_push(sio, buffer, length, host_time());
+        }
+    }
+    return rval;
+}
+
+int port_send(Gpx *gpx, Sio *sio)
+{
+    return window_write(gpx, sio);
+}
+
+// whether the printer has started on an answer, so reading it won't wait
+
+static int port_answering(Sio *sio)
+{
+    if(sio->receive.tail != sio->receive.head) return 1;
+#if defined(_WIN32) || defined(_WIN64)
+    return 1;
+#else
+    fd_set fds;
+    struct timeval tv;
+
+    FD_ZERO(&fds);
+    FD_SET(sio->port, &fds);
+    tv.tv_sec = 0;
+    tv.tv_usec = 0;
+    return select(sio->port + 1, &fds, NULL, NULL, &tv) > 0;
+#endif
+}
+
+// whether port_handler would take the packet without waiting on the printer,
+// for callers with better things to do than wait.  *when is 0 if so, HUGE_VAL
+// when it's waiting on the printer to answer what's in flight, otherwise when
+// to try again on the host clock, the printer is asked for its room once the
+// model says it has enough, as in port_handler
+
+int port_room(Gpx *gpx, Sio *sio, char *buffer, size_t length, double *when)
+{
+    int rval;
+    unsigned window = gpx->serialWindow < 1 ? 1 : gpx->serialWindow < SIO_WINDOW ? gpx->serialWindow : SIO_WINDOW;
+    int ahead = is_move_packet(buffer) && window > 1 && length <= SIO_PACKET_MAX;
+
+    *when = 0.0;
+    for(;;) {
+        int room = !(buffer[COMMAND_OFFSET] & 0x80) || sio->queue.capacity < 0 || sio->queue.room >= (long)length;
+        if(room && sio->window.count < (ahead ? window : 1)) break;
+        if(sio->window.count) {
+            CALL( window_write(gpx, sio) );
+            if(!port_answering(sio)) {
+                *when = HUGE_VAL;
+                break;
+            }
+            CALL( collect_response(gpx, sio) );
+            continue;
+        }
+        size_t wanted = length * ((window + 1) / 2);
+        if(!ahead || wanted > (size_t)sio->queue.capacity / 2) wanted = length;
+        double now = host_time();
+        double ready = queue_room(sio, wanted, now);
+        if(ready == HUGE_VAL) {
+            // the printer is waiting on something, keep asking
+            ready = sio->queue.checked + 0.1;
+        }
+        else if(ready > sio->queue.checked + QUEUE_CHECK) {
+            ready = sio->queue.checked + QUEUE_CHECK;
+        }
+        else if(ready < sio->queue.checked + 0.01) {
+            // the printer is behind the model
+            ready = sio->queue.checked + 0.01;
+        }
+        if(ready > now) {
+            *when = ready;
+            break;
+        }
+        CALL( port_handler(gpx, sio, buffer_size_query, 4) );
+    }
+    return SUCCESS;
+}
+
+int port_flush(Gpx *gpx, Sio *sio)
+{
+    int rval;
+
+    while(sio->window.count) {
+        CALL( collect_response(gpx, sio) );
+    }
+    return SUCCESS;
+}
+
+// Queries go out back to back in one write and their answers are heard in
+// order, one round trip for the lot rather than one each.  answer is called
+// with each query's response parsed into sio->response before the next is
+// read.  From a query that's turned away on, they're sent one at a time, as
+// port_handler would.
+
+int port_queries(Gpx *gpx, Sio *sio, unsigned count, char *const *packet, const size_t *length,
+                 int (*answer)(Gpx *gpx, void *data, unsigned i), void *data)
+{
+    char out[SIO_QUERIES * SIO_PACKET_MAX];
+    size_t total = 0;
+    unsigned i, j;
+    int rval;
+
+    if(count > SIO_QUERIES) return ERROR;
+    CALL( port_flush(gpx, sio) );
+    for(i = 0; i < count; i++) {
+        memcpy(out + total, packet[i], length[i]);
+        total += length[i];
+    }
+    VERBOSESIO( gpx_log(gpx, "port_handler write: %lu in %u queries" EOL, (unsigned long)total, count) );
+    VERBOSESIO( hexdump(gpx->log, out, total) );
+    ssize_t bytes = write(sio->port, out, total);
+    if(bytes != total) {
+        // hear out the ones that made it
+        for(i = 0, j = 0; bytes > 0 && i < count && j + length[i] <= (size_t)bytes; j += length[i++]) {
+            if(read_response(gpx, sio) != SUCCESS) break;
+        }
+        return bytes == -1 ? EOSERROR : ESIOWRITE;
+    }
+    double sent = host_time();
+    sio->bytes_out += total;
+    sio->stats.packets += count;
+    sio->stats.writes++;
+
+    for(i = 0; i < count; i++) {
+        rval = read_response(gpx, sio);
+        if(rval == SUCCESS || rval == ESIOCRC) count_response(sio, sent);
+        if(rval == SUCCESS) rval = (int)(unsigned char)gpx->buffer.in[2];
+        if(rval != 0x81) break;
+        read_query_response(gpx, sio, (unsigned char)packet[i][COMMAND_OFFSET], packet[i]);
+        if(packet[i][COMMAND_OFFSET] == 2) {
+            queue_check(sio, sio->response.bufferSize, host_time());
+        }
+        rval = answer(gpx, data, i);
+        if(rval != SUCCESS) {
+            while(++i < count) read_response(gpx, sio);
+            return rval;
+        }
+    }
+    if(i == count) return SUCCESS;
+
+    // the printer answers the rest whatever it said to this one
+    if(rval != ESIOTIMEOUT && rval != EOSERROR) {
+        for(j = i + 1; j < count; j++) {
+            if(read_response(gpx, sio) != SUCCESS) break;
+        }
+    }
+    if(rval > 0 && !is_retry_response(rval)) return rval;
+    for(; i < count; i++) {
+        CALL( send_one(gpx, sio, packet[i], length[i]) );
+        CALL( answer(gpx, data, i) );
+    }
+    return SUCCESS;
+}
+
+int port_handler(Gpx *gpx, Sio *sio, char *buffer, size_t length)
+{
+    int rval;
+    unsigned window = gpx->serialWindow < 1 ? 1 : gpx->serialWindow < SIO_WINDOW ? gpx->serialWindow : SIO_WINDOW;
+
+    if(length == 0) return SUCCESS;
+
+    // only moves are sent ahead, anything else could end up behind a move
+    // that overtook it when it has to be sent again
+    if(!is_move_packet(buffer) || window <= 1 || length > SIO_PACKET_MAX) {
+        CALL( port_flush(gpx, sio) );
+        if((buffer[COMMAND_OFFSET] & 0x80) && sio->queue.room < (long)length) {
+            // if the model is wrong the printer turns it away and it's sent again
+            double now = host_time();
+            double when = queue_room(sio, length, now);
+            if(when != HUGE_VAL) sleep_until(when, now);
+        }
+        return send_one(gpx, sio, buffer, length);
+    }
+
+    // make room in the window and in the printer's buffer, the packets sent
+    // ahead only fill the room the printer said it had, so none is turned
+    // away and overtaken, the model says when to ask for more
+    int asked = 0;
+    while(sio->window.count >= window || sio->queue.room < (long)length) {
+        if(sio->window.count) {
+            CALL( collect_response(gpx, sio) );
+            continue;
+        }
+        if(sio->queue.capacity >= 0) {
+            // ask once there's room for half a window of moves, so it isn't
+            // asked after every move once it's full
+            size_t wanted = length * ((window + 1) / 2);
+            if(wanted > (size_t)sio->queue.capacity / 2) wanted = length;
+            double now = host_time();
+            double when = queue_room(sio, wanted, now);
+            if(when == HUGE_VAL) {
+                // the printer is waiting on something, wait on it
+                return send_one(gpx, sio, buffer, length);
+            }
+            if(when > now) {
+                sleep_until(when, now);
+            }
+            else if(asked) {
+                // the printer is behind the model
+                short_sleep(NS_10MS);
+            }
+        }
+        CALL( port_handler(gpx, sio, buffer_size_query, 4) );
+        asked = 1;
+    }
+
+    double now = host_time();
+    unsigned slot = WINDOW_SLOT(sio, sio->window.count);
+    memcpy(sio->window.packet[slot], buffer, length);
+    sio->window.length[slot] = length;
+    sio->window.time[slot] = now;
+    sio->window.count++;
+    queue_push(sio, buffer, length, now);
+
+    // write them once there's no room for another like it or the first held
+    // back has waited long enough
+    if(sio->window.count < window && sio->queue.room >= (long)length
+       && now - sio->window.time[WINDOW_SLOT(sio, sio->window.sent)] < gpx->serialGather / 1000.0) {
+        return SUCCESS;
+    }
+    return window_write(gpx, sio);
+}
+
+void port_statistics(Gpx *gpx, Sio *sio)
+{
+    if(sio->stats.writes) {
+        gpx_log(gpx, "Serial packets: %lu in %lu writes, %0.1f per write" EOL,
+                sio->stats.packets, sio->stats.writes, (double)sio->stats.packets / sio->stats.writes);
+    }
+    if(sio->stats.responses) {
+        gpx_log(gpx, "Serial response time: %0.1f ms average, %0.1f ms longest" EOL,
+                sio->stats.responseTime * 1000 / sio->stats.responses, sio->stats.responseMax * 1000);
+    }
+}
+
+// the moves held back aren't kept waiting on a slow input past serialGather,
+// they go out when it runs out or before the input is waited on
+
+static int wait_for_input(Gpx *gpx, Sio *sio, Reader *reader)
+{
+    if(sio->window.sent == sio->window.count || reader_ready(reader)) return SUCCESS;
+#if !defined(_WIN32) && !defined(_WIN64)
+    double wait = sio->window.time[WINDOW_SLOT(sio, sio->window.sent)]
+        + gpx->serialGather / 1000.0 - host_time();
+    if(wait > 0.0) {
+        int fd = fileno(reader->in);
+        fd_set fds;
+        struct timeval tv;
+
+        FD_ZERO(&fds);
+        FD_SET(fd, &fds);
+        tv.tv_sec = 0;
+        tv.tv_usec = (long)(wait * 1000000.0);
+        if(select(fd + 1, &fds, NULL, NULL, &tv) > 0) return SUCCESS;
+    }
+#endif
+    return port_send(gpx, sio);
+}
+
 int gpx_convert_and_send(Gpx *gpx, FILE *file_in, int sio_port,
 			 int item_code, ...)
 {
@@ -6562,6 +9170,7 @@ int gpx_convert_and_send(Gpx *gpx, FILE *file_in, int sio_port,
     sio.bytes_in = 0;
     sio.flag.retryBufferOverflow = 1;
     sio.flag.shortRetryBufferOverflowOnly = 0;
+    port_reset(&sio);
     int logMessages = gpx->flag.logMessages;
 
     if(file_in && file_in != stdin) {
@@ -6599,27 +9208,26 @@ int gpx_convert_and_send(Gpx *gpx, FILE *file_in, int sio_port,
     }
 
     for(;;) {
-        int overflow = 0;
-
-        while(fgets(gpx->buffer.in, BUFFER_MAX, sio.in) != NULL) {
-            // detect input buffer overflow and ignore overflow input
-            if(overflow) {
-                if(strlen(gpx->buffer.in) != BUFFER_MAX - 1) {
-                    overflow = 0;
-                }
-                continue;
-            }
-            if(strlen(gpx->buffer.in) == BUFFER_MAX - 1) {
-                overflow = 1;
-                gcodeResult(gpx, "(line %u) Buffer overflow: input exceeds %u character limit, remaining characters in line will be ignored" EOL, gpx->lineNumber, BUFFER_MAX);
+        Reader reader;
+        char *line;
+        size_t length;
+
+        reader_open(&reader, sio.in);
+        for(;;) {
+            rval = gpx->flag.sioConnected ? wait_for_input(gpx, &sio, &reader) : SUCCESS;
+            if(rval == SUCCESS) {
+                if((line = reader_next_line(&reader, &length)) == NULL) break;
+                rval = gpx_convert_line(gpx, line);
             }
-
-            rval = gpx_convert_line(gpx, gpx->buffer.in);
             // normal exit
             if(rval > 0) break;
             // error
-            if(rval < 0) return rval;
+            if(rval < 0) {
+                reader_close(&reader);
+                return rval;
+            }
         }
+        reader_close(&reader);
 
         if(program_is_running()) {
             end_program();
@@ -6654,8 +9262,11 @@ int gpx_convert_and_send(Gpx *gpx, FILE *file_in, int sio_port,
         gpx->sio = &sio;
         gpx->flag.sioConnected = 1;
     }
+    // hear out the packets still in flight
+    rval = port_flush(gpx, &sio);
     gpx->flag.logMessages = logMessages;;
-    return SUCCESS;
+    if(gpx->flag.verboseMode && gpx->flag.logMessages) port_statistics(gpx, &sio);
+    return rval;
 }
 
 void gpx_end_convert(Gpx *gpx)
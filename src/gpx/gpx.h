@@ -93,7 +93,6 @@ typedef long speed_t;
 #define HBP_MAX 130
 #define HBP_TIME 6
 #define AMBIENT_TEMP 24
-#define ACCELERATION_TIME 1.15
 
 #define MAX_TIMEOUT 0xFFFF
 
@@ -104,6 +103,15 @@ typedef long speed_t;
 #define NS_100MS (100000000L)
 #define NS_10MS  (10000000L)
 
+// serial packets
+
+#define SIO_WINDOW 8            // most action packets sent ahead of their responses
+#define SIO_PACKET_MAX 258      // start byte, length, payload and crc
+#define SIO_RECEIVE 1024        // bytes read from the printer ahead of parsing
+#define SIO_QUERIES 16          // most queries sent together
+#define SIO_QUEUE 128           // packets the printer's buffer is modelled as holding
+#define TIO_QUEUE 128           // packets daemon mode holds for the printer
+
 
 #if !defined(SPEED_T_DEFINED)
 #if defined(_WIN32) || defined(_WIN64)
@@ -136,7 +144,9 @@ typedef long speed_t;
 
 #define E_IS_SET 0x20
 #define F_IS_SET 0x40
+#define I_IS_SET 0x80
 #define P_IS_SET 0x100
+#define J_IS_SET 0x200
 #define R_IS_SET 0x400
 #define S_IS_SET 0x800
 
@@ -148,6 +158,7 @@ typedef long speed_t;
 
 #define COMMENT_IS_SET 0x8000
 #define ARG_IS_SET 0x10000
+#define K_IS_SET 0x20000
 
     typedef struct tPoint2d {
         double a;
@@ -179,6 +190,11 @@ typedef long speed_t;
         double e;
         double f;
 
+        // arc centre offsets
+        double i;
+        double j;
+        double k;
+
         double p;
         double r;
         double s;
@@ -211,6 +227,7 @@ typedef long speed_t;
 
 #include "machine.h"
 #include "eeprominfo.h"
+#include "planner.h"
 
     typedef struct tTool {
         unsigned motor_enabled;
@@ -255,6 +272,7 @@ typedef long speed_t;
 
     typedef struct tGpx Gpx;
     typedef struct tSio Sio;
+    typedef struct tTio Tio;
 
     struct tGpx {
 
@@ -286,6 +304,7 @@ typedef long speed_t;
             int offset;         // current G10 offset
             unsigned percent;   // current percent progress
             unsigned speed_factor; // set by M220
+            unsigned plane;     // the arc plane, 17 for XY, 18 for ZX or 19 for YZ
         } current;
 
         struct {
@@ -294,6 +313,23 @@ typedef long speed_t;
         } axis;
 
         Point2d excess;         // the accumulated rounding error in mm to step conversion
+
+        // the extended point held back so the nearly collinear moves after it
+        // can be merged into it, see coalesce_move
+        struct {
+            int count;          // moves merged into it, 0 when none is held
+            Point5d steps;      // the target, A and B relative
+            Point5d deltaSteps; // steps moved along each axis
+            Point3d direction;  // unit vector of the first move
+            Point2d extrusion;  // extruder mm per mm of the first move
+            double feedrate;    // of the first move, in mm/s
+            double distance;
+            double minutes;
+            int flag;           // axes set by the moves
+            size_t length;
+            char packet[64];
+        } held;
+        Planner planner;        // the moves the firmware is planning ahead
         Point3d offset[7];      // G10 offsets
         struct {
             Point3d offset;     // command line offset
@@ -313,6 +349,14 @@ typedef long speed_t;
         // vector (dynamic array) of eeprom mappings defined by @eeprom macro
         vector *eepromMappingVector;
 
+        // vector (dynamic array) of build progress checks recorded by the
+        // single-pass converter to be patched once the total time is known
+        vector *progressMarkVector;
+
+        // the part of the input a worker of the parallel converter is
+        // converting, NULL when the whole input is being converted
+        struct tChunk *chunk;
+
         // builtin eeprom map
         EepromMap *eepromMap;
 
@@ -324,6 +368,20 @@ typedef long speed_t;
         char *sdCardPath;
         char *buildName;
         char *iniPath;
+        const char *cachePath;  // parse cache of the input, see cache.c
+        int threads;            // worker threads for the parallel converter
+        int serialWindow;       // action packets sent ahead of their responses
+        int serialGather;       // milliseconds a move is held back to go out with the ones after it
+        struct {
+            double angle;       // largest change of direction, in degrees
+            double extrusion;   // largest change of extrusion per mm, in percent
+            double feedrate;    // largest change of feedrate, in percent
+            double length;      // longest merged move, in mm
+        } coalesce;
+        struct {
+            double tolerance;   // furthest a chord strays from the arc, in mm
+            double segment;     // shortest chord, in mm
+        } arc;
 
         struct {
             unsigned relativeCoordinates:1; // signals relative or absolute coordinates
@@ -337,6 +395,8 @@ typedef long speed_t;
             unsigned rewrite5D:1;       // calculate 5D E values rather than scaling them
             unsigned M106AlwaysValve:1; // force M106 to reprap flavor even in makerbot mode
             unsigned onlyExplicitToolChange:1; // no implicit tool change when Tn used as a parameter
+            unsigned singlePass:1;      // convert in one pass and patch in the build progress afterwards
+            unsigned coalesceMoves:1;   // merge runs of nearly collinear moves into one
 
         // STATE
             unsigned programState:8;    // gcode program state used to trigger start and end code sequences
@@ -345,6 +405,9 @@ typedef long speed_t;
             unsigned macrosEnabled:1;   // M73 P1 or ;@body encountered signalling body start (so we don't pause during homing)
             unsigned loadMacros:1;      // used by the multi-pass converter to maintain state
             unsigned runMacros:1;       // used by the multi-pass converter to maintain state
+            unsigned deferProgress:1;   // used by the single-pass converter to record progress checks
+            unsigned singlePassFailed:1; // single-pass can't reproduce the multi-pass output
+            unsigned repeatPass:1;      // second pass of the multi-pass converter, the first reported its diagnostics
             unsigned framingEnabled:1;  // enable framming of packets with header and crc
             unsigned sioConnected:1;    // connected to the bot
             unsigned sd_paused:1;       // printing from sd paused
@@ -378,6 +441,7 @@ typedef long speed_t;
         void *callbackData;
         int (*resultHandler)(Gpx *gpx, void *callbackData, const char *fmt, va_list ap);
         struct tSio *sio;
+        Tio *tio;               // the responses to the host, in daemon mode or the python module
 
         // LOGGING
 
@@ -394,6 +458,46 @@ typedef long speed_t;
             unsigned shortRetryBufferOverflowOnly : 1;
         } flag;
 
+        // action packets written ahead of their responses, oldest first
+        struct {
+            char packet[SIO_WINDOW][SIO_PACKET_MAX];
+            size_t length[SIO_WINDOW];
+            double time[SIO_WINDOW];    // when it was written, or held back
+            unsigned first;
+            unsigned count;
+            unsigned sent;      // the ones written, the rest are held back to go together
+        } window;
+
+        // the packets the printer is thought to still have in its buffer and
+        // how long each takes, so it's known when there's room without asking
+        struct {
+            unsigned short length[SIO_QUEUE];
+            double duration[SIO_QUEUE]; // seconds, HUGE_VAL when it can't be told
+            unsigned first;
+            unsigned count;
+            long queued;        // bytes of the packets in it
+            long capacity;      // the printer's buffer size, -1 until it's been asked
+            long room;          // bytes it said it had room for, less those sent since
+            double start;       // when the oldest one began, on the host clock
+            double checked;     // when the printer was last asked
+        } queue;
+
+        // for the verbose statistics
+        struct {
+            unsigned long packets;      // packets written
+            unsigned long writes;       // writes they took
+            unsigned long responses;    // responses heard
+            double responseTime;        // seconds from write to response, summed
+            double responseMax;
+        } stats;
+
+        // bytes read from the printer and not yet parsed into a response
+        struct {
+            unsigned char buffer[SIO_RECEIVE];
+            unsigned head;      // the oldest unparsed byte
+            unsigned tail;      // one past the newest
+        } receive;
+
         union {
             struct {
                 unsigned short version;
@@ -542,10 +646,19 @@ typedef long speed_t;
         unsigned target;
     } Tr;
 
+    // the status answers Tio keeps, by slot
+#define STATUS_TOOL_TEMPERATURE 0   // + the tool
+#define STATUS_TOOL_TARGET 2        // + the tool
+#define STATUS_BED_TEMPERATURE 4
+#define STATUS_BED_TARGET 5
+#define STATUS_BUILD 6
+#define STATUS_MOTHERBOARD 7
+#define STATUS_MAX 8
+
     // Tio - translated serial io
     // wraps Sio and adds translation output buffer
     // translation is reprap style response
-    typedef struct tTio
+    struct tTio
     {
         char translation[BUFFER_MAX + 1];
         size_t cur;
@@ -559,6 +672,8 @@ typedef long speed_t;
                 unsigned okPending:1;         // we want the ok to come at the end of the response
                 unsigned waitClearedByCancel:1; // recheck wait state
                 unsigned clear_on_estop_set:1;// eeprom says that the bot clears on estop, so no abs moves until G92/M132 after cancel
+                unsigned queueing:1;          // action packets go out from the queue as the printer has room
+                unsigned batching:1;          // queries are gathered to go to the printer together
             } flag;
         };
         union {
@@ -582,7 +697,54 @@ typedef long speed_t;
         Tr bed_tr;
         Gpx *gpx;
         int upstream;
-    } Tio;
+        char line[BUFFER_MAX];          // the line being converted
+        char input[BUFFER_MAX * 4];     // what upstream sent that isn't converted yet
+        size_t inputLength;
+        unsigned lineOverflow;          // dropping the rest of a line that's too long
+        char pending[BUFFER_MAX * 4];   // output upstream hasn't taken yet
+        size_t pendingLength;
+
+        // converted action packets waiting for room in the printer's buffer,
+        // the host has already been told ok
+        struct {
+            char packet[TIO_QUEUE][SIO_PACKET_MAX];
+            size_t length[TIO_QUEUE];
+            unsigned first;
+            unsigned count;
+        } queue;
+
+        // recent answers to status queries, so M105 from the host and the
+        // checks on a wait share them rather than each asking the printer
+        struct {
+            double checked[STATUS_MAX];     // host time of each answer, 0 when there isn't one
+            unsigned short temperature[6];  // by slot, for the temperatures
+            unsigned char motherboard;
+            unsigned buildLineNumber;
+            unsigned char buildStatus;
+            unsigned char buildHours;
+            unsigned char buildMinutes;
+            unsigned long hits;             // queries answered from here
+            unsigned long misses;           // queries that went to the printer
+        } status;
+
+        // queries gathered to go to the printer together
+        struct {
+            char packet[SIO_QUERIES][SIO_PACKET_MAX];
+            size_t length[SIO_QUERIES];
+            int slot[SIO_QUERIES];          // where its answer is kept, -1 if it isn't
+            unsigned sent[SIO_QUERIES];     // the ones that went to the printer
+            unsigned count;
+            unsigned done;                  // the ones answered so far
+        } batch;
+
+        // the daemon loop's state for the printer
+        const char *printerPort;
+        int hungUp;                     // the host has hung up, retry until it's back
+        unsigned waitChecked;           // the wait being checked on the timer
+        double nextWait;                // when to check on it next
+        double nextSend;                // when to send from the queue, HUGE_VAL once the printer answers
+        int stopped;                    // the printer has gone away
+    };
 
     // 23 - Get build statistics: build state values
     // From sailfish sources (Host.hh)
@@ -596,6 +758,8 @@ typedef long speed_t;
     };
 
     void gpx_initialize(Gpx *gpx, int firstTime);
+    int gpx_clone(Gpx *clone, Gpx *gpx);
+    void gpx_clone_cleanup(Gpx *clone);
     int gpx_set_machine(Gpx *gpx, const char *machine, int init);
 
     int gpx_set_property(Gpx *gpx, const char* section, const char* property, char* value);
@@ -604,12 +768,19 @@ typedef long speed_t;
     int gpx_sio_open(Gpx *gpx, const char *filename, speed_t baud_rate, int *sio_port);
     int ready_to_read(int fd);
     int port_handler(Gpx *gpx, Sio *sio, char *buffer, size_t length);
+    int port_send(Gpx *gpx, Sio *sio);
+    int port_room(Gpx *gpx, Sio *sio, char *buffer, size_t length, double *when);
+    int port_flush(Gpx *gpx, Sio *sio);
+    int port_queries(Gpx *gpx, Sio *sio, unsigned count, char *const *packet, const size_t *length,
+                     int (*answer)(Gpx *gpx, void *data, unsigned i), void *data);
+    void port_reset(Sio *sio);
+    void port_statistics(Gpx *gpx, Sio *sio);
 
     void gpx_register_callback(Gpx *gpx, int (*callbackHandler)(Gpx *gpx, void *callbackData, char *buffer, size_t length), void *callbackData);
 
     void gpx_start_convert(Gpx *gpx, char *buildName, int item_code, ...);
 
-    int gpx_daemon(Gpx *gpx, int create_daemon_port, const char *daemon_port, const char *printer_port, speed_t baudrate);
+    int gpx_daemon(Gpx *gpx, int count, const int *create_daemon_port, char *const *daemon_port, char *const *printer_port, speed_t baudrate);
     int gpx_convert_line(Gpx *gpx, char *gcode_line);
     int gpx_convert(Gpx *gpx, FILE *file_in, FILE *file_out, FILE *file_out2);
     int gpx_convert_and_send(Gpx *gpx, FILE *file_in, int sio_port, int item_code, ...);
@@ -662,20 +833,27 @@ typedef long speed_t;
     int write_eeprom_float(Gpx *gpx, Sio *sio, unsigned address, float value);
     int read_eeprom_float(Gpx *gpx, Sio *sio, unsigned address, float *value);
 
-    Tio *tio_initialize(Gpx *gpx);
+    Tio *tio_initialize(Tio *tio, Gpx *gpx);
     void tio_cleanup(Tio *tio);
+    void tio_release(Tio *tio);
     void tio_clear_state_for_cancel(Tio *tio);
+    void tio_status_statistics(Tio *tio);
+    void tio_batch_begin(Tio *tio);
+    int tio_batch_end(Gpx *gpx, Tio *tio, int rval);
     int tio_printf(Tio *tio, char const* fmt, ...);
     int tio_log_printf(Tio *tio, char const* fmt, ...);
     int gpx_connect(Gpx *gpx, const char *printer_port, speed_t speed);
     int gpx_return_translation(Gpx *gpx, int rval);
     int gpx_write_string_core(Gpx *gpx, const char *s);
     int gpx_write_string(Gpx *gpx, const char *s);
+    int gpx_do_wait(Gpx *gpx);
     int gcodeResult(Gpx *gpx, const char *fmt, ...);
-    speed_t speed_from_long(long *baudrate);
+    int gpx_log(Gpx *gpx, const char *fmt, ...);
+    speed_t speed_from_long(Tio *tio, long *baudrate);
 
     void short_sleep(long nsec);
     void long_sleep(time_t sec);
+    double host_time(void);
 
 #ifdef __eeprominfo_h__
     EepromMapping *find_any_eeprom_mapping(Gpx *, char *name);
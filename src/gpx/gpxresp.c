@@ -32,15 +32,17 @@
 #include <string.h>
 #include <time.h>
 #include <errno.h>
-#ifdef HAVE_POLL_H
-#include <poll.h>
-#endif
+#include <math.h>
 #ifndef _WIN32
 #include <sys/select.h>
 #endif
 
 #include "gpx.h"
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
 // make a new string table
 // cs_chunk -- count of strings -- grow the string array in chunks of this many strings
 Sttb *sttb_init(Sttb *psttb, long cs_chunk)
@@ -110,8 +112,6 @@ long sttb_find_nocase(Sttb *psttb, char *s)
     return -1;
 }
 
-static Tio tio;
-
 int tio_vprintf(Tio *tio, const char *fmt, va_list ap)
 {
     size_t result;
@@ -150,24 +150,53 @@ int tio_log_printf(Tio *tio, char const* fmt, ...)
     return result;
 }
 
-Tio *tio_initialize(Gpx *gpx)
+// forget the status answers kept for the printer
+
+static void status_clear(Tio *tio)
+{
+    memset(tio->status.checked, 0, sizeof(tio->status.checked));
+}
+
+// ties tio and gpx to each other, each printer has its own pair
+
+Tio *tio_initialize(Tio *tio, Gpx *gpx)
 {
-    tio.cur = 0;
-    tio.translation[0] = 0;
-    tio.sio.port = -1;
-    tio.flags = 0;
-    tio.waiting = 0;
-    tio.sec = 0;
-    tio.gpx = gpx;
-    sttb_init(&tio.sttb, 10);
+    tio->cur = 0;
+    tio->translation[0] = 0;
+    tio->sio.port = -1;
+    tio->flags = 0;
+    tio->waiting = 0;
+    tio->sec = 0;
+    tio->gpx = gpx;
+    gpx->tio = tio;
+    sttb_init(&tio->sttb, 10);
     gpx->axis.positionKnown = 0;
     gpx->flag.M106AlwaysValve = 1;
-    tio.upstream = -1;
-    return &tio;
+    tio->upstream = -1;
+    tio->inputLength = 0;
+    tio->lineOverflow = 0;
+    tio->pendingLength = 0;
+    tio->queue.first = 0;
+    tio->queue.count = 0;
+    tio->batch.count = 0;
+    tio->printerPort = NULL;
+    tio->hungUp = 0;
+    tio->stopped = 0;
+    status_clear(tio);
+    tio->status.hits = 0;
+    tio->status.misses = 0;
+    return tio;
 }
 
 void tio_cleanup(Tio *tio)
 {
+    if (tio->sio.port > -1) {
+        port_flush(tio->gpx, &tio->sio);
+        if (tio->gpx->flag.verboseMode) {
+            port_statistics(tio->gpx, &tio->sio);
+            tio_status_statistics(tio);
+        }
+    }
     if (tio->gpx->log != NULL && tio->gpx->log != stderr) {
         fflush(tio->gpx->log);
         fclose(tio->gpx->log);
@@ -187,6 +216,13 @@ void tio_cleanup(Tio *tio)
     gpx_set_machine(tio->gpx, "r2", 1);
 }
 
+// frees what tio_initialize allocated, the tio can't be used after this
+void tio_release(Tio *tio)
+{
+    tio_cleanup(tio);
+    sttb_cleanup(&tio->sttb);
+}
+
 
 void tio_clear_state_for_cancel(Tio *tio)
 {
@@ -197,12 +233,81 @@ void tio_clear_state_for_cancel(Tio *tio)
     if (tio->waiting) {
         tio->flag.waitClearedByCancel = 1;
         if(tio->gpx->flag.verboseMode)
-            fprintf(tio->gpx->log, "setting waitClearedByCancel");
+            gpx_log(tio->gpx, "setting waitClearedByCancel");
     }
     tio->waiting = 0;
     tio->waitflag.waitForEmptyQueue = 1;
     tio->flag.getPosWhenReady = 0;
     tio->gpx->flag.ignoreAbsoluteMoves = tio->flag.clear_on_estop_set;
+    tio->queue.first = 0;
+    tio->queue.count = 0;
+    status_clear(tio);
+}
+
+// In daemon mode action packets are queued as they're converted so the host
+// can be told ok without waiting on the printer, the daemon loop sends them as
+// the printer makes room.  Queries go ahead of them, other host commands go
+// after them, except the ones that throw them away.
+
+static int is_host_query(unsigned command)
+{
+    switch (command) {
+        case 0:     // version
+        case 2:     // buffer size
+        case 4:     // position
+        case 10:    // tool query
+        case 11:    // is ready
+        case 12:    // read from eeprom
+        case 18:    // next filename
+        case 20:    // build name
+        case 21:    // extended position
+        case 23:    // motherboard status
+        case 24:    // build statistics
+        case 25:    // communication statistics
+        case 27:    // advanced version
+            return 1;
+    }
+    return 0;
+}
+
+static void status_forget(Tio *tio, const char *buffer);
+
+// send the oldest packet in the queue, waiting on the printer for room
+
+static int tio_queue_send(Gpx *gpx, Tio *tio)
+{
+    unsigned slot = tio->queue.first;
+    tio->queue.first = (slot + 1) % TIO_QUEUE;
+    tio->queue.count--;
+    status_forget(tio, tio->queue.packet[slot]);
+    return port_handler(gpx, &tio->sio, tio->queue.packet[slot], tio->queue.length[slot]);
+}
+
+static int tio_queue_flush(Gpx *gpx, Tio *tio)
+{
+    while (tio->queue.count) {
+        int rval = tio_queue_send(gpx, tio);
+        if (rval != SUCCESS)
+            return rval;
+    }
+    return SUCCESS;
+}
+
+static int tio_queue_push(Gpx *gpx, Tio *tio, char *buffer, size_t length)
+{
+    unsigned slot;
+
+    // a line that makes more packets than there's room for waits on the printer
+    if (tio->queue.count == TIO_QUEUE) {
+        int rval = tio_queue_send(gpx, tio);
+        if (rval != SUCCESS)
+            return rval;
+    }
+    slot = (tio->queue.first + tio->queue.count) % TIO_QUEUE;
+    memcpy(tio->queue.packet[slot], buffer, length);
+    tio->queue.length[slot] = length;
+    tio->queue.count++;
+    return SUCCESS;
 }
 
 // wrap port_handler and translate to the expect gcode response
@@ -211,6 +316,130 @@ void tio_clear_state_for_cancel(Tio *tio)
 #define QUERY_COMMAND_OFFSET 4
 #define EEPROM_LENGTH_OFFSET 8
 
+// Status queries are answered from what the printer said last, as long as
+// that's recent enough, so a host polling M105 on top of the checks on a wait
+// costs the printer's link one set of queries per interval, not one per ask.
+
+#define STATUS_TEMPERATURE_TTL 1.0  // seconds a temperature answer is good for
+#define STATUS_STATE_TTL 0.5        // seconds for build and motherboard state
+
+// the slot a query's answer is kept in, -1 for a query that isn't kept
+
+static int status_slot(char *buffer)
+{
+    unsigned command = (unsigned char)buffer[COMMAND_OFFSET];
+    unsigned extruder_id = (unsigned char)buffer[EXTRUDER_ID_OFFSET];
+
+    switch (command) {
+        case 10:
+            switch ((unsigned char)buffer[QUERY_COMMAND_OFFSET]) {
+                case 2:
+                    return extruder_id < 2 ? STATUS_TOOL_TEMPERATURE + extruder_id : -1;
+                case 32:
+                    return extruder_id < 2 ? STATUS_TOOL_TARGET + extruder_id : -1;
+                case 30:
+                    return STATUS_BED_TEMPERATURE;
+                case 33:
+                    return STATUS_BED_TARGET;
+            }
+            break;
+        case 23:
+            return STATUS_MOTHERBOARD;
+        case 24:
+            return STATUS_BUILD;
+    }
+    return -1;
+}
+
+// whether the kept answer is recent enough to use
+
+static int status_fresh(Tio *tio, int slot)
+{
+    double ttl = slot < STATUS_BUILD ? STATUS_TEMPERATURE_TTL : STATUS_STATE_TTL;
+
+    if (tio->status.checked[slot] == 0.0 || host_time() - tio->status.checked[slot] > ttl) {
+        tio->status.misses++;
+        return 0;
+    }
+    tio->status.hits++;
+    return 1;
+}
+
+// put the kept answer in the response
+
+static void status_recall(Tio *tio, int slot)
+{
+    switch (slot) {
+        case STATUS_BUILD:
+            tio->sio.response.build.lineNumber = tio->status.buildLineNumber;
+            tio->sio.response.build.status = tio->status.buildStatus;
+            tio->sio.response.build.hours = tio->status.buildHours;
+            tio->sio.response.build.minutes = tio->status.buildMinutes;
+            break;
+        case STATUS_MOTHERBOARD:
+            tio->sio.response.motherboard.bitfield = tio->status.motherboard;
+            break;
+        default:
+            tio->sio.response.temperature = tio->status.temperature[slot];
+            break;
+    }
+}
+
+static void status_keep(Tio *tio, int slot)
+{
+    switch (slot) {
+        case STATUS_BUILD:
+            tio->status.buildLineNumber = tio->sio.response.build.lineNumber;
+            tio->status.buildStatus = tio->sio.response.build.status;
+            tio->status.buildHours = tio->sio.response.build.hours;
+            tio->status.buildMinutes = tio->sio.response.build.minutes;
+            break;
+        case STATUS_MOTHERBOARD:
+            tio->status.motherboard = tio->sio.response.motherboard.bitfield;
+            break;
+        default:
+            tio->status.temperature[slot] = tio->sio.response.temperature;
+            break;
+    }
+    tio->status.checked[slot] = host_time();
+}
+
+// a packet that changes what the printer would answer throws the kept answer
+// away, whether it goes to the printer now or waits in the queue
+
+static void status_forget(Tio *tio, const char *buffer)
+{
+    unsigned extruder_id = (unsigned char)buffer[EXTRUDER_ID_OFFSET];
+
+    switch ((unsigned char)buffer[COMMAND_OFFSET]) {
+        case 136:   // tool action
+            switch ((unsigned char)buffer[QUERY_COMMAND_OFFSET]) {
+                case 3:     // set the tool's target temperature
+                    if (extruder_id < 2)
+                        tio->status.checked[STATUS_TOOL_TARGET + extruder_id] = 0.0;
+                    break;
+                case 31:    // set the build platform's target temperature
+                    tio->status.checked[STATUS_BED_TARGET] = 0.0;
+                    break;
+            }
+            break;
+        case 7:     // abort
+        case 8:     // pause or resume
+        case 17:    // reset
+        case 153:   // start build
+        case 154:   // end build
+            tio->status.checked[STATUS_BUILD] = 0.0;
+            tio->status.checked[STATUS_MOTHERBOARD] = 0.0;
+            break;
+    }
+}
+
+void tio_status_statistics(Tio *tio)
+{
+    gpx_log(tio->gpx, "Status queries answered from the cache: %lu of %lu" EOL,
+            tio->status.hits, tio->status.hits + tio->status.misses);
+}
+
 static void translate_extruder_query_response(Gpx *gpx, Tio *tio, unsigned query_command, char *buffer)
 {
     unsigned extruder_id = buffer[EXTRUDER_ID_OFFSET];
@@ -280,7 +509,7 @@ static void translate_extruder_query_response(Gpx *gpx, Tio *tio, unsigned query
             // Query 36 - Get extruder status
         case 36: /* NYI
             if(gpx->flag.verboseMode && gpx->flag.logMessages) {
-                fprintf(gpx->log, "Extruder T%u status" EOL, extruder_id);
+                gpx_log(gpx, "Extruder T%u status" EOL, extruder_id);
                 if(sio->response.extruder.flag.ready) fputs("Target temperature reached" EOL, gpx->log);
                 if(sio->response.extruder.flag.notPluggedIn) fputs("The extruder or build plate is not plugged in" EOL, gpx->log);
                 if(sio->response.extruder.flag.softwareCutoff) fputs("Above maximum allowable temperature recorded: heater shutdown for safety" EOL, gpx->log);
@@ -302,83 +531,14 @@ static void translate_extruder_query_response(Gpx *gpx, Tio *tio, unsigned query
     }
 }
 
-// translate_handler
-// Callback function for gpx_convert_and_send.  It's where we translate the
-// s3g/x3g response into a text response that mimics a reprap printer.
-static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
-{
-    unsigned command;
-    unsigned extruder;
-
-    if (tio->flag.okPending) {
-        tio->flag.okPending = 0;
-        tio_printf(tio, "ok");
-        // ok means: I'm ready for another command, not necessarily that everything worked
-    }
-
-    if (length == 0) {
-        // we translated a command that has no translation to x3g or is an
-        // accumulation of multiple x3g commands and there still may be
-        // something to do to emulate gcode behavior
-        if (gpx->command.flag & M_IS_SET) {
-            switch (gpx->command.m) {
-                case 23: { // M23 - select SD file
-                    // Some host software expects case insensitivity for M23
-                    long i = sttb_find_nocase(&tio->sttb, gpx->selectedFilename);
-                    if (i >= 0) {
-                        char *s = strdup(tio->sttb.rgs[i]);
-                        if (s != NULL) {
-                            free(gpx->selectedFilename);
-                            gpx->selectedFilename = s;
-                        }
-                    }
-                    // answer to M23, at least on Marlin, Repetier and Sprinter: "File opened:%s Size:%d"
-                    // followed by "File selected:%s Size:%d".  Caller is going to 
-                    // be really surprised when the failure happens on start print
-                    // but other than enumerating all the files again, we don't
-                    // have a way to tell the printer to go check if it can be
-                    // opened
-                    tio_printf(tio, "\nFile opened:%s Size:%d\nFile selected:%s", gpx->selectedFilename, 0, gpx->selectedFilename);
-                    // currently no way to ask Sailfish for the file size, that I can tell :-(
-                    break;
-                }
-                case 105:
-                    // current extruder temps
-                    tio_printf(tio, " T:%u /%u", tio->tool_tr[gpx->current.extruder].temperature, tio->tool_tr[gpx->current.extruder].target);
-
-                    // bed temps
-                    tio_printf(tio, " B:%u /%u", tio->bed_tr.temperature, tio->bed_tr.target);
-
-                    // all extruder temps
-                    if (gpx->machine.extruder_count > 1) {
-                        int i;
-                        for(i = 0; i < gpx->machine.extruder_count; i++)
-                            tio_printf(tio, " T%u:%u /%u", i, tio->tool_tr[i].temperature, tio->tool_tr[i].target);
-                    }
-
-                    // power output (x3g can't tell us)
-                    tio_printf(tio, " @:0 B@:0");
-                    break;
-                case 400:
-                    tio->waitflag.waitForEmptyQueue = 1;
-                    break;
-            }
-        }
-        return SUCCESS;
-    }
-
-    command = buffer[COMMAND_OFFSET];
-    extruder = buffer[EXTRUDER_ID_OFFSET];
-
-    // throw any queuable command in the bit bucket while we're waiting for the cancel
-    if (tio->flag.cancelPending && (command & 0x80))
-        return SUCCESS;
+// the gcode response to what the printer said to a packet, or to what's kept
+// from the last time it was asked
 
-    int rval = port_handler(gpx, &tio->sio, buffer, length);
-    if (rval != SUCCESS) {
-        VERBOSE(fprintf(gpx->log, "port_handler returned: rval = %d\n", rval);)
-        return rval;
-    }
+static int translate_response(Gpx *gpx, Tio *tio, char *buffer)
+{
+    unsigned command = (unsigned char)buffer[COMMAND_OFFSET];
+    unsigned extruder = (unsigned char)buffer[EXTRUDER_ID_OFFSET];
+    int rval = SUCCESS;
 
     // we got a SUCCESS on a queable command, so we're not waiting anymore
     if (command & 0x80)
@@ -404,7 +564,7 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
 
             // 11 - Is ready?
         case 11:
-            VERBOSE( fprintf(gpx->log, "is_ready: %d\n", tio->sio.response.isReady) );
+            VERBOSE( gpx_log(gpx, "is_ready: %d\n", tio->sio.response.isReady) );
             if (tio->sio.response.isReady) {
                 tio->waitflag.waitForEmptyQueue = tio->waitflag.waitForButton = 0;
                 if (tio->flag.getPosWhenReady) {
@@ -618,7 +778,7 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
         case 135:
             tio->cur = 0;
             tio->translation[0] = 0;
-            VERBOSE( fprintf(gpx->log, "waiting for extruder %d\n", extruder) );
+            VERBOSE( gpx_log(gpx, "waiting for extruder %d\n", extruder) );
             if (extruder == 0)
                 tio->waitflag.waitForEmptyQueue = tio->waitflag.waitForExtruderA = 1;
             else
@@ -629,7 +789,7 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
         case 141:
             tio->cur = 0;
             tio->translation[0] = 0;
-            VERBOSE( fprintf(gpx->log, "waiting for platform\n") );
+            VERBOSE( gpx_log(gpx, "waiting for platform\n") );
             tio->waitflag.waitForEmptyQueue = tio->waitflag.waitForPlatform = 1;
             break;
 
@@ -640,7 +800,7 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
             // 131, 132 - home axes
         case 131:
         case 132:
-            VERBOSE( fprintf(gpx->log, "homing or recall home positions, wait for queue then ask bot for pos\n") );
+            VERBOSE( gpx_log(gpx, "homing or recall home positions, wait for queue then ask bot for pos\n") );
             tio->cur = 0;
             tio->translation[0] = 0;
             tio->waitflag.waitForEmptyQueue = 1;
@@ -648,7 +808,7 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
             break;
 
         case 133:
-            VERBOSE( fprintf(gpx->log, "wait for (133) delay\n") );
+            VERBOSE( gpx_log(gpx, "wait for (133) delay\n") );
             tio->cur = 0;
             tio->translation[0] = 0;
             tio->waitflag.waitForEmptyQueue = 1;
@@ -659,7 +819,7 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
         case 149:
             tio->cur = 0;
             tio->translation[0] = 0;
-            VERBOSE( fprintf(gpx->log, "waiting for button\n") );
+            VERBOSE( gpx_log(gpx, "waiting for button\n") );
             tio->waitflag.waitForButton = 1;
             break;
     }
@@ -667,168 +827,382 @@ static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
     return rval;
 }
 
-static int translate_result(Gpx *gpx, Tio *tio, const char *fmt, va_list ap)
+// Queries that are gathered go to the printer together with port_queries and
+// are answered in the order they were made, the ones with a recent enough
+// answer kept aren't sent but are answered in their turn all the same.
+
+static int tio_batch_answer(Gpx *gpx, Tio *tio, unsigned end)
 {
-    int len = 0;
-    if (!strcasecmp(fmt, "@clear_cancel")) {
-        if (tio->upstream == -1 && !tio->flag.cancelPending && gpx->flag.programState == RUNNING_STATE) {
-            // cancel gcode came through before cancel event
-            VERBOSE( fprintf(gpx->log, "got @clear_cancel, waiting for abort call\n") );
-            tio->waitflag.waitForCancelSync = 1;
-        }
-        else {
-            tio->waitflag.waitForEmptyQueue = 1;
-        }
-        tio->flag.cancelPending = 0;
-        return 0;
+    while (tio->batch.done < end) {
+        unsigned i = tio->batch.done++;
+        int rval;
+        status_recall(tio, tio->batch.slot[i]);
+        rval = translate_response(gpx, tio, tio->batch.packet[i]);
+        if (rval != SUCCESS)
+            return rval;
     }
-    else if (!strcasecmp(fmt, "@iostatus")) {
-        len = tio_printf(tio, "listingFiles: %u\n", tio->flag.listingFiles);
-        len += tio_printf(tio, "getPosWhenReady: %u\n", tio->flag.getPosWhenReady);
-        len += tio_printf(tio, "cancelPending: %u\n", tio->flag.cancelPending);
-        len += tio_printf(tio, "okPending: %u\n", tio->flag.okPending);
-        len += tio_printf(tio, "waitClearedByCancel: %u\n", tio->flag.waitClearedByCancel);
-        len += tio_printf(tio, "clear_on_estop_set: %u\n", tio->flag.clear_on_estop_set);
-        return len;
+    return SUCCESS;
+}
+
+static int tio_batch_answered(Gpx *gpx, void *data, unsigned k)
+{
+    Tio *tio = data;
+    unsigned i = tio->batch.sent[k];
+    char answer[sizeof(tio->sio.response)];
+    int rval;
+
+    // answering the kept ones ahead of it overwrites the printer's answer
+    memcpy(answer, &tio->sio.response, sizeof(answer));
+    rval = tio_batch_answer(gpx, tio, i);
+    if (rval != SUCCESS)
+        return rval;
+    memcpy(&tio->sio.response, answer, sizeof(answer));
+    tio->batch.done = i + 1;
+    if (tio->batch.slot[i] >= 0)
+        status_keep(tio, tio->batch.slot[i]);
+    return translate_response(gpx, tio, tio->batch.packet[i]);
+}
+
+static int tio_batch_send(Gpx *gpx, Tio *tio)
+{
+    char *packet[SIO_QUERIES];
+    size_t length[SIO_QUERIES];
+    unsigned i, count = 0;
+    int rval = SUCCESS;
+
+    for (i = 0; i < tio->batch.count; i++) {
+        if (tio->batch.slot[i] >= 0 && status_fresh(tio, tio->batch.slot[i]))
+            continue;
+        packet[count] = tio->batch.packet[i];
+        length[count] = tio->batch.length[i];
+        tio->batch.sent[count++] = i;
     }
-    if (tio->flag.okPending) {
-        tio->flag.okPending = 0;
-        tio_printf(tio, "ok");
-        // ok means: I'm ready for another command, not necessarily that everything worked
+    tio->batch.done = 0;
+    if (count)
+        rval = port_queries(gpx, &tio->sio, count, packet, length, tio_batch_answered, tio);
+    if (rval == SUCCESS)
+        rval = tio_batch_answer(gpx, tio, tio->batch.count);
+    if (rval != SUCCESS)
+        VERBOSE(gpx_log(gpx, "port_queries returned: rval = %d\n", rval);)
+    tio->batch.count = 0;
+    return rval;
+}
+
+static int tio_batch_push(Gpx *gpx, Tio *tio, char *buffer, size_t length)
+{
+    unsigned i;
+
+    if (tio->batch.count == SIO_QUERIES) {
+        int rval = tio_batch_send(gpx, tio);
+        if (rval != SUCCESS)
+            return rval;
     }
-    if (tio->cur > 0 && tio->translation[tio->cur - 1] != '\n')
-       len = tio_printf(tio, "\n"); 
-    return len + tio_printf(tio, "// echo: ") + tio_vprintf(tio, fmt, ap);
+    i = tio->batch.count++;
+    memcpy(tio->batch.packet[i], buffer, length);
+    tio->batch.length[i] = length;
+    tio->batch.slot[i] = status_slot(buffer);
+    return SUCCESS;
 }
 
-int gpx_return_translation(Gpx *gpx, int rval)
+// gather the queries made until tio_batch_end, which sends them unless rval
+// says something has already gone wrong, and returns rval or how sending went
+
+void tio_batch_begin(Tio *tio)
 {
-    int waiting = tio.waiting;
+    tio->flag.batching = 1;
+}
 
-    // ENDED -> READY
-    if (gpx->flag.programState > RUNNING_STATE)
-        gpx->flag.programState = READY_STATE;
-    gpx->flag.macrosEnabled = 1;
+int tio_batch_end(Gpx *gpx, Tio *tio, int rval)
+{
+    tio->flag.batching = 0;
+    if (rval != SUCCESS) {
+        tio->batch.count = 0;
+        return rval;
+    }
+    return tio->batch.count ? tio_batch_send(gpx, tio) : SUCCESS;
+}
 
-    // if we're waiting for something and we haven't produced any output
-    // give back current temps
-    if (rval == SUCCESS && tio.waiting && tio.cur == 0) {
-        if(gpx->flag.verboseMode)
-            fprintf(gpx->log, "implicit M105\n");
-        strncpy(gpx->buffer.in, "M105", sizeof(gpx->buffer.in));
-        rval = gpx_convert_line(gpx, gpx->buffer.in);
-        if(gpx->flag.verboseMode)
-            fprintf(gpx->log, "implicit M105 rval = %d\n", rval);
+// translate_handler
+// Callback function for gpx_convert_and_send.  It's where we translate the
+// s3g/x3g response into a text response that mimics a reprap printer.
+static int translate_handler(Gpx *gpx, Tio *tio, char *buffer, size_t length)
+{
+    unsigned command;
+    int rval;
+
+    if (tio->flag.okPending) {
+        tio->flag.okPending = 0;
+        tio_printf(tio, "ok");
+        // ok means: I'm ready for another command, not necessarily that everything worked
     }
 
-    if(gpx->flag.verboseMode)
-        fprintf(gpx->log, "gpx_return_translation rval = %d\n", rval);
-    fflush(gpx->log);
-    switch (rval) {
-        case SUCCESS:
-        case END_OF_FILE:
-            break;
+    // M105's queries, and the ones a wait is checked with, go to the printer
+    // together, what comes after them waits for their answers
+    if (length > 0 && is_host_query((unsigned char)buffer[COMMAND_OFFSET])
+            && (tio->flag.batching || ((gpx->command.flag & M_IS_SET) && gpx->command.m == 105)))
+        return tio_batch_push(gpx, tio, buffer, length);
+    if (tio->batch.count) {
+        rval = tio_batch_send(gpx, tio);
+        if (rval != SUCCESS)
+            return rval;
+    }
 
-        case EOSERROR:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: OS error trying to access X3G port");
-            break;
+    if (length == 0) {
+        // we translated a command that has no translation to x3g or is an
+        // accumulation of multiple x3g commands and there still may be
+        // something to do to emulate gcode behavior
+        if (gpx->command.flag & M_IS_SET) {
+            switch (gpx->command.m) {
+                case 23: { // M23 - select SD file
+                    // Some host software expects case insensitivity for M23
+                    long i = sttb_find_nocase(&tio->sttb, gpx->selectedFilename);
+                    if (i >= 0) {
+                        char *s = strdup(tio->sttb.rgs[i]);
+                        if (s != NULL) {
+                            free(gpx->selectedFilename);
+                            gpx->selectedFilename = s;
+                        }
+                    }
+                    // answer to M23, at least on Marlin, Repetier and Sprinter: "File opened:%s Size:%d"
+                    // followed by "File selected:%s Size:%d".  Caller is going to 
+                    // be really surprised when the failure happens on start print
+                    // but other than enumerating all the files again, we don't
+                    // have a way to tell the printer to go check if it can be
+                    // opened
+                    tio_printf(tio, "\nFile opened:%s Size:%d\nFile selected:%s", gpx->selectedFilename, 0, gpx->selectedFilename);
+                    // currently no way to ask Sailfish for the file size, that I can tell :-(
+                    break;
+                }
+                case 105:
+                    // current extruder temps
+                    tio_printf(tio, " T:%u /%u", tio->tool_tr[gpx->current.extruder].temperature, tio->tool_tr[gpx->current.extruder].target);
+
+                    // bed temps
+                    tio_printf(tio, " B:%u /%u", tio->bed_tr.temperature, tio->bed_tr.target);
+
+                    // all extruder temps
+                    if (gpx->machine.extruder_count > 1) {
+                        int i;
+                        for(i = 0; i < gpx->machine.extruder_count; i++)
+                            tio_printf(tio, " T%u:%u /%u", i, tio->tool_tr[i].temperature, tio->tool_tr[i].target);
+                    }
+
+                    // power output (x3g can't tell us)
+                    tio_printf(tio, " @:0 B@:0");
+                    break;
+                case 400:
+                    // the ok waits for the printer to finish what it has,
+                    // and what's queued for it
+                    tio->cur = 0;
+                    tio->translation[0] = 0;
+                    tio->waitflag.waitForEmptyQueue = 1;
+                    break;
+            }
+        }
+        return SUCCESS;
+    }
+
+    command = (unsigned char)buffer[COMMAND_OFFSET];
+
+    // throw any queuable command in the bit bucket while we're waiting for the cancel
+    if (tio->flag.cancelPending && (command & 0x80))
+        return SUCCESS;
+
+    status_forget(tio, buffer);
+    int slot = status_slot(buffer);
+    if (slot >= 0 && status_fresh(tio, slot)) {
+        status_recall(tio, slot);
+        rval = SUCCESS;
+    }
+    else if (!tio->flag.queueing || is_host_query(command)) {
+        rval = port_handler(gpx, &tio->sio, buffer, length);
+        if (rval == SUCCESS && slot >= 0)
+            status_keep(tio, slot);
+    }
+    else if (command & 0x80) {
+        rval = tio_queue_push(gpx, tio, buffer, length);
+    }
+    else {
+        // clear buffer, abort and reset throw away what's queued
+        if (command == 3 || command == 7 || command == 17) {
+            tio->queue.first = 0;
+            tio->queue.count = 0;
+        }
+        rval = tio_queue_flush(gpx, tio);
+        if (rval == SUCCESS)
+            rval = port_handler(gpx, &tio->sio, buffer, length);
+    }
+    if (rval != SUCCESS) {
+        VERBOSE(gpx_log(gpx, "port_handler returned: rval = %d\n", rval);)
+        return rval;
+    }
+
+    return translate_response(gpx, tio, buffer);
+}
+
+static int translate_result(Gpx *gpx, Tio *tio, const char *fmt, va_list ap)
+{
+    int len = 0;
+    if (!strcasecmp(fmt, "@clear_cancel")) {
+        if (tio->upstream == -1 && !tio->flag.cancelPending && gpx->flag.programState == RUNNING_STATE) {
+            // cancel gcode came through before cancel event
+            VERBOSE( gpx_log(gpx, "got @clear_cancel, waiting for abort call\n") );
+            tio->waitflag.waitForCancelSync = 1;
+        }
+        else {
+            tio->waitflag.waitForEmptyQueue = 1;
+        }
+        tio->flag.cancelPending = 0;
+        return 0;
+    }
+    else if (!strcasecmp(fmt, "@iostatus")) {
+        len = tio_printf(tio, "listingFiles: %u\n", tio->flag.listingFiles);
+        len += tio_printf(tio, "getPosWhenReady: %u\n", tio->flag.getPosWhenReady);
+        len += tio_printf(tio, "cancelPending: %u\n", tio->flag.cancelPending);
+        len += tio_printf(tio, "okPending: %u\n", tio->flag.okPending);
+        len += tio_printf(tio, "waitClearedByCancel: %u\n", tio->flag.waitClearedByCancel);
+        len += tio_printf(tio, "clear_on_estop_set: %u\n", tio->flag.clear_on_estop_set);
+        return len;
+    }
+    if (tio->flag.okPending) {
+        tio->flag.okPending = 0;
+        tio_printf(tio, "ok");
+        // ok means: I'm ready for another command, not necessarily that everything worked
+    }
+    if (tio->cur > 0 && tio->translation[tio->cur - 1] != '\n')
+       len = tio_printf(tio, "\n"); 
+    return len + tio_printf(tio, "// echo: ") + tio_vprintf(tio, fmt, ap);
+}
+
+int gpx_return_translation(Gpx *gpx, int rval)
+{
+    Tio *tio = gpx->tio;
+    int waiting = tio->waiting;
+
+    // ENDED -> READY
+    if (gpx->flag.programState > RUNNING_STATE)
+        gpx->flag.programState = READY_STATE;
+    gpx->flag.macrosEnabled = 1;
+
+    // if we're waiting for something and we haven't produced any output
+    // give back current temps
+    if (rval == SUCCESS && tio->waiting && tio->cur == 0) {
+        if(gpx->flag.verboseMode)
+            gpx_log(gpx, "implicit M105\n");
+        strncpy(gpx->buffer.in, "M105", sizeof(gpx->buffer.in));
+        rval = gpx_convert_line(gpx, gpx->buffer.in);
+        if(gpx->flag.verboseMode)
+            gpx_log(gpx, "implicit M105 rval = %d\n", rval);
+    }
+
+    if(gpx->flag.verboseMode)
+        gpx_log(gpx, "gpx_return_translation rval = %d\n", rval);
+    fflush(gpx->log);
+    switch (rval) {
+        case SUCCESS:
+        case END_OF_FILE:
+            break;
+
+        case EOSERROR:
+            tio->cur = 0;
+            tio_printf(tio, "Error: OS error trying to access X3G port");
+            break;
         case ERROR:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: GPX error");
+            tio->cur = 0;
+            tio_printf(tio, "Error: GPX error");
             break;
         case ESIOWRITE:
         case ESIOREAD:
         case ESIOFRAME:
         case ESIOCRC:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: Serial communication error on X3G port. code = %d", rval);
+            tio->cur = 0;
+            tio_printf(tio, "Error: Serial communication error on X3G port. code = %d", rval);
             break;
         case ESIOTIMEOUT:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: Timeout on X3G port");
+            tio->cur = 0;
+            tio_printf(tio, "Error: Timeout on X3G port");
             break;
         case 0x80:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: X3G generic packet error");
+            tio->cur = 0;
+            tio_printf(tio, "Error: X3G generic packet error");
             break;
         case 0x82: // Action buffer overflow
-            tio.waitflag.waitForBuffer = 1;
-            tio.cur = 0;
-            tio_printf(&tio, "Status: Buffer full");
+            tio->waitflag.waitForBuffer = 1;
+            tio->cur = 0;
+            tio_printf(tio, "Status: Buffer full");
             break;
         case 0x83:
             // TODO resend?
-            tio.cur = 0;
-            tio_printf(&tio, "Error: X3G checksum mismatch");
+            tio->cur = 0;
+            tio_printf(tio, "Error: X3G checksum mismatch");
             break;
         case 0x84:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: X3G query packet too big");
+            tio->cur = 0;
+            tio_printf(tio, "Error: X3G query packet too big");
             break;
         case 0x85:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: X3G command not supported or recognized");
+            tio->cur = 0;
+            tio_printf(tio, "Error: X3G command not supported or recognized");
             break;
         case 0x87:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: X3G timeout downstream");
+            tio->cur = 0;
+            tio_printf(tio, "Error: X3G timeout downstream");
             break;
         case 0x88:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: X3G timeout for tool lock");
+            tio->cur = 0;
+            tio_printf(tio, "Error: X3G timeout for tool lock");
             break;
         case 0x89:
-            if (tio.waitflag.waitForBotCancel) {
+            if (tio->waitflag.waitForBotCancel) {
                 // ah, we told the bot to abort, and this 0x89 means that it did
-                tio.waitflag.waitForBotCancel = 0;
+                tio->waitflag.waitForBotCancel = 0;
                 if(gpx->flag.verboseMode)
-                    fprintf(gpx->log, "cleared waitForBotCancel\n");
+                    gpx_log(gpx, "cleared waitForBotCancel\n");
                 rval = SUCCESS;
                 break;
             }
 
             // bot is initiating a cancel
             if (gpx->flag.verboseMode)
-                fprintf(gpx->log, "bot cancelled, now waiting for @clear_cancel\n");
+                gpx_log(gpx, "bot cancelled, now waiting for @clear_cancel\n");
             // we'll only get a @clear_cancel from the host loop, an M112
             // won't come through because the event layer will eat the next
             // event (because it's anticipating this event)
-            tio.flag.cancelPending = 1;
-            tio_clear_state_for_cancel(&tio);
-            tio_printf(&tio, "\nBuild cancelled");
+            tio->flag.cancelPending = 1;
+            tio_clear_state_for_cancel(tio);
+            tio_printf(tio, "\nBuild cancelled");
             break;
         case 0x8A:
-            tio.cur = 0;
-            tio_printf(&tio, "SD printing");
+            tio->cur = 0;
+            tio_printf(tio, "SD printing");
             break;
         case 0x8B:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: RC_BOT_OVERHEAT Printer reports overheat condition");
+            tio->cur = 0;
+            tio_printf(tio, "Error: RC_BOT_OVERHEAT Printer reports overheat condition");
             break;
         case 0x8C:
-            tio.cur = 0;
-            tio_printf(&tio, "Error: timeout");
+            tio->cur = 0;
+            tio_printf(tio, "Error: timeout");
             break;
 
         default:
             if (gpx->flag.verboseMode)
-                fprintf(gpx->log, "Error: Unknown error code: %d", rval);
-            tio.cur = 0;
-            tio_printf(&tio, "Error: Unknown error code: %d", rval);
+                gpx_log(gpx, "Error: Unknown error code: %d", rval);
+            tio->cur = 0;
+            tio_printf(tio, "Error: Unknown error code: %d", rval);
             break;
     }
 
     // if the rval cleared the wait state, we need an ok
-    if(waiting && !tio.waiting) {
+    if(waiting && !tio->waiting) {
         if(gpx->flag.verboseMode)
-            fprintf(gpx->log, "add ok for wait cleared\n");
-        if (tio.cur > 0 && tio.translation[tio.cur - 1] != '\n')
-            tio_printf(&tio, "\n");
-        tio_printf(&tio, "ok");
+            gpx_log(gpx, "add ok for wait cleared\n");
+        if (tio->cur > 0 && tio->translation[tio->cur - 1] != '\n')
+            tio_printf(tio, "\n");
+        tio_printf(tio, "ok");
     }
-    else if (tio.cur > 0 && tio.translation[tio.cur - 1] == '\n')
-        tio.translation[--tio.cur] = 0;
+    else if (tio->cur > 0 && tio->translation[tio->cur - 1] == '\n')
+        tio->translation[--tio->cur] = 0;
 
     fflush(gpx->log);
     return rval;
@@ -836,26 +1210,33 @@ int gpx_return_translation(Gpx *gpx, int rval)
 
 int gpx_write_string_core(Gpx *gpx, const char *s)
 {
-    unsigned waiting = tio.waiting;
+    Tio *tio = gpx->tio;
+    unsigned waiting = tio->waiting;
     if (waiting && gpx->flag.verboseMode)
-        fprintf(gpx->log, "waiting in gpx_write_string\n");
+        gpx_log(gpx, "waiting in gpx_write_string\n");
 
     strncpy(gpx->buffer.in, s, sizeof(gpx->buffer.in));
     int rval = gpx_convert_line(gpx, gpx->buffer.in);
+    // a line's queries are answered with it
+    rval = tio_batch_end(gpx, tio, rval);
+    // the host may wait on the ok before the next line, so what was held
+    // back to go out with the next line's packets can't wait for it
+    if (rval == SUCCESS && tio->sio.port > -1)
+        rval = port_send(gpx, &tio->sio);
 
     if (gpx->flag.verboseMode)
-        fprintf(gpx->log, "gpx_write_string_core rval = %d\n", rval);
+        gpx_log(gpx, "gpx_write_string_core rval = %d\n", rval);
 
-    if (tio.flag.okPending) {
-        tio_printf(&tio, "ok");
+    if (tio->flag.okPending) {
+        tio_printf(tio, "ok");
         // ok means: I'm ready for another command, not necessarily that everything worked
     }
     // if we were waiting, but now we're not, throw an ok on there
-    else if (!tio.waiting && waiting)
-        tio_printf(&tio, "\nok");
-    tio.flag.okPending = 0;
+    else if (!tio->waiting && waiting)
+        tio_printf(tio, "\nok");
+    tio->flag.okPending = 0;
     if (waiting && gpx->flag.verboseMode)
-        fprintf(gpx->log, "leaving gpx_write_string_core %d\n", tio.waiting);
+        gpx_log(gpx, "leaving gpx_write_string_core %d\n", tio->waiting);
     fflush(gpx->log);
 
     return rval;
@@ -868,7 +1249,7 @@ int gpx_write_string(Gpx *gpx, const char *s)
 
 // convert from a long int value to a speed_t constant
 // returns B0 on failure
-speed_t speed_from_long(long *baudrate)
+speed_t speed_from_long(Tio *tio, long *baudrate)
 {
     speed_t speed = B0;
 
@@ -906,7 +1287,7 @@ speed_t speed_from_long(long *baudrate)
             speed=B115200;
             break;
         default:
-            tio_log_printf(&tio, "Error: Unsupported baud rate '%ld'\n", *baudrate);
+            tio_log_printf(tio, "Error: Unsupported baud rate '%ld'\n", *baudrate);
             break;
     }
     return speed;
@@ -914,72 +1295,81 @@ speed_t speed_from_long(long *baudrate)
 
 int gpx_do_wait(Gpx *gpx)
 {
+    Tio *tio = gpx->tio;
     int rval = SUCCESS;
 
     if (gpx->flag.verboseMode)
-        fprintf(gpx->log, "tio.waiting = %u\n", tio.waiting);
-    if (!tio.waitflag.waitForCancelSync) {
-        if (tio.waitflag.waitForUnpause)
+        gpx_log(gpx, "tio->waiting = %u\n", tio->waiting);
+    if (!tio->waitflag.waitForCancelSync) {
+        // the queries that don't depend on each other go together
+        tio_batch_begin(tio);
+        if (tio->waitflag.waitForUnpause)
             rval = get_build_statistics(gpx);
         // if we're waiting for the queue to drain, do that before checking on
         // anything else
-        if (rval == SUCCESS && (tio.waitflag.waitForEmptyQueue || tio.waitflag.waitForButton))
+        if (rval == SUCCESS && (tio->waitflag.waitForEmptyQueue || tio->waitflag.waitForButton))
             rval = is_ready(gpx);
-        if (rval == SUCCESS && !tio.waitflag.waitForEmptyQueue) {
-            if (tio.waitflag.waitForStart || tio.waitflag.waitForBotCancel)
+        rval = tio_batch_end(gpx, tio, rval);
+        if (rval == SUCCESS && !tio->waitflag.waitForEmptyQueue) {
+            tio_batch_begin(tio);
+            if (tio->waitflag.waitForStart || tio->waitflag.waitForBotCancel)
                 rval = get_build_statistics(gpx);
-            if (rval == SUCCESS && tio.waitflag.waitForPlatform)
+            if (rval == SUCCESS && tio->waitflag.waitForPlatform)
                 rval = is_build_platform_ready(gpx, 0);
-            if (rval == SUCCESS && tio.waitflag.waitForExtruderA)
+            if (rval == SUCCESS && tio->waitflag.waitForExtruderA)
                 rval = is_extruder_ready(gpx, 0);
-            if (rval == SUCCESS && tio.waitflag.waitForExtruderB)
+            if (rval == SUCCESS && tio->waitflag.waitForExtruderB)
                 rval = is_extruder_ready(gpx, 1);
+            rval = tio_batch_end(gpx, tio, rval);
         }
     }
     if (gpx->flag.verboseMode)
-        fprintf(gpx->log, "tio.waiting = %u and rval = %d\n", tio.waiting, rval);
+        gpx_log(gpx, "tio->waiting = %u and rval = %d\n", tio->waiting, rval);
     if (rval == SUCCESS) {
-        if (tio.waiting) {
+        if (tio->waiting) {
             if (gpx->flag.verboseMode) {
-                tio_printf(&tio, "// echo: tio.waiting = 0x%x\n", tio.waiting);
+                tio_printf(tio, "// echo: tio->waiting = 0x%x\n", tio->waiting);
             }
             return gpx_write_string_core(gpx, "M105");
         }
-        tio.cur = 0;
-        tio_printf(&tio, "ok");
+        tio->cur = 0;
+        tio_printf(tio, "ok");
     }
     return rval;
 }
 
 int gpx_connect(Gpx *gpx, const char *printer_port, speed_t speed)
 {
+    Tio *tio = gpx->tio;
     // open the port
     if (speed == B0)
         return ESIOBADBAUD;
-    if (!gpx_sio_open(gpx, printer_port, speed, &tio.sio.port))
+    if (!gpx_sio_open(gpx, printer_port, speed, &tio->sio.port))
         return EOSERROR;
 
     // initialize tio
-    tio.gpx = gpx;
-    tio.sio.in = NULL;
-    tio.sio.bytes_out = tio.sio.bytes_in = 0;
-    tio.sio.flag.retryBufferOverflow = 1;
-    tio.sio.flag.shortRetryBufferOverflowOnly = 0;
+    tio->gpx = gpx;
+    tio->sio.in = NULL;
+    tio->sio.bytes_out = tio->sio.bytes_in = 0;
+    tio->sio.flag.retryBufferOverflow = 1;
+    tio->sio.flag.shortRetryBufferOverflowOnly = 0;
+    port_reset(&tio->sio);
+    status_clear(tio);
 
     // set up gpx
     gpx_start_convert(gpx, "", 0);
     gpx->flag.framingEnabled = 1;
     gpx->flag.sioConnected = 1;
-    gpx->sio = &tio.sio;
-    gpx_register_callback(gpx, (int (*)(Gpx*, void*, char*, size_t))translate_handler, &tio);
+    gpx->sio = &tio->sio;
+    gpx_register_callback(gpx, (int (*)(Gpx*, void*, char*, size_t))translate_handler, tio);
     gpx->resultHandler = (int (*)(Gpx*, void*, const char*, va_list))translate_result;
 
-    fprintf(gpx->log, "gpx connected to %s\n", printer_port);
+    gpx_log(gpx, "gpx connected to %s\n", printer_port);
 
     // if the user has CLEAR_FOR_ESTOP set, then we shouldn't send absolute moves
     // to the bot after cancel (ESTOP) until a new coordinate system is defined
     // with G92 or M132.
-    tio.flag.clear_on_estop_set = 0;
+    tio->flag.clear_on_estop_set = 0;
     EepromMap *map = find_eeprom_map(gpx);
     if (map != NULL) {
         gpx->eepromMap = map;
@@ -989,231 +1379,705 @@ int gpx_connect(Gpx *gpx, const char *printer_port, speed_t speed)
             unsigned char b = 0;
             int rval = read_eeprom_8(gpx, gpx->sio, mapping->address, &b);
             if (rval == SUCCESS) {
-                tio.flag.clear_on_estop_set = 1;
+                tio->flag.clear_on_estop_set = 1;
             }
         }
     }
 
-    tio.cur = 0;
-    tio_printf(&tio, "start\n");
+    tio->cur = 0;
+    tio_printf(tio, "start\n");
     return SUCCESS;
 }
 
 static int gpx_create_daemon_port(Gpx *gpx, const char *daemon_port)
 {
+    Tio *tio = gpx->tio;
 #ifdef HAVE_POSIX_OPENPT
     // create the master/slave psuedo-terminal pair
-    if ((tio.upstream = posix_openpt(O_RDWR|O_NOCTTY)) < 0) {
-        fprintf(gpx->log, "Error: Unable to create psuedo terminal (posix_openpt failed). errno = %d\n", errno);
+    if ((tio->upstream = posix_openpt(O_RDWR|O_NOCTTY)) < 0) {
+        gpx_log(gpx, "Error: Unable to create psuedo terminal (posix_openpt failed). errno = %d\n", errno);
         return EOSERROR;
     }
 
     // grant and unlock
-    if (grantpt(tio.upstream) < 0) {
-        fprintf(gpx->log, "Warning: Unable to grant psuedo terminal. errno = %d\n", errno);
+    if (grantpt(tio->upstream) < 0) {
+        gpx_log(gpx, "Warning: Unable to grant psuedo terminal. errno = %d\n", errno);
     }
-    if (unlockpt(tio.upstream) < 0) {
-        fprintf(gpx->log, "Warning: Unable to unlock psuedo terminal. errno = %d\n", errno);
+    if (unlockpt(tio->upstream) < 0) {
+        gpx_log(gpx, "Warning: Unable to unlock psuedo terminal. errno = %d\n", errno);
     }
 
     // figure out the slave end's name
     char *pn = NULL;
-    if ((pn = ptsname(tio.upstream)) == NULL) {
-        fprintf(gpx->log, "Error: Unable to create virtual port (ptsname returned NULL). errno = %d\n", errno);
+    if ((pn = ptsname(tio->upstream)) == NULL) {
+        gpx_log(gpx, "Error: Unable to create virtual port (ptsname returned NULL). errno = %d\n", errno);
         return EOSERROR;
     }
-    fprintf(gpx->log, "Created virtual port: %s.\n", pn);
+    gpx_log(gpx, "Created virtual port: %s.\n", pn);
 
     // create the requested "daemon_port" as a symlink to the slave end
     if (unlink(daemon_port) < 0 && errno != ENOENT) {
-        fprintf(gpx->log, "Error: %s already exists and can't be removed. errno = %d\n", daemon_port, errno);
+        gpx_log(gpx, "Error: %s already exists and can't be removed. errno = %d\n", daemon_port, errno);
         return EOSERROR;
     }
     if (symlink(pn, daemon_port) < 0) {
-        fprintf(gpx->log, "Error: Unable to create the virtual port symlink (%s). errno = %d\n", daemon_port, errno);
+        gpx_log(gpx, "Error: Unable to create the virtual port symlink (%s). errno = %d\n", daemon_port, errno);
         return EOSERROR;
     }
 
     // attempt to set it to raw
     struct termios ti;
-    if(tcgetattr(tio.upstream, &ti) < 0) {
-        fprintf(gpx->log, "Warn: Unable to get virtual port attributes. errno = %d\n", errno);
+    if(tcgetattr(tio->upstream, &ti) < 0) {
+        gpx_log(gpx, "Warn: Unable to get virtual port attributes. errno = %d\n", errno);
     }
     else {
         cfmakeraw(&ti);
-        if(tcsetattr(tio.upstream, TCSANOW, &ti) < 0) {
-            fprintf(gpx->log, "Warn: Unable to set virtual port attributes. errno = %d\n", errno);
+        if(tcsetattr(tio->upstream, TCSANOW, &ti) < 0) {
+            gpx_log(gpx, "Warn: Unable to set virtual port attributes. errno = %d\n", errno);
         }
     }
 
     return SUCCESS;
 #else // !HAVE_POSIX_OPENPT
-    fprintf(gpx->log, "Error: Daemon port (psuedo-terminal) not supported in this build of GPX.\n");
+    gpx_log(gpx, "Error: Daemon port (psuedo-terminal) not supported in this build of GPX.\n");
     return ERROR;
 #endif // !HAVE_POSIX_OPENPT
 }
 
-static void gpx_write_upstream_translation(Gpx *gpx)
+// Daemon mode answers a host on the upstream port as if the printer spoke
+// gcode.  Lines are converted as they come in, a wait (M109, M6 and the like)
+// is checked on the printer on a timer rather than after every line, and what
+// the host hasn't read yet is held until it does, so neither side holds up
+// the other.
+
+#define DAEMON_WAIT_INTERVAL 1.0    // seconds between checks on a wait
+#define DAEMON_HUP_INTERVAL 250     // milliseconds between checks for the host
+
+static void upstream_write(Gpx *gpx, const char *s, size_t length)
 {
-    tio_printf(&tio, "\n");
-    VERBOSE( fprintf(gpx->log, "write: %s", tio.translation); )
-    int len = strlen(tio.translation);
-    if(len != write(tio.upstream, tio.translation, strlen(tio.translation))) {
-        VERBOSE( fprintf(gpx->log, "write on upstream failed to write all bytes.  errno = %d.\n", errno) );
+    Tio *tio = gpx->tio;
+    // anything already held goes first
+    if (tio->pendingLength == 0) {
+        ssize_t bytes = write(tio->upstream, s, length);
+        if (bytes < 0) {
+            // nobody's there to read it
+            if (errno == EIO)
+                return;
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                VERBOSE( gpx_log(gpx, "write on upstream failed to write all bytes.  errno = %d.\n", errno) );
+                return;
+            }
+            bytes = 0;
+        }
+        s += bytes;
+        length -= bytes;
+    }
+    if (length > sizeof(tio->pending) - tio->pendingLength) {
+        gpx_log(gpx, "Error: upstream isn't reading, %lu bytes dropped.\n",
+                (unsigned long)(length - (sizeof(tio->pending) - tio->pendingLength)));
+        length = sizeof(tio->pending) - tio->pendingLength;
     }
-    tio.translation[tio.cur = 0] = 0;
+    memcpy(tio->pending + tio->pendingLength, s, length);
+    tio->pendingLength += length;
+}
+
+static void gpx_write_upstream_translation(Gpx *gpx)
+{
+    Tio *tio = gpx->tio;
+    tio_printf(tio, "\n");
+    VERBOSE( gpx_log(gpx, "write: %s", tio->translation); )
+    upstream_write(gpx, tio->translation, strlen(tio->translation));
+    tio->translation[tio->cur = 0] = 0;
     fflush(gpx->log);
 }
 
-#ifdef HAVE_POLL_H
-static int wait_for_hup_clear(Gpx *gpx, int fd)
+// whether there's room for another reply in what the host hasn't read yet,
+// the host isn't listened to until there is, so no reply is dropped
+
+#define DAEMON_PENDING_ROOM (2 * (BUFFER_MAX + 1))
+
+static int upstream_room(Tio *tio)
 {
-    int send_ok = 0;
-    for (;;send_ok = 1) {
-        struct pollfd ufd;
-        ufd.fd = fd;
-        ufd.events = POLLHUP;
-        if (poll(&ufd, 1, 0) < 0) {
-            fprintf(gpx->log, "Error: poll failed. errno = %d.\n", errno);
-            return EOSERROR;
+    return sizeof(tio->pending) - tio->pendingLength >= DAEMON_PENDING_ROOM;
+}
+
+// answer M20 with the rest of the files while the host keeps up, the daemon
+// loop carries on with it once the host has read some
+
+static void daemon_list_files(Gpx *gpx)
+{
+    Tio *tio = gpx->tio;
+
+    while (tio->flag.listingFiles && upstream_room(tio)) {
+        get_next_filename(gpx, 0);
+        gpx_write_upstream_translation(gpx);
+    }
+}
+
+// check on what we're waiting for and tell the host how it's going
+
+static void daemon_wait(Gpx *gpx)
+{
+    Tio *tio = gpx->tio;
+    int rval = gpx_return_translation(gpx, gpx_do_wait(gpx));
+    if(rval != SUCCESS)
+        gpx_log(gpx, "wait test failed. gpx_do_wait returned %d.", rval);
+    if(tio->cur > 0)
+        gpx_write_upstream_translation(gpx);
+}
+
+// convert a line from the host and answer it, returns EOSERROR when the
+// printer has gone away
+
+static int daemon_line(Gpx *gpx, char *line)
+{
+    Tio *tio = gpx->tio;
+    int rval;
+
+    VERBOSE( gpx_log(gpx, "read a line: %s\n", line); )
+    tio->flag.okPending = !tio->waiting;
+    rval = gpx_write_string(gpx, line);
+    gpx_write_upstream_translation(gpx);
+
+    if(rval == EOSERROR && access(tio->printerPort, R_OK)) {
+        tio_printf(tio, "Error: GPX shutting down, printer disconnected.");
+        gpx_write_upstream_translation(gpx);
+        return EOSERROR;
+    }
+
+    daemon_list_files(gpx);
+
+    if (tio->flag.waitClearedByCancel) {
+        if(gpx->flag.verboseMode)
+            gpx_log(gpx, "adding ok for wait cleared by cancel\n");
+        tio->flag.waitClearedByCancel = 0;
+        tio_printf(tio, "ok");
+        gpx_write_upstream_translation(gpx);
+    }
+
+    // a full buffer is waited out in port_handler, not here
+    tio->waitflag.waitForBuffer = 0;
+    return SUCCESS;
+}
+
+// convert the lines the host has sent while the queue has room for what they
+// make and the host is reading the replies, the part of a line past
+// BUFFER_MAX - 1 characters is dropped
+
+#define DAEMON_LINE_ROOM 16         // packets left free in the queue for a line
+
+static int daemon_input(Gpx *gpx)
+{
+    Tio *tio = gpx->tio;
+    size_t used = 0;
+    int rval = SUCCESS;
+
+    daemon_list_files(gpx);
+    while (used < tio->inputLength) {
+        char *s = tio->input + used;
+        size_t length = tio->inputLength - used;
+        char *end = memchr(s, '\n', length);
+
+        if (tio->lineOverflow) {
+            used += end ? (size_t)(end - s) + 1 : length;
+            tio->lineOverflow = end == NULL;
+            continue;
+        }
+        if (end)
+            length = end - s;
+        else if (length <= BUFFER_MAX - 1)
+            break;
+        if (tio->queue.count + DAEMON_LINE_ROOM > TIO_QUEUE)
+            break;
+        if (tio->flag.listingFiles || !upstream_room(tio))
+            break;
+
+        if (length > BUFFER_MAX - 1) {
+            length = BUFFER_MAX - 1;
+            memcpy(tio->line, s, length);
+            tio->line[length] = '\0';
+            used += length;
+            tio->lineOverflow = 1;
+            // ignore run-on comments, this is actually a little too permissive
+            // since technically we should ignore ';' contained within a
+            // parenthetical comment
+            if(!strchr(tio->line, ';'))
+                tio_printf(tio, "(line %u) Buffer overflow: input exceeds %u character limit, remaining characters in line will be ignored" EOL, gpx->lineNumber, BUFFER_MAX);
+        }
+        else {
+            memcpy(tio->line, s, length);
+            tio->line[length] = '\0';
+            used += length + 1;
         }
-        if (!(ufd.revents & POLLHUP))
+        if(daemon_line(gpx, tio->line) == EOSERROR) {
+            rval = EOSERROR;
             break;
-        short_sleep(250000000L);
+        }
     }
-    if (send_ok) {
-        tio_printf("ok");
-        gpx_write_upstream_translation(gpx);
+    memmove(tio->input, tio->input + used, tio->inputLength - used);
+    tio->inputLength -= used;
+    return rval;
+}
+
+#ifdef HAVE_POLL_H
+// M112 from the host is acted on as soon as it comes in, what's ahead of it
+// waiting to be converted or sent is thrown away
+
+static int is_emergency_stop(const char *s, size_t length)
+{
+    size_t i = 0;
+
+    while (i < length && isspace((unsigned char)s[i]))
+        i++;
+    // skip a line number
+    if (i < length && toupper((unsigned char)s[i]) == 'N') {
+        i++;
+        while (i < length && isdigit((unsigned char)s[i]))
+            i++;
+        while (i < length && isspace((unsigned char)s[i]))
+            i++;
+    }
+    if (length - i < 4 || toupper((unsigned char)s[i]) != 'M' || strncmp(s + i + 1, "112", 3))
+        return 0;
+    return length - i == 4 || !isdigit((unsigned char)s[i + 4]);
+}
+
+static int daemon_emergency(Gpx *gpx)
+{
+    Tio *tio = gpx->tio;
+    size_t i = 0;
+
+    while (i < tio->inputLength) {
+        char *s = tio->input + i;
+        char *end = memchr(s, '\n', tio->inputLength - i);
+        if (end == NULL)
+            break;
+        i += end - s + 1;
+        if (is_emergency_stop(s, end - s)) {
+            VERBOSE( gpx_log(gpx, "emergency stop, dropping %u queued packets\n", tio->queue.count) );
+            memmove(tio->input, tio->input + i, tio->inputLength - i);
+            tio->inputLength -= i;
+            tio->lineOverflow = 0;
+            strcpy(tio->line, "M112");
+            return daemon_line(gpx, tio->line);
+        }
     }
     return SUCCESS;
 }
-#else // !HAVE_POLL_H
-static int wait_for_hup_clear(Gpx *gpx, int fd)
+
+// send what's queued while the printer has room for it, *when is 0 once the
+// queue is empty, HUGE_VAL to try again once the printer answers, otherwise
+// when to try again
+
+static int daemon_send(Gpx *gpx, double *when)
 {
-    short_sleep(500000000L);
+    Tio *tio = gpx->tio;
+    int rval = SUCCESS;
+
+    *when = 0.0;
+    while (tio->queue.count) {
+        unsigned slot = tio->queue.first;
+        rval = port_room(gpx, &tio->sio, tio->queue.packet[slot], tio->queue.length[slot], when);
+        if (rval != SUCCESS || *when != 0.0)
+            break;
+        rval = tio_queue_send(gpx, tio);
+        if (rval != SUCCESS)
+            break;
+    }
+    if (rval == SUCCESS)
+        rval = port_send(gpx, &tio->sio);
+    if (rval != SUCCESS) {
+        // the host has had its ok for what's queued, so there's a gap in the
+        // print, it's stopped like a cancel from the printer and what the host
+        // sends is thrown away until it says it has stopped (@clear_cancel)
+        unsigned lost = tio->queue.count;
+        int cancelled = rval == 0x89;
+        tio->queue.first = 0;
+        tio->queue.count = 0;
+        if (!cancelled)
+            gpx_log(gpx, "Error: sending from the queue failed, %u queued packets lost, stopping the print\n", lost);
+        *when = 0.0;
+        tio->cur = 0;
+        rval = gpx_return_translation(gpx, rval);
+        tio->waitflag.waitForBuffer = 0;
+        if (tio->cur > 0)
+            gpx_write_upstream_translation(gpx);
+        if (rval == EOSERROR && access(tio->printerPort, R_OK)) {
+            tio_printf(tio, "Error: GPX shutting down, printer disconnected.");
+            gpx_write_upstream_translation(gpx);
+            return EOSERROR;
+        }
+        // the printer cancelling has already been dealt with as a cancel
+        if (!cancelled) {
+            tio->flag.cancelPending = 1;
+            tio_clear_state_for_cancel(tio);
+            tio_printf(tio, "Error: Print stopped, %u queued packets were lost", lost);
+            gpx_write_upstream_translation(gpx);
+        }
+    }
     return SUCCESS;
 }
-#endif // !HAVE_POLL_H
+#endif // HAVE_POLL_H
 
 #ifndef _WIN32
 int ready_to_read(int fd)
 {
     fd_set rfds;
     FD_ZERO(&rfds);
-    FD_SET(tio.upstream, &rfds);
+    FD_SET(fd, &rfds);
 
     struct timeval timeout;
     timeout.tv_sec = 1;
     timeout.tv_usec = 0;
 
-    return (select(tio.upstream + 1, &rfds, NULL, NULL, &timeout) > 0);
+    return (select(fd + 1, &rfds, NULL, NULL, &timeout) > 0);
 }
 #endif
 
-int gpx_daemon(Gpx *gpx, int create_port, const char *daemon_port, const char *printer_port, speed_t speed)
+#ifdef HAVE_POLL_H
+static void upstream_flush(Gpx *gpx)
 {
-    int rval = SUCCESS;
-    int overflow = 0;
+    Tio *tio = gpx->tio;
+    ssize_t bytes = write(tio->upstream, tio->pending, tio->pendingLength);
+    if (bytes < 0) {
+        if (errno == EIO)
+            tio->pendingLength = 0;
+        return;
+    }
+    memmove(tio->pending, tio->pending + bytes, tio->pendingLength - bytes);
+    tio->pendingLength -= bytes;
+}
 
-    tio_initialize(gpx);
+// a poll timeout that lasts until when on the host clock
 
-    if (create_port) {
-        if ((rval = gpx_create_daemon_port(gpx, daemon_port)) != SUCCESS)
-            return rval;
+static int milliseconds_until(double when, double now)
+{
+    return when > now ? (int)((when - now) * 1000.0) + 1 : 0;
+}
+
+// stop serving one printer, the others carry on
+
+static void daemon_stop(Gpx *gpx)
+{
+    Tio *tio = gpx->tio;
+
+    tio->stopped = 1;
+    if (tio->sio.port > -1) {
+        close(tio->sio.port);
+        tio->sio.port = -1;
     }
-    else {
-        if ((tio.upstream = open(daemon_port, O_RDWR)) < 0) {
-            fprintf(gpx->log, "Error: Unable to open psuedo terminal (%s). errno = %d\n", daemon_port, errno);
-            return EOSERROR;
+    if (tio->upstream > -1) {
+        upstream_flush(gpx);
+        close(tio->upstream);
+        tio->upstream = -1;
+    }
+    VERBOSE( tio_status_statistics(tio) );
+    gpx_log(gpx, "gpx stopped serving %s\n", tio->printerPort);
+}
+
+// do what a printer can without waiting and fill in what its loop waits on
+// next, fds[0] for the host and fds[1] for the printer, returns the longest
+// the loop may sleep in milliseconds or -1 for as long as it likes
+
+static int daemon_prepare(Gpx *gpx, struct pollfd *fds)
+{
+    Tio *tio = gpx->tio;
+    double now;
+    int timeout = -1;
+
+    fds[0].fd = fds[1].fd = -1;
+    fds[0].events = fds[1].events = 0;
+    fds[0].revents = fds[1].revents = 0;
+    if (tio->stopped)
+        return -1;
+
+    // lines wait in the input for room in the queue, which the printer
+    // makes as it goes
+    if (daemon_send(gpx, &tio->nextSend) == EOSERROR
+            || daemon_input(gpx) == EOSERROR
+            || daemon_send(gpx, &tio->nextSend) == EOSERROR) {
+        daemon_stop(gpx);
+        return -1;
+    }
+    now = host_time();
+    if (tio->nextSend != 0.0 && tio->nextSend != HUGE_VAL)
+        timeout = milliseconds_until(tio->nextSend, now);
+
+    // a wait is checked as soon as it starts and what was queued ahead of
+    // it has been sent, then on the timer, not while the host is away or
+    // isn't reading
+    if (tio->waiting && tio->queue.count == 0) {
+        if (!tio->waitChecked)
+            tio->nextWait = now;
+        if (!tio->hungUp && upstream_room(tio)) {
+            if (now >= tio->nextWait) {
+                daemon_wait(gpx);
+                tio->nextWait = now + DAEMON_WAIT_INTERVAL;
+            }
+            if (timeout < 0 || milliseconds_until(tio->nextWait, now) < timeout)
+                timeout = milliseconds_until(tio->nextWait, now);
         }
     }
+    tio->waitChecked = tio->waiting && tio->queue.count == 0;
+    if (tio->hungUp && (timeout < 0 || timeout > DAEMON_HUP_INTERVAL))
+        timeout = DAEMON_HUP_INTERVAL;
+
+    fds[0].fd = tio->hungUp ? -1 : tio->upstream;
+    // the host isn't listened to while it isn't reading what it's been sent
+    fds[0].events = (tio->inputLength < sizeof(tio->input) && upstream_room(tio) ? POLLIN : 0)
+        | (tio->pendingLength ? POLLOUT : 0);
+    fds[1].fd = tio->sio.port;
+    fds[1].events = tio->nextSend == HUGE_VAL ? POLLIN : 0;
+    return timeout;
+}
 
-    if ((rval = gpx_connect(gpx, printer_port, speed)) != SUCCESS) {
-        return rval;
+// act on what poll found on a printer's ports
+
+static void daemon_events(Gpx *gpx, struct pollfd *fds)
+{
+    Tio *tio = gpx->tio;
+
+    if (tio->stopped)
+        return;
+
+    if (fds[1].revents & (POLLHUP | POLLERR | POLLNVAL)) {
+        tio_printf(tio, "Error: GPX shutting down, printer disconnected.");
+        gpx_write_upstream_translation(gpx);
+        daemon_stop(gpx);
+        return;
+    }
+
+    // the host is back when the port stops reporting the hang up
+    if (tio->hungUp) {
+        fds[0].fd = tio->upstream;
+        fds[0].events = 0;
+        if (poll(fds, 1, 0) >= 0 && !(fds[0].revents & POLLHUP)) {
+            tio->hungUp = 0;
+            tio_printf(tio, "ok");
+            gpx_write_upstream_translation(gpx);
+        }
+        return;
+    }
+
+    if (fds[0].revents & POLLOUT)
+        upstream_flush(gpx);
+    if (fds[0].revents & POLLIN) {
+        ssize_t bytes = read(tio->upstream, tio->input + tio->inputLength, sizeof(tio->input) - tio->inputLength);
+        if (bytes > 0) {
+            tio->inputLength += bytes;
+            if (daemon_emergency(gpx) == EOSERROR)
+                daemon_stop(gpx);
+        }
+        else if (bytes < 0) {
+            switch (errno) {
+                case EIO:
+                    tio->hungUp = 1;
+                    break;
+                case EINTR:
+                case EAGAIN:
+                    break;
+                default:
+                    gpx_log(gpx, "read upstream failed. errno = %d, %s\n", errno, strerror(errno));
+                    daemon_stop(gpx);
+                    break;
+            }
+        }
+    }
+    else if (fds[0].revents & POLLHUP) {
+        tio->hungUp = 1;
+    }
+}
+
+// serve every printer from one poll, until the last of them has gone away
+
+static int daemon_loop(Gpx **printer, int count)
+{
+    struct pollfd *fds;
+    int i;
+
+    if ((fds = calloc(count * 2, sizeof(struct pollfd))) == NULL) {
+        fprintf(printer[0]->log, "Error: Out of memory for %d printers\n", count);
+        return ERROR;
+    }
+    for (i = 0; i < count; i++) {
+        Tio *tio = printer[i]->tio;
+        if (tio->stopped)
+            continue;
+        if (fcntl(tio->upstream, F_SETFL, fcntl(tio->upstream, F_GETFL) | O_NONBLOCK) < 0) {
+            gpx_log(printer[i], "Error: Unable to make the virtual port non-blocking. errno = %d\n", errno);
+            daemon_stop(printer[i]);
+            continue;
+        }
+        tio->flag.queueing = 1;
     }
-    gpx_write_upstream_translation(gpx);
 
-    int bytes_read;
     for (;;) {
-        char *p = gpx->buffer.in;
-        int remaining = BUFFER_MAX;
+        int timeout = -1;
+        int running = 0;
+
+        for (i = 0; i < count; i++) {
+            int t = daemon_prepare(printer[i], fds + i * 2);
+            if (printer[i]->tio->stopped)
+                continue;
+            running++;
+            if (t >= 0 && (timeout < 0 || t < timeout))
+                timeout = t;
+        }
+        if (running == 0)
+            break;
+
+        if (poll(fds, count * 2, timeout) < 0) {
+            if (errno == EINTR)
+                continue;
+            fprintf(printer[0]->log, "Error: poll failed. errno = %d.\n", errno);
+            break;
+        }
+
+        for (i = 0; i < count; i++)
+            daemon_events(printer[i], fds + i * 2);
+    }
+    free(fds);
+    return EOSERROR;
+}
+#else // !HAVE_POLL_H
+static int daemon_loop(Gpx **printer, int count)
+{
+    Gpx *gpx = printer[0];
+    Tio *tio = gpx->tio;
+
+    if (tio->stopped)
+        return EOSERROR;
+    for (;;) {
+        int bytes_read;
 
         // simulate wait loop, if we are waiting
-        tio.waitflag.waitForBuffer = 0;
-        while (tio.waiting) {
-            rval = gpx_return_translation(gpx, gpx_do_wait(gpx));
-            if(rval != SUCCESS)
-                fprintf(gpx->log, "wait test failed. gpx_do_wait returned %d.", rval);
-            if(tio.cur > 0)
-                gpx_write_upstream_translation(gpx);
-            if(ready_to_read(tio.upstream))
+        while (tio->waiting) {
+            daemon_wait(gpx);
+            if(ready_to_read(tio->upstream))
                 break;
         }
 
-        // read a line
-        for(; remaining; remaining--, p++) {
-            while ((bytes_read = read(tio.upstream, p, 1)) != 1) {
-                if (bytes_read < 0) {
-                    switch (errno) {
-                        case EIO:
-                            wait_for_hup_clear(gpx, tio.upstream);
-                            break;
-                        case EINTR:
-                            break;
-                        default:
-                            fprintf(gpx->log, "read upstream failed. errno = %d, %s\n", errno, strerror(errno));
-                            return EOSERROR;
-                    }
-                    VERBOSE( fprintf(gpx->log, "read upstream failed. errno = %d, %s\n", errno, strerror(errno)); )
-                }
-                else {
-                    VERBOSE( fprintf(gpx->log, "read upstream returned 0 bytes.\n"); )
+        while ((bytes_read = read(tio->upstream, tio->input + tio->inputLength, 1)) != 1) {
+            if (bytes_read < 0) {
+                switch (errno) {
+                    case EIO:
+                        short_sleep(500000000L);
+                        break;
+                    case EINTR:
+                        break;
+                    default:
+                        gpx_log(gpx, "read upstream failed. errno = %d, %s\n", errno, strerror(errno));
+                        return EOSERROR;
                 }
             }
-            if(*p == '\n')
-                break;
         }
-        *p = '\0';
-        VERBOSE( fprintf(gpx->log, "read a line: %s\n", gpx->buffer.in); )
+        tio->inputLength++;
+        if (daemon_input(gpx) == EOSERROR)
+            return EOSERROR;
+    }
+}
+#endif // !HAVE_POLL_H
 
-        // detect input buffer overflow and ignore overflow input
-        if(overflow) {
-            if(strlen(gpx->buffer.in) != BUFFER_MAX - 1) {
-                overflow = 0;
-            }
-            continue;
-        }
-        if(strlen(gpx->buffer.in) == BUFFER_MAX - 1) {
-            overflow = 1;
-            // ignore run-on comments, this is actually a little too permissive
-            // since technically we should ignore ';' contained within a
-            // parenthetical comment
-            if(!strchr(gpx->buffer.in, ';'))
-                tio_printf(&tio, "(line %u) Buffer overflow: input exceeds %u character limit, remaining characters in line will be ignored" EOL, gpx->lineNumber, BUFFER_MAX);
-        }
+// open the host's port and the printer's, the printer is stopped when either
+// can't be
 
-        tio.flag.okPending = !tio.waiting;
-        rval = gpx_write_string(gpx, gpx->buffer.in);
-        gpx_write_upstream_translation(gpx);
+static int daemon_start(Gpx *gpx, int create_port, const char *daemon_port, speed_t speed)
+{
+    Tio *tio = gpx->tio;
+    int rval = SUCCESS;
 
-        if(rval == EOSERROR && access(printer_port, R_OK)) {
-            tio_printf(&tio, "Error: GPX shutting down, printer disconnected.\n");
-            break;
+    if (create_port) {
+        rval = gpx_create_daemon_port(gpx, daemon_port);
+    }
+    else if ((tio->upstream = open(daemon_port, O_RDWR)) < 0) {
+        gpx_log(gpx, "Error: Unable to open psuedo terminal (%s). errno = %d\n", daemon_port, errno);
+        rval = EOSERROR;
+    }
+
+    if (rval == SUCCESS)
+        rval = gpx_connect(gpx, tio->printerPort, speed);
+    if (rval != SUCCESS) {
+        tio->stopped = 1;
+        if (tio->upstream > -1) {
+            close(tio->upstream);
+            tio->upstream = -1;
         }
+        return rval;
+    }
+    gpx_write_upstream_translation(gpx);
+    return SUCCESS;
+}
 
-        while(tio.flag.listingFiles) {
-            get_next_filename(gpx, 0);
-            gpx_write_upstream_translation(gpx);
+// serve count printers, printer_port[i] to a host on daemon_port[i]; each
+// printer converts with its own copy of gpx's settings
+
+int gpx_daemon(Gpx *gpx, int count, const int *create_daemon_port, char *const *daemon_port, char *const *printer_port, speed_t speed)
+{
+    Gpx **printer;
+    int i;
+    int started = 0;
+    int rval = SUCCESS;
+
+#ifndef HAVE_POLL_H
+    if (count > 1) {
+        fprintf(gpx->log, "Error: This build of GPX serves only one printer at a time\n");
+        return ERROR;
+    }
+#endif
+    if ((printer = calloc(count, sizeof(Gpx *))) == NULL) {
+        fprintf(gpx->log, "Error: Out of memory for %d printers\n", count);
+        return ERROR;
+    }
+
+    // copy the settings before the first printer's connection changes them
+    printer[0] = gpx;
+    for (i = 1; i < count; i++) {
+        if ((printer[i] = malloc(sizeof(Gpx))) == NULL || gpx_clone(printer[i], gpx) != SUCCESS) {
+            fprintf(gpx->log, "Error: Out of memory for %d printers\n", count);
+            free(printer[i]);
+            count = i;
+            rval = ERROR;
+            goto cleanup;
         }
+    }
 
-        if (tio.flag.waitClearedByCancel) {
-            if(gpx->flag.verboseMode)
-                fprintf(gpx->log, "adding ok for wait cleared by cancel\n");
-            tio.flag.waitClearedByCancel = 0;
-            tio_printf(&tio, "ok");
-            gpx_write_upstream_translation(gpx);
+    for (i = 0; i < count; i++) {
+        Tio *tio = calloc(1, sizeof(Tio));
+        if (tio == NULL) {
+            fprintf(gpx->log, "Error: Out of memory for %d printers\n", count);
+            rval = ERROR;
+            goto cleanup;
         }
+        tio_initialize(tio, printer[i]);
+        tio->printerPort = printer_port[i];
+        rval = daemon_start(printer[i], create_daemon_port[i], daemon_port[i], speed);
+        if (rval == SUCCESS)
+            started++;
+        else
+            fprintf(gpx->log, "Error: Unable to serve %s on %s\n", printer_port[i], daemon_port[i]);
     }
 
+    if (started)
+        rval = daemon_loop(printer, count);
+
+cleanup:
+    for (i = 0; i < count; i++) {
+        Tio *tio = printer[i]->tio;
+        if (tio != NULL) {
+            if (tio->sio.port > -1)
+                close(tio->sio.port);
+            if (tio->upstream > -1)
+                close(tio->upstream);
+            if (tio->sttb.cs > 0)
+                sttb_cleanup(&tio->sttb);
+            free(tio);
+            printer[i]->tio = NULL;
+        }
+        if (i > 0) {
+            gpx_clone_cleanup(printer[i]);
+            free(printer[i]);
+        }
+    }
+    free(printer);
     return rval;
 }
@@ -0,0 +1,216 @@
+//  planner-test.c
+//
+//  Check the planner's print time estimate against worked out moves, or with
+//  -b time it
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "planner.h"
+
+#define RANDOM_COUNT 100000
+#define BENCH_COUNT 1000000
+#define BENCH_ROUNDS 5
+
+static unsigned long failures = 0;
+static unsigned long checked = 0;
+
+static void check(const char *what, double time, double expected)
+{
+    checked++;
+    if(fabs(time - expected) > 1e-9 * (1.0 + expected)) {
+        failures++;
+        fprintf(stderr, "%s: %.9f s, expected %.9f s\n", what, time, expected);
+    }
+}
+
+// the limits of a Replicator 2X
+
+static void replicator_2x(Machine *machine)
+{
+    memset(machine, 0, sizeof(Machine));
+    machine->x.max_accel = 1000;
+    machine->x.max_speed_change = 15;
+    machine->y.max_accel = 1000;
+    machine->y.max_speed_change = 15;
+    machine->z.max_accel = 150;
+    machine->z.max_speed_change = 10;
+    machine->a.max_accel = 2000;
+    machine->a.max_speed_change = 20;
+    machine->b.max_accel = 2000;
+    machine->b.max_speed_change = 20;
+}
+
+static double move(Planner *planner, Machine *machine, double x, double y, double e, double speed)
+{
+    double delta[PLANNER_AXES] = {x, y, 0.0, e, 0.0};
+    return planner_add(planner, machine, delta, sqrt(x * x + y * y), speed);
+}
+
+// accelerate from v0 to v, cruise, decelerate from v to v1
+
+static double trapezoid(double d, double v0, double v, double v1, double a)
+{
+    double up = (v * v - v0 * v0) / (2 * a);
+    double down = (v * v - v1 * v1) / (2 * a);
+    return (v - v0) / a + (v - v1) / a + (d - up - down) / v;
+}
+
+static uint64_t lcg(uint64_t *seed)
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed >> 11;
+}
+
+static double uniform(uint64_t *seed)
+{
+    return (double)lcg(seed) / (double)(1ULL << 53);
+}
+
+static int check_planner(void)
+{
+    Machine machine;
+    Planner planner;
+    double time, lower;
+    uint64_t seed = 1;
+    int i;
+
+    replicator_2x(&machine);
+
+    // one move starts and ends at the speed X can jump to
+    planner_reset(&planner);
+    time = move(&planner, &machine, 100.0, 0.0, 0.0, 100.0);
+    time += planner_stop(&planner);
+    check("straight move", time, trapezoid(100.0, 15.0, 100.0, 15.0, 1000.0));
+
+    // the same move in 1mm pieces runs through the junctions at full speed
+    planner_reset(&planner);
+    for(i = 0, time = 0.0; i < 100; i++)
+        time += move(&planner, &machine, 1.0, 0.0, 0.0, 100.0);
+    time += planner_stop(&planner);
+    check("straight move in pieces", time, trapezoid(100.0, 15.0, 100.0, 15.0, 1000.0));
+
+    // a diagonal accelerates as fast as the slower of its axes allows
+    planner_reset(&planner);
+    time = move(&planner, &machine, 60.0, 80.0, 0.0, 100.0);
+    time += planner_stop(&planner);
+    check("diagonal move", time, trapezoid(100.0, 15.0 / 0.8, 100.0, 15.0 / 0.8, 1000.0 / 0.8));
+
+    // a square corner slows down to where X and Y each change by 15 mm/s
+    planner_reset(&planner);
+    time = move(&planner, &machine, 50.0, 0.0, 0.0, 100.0);
+    time += move(&planner, &machine, 0.0, 50.0, 0.0, 100.0);
+    time += planner_stop(&planner);
+    check("square corner", time, 2 * trapezoid(50.0, 15.0, 100.0, 15.0, 1000.0));
+
+    // a move too short to get up to speed
+    planner_reset(&planner);
+    time = move(&planner, &machine, 1.0, 0.0, 0.0, 100.0);
+    time += planner_stop(&planner);
+    check("short move", time, 2 * (sqrt(15.0 * 15.0 + 1000.0) - 15.0) / 1000.0);
+
+    // the extruder limits a retraction
+    planner_reset(&planner);
+    {
+        double delta[PLANNER_AXES] = {0.0, 0.0, 0.0, -1.0, 0.0};
+        time = planner_add(&planner, &machine, delta, 1.0, 40.0);
+    }
+    time += planner_stop(&planner);
+    check("retraction", time, trapezoid(1.0, 20.0, 40.0, 20.0, 2000.0));
+
+    // no move is faster than its nominal speed, however they are strung together
+    planner_reset(&planner);
+    for(i = 0, time = 0.0, lower = 0.0; i < RANDOM_COUNT; i++) {
+        double x = uniform(&seed) * 20.0 - 10.0;
+        double y = uniform(&seed) * 20.0 - 10.0;
+        double speed = 10.0 + uniform(&seed) * 140.0;
+        lower += sqrt(x * x + y * y) / speed;
+        time += move(&planner, &machine, x, y, 0.05, speed);
+    }
+    time += planner_stop(&planner);
+    checked++;
+    if(!(time >= lower)) {
+        failures++;
+        fprintf(stderr, "random moves: %.6f s, faster than the nominal %.6f s\n", time, lower);
+    }
+
+    printf("%lu of %lu planner checks failed\n", failures, checked);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// time the planner on short moves around a curve, as slicers write them,
+// against the fixed acceleration factor gpx used before
+
+static volatile double sink;
+
+static int benchmark(void)
+{
+    double (*moves)[3] = malloc(BENCH_COUNT * sizeof(*moves));
+    Machine machine;
+    Planner planner;
+    double sum;
+    clock_t t;
+    int i, round;
+
+    if(moves == NULL) return EXIT_FAILURE;
+    replicator_2x(&machine);
+    for(i = 0; i < BENCH_COUNT; i++) {
+        double angle = i * (M_PI / 180.0);
+        double radius = 5.0 + (i / 360 % 40) * 0.4;
+        moves[i][0] = -radius * sin(angle) * (M_PI / 180.0);
+        moves[i][1] = radius * cos(angle) * (M_PI / 180.0);
+        moves[i][2] = i % 360 == 0 ? 200.0 : 30.0;
+    }
+
+    sum = 0.0;
+    t = clock();
+    for(round = 0; round < BENCH_ROUNDS; round++) {
+        for(i = 0; i < BENCH_COUNT; i++) {
+            double distance = sqrt(moves[i][0] * moves[i][0] + moves[i][1] * moves[i][1]);
+            sum += distance / moves[i][2] * 1.15;
+        }
+    }
+    t = clock() - t;
+    sink = sum;
+    printf("acceleration factor: %6.1f ms per million moves\n", (double)t * 1e3 / CLOCKS_PER_SEC / BENCH_ROUNDS * 1000000 / BENCH_COUNT);
+
+    sum = 0.0;
+    t = clock();
+    for(round = 0; round < BENCH_ROUNDS; round++) {
+        planner_reset(&planner);
+        for(i = 0; i < BENCH_COUNT; i++)
+            sum += move(&planner, &machine, moves[i][0], moves[i][1], 0.01, moves[i][2]);
+        sum += planner_stop(&planner);
+    }
+    t = clock() - t;
+    sink = sum;
+    printf("planner:             %6.1f ms per million moves\n", (double)t * 1e3 / CLOCKS_PER_SEC / BENCH_ROUNDS * 1000000 / BENCH_COUNT);
+
+    free(moves);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc > 1 && strcmp(argv[1], "-b") == 0)
+        return benchmark();
+    return check_planner();
+}
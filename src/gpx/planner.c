@@ -0,0 +1,157 @@
+//  planner.c
+//
+//  Print time estimate from a simulation of the firmware's lookahead planner
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#include "planner.h"
+
+// Sailfish plans a buffer of moves so each one is a trapezoid: it accelerates
+// from its entry speed, cruises at its nominal speed and decelerates to the
+// entry speed of the next.  The speed through the junction between two moves
+// is limited so no axis changes speed by more than its max_speed_change, and
+// the last move in the buffer has to be able to stop.  The oldest move is the
+// one executing, so once the buffer is full the move that makes way for a new
+// one has its exit speed settled and can be timed.
+
+void planner_reset(Planner *planner)
+{
+    memset(planner, 0, sizeof(Planner));
+}
+
+// the time a move takes from entry to exit
+
+static double trapezoid_time(PlannerBlock *block, double exit)
+{
+    double a = block->acceleration;
+    double v0 = block->entry;
+    double vc = block->speed;
+    double d = block->distance;
+    double accelerate, decelerate, peak;
+
+    if(a == DBL_MAX) return d / vc;
+    accelerate = (vc * vc - v0 * v0) / (2 * a);
+    decelerate = (vc * vc - exit * exit) / (2 * a);
+    if(accelerate + decelerate <= d) {
+        return (vc - v0) / a + (vc - exit) / a + (d - accelerate - decelerate) / vc;
+    }
+    // never gets up to speed
+    peak = sqrt((2 * a * d + v0 * v0 + exit * exit) / 2);
+    if(peak < v0) peak = v0;
+    if(peak < exit) peak = exit;
+    return (peak - v0) / a + (peak - exit) / a;
+}
+
+double planner_retire(Planner *planner)
+{
+    double exit = planner->count > 1 ? planner->block[1].entry : planner->block[0].maxExit;
+    double time = trapezoid_time(planner->block, exit);
+
+    planner->count--;
+    memmove(planner->block, planner->block + 1, planner->count * sizeof(PlannerBlock));
+    memset(planner->block + planner->count, 0, sizeof(PlannerBlock));
+    return time;
+}
+
+// the fastest a move can enter and still reach speed at its end
+
+static double reach(PlannerBlock *block, double speed)
+{
+    if(block->acceleration == DBL_MAX) return DBL_MAX;
+    return sqrt(speed * speed + 2 * block->acceleration * block->distance);
+}
+
+double planner_add(Planner *planner, const Machine *machine, const double *delta, double distance, double speed)
+{
+    const double accel[PLANNER_AXES] = {
+        machine->x.max_accel, machine->y.max_accel, machine->z.max_accel,
+        machine->a.max_accel, machine->b.max_accel
+    };
+    const double change[PLANNER_AXES] = {
+        machine->x.max_speed_change, machine->y.max_speed_change, machine->z.max_speed_change,
+        machine->a.max_speed_change, machine->b.max_speed_change
+    };
+    double unit[PLANNER_AXES];
+    double time = 0.0;
+    PlannerBlock *block;
+    int i;
+
+    if(distance <= 0.0 || speed <= 0.0) return 0.0;
+    if(planner->count == PLANNER_LOOKAHEAD) time = planner_retire(planner);
+    block = planner->block + planner->count;
+    block->distance = distance;
+    block->speed = speed;
+    block->acceleration = DBL_MAX;
+    // from and to a stop the axes jump to the speed their max_speed_change allows
+    block->maxEntry = planner->speed > 0.0 && planner->speed < speed ? planner->speed : speed;
+    block->maxExit = speed;
+    for(i = 0; i < PLANNER_AXES; i++) {
+        double component, jump;
+        unit[i] = delta[i] / distance;
+        component = fabs(unit[i]);
+        if(component > 0.0 && accel[i] > 0.0 && accel[i] / component < block->acceleration) {
+            block->acceleration = accel[i] / component;
+        }
+        if(component > 0.0 && change[i] > 0.0 && change[i] / component < block->maxExit) {
+            block->maxExit = change[i] / component;
+        }
+        jump = fabs(unit[i] - planner->unit[i]);
+        if(jump > 0.0 && change[i] > 0.0 && change[i] / jump < block->maxEntry) {
+            block->maxEntry = change[i] / jump;
+        }
+    }
+    memcpy(planner->unit, unit, sizeof(unit));
+    planner->speed = speed;
+
+    // the newest move stops at its end, the oldest is already under way, and
+    // once a move's limit comes out as before so do those of the moves before it
+    if(planner->count == 0) {
+        double stop = reach(block, block->maxExit);
+        block->entry = block->stopEntry = block->maxEntry < stop ? block->maxEntry : stop;
+    }
+    else {
+        double next = block->maxExit;
+        int first = planner->count;
+        for(i = planner->count; i > 0; i--) {
+            PlannerBlock *b = planner->block + i;
+            double limit = reach(b, next);
+            if(limit > b->maxEntry) limit = b->maxEntry;
+            if(i < planner->count && limit == b->stopEntry) break;
+            b->stopEntry = next = limit;
+            first = i;
+        }
+        for(i = first; i <= planner->count; i++) {
+            PlannerBlock *b = planner->block + i;
+            double limit = reach(b - 1, b[-1].entry);
+            b->entry = b->stopEntry < limit ? b->stopEntry : limit;
+        }
+    }
+    planner->count++;
+    return time;
+}
+
+double planner_stop(Planner *planner)
+{
+    double time = 0.0;
+
+    while(planner->count) time += planner_retire(planner);
+    memset(planner->unit, 0, sizeof(planner->unit));
+    planner->speed = 0.0;
+    return time;
+}
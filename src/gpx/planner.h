@@ -0,0 +1,62 @@
+//  planner.h
+//
+//  Print time estimate from a simulation of the firmware's lookahead planner
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef __planner_h__
+#define __planner_h__
+
+#include "machine.h"
+
+// the moves Sailfish plans ahead
+#define PLANNER_LOOKAHEAD 16
+// x, y, z, a and b
+#define PLANNER_AXES 5
+
+typedef struct tPlannerBlock {
+    double distance;        // mm
+    double speed;           // nominal speed, mm/s
+    double acceleration;    // mm/s^2
+    double maxEntry;        // fastest the junction into the move allows, mm/s
+    double maxExit;         // fastest the move can come to a stop from, mm/s
+    double stopEntry;       // fastest entry the moves after it can still stop from, mm/s
+    double entry;           // planned entry speed, mm/s
+} PlannerBlock;
+
+// the blocks are kept oldest first and the unused ones zeroed, so two planners
+// that are going to time the moves after them the same compare the same
+typedef struct tPlanner {
+    PlannerBlock block[PLANNER_LOOKAHEAD];
+    int count;
+    double unit[PLANNER_AXES];  // direction of the last move, zero when stopped
+    double speed;               // nominal speed of the last move, zero when stopped
+} Planner;
+
+void planner_reset(Planner *planner);
+
+// plan a move of distance mm at speed mm/s, delta is the signed mm moved on
+// each axis, returns the time in seconds of the move that made way for it,
+// zero until the planner is full
+double planner_add(Planner *planner, const Machine *machine, const double *delta, double distance, double speed);
+
+// time the oldest planned move, as if the moves after it were the last, and
+// drop it
+double planner_retire(Planner *planner);
+
+// come to a stop after the planned moves, returns the time they take
+double planner_stop(Planner *planner);
+
+#endif /* __planner_h__ */
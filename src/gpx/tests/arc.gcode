@@ -0,0 +1,32 @@
+; arcs in each form, turned into chords
+M73 P0
+G21
+G90
+M82
+G92 X0 Y0 Z0 A0 B0 E0
+G1 Z0.2 F1200
+G1 X10 Y0 F3000
+; centre offset, anticlockwise quarter
+G3 X0 Y10 I-10 J0 E1.5 F1800
+; radius, clockwise quarter back
+G2 X10 Y0 R10 E3
+; full circle
+G3 I-10 J0 E6
+; helix up a layer
+G3 X-10 Y0 Z0.4 I-10 J0 E9
+; negative radius goes the long way round
+G2 X0 Y10 R-10 E13.5
+; relative coordinates
+G91
+G2 X10 Y-10 I0 J-10 E1.5
+G90
+; a small hole
+G1 X2 Y0
+G3 X2 Y0 I-1 J0 E14
+; the ZX plane
+G18
+G1 X0 Y0 Z5.4
+G2 X10 Z5.4 I5 K0
+G17
+G1 X0 Y0
+M73 P100
@@ -0,0 +1,255 @@
+; runs of short moves for the move coalescing to merge
+M73 P0
+G21
+G90
+M82
+G92 X0 Y0 Z0 A0 B0 E0
+G1 Z0.2 F1200
+G1 X10 Y0 F6000
+G1 X9.998 Y0.175 E0.00873 F1800
+G1 X9.994 Y0.349 E0.01745 F1800
+G1 X9.986 Y0.523 E0.02618 F1800
+G1 X9.976 Y0.698 E0.03491 F1800
+G1 X9.962 Y0.872 E0.04363 F1800
+G1 X9.945 Y1.045 E0.05236 F1800
+G1 X9.925 Y1.219 E0.06109 F1800
+G1 X9.903 Y1.392 E0.06981 F1800
+G1 X9.877 Y1.564 E0.07854 F1800
+G1 X9.848 Y1.736 E0.08727 F1800
+G1 X9.816 Y1.908 E0.09599 F1800
+G1 X9.781 Y2.079 E0.10472 F1800
+G1 X9.744 Y2.250 E0.11345 F1800
+G1 X9.703 Y2.419 E0.12217 F1800
+G1 X9.659 Y2.588 E0.13090 F1800
+G1 X9.613 Y2.756 E0.13963 F1800
+G1 X9.563 Y2.924 E0.14835 F1800
+G1 X9.511 Y3.090 E0.15708 F1800
+G1 X9.455 Y3.256 E0.16581 F1800
+G1 X9.397 Y3.420 E0.17453 F1800
+G1 X9.336 Y3.584 E0.18326 F1800
+G1 X9.272 Y3.746 E0.19199 F1800
+G1 X9.205 Y3.907 E0.20071 F1800
+G1 X9.135 Y4.067 E0.20944 F1800
+G1 X9.063 Y4.226 E0.21817 F1800
+G1 X8.988 Y4.384 E0.22689 F1800
+G1 X8.910 Y4.540 E0.23562 F1800
+G1 X8.829 Y4.695 E0.24435 F1800
+G1 X8.746 Y4.848 E0.25307 F1800
+G1 X8.660 Y5.000 E0.26180 F1800
+G1 X8.572 Y5.150 E0.27053 F1800
+G1 X8.480 Y5.299 E0.27925 F1800
+G1 X8.387 Y5.446 E0.28798 F1800
+G1 X8.290 Y5.592 E0.29671 F1800
+G1 X8.192 Y5.736 E0.30543 F1800
+G1 X8.090 Y5.878 E0.31416 F1800
+G1 X7.986 Y6.018 E0.32289 F1800
+G1 X7.880 Y6.157 E0.33161 F1800
+G1 X7.771 Y6.293 E0.34034 F1800
+G1 X7.660 Y6.428 E0.34907 F1800
+G1 X7.547 Y6.561 E0.35779 F1800
+G1 X7.431 Y6.691 E0.36652 F1800
+G1 X7.314 Y6.820 E0.37525 F1800
+G1 X7.193 Y6.947 E0.38397 F1800
+G1 X7.071 Y7.071 E0.39270 F1800
+G1 X6.947 Y7.193 E0.40143 F1800
+G1 X6.820 Y7.314 E0.41015 F1800
+G1 X6.691 Y7.431 E0.41888 F1800
+G1 X6.561 Y7.547 E0.42761 F1800
+G1 X6.428 Y7.660 E0.43633 F1800
+G1 X6.293 Y7.771 E0.44506 F1800
+G1 X6.157 Y7.880 E0.45379 F1800
+G1 X6.018 Y7.986 E0.46251 F1800
+G1 X5.878 Y8.090 E0.47124 F1800
+G1 X5.736 Y8.192 E0.47997 F1800
+G1 X5.592 Y8.290 E0.48869 F1800
+G1 X5.446 Y8.387 E0.49742 F1800
+G1 X5.299 Y8.480 E0.50615 F1800
+G1 X5.150 Y8.572 E0.51487 F1800
+G1 X5.000 Y8.660 E0.52360 F1800
+G1 X4.848 Y8.746 E0.53233 F1800
+G1 X4.695 Y8.829 E0.54105 F1800
+G1 X4.540 Y8.910 E0.54978 F1800
+G1 X4.384 Y8.988 E0.55851 F1800
+G1 X4.226 Y9.063 E0.56723 F1800
+G1 X4.067 Y9.135 E0.57596 F1800
+G1 X3.907 Y9.205 E0.58469 F1800
+G1 X3.746 Y9.272 E0.59341 F1800
+G1 X3.584 Y9.336 E0.60214 F1800
+G1 X3.420 Y9.397 E0.61087 F1800
+G1 X3.256 Y9.455 E0.61959 F1800
+G1 X3.090 Y9.511 E0.62832 F1800
+G1 X2.924 Y9.563 E0.63705 F1800
+G1 X2.756 Y9.613 E0.64577 F1800
+G1 X2.588 Y9.659 E0.65450 F1800
+G1 X2.419 Y9.703 E0.66323 F1800
+G1 X2.250 Y9.744 E0.67195 F1800
+G1 X2.079 Y9.781 E0.68068 F1800
+G1 X1.908 Y9.816 E0.68941 F1800
+G1 X1.736 Y9.848 E0.69813 F1800
+G1 X1.564 Y9.877 E0.70686 F1800
+G1 X1.392 Y9.903 E0.71558 F1800
+G1 X1.219 Y9.925 E0.72431 F1800
+G1 X1.045 Y9.945 E0.73304 F1800
+G1 X0.872 Y9.962 E0.74176 F1800
+G1 X0.698 Y9.976 E0.75049 F1800
+G1 X0.523 Y9.986 E0.75922 F1800
+G1 X0.349 Y9.994 E0.76794 F1800
+G1 X0.175 Y9.998 E0.77667 F1800
+G1 X0.000 Y10.000 E0.78540 F1800
+G1 X-0.500 Y10.000 E0.81040
+G1 X-1.000 Y10.000 E0.83540
+G1 X-1.500 Y10.000 E0.86040
+G1 X-2.000 Y10.000 E0.88540
+G1 X-2.500 Y10.000 E0.91040
+G1 X-3.000 Y10.000 E0.93540
+G1 X-3.500 Y10.000 E0.96040
+G1 X-4.000 Y10.000 E0.98540
+G1 X-4.500 Y10.000 E1.01040
+G1 X-5.000 Y10.000 E1.03540
+G1 X-5.500 Y10.000 E1.06040
+G1 X-6.000 Y10.000 E1.08540
+G1 X-6.500 Y10.000 E1.11040
+G1 X-7.000 Y10.000 E1.13540
+G1 X-7.500 Y10.000 E1.16040
+G1 X-8.000 Y10.000 E1.18540
+G1 X-8.500 Y10.000 E1.21040
+G1 X-9.000 Y10.000 E1.23540
+G1 X-9.500 Y10.000 E1.26040
+G1 X-10.000 Y10.000 E1.28540
+G1 E0.28540 F2400
+G1 X-10.000 Y9.000 F6000
+G1 X-10.000 Y8.000 F6000
+G1 X-10.000 Y7.000 F6000
+G1 X-10.000 Y6.000 F6000
+G1 X-10.000 Y5.000 F6000
+G1 X-10.000 Y4.000 F6000
+G1 X-10.000 Y3.000 F6000
+G1 X-10.000 Y2.000 F6000
+G1 X-10.000 Y1.000 F6000
+G1 X-10.000 Y0.000 F6000
+G1 E1.28540 F2400
+G1 Z0.4 F1200
+G1 X10 Y0 F6000
+G1 X9.998 Y0.175 E1.29412 F1800
+G1 X9.994 Y0.349 E1.30285 F1800
+G1 X9.986 Y0.523 E1.31158 F1800
+G1 X9.976 Y0.698 E1.32030 F1800
+G1 X9.962 Y0.872 E1.32903 F1800
+G1 X9.945 Y1.045 E1.33776 F1800
+G1 X9.925 Y1.219 E1.34648 F1800
+G1 X9.903 Y1.392 E1.35521 F1800
+G1 X9.877 Y1.564 E1.36394 F1800
+G1 X9.848 Y1.736 E1.37266 F1800
+G1 X9.816 Y1.908 E1.38139 F1800
+G1 X9.781 Y2.079 E1.39012 F1800
+G1 X9.744 Y2.250 E1.39884 F1800
+G1 X9.703 Y2.419 E1.40757 F1800
+G1 X9.659 Y2.588 E1.41630 F1800
+G1 X9.613 Y2.756 E1.42502 F1800
+G1 X9.563 Y2.924 E1.43375 F1800
+G1 X9.511 Y3.090 E1.44248 F1800
+G1 X9.455 Y3.256 E1.45120 F1800
+G1 X9.397 Y3.420 E1.45993 F1800
+G1 X9.336 Y3.584 E1.46866 F1800
+G1 X9.272 Y3.746 E1.47738 F1800
+G1 X9.205 Y3.907 E1.48611 F1800
+G1 X9.135 Y4.067 E1.49484 F1800
+G1 X9.063 Y4.226 E1.50356 F1800
+G1 X8.988 Y4.384 E1.51229 F1800
+G1 X8.910 Y4.540 E1.52102 F1800
+G1 X8.829 Y4.695 E1.52974 F1800
+G1 X8.746 Y4.848 E1.53847 F1800
+G1 X8.660 Y5.000 E1.54720 F1800
+G1 X8.572 Y5.150 E1.55592 F1800
+G1 X8.480 Y5.299 E1.56465 F1800
+G1 X8.387 Y5.446 E1.57338 F1800
+G1 X8.290 Y5.592 E1.58210 F1800
+G1 X8.192 Y5.736 E1.59083 F1800
+G1 X8.090 Y5.878 E1.59956 F1800
+G1 X7.986 Y6.018 E1.60828 F1800
+G1 X7.880 Y6.157 E1.61701 F1800
+G1 X7.771 Y6.293 E1.62574 F1800
+G1 X7.660 Y6.428 E1.63446 F1800
+G1 X7.547 Y6.561 E1.64319 F1800
+G1 X7.431 Y6.691 E1.65192 F1800
+G1 X7.314 Y6.820 E1.66064 F1800
+G1 X7.193 Y6.947 E1.66937 F1800
+G1 X7.071 Y7.071 E1.67810 F1800
+G1 X6.947 Y7.193 E1.68682 F1800
+G1 X6.820 Y7.314 E1.69555 F1800
+G1 X6.691 Y7.431 E1.70428 F1800
+G1 X6.561 Y7.547 E1.71300 F1800
+G1 X6.428 Y7.660 E1.72173 F1800
+G1 X6.293 Y7.771 E1.73046 F1800
+G1 X6.157 Y7.880 E1.73918 F1800
+G1 X6.018 Y7.986 E1.74791 F1800
+G1 X5.878 Y8.090 E1.75664 F1800
+G1 X5.736 Y8.192 E1.76536 F1800
+G1 X5.592 Y8.290 E1.77409 F1800
+G1 X5.446 Y8.387 E1.78282 F1800
+G1 X5.299 Y8.480 E1.79154 F1800
+G1 X5.150 Y8.572 E1.80027 F1800
+G1 X5.000 Y8.660 E1.80900 F1800
+G1 X4.848 Y8.746 E1.81772 F1800
+G1 X4.695 Y8.829 E1.82645 F1800
+G1 X4.540 Y8.910 E1.83518 F1800
+G1 X4.384 Y8.988 E1.84390 F1800
+G1 X4.226 Y9.063 E1.85263 F1800
+G1 X4.067 Y9.135 E1.86136 F1800
+G1 X3.907 Y9.205 E1.87008 F1800
+G1 X3.746 Y9.272 E1.87881 F1800
+G1 X3.584 Y9.336 E1.88754 F1800
+G1 X3.420 Y9.397 E1.89626 F1800
+G1 X3.256 Y9.455 E1.90499 F1800
+G1 X3.090 Y9.511 E1.91372 F1800
+G1 X2.924 Y9.563 E1.92244 F1800
+G1 X2.756 Y9.613 E1.93117 F1800
+G1 X2.588 Y9.659 E1.93990 F1800
+G1 X2.419 Y9.703 E1.94862 F1800
+G1 X2.250 Y9.744 E1.95735 F1800
+G1 X2.079 Y9.781 E1.96608 F1800
+G1 X1.908 Y9.816 E1.97480 F1800
+G1 X1.736 Y9.848 E1.98353 F1800
+G1 X1.564 Y9.877 E1.99226 F1800
+G1 X1.392 Y9.903 E2.00098 F1800
+G1 X1.219 Y9.925 E2.00971 F1800
+G1 X1.045 Y9.945 E2.01844 F1800
+G1 X0.872 Y9.962 E2.02716 F1800
+G1 X0.698 Y9.976 E2.03589 F1800
+G1 X0.523 Y9.986 E2.04462 F1800
+G1 X0.349 Y9.994 E2.05334 F1800
+G1 X0.175 Y9.998 E2.06207 F1800
+G1 X0.000 Y10.000 E2.07080 F1800
+G1 X-0.500 Y10.000 E2.09580
+G1 X-1.000 Y10.000 E2.12080
+G1 X-1.500 Y10.000 E2.14580
+G1 X-2.000 Y10.000 E2.17080
+G1 X-2.500 Y10.000 E2.19580
+G1 X-3.000 Y10.000 E2.22080
+G1 X-3.500 Y10.000 E2.24580
+G1 X-4.000 Y10.000 E2.27080
+G1 X-4.500 Y10.000 E2.29580
+G1 X-5.000 Y10.000 E2.32080
+G1 X-5.500 Y10.000 E2.34580
+G1 X-6.000 Y10.000 E2.37080
+G1 X-6.500 Y10.000 E2.39580
+G1 X-7.000 Y10.000 E2.42080
+G1 X-7.500 Y10.000 E2.44580
+G1 X-8.000 Y10.000 E2.47080
+G1 X-8.500 Y10.000 E2.49580
+G1 X-9.000 Y10.000 E2.52080
+G1 X-9.500 Y10.000 E2.54580
+G1 X-10.000 Y10.000 E2.57080
+G1 E1.57080 F2400
+G1 X-10.000 Y9.000 F6000
+G1 X-10.000 Y8.000 F6000
+G1 X-10.000 Y7.000 F6000
+G1 X-10.000 Y6.000 F6000
+G1 X-10.000 Y5.000 F6000
+G1 X-10.000 Y4.000 F6000
+G1 X-10.000 Y3.000 F6000
+G1 X-10.000 Y2.000 F6000
+G1 X-10.000 Y1.000 F6000
+G1 X-10.000 Y0.000 F6000
+G1 E2.57080 F2400
+M73 P100
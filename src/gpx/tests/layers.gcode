@@ -0,0 +1,6722 @@
+; generated test part: 24 layers of a ring with a square infill
+M73 P0
+M104 S230 T0
+M104 S230 T1
+M140 S110
+G21
+G90
+M82
+G28
+M109 S230 T0
+M190 S110
+G92 X0 Y0 Z0 E0
+G1 Z5 F3000
+;LAYER:0
+G1 Z0.20 F1200
+G1 E-1.00000 F2400
+G1 X20.000 Y0.000 F9000
+G1 E0.00000 F2400
+G1 X19.924 Y1.743 E0.05775 F1800
+G1 X19.696 Y3.473 E0.11550 F1800
+G1 X19.319 Y5.176 E0.17326 F1800
+G1 X18.794 Y6.840 E0.23101 F1800
+G1 X18.126 Y8.452 E0.28876 F1800
+G1 X17.321 Y10.000 E0.34651 F1800
+G1 X16.383 Y11.472 E0.40426 F1800
+G1 X15.321 Y12.856 E0.46202 F1800
+G1 X14.142 Y14.142 E0.51977 F1800
+G1 X12.856 Y15.321 E0.57752 F1800
+G1 X11.472 Y16.383 E0.63527 F1800
+G1 X10.000 Y17.321 E0.69302 F1800
+G1 X8.452 Y18.126 E0.75078 F1800
+G1 X6.840 Y18.794 E0.80853 F1800
+G1 X5.176 Y19.319 E0.86628 F1800
+G1 X3.473 Y19.696 E0.92403 F1800
+G1 X1.743 Y19.924 E0.98179 F1800
+G1 X0.000 Y20.000 E1.03954 F1800
+G1 X-1.743 Y19.924 E1.09729 F1800
+G1 X-3.473 Y19.696 E1.15504 F1800
+G1 X-5.176 Y19.319 E1.21279 F1800
+G1 X-6.840 Y18.794 E1.27055 F1800
+G1 X-8.452 Y18.126 E1.32830 F1800
+G1 X-10.000 Y17.321 E1.38605 F1800
+G1 X-11.472 Y16.383 E1.44380 F1800
+G1 X-12.856 Y15.321 E1.50155 F1800
+G1 X-14.142 Y14.142 E1.55931 F1800
+G1 X-15.321 Y12.856 E1.61706 F1800
+G1 X-16.383 Y11.472 E1.67481 F1800
+G1 X-17.321 Y10.000 E1.73256 F1800
+G1 X-18.126 Y8.452 E1.79031 F1800
+G1 X-18.794 Y6.840 E1.84807 F1800
+G1 X-19.319 Y5.176 E1.90582 F1800
+G1 X-19.696 Y3.473 E1.96357 F1800
+G1 X-19.924 Y1.743 E2.02132 F1800
+G1 X-20.000 Y0.000 E2.07907 F1800
+G1 X-19.924 Y-1.743 E2.13683 F1800
+G1 X-19.696 Y-3.473 E2.19458 F1800
+G1 X-19.319 Y-5.176 E2.25233 F1800
+G1 X-18.794 Y-6.840 E2.31008 F1800
+G1 X-18.126 Y-8.452 E2.36783 F1800
+G1 X-17.321 Y-10.000 E2.42559 F1800
+G1 X-16.383 Y-11.472 E2.48334 F1800
+G1 X-15.321 Y-12.856 E2.54109 F1800
+G1 X-14.142 Y-14.142 E2.59884 F1800
+G1 X-12.856 Y-15.321 E2.65660 F1800
+G1 X-11.472 Y-16.383 E2.71435 F1800
+G1 X-10.000 Y-17.321 E2.77210 F1800
+G1 X-8.452 Y-18.126 E2.82985 F1800
+G1 X-6.840 Y-18.794 E2.88760 F1800
+G1 X-5.176 Y-19.319 E2.94536 F1800
+G1 X-3.473 Y-19.696 E3.00311 F1800
+G1 X-1.743 Y-19.924 E3.06086 F1800
+G1 X-0.000 Y-20.000 E3.11861 F1800
+G1 X1.743 Y-19.924 E3.17636 F1800
+G1 X3.473 Y-19.696 E3.23412 F1800
+G1 X5.176 Y-19.319 E3.29187 F1800
+G1 X6.840 Y-18.794 E3.34962 F1800
+G1 X8.452 Y-18.126 E3.40737 F1800
+G1 X10.000 Y-17.321 E3.46512 F1800
+G1 X11.472 Y-16.383 E3.52288 F1800
+G1 X12.856 Y-15.321 E3.58063 F1800
+G1 X14.142 Y-14.142 E3.63838 F1800
+G1 X15.321 Y-12.856 E3.69613 F1800
+G1 X16.383 Y-11.472 E3.75388 F1800
+G1 X17.321 Y-10.000 E3.81164 F1800
+G1 X18.126 Y-8.452 E3.86939 F1800
+G1 X18.794 Y-6.840 E3.92714 F1800
+G1 X19.319 Y-5.176 E3.98489 F1800
+G1 X19.696 Y-3.473 E4.04264 F1800
+G1 X19.924 Y-1.743 E4.10040 F1800
+G1 X20.000 Y-0.000 E4.15815 F1800
+G1 X19.525 Y1.708 E4.21683 F2400
+G1 X19.302 Y3.404 E4.27343 F2400
+G1 X18.932 Y5.073 E4.33003 F2400
+G1 X18.418 Y6.704 E4.38662 F2400
+G1 X17.764 Y8.283 E4.44322 F2400
+G1 X16.974 Y9.800 E4.49982 F2400
+G1 X16.055 Y11.242 E4.55642 F2400
+G1 X15.014 Y12.599 E4.61301 F2400
+G1 X13.859 Y13.859 E4.66961 F2400
+G1 X12.599 Y15.014 E4.72621 F2400
+G1 X11.242 Y16.055 E4.78280 F2400
+G1 X9.800 Y16.974 E4.83940 F2400
+G1 X8.283 Y17.764 E4.89600 F2400
+G1 X6.704 Y18.418 E4.95260 F2400
+G1 X5.073 Y18.932 E5.00919 F2400
+G1 X3.404 Y19.302 E5.06579 F2400
+G1 X1.708 Y19.525 E5.12239 F2400
+G1 X0.000 Y19.600 E5.17898 F2400
+G1 X-1.708 Y19.525 E5.23558 F2400
+G1 X-3.404 Y19.302 E5.29218 F2400
+G1 X-5.073 Y18.932 E5.34877 F2400
+G1 X-6.704 Y18.418 E5.40537 F2400
+G1 X-8.283 Y17.764 E5.46197 F2400
+G1 X-9.800 Y16.974 E5.51857 F2400
+G1 X-11.242 Y16.055 E5.57516 F2400
+G1 X-12.599 Y15.014 E5.63176 F2400
+G1 X-13.859 Y13.859 E5.68836 F2400
+G1 X-15.014 Y12.599 E5.74495 F2400
+G1 X-16.055 Y11.242 E5.80155 F2400
+G1 X-16.974 Y9.800 E5.85815 F2400
+G1 X-17.764 Y8.283 E5.91474 F2400
+G1 X-18.418 Y6.704 E5.97134 F2400
+G1 X-18.932 Y5.073 E6.02794 F2400
+G1 X-19.302 Y3.404 E6.08454 F2400
+G1 X-19.525 Y1.708 E6.14113 F2400
+G1 X-19.600 Y0.000 E6.19773 F2400
+G1 X-19.525 Y-1.708 E6.25433 F2400
+G1 X-19.302 Y-3.404 E6.31092 F2400
+G1 X-18.932 Y-5.073 E6.36752 F2400
+G1 X-18.418 Y-6.704 E6.42412 F2400
+G1 X-17.764 Y-8.283 E6.48071 F2400
+G1 X-16.974 Y-9.800 E6.53731 F2400
+G1 X-16.055 Y-11.242 E6.59391 F2400
+G1 X-15.014 Y-12.599 E6.65051 F2400
+G1 X-13.859 Y-13.859 E6.70710 F2400
+G1 X-12.599 Y-15.014 E6.76370 F2400
+G1 X-11.242 Y-16.055 E6.82030 F2400
+G1 X-9.800 Y-16.974 E6.87689 F2400
+G1 X-8.283 Y-17.764 E6.93349 F2400
+G1 X-6.704 Y-18.418 E6.99009 F2400
+G1 X-5.073 Y-18.932 E7.04669 F2400
+G1 X-3.404 Y-19.302 E7.10328 F2400
+G1 X-1.708 Y-19.525 E7.15988 F2400
+G1 X-0.000 Y-19.600 E7.21648 F2400
+G1 X1.708 Y-19.525 E7.27307 F2400
+G1 X3.404 Y-19.302 E7.32967 F2400
+G1 X5.073 Y-18.932 E7.38627 F2400
+G1 X6.704 Y-18.418 E7.44286 F2400
+G1 X8.283 Y-17.764 E7.49946 F2400
+G1 X9.800 Y-16.974 E7.55606 F2400
+G1 X11.242 Y-16.055 E7.61266 F2400
+G1 X12.599 Y-15.014 E7.66925 F2400
+G1 X13.859 Y-13.859 E7.72585 F2400
+G1 X15.014 Y-12.599 E7.78245 F2400
+G1 X16.055 Y-11.242 E7.83904 F2400
+G1 X16.974 Y-9.800 E7.89564 F2400
+G1 X17.764 Y-8.283 E7.95224 F2400
+G1 X18.418 Y-6.704 E8.00883 F2400
+G1 X18.932 Y-5.073 E8.06543 F2400
+G1 X19.302 Y-3.404 E8.12203 F2400
+G1 X19.525 Y-1.708 E8.17863 F2400
+G1 X19.600 Y-0.000 E8.23522 F2400
+G1 X19.127 Y1.673 E8.29278 F2400
+G1 X18.908 Y3.334 E8.34822 F2400
+G1 X18.546 Y4.969 E8.40367 F2400
+G1 X18.042 Y6.567 E8.45911 F2400
+G1 X17.401 Y8.114 E8.51455 F2400
+G1 X16.628 Y9.600 E8.56999 F2400
+G1 X15.728 Y11.013 E8.62543 F2400
+G1 X14.708 Y12.342 E8.68088 F2400
+G1 X13.576 Y13.576 E8.73632 F2400
+G1 X12.342 Y14.708 E8.79176 F2400
+G1 X11.013 Y15.728 E8.84720 F2400
+G1 X9.600 Y16.628 E8.90264 F2400
+G1 X8.114 Y17.401 E8.95809 F2400
+G1 X6.567 Y18.042 E9.01353 F2400
+G1 X4.969 Y18.546 E9.06897 F2400
+G1 X3.334 Y18.908 E9.12441 F2400
+G1 X1.673 Y19.127 E9.17985 F2400
+G1 X0.000 Y19.200 E9.23530 F2400
+G1 X-1.673 Y19.127 E9.29074 F2400
+G1 X-3.334 Y18.908 E9.34618 F2400
+G1 X-4.969 Y18.546 E9.40162 F2400
+G1 X-6.567 Y18.042 E9.45706 F2400
+G1 X-8.114 Y17.401 E9.51251 F2400
+G1 X-9.600 Y16.628 E9.56795 F2400
+G1 X-11.013 Y15.728 E9.62339 F2400
+G1 X-12.342 Y14.708 E9.67883 F2400
+G1 X-13.576 Y13.576 E9.73427 F2400
+G1 X-14.708 Y12.342 E9.78972 F2400
+G1 X-15.728 Y11.013 E9.84516 F2400
+G1 X-16.628 Y9.600 E9.90060 F2400
+G1 X-17.401 Y8.114 E9.95604 F2400
+G1 X-18.042 Y6.567 E10.01148 F2400
+G1 X-18.546 Y4.969 E10.06693 F2400
+G1 X-18.908 Y3.334 E10.12237 F2400
+G1 X-19.127 Y1.673 E10.17781 F2400
+G1 X-19.200 Y0.000 E10.23325 F2400
+G1 X-19.127 Y-1.673 E10.28869 F2400
+G1 X-18.908 Y-3.334 E10.34414 F2400
+G1 X-18.546 Y-4.969 E10.39958 F2400
+G1 X-18.042 Y-6.567 E10.45502 F2400
+G1 X-17.401 Y-8.114 E10.51046 F2400
+G1 X-16.628 Y-9.600 E10.56590 F2400
+G1 X-15.728 Y-11.013 E10.62135 F2400
+G1 X-14.708 Y-12.342 E10.67679 F2400
+G1 X-13.576 Y-13.576 E10.73223 F2400
+G1 X-12.342 Y-14.708 E10.78767 F2400
+G1 X-11.013 Y-15.728 E10.84311 F2400
+G1 X-9.600 Y-16.628 E10.89856 F2400
+G1 X-8.114 Y-17.401 E10.95400 F2400
+G1 X-6.567 Y-18.042 E11.00944 F2400
+G1 X-4.969 Y-18.546 E11.06488 F2400
+G1 X-3.334 Y-18.908 E11.12032 F2400
+G1 X-1.673 Y-19.127 E11.17577 F2400
+G1 X-0.000 Y-19.200 E11.23121 F2400
+G1 X1.673 Y-19.127 E11.28665 F2400
+G1 X3.334 Y-18.908 E11.34209 F2400
+G1 X4.969 Y-18.546 E11.39753 F2400
+G1 X6.567 Y-18.042 E11.45298 F2400
+G1 X8.114 Y-17.401 E11.50842 F2400
+G1 X9.600 Y-16.628 E11.56386 F2400
+G1 X11.013 Y-15.728 E11.61930 F2400
+G1 X12.342 Y-14.708 E11.67474 F2400
+G1 X13.576 Y-13.576 E11.73019 F2400
+G1 X14.708 Y-12.342 E11.78563 F2400
+G1 X15.728 Y-11.013 E11.84107 F2400
+G1 X16.628 Y-9.600 E11.89651 F2400
+G1 X17.401 Y-8.114 E11.95195 F2400
+G1 X18.042 Y-6.567 E12.00740 F2400
+G1 X18.546 Y-4.969 E12.06284 F2400
+G1 X18.908 Y-3.334 E12.11828 F2400
+G1 X19.127 Y-1.673 E12.17372 F2400
+G1 X19.200 Y-0.000 E12.22916 F2400
+G1 E11.22916 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E12.22916 F2400
+G1 X12.000 Y-12.000 E13.02356 F3600
+G1 X12.000 Y-11.000 E13.05666 F3600
+G1 X-12.000 Y-11.000 E13.85106 F3600
+G1 X-12.000 Y-10.000 E13.88416 F3600
+G1 X12.000 Y-10.000 E14.67856 F3600
+G1 X12.000 Y-9.000 E14.71166 F3600
+G1 X-12.000 Y-9.000 E15.50606 F3600
+G1 X-12.000 Y-8.000 E15.53916 F3600
+G1 X12.000 Y-8.000 E16.33356 F3600
+G1 X12.000 Y-7.000 E16.36666 F3600
+G1 X-12.000 Y-7.000 E17.16106 F3600
+G1 X-12.000 Y-6.000 E17.19416 F3600
+G1 X12.000 Y-6.000 E17.98856 F3600
+G1 X12.000 Y-5.000 E18.02166 F3600
+G1 X-12.000 Y-5.000 E18.81606 F3600
+G1 X-12.000 Y-4.000 E18.84916 F3600
+G1 X12.000 Y-4.000 E19.64356 F3600
+G1 X12.000 Y-3.000 E19.67666 F3600
+G1 X-12.000 Y-3.000 E20.47106 F3600
+G1 X-12.000 Y-2.000 E20.50416 F3600
+G1 X12.000 Y-2.000 E21.29856 F3600
+G1 X12.000 Y-1.000 E21.33166 F3600
+G1 X-12.000 Y-1.000 E22.12606 F3600
+G1 X-12.000 Y0.000 E22.15916 F3600
+G1 X12.000 Y0.000 E22.95356 F3600
+G1 X12.000 Y1.000 E22.98666 F3600
+G1 X-12.000 Y1.000 E23.78106 F3600
+G1 X-12.000 Y2.000 E23.81416 F3600
+G1 X12.000 Y2.000 E24.60856 F3600
+G1 X12.000 Y3.000 E24.64166 F3600
+G1 X-12.000 Y3.000 E25.43606 F3600
+G1 X-12.000 Y4.000 E25.46916 F3600
+G1 X12.000 Y4.000 E26.26356 F3600
+G1 X12.000 Y5.000 E26.29666 F3600
+G1 X-12.000 Y5.000 E27.09106 F3600
+G1 X-12.000 Y6.000 E27.12416 F3600
+G1 X12.000 Y6.000 E27.91856 F3600
+G1 X12.000 Y7.000 E27.95166 F3600
+G1 X-12.000 Y7.000 E28.74606 F3600
+G1 X-12.000 Y8.000 E28.77916 F3600
+G1 X12.000 Y8.000 E29.57356 F3600
+G1 X12.000 Y9.000 E29.60666 F3600
+G1 X-12.000 Y9.000 E30.40106 F3600
+G1 X-12.000 Y10.000 E30.43416 F3600
+G1 X12.000 Y10.000 E31.22856 F3600
+G1 X12.000 Y11.000 E31.26166 F3600
+G1 X-12.000 Y11.000 E32.05606 F3600
+G1 X-12.000 Y12.000 E32.08916 F3600
+G1 X12.000 Y12.000 E32.88356 F3600
+;LAYER:1
+M106 S255
+G1 Z0.40 F1200
+G1 E31.88356 F2400
+G1 X20.000 Y0.000 F9000
+G1 E32.88356 F2400
+G1 X19.924 Y1.743 E32.94132 F1800
+G1 X19.696 Y3.473 E32.99907 F1800
+G1 X19.319 Y5.176 E33.05682 F1800
+G1 X18.794 Y6.840 E33.11457 F1800
+G1 X18.126 Y8.452 E33.17232 F1800
+G1 X17.321 Y10.000 E33.23008 F1800
+G1 X16.383 Y11.472 E33.28783 F1800
+G1 X15.321 Y12.856 E33.34558 F1800
+G1 X14.142 Y14.142 E33.40333 F1800
+G1 X12.856 Y15.321 E33.46108 F1800
+G1 X11.472 Y16.383 E33.51884 F1800
+G1 X10.000 Y17.321 E33.57659 F1800
+G1 X8.452 Y18.126 E33.63434 F1800
+G1 X6.840 Y18.794 E33.69209 F1800
+G1 X5.176 Y19.319 E33.74984 F1800
+G1 X3.473 Y19.696 E33.80760 F1800
+G1 X1.743 Y19.924 E33.86535 F1800
+G1 X0.000 Y20.000 E33.92310 F1800
+G1 X-1.743 Y19.924 E33.98085 F1800
+G1 X-3.473 Y19.696 E34.03860 F1800
+G1 X-5.176 Y19.319 E34.09636 F1800
+G1 X-6.840 Y18.794 E34.15411 F1800
+G1 X-8.452 Y18.126 E34.21186 F1800
+G1 X-10.000 Y17.321 E34.26961 F1800
+G1 X-11.472 Y16.383 E34.32737 F1800
+G1 X-12.856 Y15.321 E34.38512 F1800
+G1 X-14.142 Y14.142 E34.44287 F1800
+G1 X-15.321 Y12.856 E34.50062 F1800
+G1 X-16.383 Y11.472 E34.55837 F1800
+G1 X-17.321 Y10.000 E34.61613 F1800
+G1 X-18.126 Y8.452 E34.67388 F1800
+G1 X-18.794 Y6.840 E34.73163 F1800
+G1 X-19.319 Y5.176 E34.78938 F1800
+G1 X-19.696 Y3.473 E34.84713 F1800
+G1 X-19.924 Y1.743 E34.90489 F1800
+G1 X-20.000 Y0.000 E34.96264 F1800
+G1 X-19.924 Y-1.743 E35.02039 F1800
+G1 X-19.696 Y-3.473 E35.07814 F1800
+G1 X-19.319 Y-5.176 E35.13589 F1800
+G1 X-18.794 Y-6.840 E35.19365 F1800
+G1 X-18.126 Y-8.452 E35.25140 F1800
+G1 X-17.321 Y-10.000 E35.30915 F1800
+G1 X-16.383 Y-11.472 E35.36690 F1800
+G1 X-15.321 Y-12.856 E35.42465 F1800
+G1 X-14.142 Y-14.142 E35.48241 F1800
+G1 X-12.856 Y-15.321 E35.54016 F1800
+G1 X-11.472 Y-16.383 E35.59791 F1800
+G1 X-10.000 Y-17.321 E35.65566 F1800
+G1 X-8.452 Y-18.126 E35.71341 F1800
+G1 X-6.840 Y-18.794 E35.77117 F1800
+G1 X-5.176 Y-19.319 E35.82892 F1800
+G1 X-3.473 Y-19.696 E35.88667 F1800
+G1 X-1.743 Y-19.924 E35.94442 F1800
+G1 X-0.000 Y-20.000 E36.00218 F1800
+G1 X1.743 Y-19.924 E36.05993 F1800
+G1 X3.473 Y-19.696 E36.11768 F1800
+G1 X5.176 Y-19.319 E36.17543 F1800
+G1 X6.840 Y-18.794 E36.23318 F1800
+G1 X8.452 Y-18.126 E36.29094 F1800
+G1 X10.000 Y-17.321 E36.34869 F1800
+G1 X11.472 Y-16.383 E36.40644 F1800
+G1 X12.856 Y-15.321 E36.46419 F1800
+G1 X14.142 Y-14.142 E36.52194 F1800
+G1 X15.321 Y-12.856 E36.57970 F1800
+G1 X16.383 Y-11.472 E36.63745 F1800
+G1 X17.321 Y-10.000 E36.69520 F1800
+G1 X18.126 Y-8.452 E36.75295 F1800
+G1 X18.794 Y-6.840 E36.81070 F1800
+G1 X19.319 Y-5.176 E36.86846 F1800
+G1 X19.696 Y-3.473 E36.92621 F1800
+G1 X19.924 Y-1.743 E36.98396 F1800
+G1 X20.000 Y-0.000 E37.04171 F1800
+G1 X19.525 Y1.708 E37.10040 F2400
+G1 X19.302 Y3.404 E37.15699 F2400
+G1 X18.932 Y5.073 E37.21359 F2400
+G1 X18.418 Y6.704 E37.27019 F2400
+G1 X17.764 Y8.283 E37.32679 F2400
+G1 X16.974 Y9.800 E37.38338 F2400
+G1 X16.055 Y11.242 E37.43998 F2400
+G1 X15.014 Y12.599 E37.49658 F2400
+G1 X13.859 Y13.859 E37.55317 F2400
+G1 X12.599 Y15.014 E37.60977 F2400
+G1 X11.242 Y16.055 E37.66637 F2400
+G1 X9.800 Y16.974 E37.72296 F2400
+G1 X8.283 Y17.764 E37.77956 F2400
+G1 X6.704 Y18.418 E37.83616 F2400
+G1 X5.073 Y18.932 E37.89276 F2400
+G1 X3.404 Y19.302 E37.94935 F2400
+G1 X1.708 Y19.525 E38.00595 F2400
+G1 X0.000 Y19.600 E38.06255 F2400
+G1 X-1.708 Y19.525 E38.11914 F2400
+G1 X-3.404 Y19.302 E38.17574 F2400
+G1 X-5.073 Y18.932 E38.23234 F2400
+G1 X-6.704 Y18.418 E38.28893 F2400
+G1 X-8.283 Y17.764 E38.34553 F2400
+G1 X-9.800 Y16.974 E38.40213 F2400
+G1 X-11.242 Y16.055 E38.45873 F2400
+G1 X-12.599 Y15.014 E38.51532 F2400
+G1 X-13.859 Y13.859 E38.57192 F2400
+G1 X-15.014 Y12.599 E38.62852 F2400
+G1 X-16.055 Y11.242 E38.68511 F2400
+G1 X-16.974 Y9.800 E38.74171 F2400
+G1 X-17.764 Y8.283 E38.79831 F2400
+G1 X-18.418 Y6.704 E38.85491 F2400
+G1 X-18.932 Y5.073 E38.91150 F2400
+G1 X-19.302 Y3.404 E38.96810 F2400
+G1 X-19.525 Y1.708 E39.02470 F2400
+G1 X-19.600 Y0.000 E39.08129 F2400
+G1 X-19.525 Y-1.708 E39.13789 F2400
+G1 X-19.302 Y-3.404 E39.19449 F2400
+G1 X-18.932 Y-5.073 E39.25108 F2400
+G1 X-18.418 Y-6.704 E39.30768 F2400
+G1 X-17.764 Y-8.283 E39.36428 F2400
+G1 X-16.974 Y-9.800 E39.42088 F2400
+G1 X-16.055 Y-11.242 E39.47747 F2400
+G1 X-15.014 Y-12.599 E39.53407 F2400
+G1 X-13.859 Y-13.859 E39.59067 F2400
+G1 X-12.599 Y-15.014 E39.64726 F2400
+G1 X-11.242 Y-16.055 E39.70386 F2400
+G1 X-9.800 Y-16.974 E39.76046 F2400
+G1 X-8.283 Y-17.764 E39.81705 F2400
+G1 X-6.704 Y-18.418 E39.87365 F2400
+G1 X-5.073 Y-18.932 E39.93025 F2400
+G1 X-3.404 Y-19.302 E39.98685 F2400
+G1 X-1.708 Y-19.525 E40.04344 F2400
+G1 X-0.000 Y-19.600 E40.10004 F2400
+G1 X1.708 Y-19.525 E40.15664 F2400
+G1 X3.404 Y-19.302 E40.21323 F2400
+G1 X5.073 Y-18.932 E40.26983 F2400
+G1 X6.704 Y-18.418 E40.32643 F2400
+G1 X8.283 Y-17.764 E40.38302 F2400
+G1 X9.800 Y-16.974 E40.43962 F2400
+G1 X11.242 Y-16.055 E40.49622 F2400
+G1 X12.599 Y-15.014 E40.55282 F2400
+G1 X13.859 Y-13.859 E40.60941 F2400
+G1 X15.014 Y-12.599 E40.66601 F2400
+G1 X16.055 Y-11.242 E40.72261 F2400
+G1 X16.974 Y-9.800 E40.77920 F2400
+G1 X17.764 Y-8.283 E40.83580 F2400
+G1 X18.418 Y-6.704 E40.89240 F2400
+G1 X18.932 Y-5.073 E40.94900 F2400
+G1 X19.302 Y-3.404 E41.00559 F2400
+G1 X19.525 Y-1.708 E41.06219 F2400
+G1 X19.600 Y-0.000 E41.11879 F2400
+G1 X19.127 Y1.673 E41.17635 F2400
+G1 X18.908 Y3.334 E41.23179 F2400
+G1 X18.546 Y4.969 E41.28723 F2400
+G1 X18.042 Y6.567 E41.34267 F2400
+G1 X17.401 Y8.114 E41.39811 F2400
+G1 X16.628 Y9.600 E41.45356 F2400
+G1 X15.728 Y11.013 E41.50900 F2400
+G1 X14.708 Y12.342 E41.56444 F2400
+G1 X13.576 Y13.576 E41.61988 F2400
+G1 X12.342 Y14.708 E41.67532 F2400
+G1 X11.013 Y15.728 E41.73077 F2400
+G1 X9.600 Y16.628 E41.78621 F2400
+G1 X8.114 Y17.401 E41.84165 F2400
+G1 X6.567 Y18.042 E41.89709 F2400
+G1 X4.969 Y18.546 E41.95253 F2400
+G1 X3.334 Y18.908 E42.00798 F2400
+G1 X1.673 Y19.127 E42.06342 F2400
+G1 X0.000 Y19.200 E42.11886 F2400
+G1 X-1.673 Y19.127 E42.17430 F2400
+G1 X-3.334 Y18.908 E42.22974 F2400
+G1 X-4.969 Y18.546 E42.28519 F2400
+G1 X-6.567 Y18.042 E42.34063 F2400
+G1 X-8.114 Y17.401 E42.39607 F2400
+G1 X-9.600 Y16.628 E42.45151 F2400
+G1 X-11.013 Y15.728 E42.50695 F2400
+G1 X-12.342 Y14.708 E42.56240 F2400
+G1 X-13.576 Y13.576 E42.61784 F2400
+G1 X-14.708 Y12.342 E42.67328 F2400
+G1 X-15.728 Y11.013 E42.72872 F2400
+G1 X-16.628 Y9.600 E42.78416 F2400
+G1 X-17.401 Y8.114 E42.83961 F2400
+G1 X-18.042 Y6.567 E42.89505 F2400
+G1 X-18.546 Y4.969 E42.95049 F2400
+G1 X-18.908 Y3.334 E43.00593 F2400
+G1 X-19.127 Y1.673 E43.06137 F2400
+G1 X-19.200 Y0.000 E43.11682 F2400
+G1 X-19.127 Y-1.673 E43.17226 F2400
+G1 X-18.908 Y-3.334 E43.22770 F2400
+G1 X-18.546 Y-4.969 E43.28314 F2400
+G1 X-18.042 Y-6.567 E43.33858 F2400
+G1 X-17.401 Y-8.114 E43.39403 F2400
+G1 X-16.628 Y-9.600 E43.44947 F2400
+G1 X-15.728 Y-11.013 E43.50491 F2400
+G1 X-14.708 Y-12.342 E43.56035 F2400
+G1 X-13.576 Y-13.576 E43.61579 F2400
+G1 X-12.342 Y-14.708 E43.67124 F2400
+G1 X-11.013 Y-15.728 E43.72668 F2400
+G1 X-9.600 Y-16.628 E43.78212 F2400
+G1 X-8.114 Y-17.401 E43.83756 F2400
+G1 X-6.567 Y-18.042 E43.89300 F2400
+G1 X-4.969 Y-18.546 E43.94845 F2400
+G1 X-3.334 Y-18.908 E44.00389 F2400
+G1 X-1.673 Y-19.127 E44.05933 F2400
+G1 X-0.000 Y-19.200 E44.11477 F2400
+G1 X1.673 Y-19.127 E44.17021 F2400
+G1 X3.334 Y-18.908 E44.22566 F2400
+G1 X4.969 Y-18.546 E44.28110 F2400
+G1 X6.567 Y-18.042 E44.33654 F2400
+G1 X8.114 Y-17.401 E44.39198 F2400
+G1 X9.600 Y-16.628 E44.44742 F2400
+G1 X11.013 Y-15.728 E44.50287 F2400
+G1 X12.342 Y-14.708 E44.55831 F2400
+G1 X13.576 Y-13.576 E44.61375 F2400
+G1 X14.708 Y-12.342 E44.66919 F2400
+G1 X15.728 Y-11.013 E44.72463 F2400
+G1 X16.628 Y-9.600 E44.78008 F2400
+G1 X17.401 Y-8.114 E44.83552 F2400
+G1 X18.042 Y-6.567 E44.89096 F2400
+G1 X18.546 Y-4.969 E44.94640 F2400
+G1 X18.908 Y-3.334 E45.00184 F2400
+G1 X19.127 Y-1.673 E45.05729 F2400
+G1 X19.200 Y-0.000 E45.11273 F2400
+G1 E44.11273 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E45.11273 F2400
+G1 X-12.000 Y12.000 E45.90713 F3600
+G1 X-11.200 Y12.000 E45.93361 F3600
+G1 X-11.200 Y-12.000 E46.72801 F3600
+G1 X-10.400 Y-12.000 E46.75449 F3600
+G1 X-10.400 Y12.000 E47.54889 F3600
+G1 X-9.600 Y12.000 E47.57537 F3600
+G1 X-9.600 Y-12.000 E48.36977 F3600
+G1 X-8.800 Y-12.000 E48.39625 F3600
+G1 X-8.800 Y12.000 E49.19065 F3600
+G1 X-8.000 Y12.000 E49.21713 F3600
+G1 X-8.000 Y-12.000 E50.01153 F3600
+G1 X-7.200 Y-12.000 E50.03801 F3600
+G1 X-7.200 Y12.000 E50.83241 F3600
+G1 X-6.400 Y12.000 E50.85889 F3600
+G1 X-6.400 Y-12.000 E51.65329 F3600
+G1 X-5.600 Y-12.000 E51.67977 F3600
+G1 X-5.600 Y12.000 E52.47417 F3600
+G1 X-4.800 Y12.000 E52.50065 F3600
+G1 X-4.800 Y-12.000 E53.29505 F3600
+G1 X-4.000 Y-12.000 E53.32153 F3600
+G1 X-4.000 Y12.000 E54.11593 F3600
+G1 X-3.200 Y12.000 E54.14241 F3600
+G1 X-3.200 Y-12.000 E54.93681 F3600
+G1 X-2.400 Y-12.000 E54.96329 F3600
+G1 X-2.400 Y12.000 E55.75769 F3600
+G1 X-1.600 Y12.000 E55.78417 F3600
+G1 X-1.600 Y-12.000 E56.57857 F3600
+G1 X-0.800 Y-12.000 E56.60505 F3600
+G1 X-0.800 Y12.000 E57.39945 F3600
+G1 X0.000 Y12.000 E57.42593 F3600
+G1 X0.000 Y-12.000 E58.22033 F3600
+G1 X0.800 Y-12.000 E58.24681 F3600
+G1 X0.800 Y12.000 E59.04121 F3600
+G1 X1.600 Y12.000 E59.06769 F3600
+G1 X1.600 Y-12.000 E59.86209 F3600
+G1 X2.400 Y-12.000 E59.88857 F3600
+G1 X2.400 Y12.000 E60.68297 F3600
+G1 X3.200 Y12.000 E60.70945 F3600
+G1 X3.200 Y-12.000 E61.50385 F3600
+G1 X4.000 Y-12.000 E61.53033 F3600
+G1 X4.000 Y12.000 E62.32473 F3600
+G1 X4.800 Y12.000 E62.35121 F3600
+G1 X4.800 Y-12.000 E63.14561 F3600
+G1 X5.600 Y-12.000 E63.17209 F3600
+G1 X5.600 Y12.000 E63.96649 F3600
+G1 X6.400 Y12.000 E63.99297 F3600
+G1 X6.400 Y-12.000 E64.78737 F3600
+G1 X7.200 Y-12.000 E64.81385 F3600
+G1 X7.200 Y12.000 E65.60825 F3600
+G1 X8.000 Y12.000 E65.63473 F3600
+G1 X8.000 Y-12.000 E66.42913 F3600
+G1 X8.800 Y-12.000 E66.45561 F3600
+G1 X8.800 Y12.000 E67.25001 F3600
+G1 X9.600 Y12.000 E67.27649 F3600
+G1 X9.600 Y-12.000 E68.07089 F3600
+G1 X10.400 Y-12.000 E68.09737 F3600
+G1 X10.400 Y12.000 E68.89177 F3600
+G1 X11.200 Y12.000 E68.91825 F3600
+G1 X11.200 Y-12.000 E69.71265 F3600
+G1 X12.000 Y-12.000 E69.73913 F3600
+G1 X12.000 Y12.000 E70.53353 F3600
+;LAYER:2
+G1 Z0.60 F1200
+G1 E69.53353 F2400
+G1 X20.000 Y0.000 F9000
+G1 E70.53353 F2400
+G1 X19.924 Y1.743 E70.59128 F1800
+G1 X19.696 Y3.473 E70.64903 F1800
+G1 X19.319 Y5.176 E70.70678 F1800
+G1 X18.794 Y6.840 E70.76454 F1800
+G1 X18.126 Y8.452 E70.82229 F1800
+G1 X17.321 Y10.000 E70.88004 F1800
+G1 X16.383 Y11.472 E70.93779 F1800
+G1 X15.321 Y12.856 E70.99554 F1800
+G1 X14.142 Y14.142 E71.05330 F1800
+G1 X12.856 Y15.321 E71.11105 F1800
+G1 X11.472 Y16.383 E71.16880 F1800
+G1 X10.000 Y17.321 E71.22655 F1800
+G1 X8.452 Y18.126 E71.28430 F1800
+G1 X6.840 Y18.794 E71.34206 F1800
+G1 X5.176 Y19.319 E71.39981 F1800
+G1 X3.473 Y19.696 E71.45756 F1800
+G1 X1.743 Y19.924 E71.51531 F1800
+G1 X0.000 Y20.000 E71.57306 F1800
+G1 X-1.743 Y19.924 E71.63082 F1800
+G1 X-3.473 Y19.696 E71.68857 F1800
+G1 X-5.176 Y19.319 E71.74632 F1800
+G1 X-6.840 Y18.794 E71.80407 F1800
+G1 X-8.452 Y18.126 E71.86182 F1800
+G1 X-10.000 Y17.321 E71.91958 F1800
+G1 X-11.472 Y16.383 E71.97733 F1800
+G1 X-12.856 Y15.321 E72.03508 F1800
+G1 X-14.142 Y14.142 E72.09283 F1800
+G1 X-15.321 Y12.856 E72.15059 F1800
+G1 X-16.383 Y11.472 E72.20834 F1800
+G1 X-17.321 Y10.000 E72.26609 F1800
+G1 X-18.126 Y8.452 E72.32384 F1800
+G1 X-18.794 Y6.840 E72.38159 F1800
+G1 X-19.319 Y5.176 E72.43935 F1800
+G1 X-19.696 Y3.473 E72.49710 F1800
+G1 X-19.924 Y1.743 E72.55485 F1800
+G1 X-20.000 Y0.000 E72.61260 F1800
+G1 X-19.924 Y-1.743 E72.67035 F1800
+G1 X-19.696 Y-3.473 E72.72811 F1800
+G1 X-19.319 Y-5.176 E72.78586 F1800
+G1 X-18.794 Y-6.840 E72.84361 F1800
+G1 X-18.126 Y-8.452 E72.90136 F1800
+G1 X-17.321 Y-10.000 E72.95911 F1800
+G1 X-16.383 Y-11.472 E73.01687 F1800
+G1 X-15.321 Y-12.856 E73.07462 F1800
+G1 X-14.142 Y-14.142 E73.13237 F1800
+G1 X-12.856 Y-15.321 E73.19012 F1800
+G1 X-11.472 Y-16.383 E73.24787 F1800
+G1 X-10.000 Y-17.321 E73.30563 F1800
+G1 X-8.452 Y-18.126 E73.36338 F1800
+G1 X-6.840 Y-18.794 E73.42113 F1800
+G1 X-5.176 Y-19.319 E73.47888 F1800
+G1 X-3.473 Y-19.696 E73.53663 F1800
+G1 X-1.743 Y-19.924 E73.59439 F1800
+G1 X-0.000 Y-20.000 E73.65214 F1800
+G1 X1.743 Y-19.924 E73.70989 F1800
+G1 X3.473 Y-19.696 E73.76764 F1800
+G1 X5.176 Y-19.319 E73.82540 F1800
+G1 X6.840 Y-18.794 E73.88315 F1800
+G1 X8.452 Y-18.126 E73.94090 F1800
+G1 X10.000 Y-17.321 E73.99865 F1800
+G1 X11.472 Y-16.383 E74.05640 F1800
+G1 X12.856 Y-15.321 E74.11416 F1800
+G1 X14.142 Y-14.142 E74.17191 F1800
+G1 X15.321 Y-12.856 E74.22966 F1800
+G1 X16.383 Y-11.472 E74.28741 F1800
+G1 X17.321 Y-10.000 E74.34516 F1800
+G1 X18.126 Y-8.452 E74.40292 F1800
+G1 X18.794 Y-6.840 E74.46067 F1800
+G1 X19.319 Y-5.176 E74.51842 F1800
+G1 X19.696 Y-3.473 E74.57617 F1800
+G1 X19.924 Y-1.743 E74.63392 F1800
+G1 X20.000 Y-0.000 E74.69168 F1800
+G1 X19.525 Y1.708 E74.75036 F2400
+G1 X19.302 Y3.404 E74.80696 F2400
+G1 X18.932 Y5.073 E74.86355 F2400
+G1 X18.418 Y6.704 E74.92015 F2400
+G1 X17.764 Y8.283 E74.97675 F2400
+G1 X16.974 Y9.800 E75.03335 F2400
+G1 X16.055 Y11.242 E75.08994 F2400
+G1 X15.014 Y12.599 E75.14654 F2400
+G1 X13.859 Y13.859 E75.20314 F2400
+G1 X12.599 Y15.014 E75.25973 F2400
+G1 X11.242 Y16.055 E75.31633 F2400
+G1 X9.800 Y16.974 E75.37293 F2400
+G1 X8.283 Y17.764 E75.42953 F2400
+G1 X6.704 Y18.418 E75.48612 F2400
+G1 X5.073 Y18.932 E75.54272 F2400
+G1 X3.404 Y19.302 E75.59932 F2400
+G1 X1.708 Y19.525 E75.65591 F2400
+G1 X0.000 Y19.600 E75.71251 F2400
+G1 X-1.708 Y19.525 E75.76911 F2400
+G1 X-3.404 Y19.302 E75.82570 F2400
+G1 X-5.073 Y18.932 E75.88230 F2400
+G1 X-6.704 Y18.418 E75.93890 F2400
+G1 X-8.283 Y17.764 E75.99550 F2400
+G1 X-9.800 Y16.974 E76.05209 F2400
+G1 X-11.242 Y16.055 E76.10869 F2400
+G1 X-12.599 Y15.014 E76.16529 F2400
+G1 X-13.859 Y13.859 E76.22188 F2400
+G1 X-15.014 Y12.599 E76.27848 F2400
+G1 X-16.055 Y11.242 E76.33508 F2400
+G1 X-16.974 Y9.800 E76.39167 F2400
+G1 X-17.764 Y8.283 E76.44827 F2400
+G1 X-18.418 Y6.704 E76.50487 F2400
+G1 X-18.932 Y5.073 E76.56147 F2400
+G1 X-19.302 Y3.404 E76.61806 F2400
+G1 X-19.525 Y1.708 E76.67466 F2400
+G1 X-19.600 Y0.000 E76.73126 F2400
+G1 X-19.525 Y-1.708 E76.78785 F2400
+G1 X-19.302 Y-3.404 E76.84445 F2400
+G1 X-18.932 Y-5.073 E76.90105 F2400
+G1 X-18.418 Y-6.704 E76.95764 F2400
+G1 X-17.764 Y-8.283 E77.01424 F2400
+G1 X-16.974 Y-9.800 E77.07084 F2400
+G1 X-16.055 Y-11.242 E77.12744 F2400
+G1 X-15.014 Y-12.599 E77.18403 F2400
+G1 X-13.859 Y-13.859 E77.24063 F2400
+G1 X-12.599 Y-15.014 E77.29723 F2400
+G1 X-11.242 Y-16.055 E77.35382 F2400
+G1 X-9.800 Y-16.974 E77.41042 F2400
+G1 X-8.283 Y-17.764 E77.46702 F2400
+G1 X-6.704 Y-18.418 E77.52362 F2400
+G1 X-5.073 Y-18.932 E77.58021 F2400
+G1 X-3.404 Y-19.302 E77.63681 F2400
+G1 X-1.708 Y-19.525 E77.69341 F2400
+G1 X-0.000 Y-19.600 E77.75000 F2400
+G1 X1.708 Y-19.525 E77.80660 F2400
+G1 X3.404 Y-19.302 E77.86320 F2400
+G1 X5.073 Y-18.932 E77.91979 F2400
+G1 X6.704 Y-18.418 E77.97639 F2400
+G1 X8.283 Y-17.764 E78.03299 F2400
+G1 X9.800 Y-16.974 E78.08959 F2400
+G1 X11.242 Y-16.055 E78.14618 F2400
+G1 X12.599 Y-15.014 E78.20278 F2400
+G1 X13.859 Y-13.859 E78.25938 F2400
+G1 X15.014 Y-12.599 E78.31597 F2400
+G1 X16.055 Y-11.242 E78.37257 F2400
+G1 X16.974 Y-9.800 E78.42917 F2400
+G1 X17.764 Y-8.283 E78.48576 F2400
+G1 X18.418 Y-6.704 E78.54236 F2400
+G1 X18.932 Y-5.073 E78.59896 F2400
+G1 X19.302 Y-3.404 E78.65556 F2400
+G1 X19.525 Y-1.708 E78.71215 F2400
+G1 X19.600 Y-0.000 E78.76875 F2400
+G1 X19.127 Y1.673 E78.82631 F2400
+G1 X18.908 Y3.334 E78.88175 F2400
+G1 X18.546 Y4.969 E78.93719 F2400
+G1 X18.042 Y6.567 E78.99264 F2400
+G1 X17.401 Y8.114 E79.04808 F2400
+G1 X16.628 Y9.600 E79.10352 F2400
+G1 X15.728 Y11.013 E79.15896 F2400
+G1 X14.708 Y12.342 E79.21440 F2400
+G1 X13.576 Y13.576 E79.26985 F2400
+G1 X12.342 Y14.708 E79.32529 F2400
+G1 X11.013 Y15.728 E79.38073 F2400
+G1 X9.600 Y16.628 E79.43617 F2400
+G1 X8.114 Y17.401 E79.49161 F2400
+G1 X6.567 Y18.042 E79.54706 F2400
+G1 X4.969 Y18.546 E79.60250 F2400
+G1 X3.334 Y18.908 E79.65794 F2400
+G1 X1.673 Y19.127 E79.71338 F2400
+G1 X0.000 Y19.200 E79.76882 F2400
+G1 X-1.673 Y19.127 E79.82427 F2400
+G1 X-3.334 Y18.908 E79.87971 F2400
+G1 X-4.969 Y18.546 E79.93515 F2400
+G1 X-6.567 Y18.042 E79.99059 F2400
+G1 X-8.114 Y17.401 E80.04603 F2400
+G1 X-9.600 Y16.628 E80.10148 F2400
+G1 X-11.013 Y15.728 E80.15692 F2400
+G1 X-12.342 Y14.708 E80.21236 F2400
+G1 X-13.576 Y13.576 E80.26780 F2400
+G1 X-14.708 Y12.342 E80.32324 F2400
+G1 X-15.728 Y11.013 E80.37869 F2400
+G1 X-16.628 Y9.600 E80.43413 F2400
+G1 X-17.401 Y8.114 E80.48957 F2400
+G1 X-18.042 Y6.567 E80.54501 F2400
+G1 X-18.546 Y4.969 E80.60045 F2400
+G1 X-18.908 Y3.334 E80.65590 F2400
+G1 X-19.127 Y1.673 E80.71134 F2400
+G1 X-19.200 Y0.000 E80.76678 F2400
+G1 X-19.127 Y-1.673 E80.82222 F2400
+G1 X-18.908 Y-3.334 E80.87766 F2400
+G1 X-18.546 Y-4.969 E80.93311 F2400
+G1 X-18.042 Y-6.567 E80.98855 F2400
+G1 X-17.401 Y-8.114 E81.04399 F2400
+G1 X-16.628 Y-9.600 E81.09943 F2400
+G1 X-15.728 Y-11.013 E81.15487 F2400
+G1 X-14.708 Y-12.342 E81.21032 F2400
+G1 X-13.576 Y-13.576 E81.26576 F2400
+G1 X-12.342 Y-14.708 E81.32120 F2400
+G1 X-11.013 Y-15.728 E81.37664 F2400
+G1 X-9.600 Y-16.628 E81.43208 F2400
+G1 X-8.114 Y-17.401 E81.48753 F2400
+G1 X-6.567 Y-18.042 E81.54297 F2400
+G1 X-4.969 Y-18.546 E81.59841 F2400
+G1 X-3.334 Y-18.908 E81.65385 F2400
+G1 X-1.673 Y-19.127 E81.70929 F2400
+G1 X-0.000 Y-19.200 E81.76473 F2400
+G1 X1.673 Y-19.127 E81.82018 F2400
+G1 X3.334 Y-18.908 E81.87562 F2400
+G1 X4.969 Y-18.546 E81.93106 F2400
+G1 X6.567 Y-18.042 E81.98650 F2400
+G1 X8.114 Y-17.401 E82.04194 F2400
+G1 X9.600 Y-16.628 E82.09739 F2400
+G1 X11.013 Y-15.728 E82.15283 F2400
+G1 X12.342 Y-14.708 E82.20827 F2400
+G1 X13.576 Y-13.576 E82.26371 F2400
+G1 X14.708 Y-12.342 E82.31915 F2400
+G1 X15.728 Y-11.013 E82.37460 F2400
+G1 X16.628 Y-9.600 E82.43004 F2400
+G1 X17.401 Y-8.114 E82.48548 F2400
+G1 X18.042 Y-6.567 E82.54092 F2400
+G1 X18.546 Y-4.969 E82.59636 F2400
+G1 X18.908 Y-3.334 E82.65181 F2400
+G1 X19.127 Y-1.673 E82.70725 F2400
+G1 X19.200 Y-0.000 E82.76269 F2400
+G1 E81.76269 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E82.76269 F2400
+G1 X12.000 Y-12.000 E83.55709 F3600
+G1 X12.000 Y-11.000 E83.59019 F3600
+G1 X-12.000 Y-11.000 E84.38459 F3600
+G1 X-12.000 Y-10.000 E84.41769 F3600
+G1 X12.000 Y-10.000 E85.21209 F3600
+G1 X12.000 Y-9.000 E85.24519 F3600
+G1 X-12.000 Y-9.000 E86.03959 F3600
+G1 X-12.000 Y-8.000 E86.07269 F3600
+G1 X12.000 Y-8.000 E86.86709 F3600
+G1 X12.000 Y-7.000 E86.90019 F3600
+G1 X-12.000 Y-7.000 E87.69459 F3600
+G1 X-12.000 Y-6.000 E87.72769 F3600
+G1 X12.000 Y-6.000 E88.52209 F3600
+G1 X12.000 Y-5.000 E88.55519 F3600
+G1 X-12.000 Y-5.000 E89.34959 F3600
+G1 X-12.000 Y-4.000 E89.38269 F3600
+G1 X12.000 Y-4.000 E90.17709 F3600
+G1 X12.000 Y-3.000 E90.21019 F3600
+G1 X-12.000 Y-3.000 E91.00459 F3600
+G1 X-12.000 Y-2.000 E91.03769 F3600
+G1 X12.000 Y-2.000 E91.83209 F3600
+G1 X12.000 Y-1.000 E91.86519 F3600
+G1 X-12.000 Y-1.000 E92.65959 F3600
+G1 X-12.000 Y0.000 E92.69269 F3600
+G1 X12.000 Y0.000 E93.48709 F3600
+G1 X12.000 Y1.000 E93.52019 F3600
+G1 X-12.000 Y1.000 E94.31459 F3600
+G1 X-12.000 Y2.000 E94.34769 F3600
+G1 X12.000 Y2.000 E95.14209 F3600
+G1 X12.000 Y3.000 E95.17519 F3600
+G1 X-12.000 Y3.000 E95.96959 F3600
+G1 X-12.000 Y4.000 E96.00269 F3600
+G1 X12.000 Y4.000 E96.79709 F3600
+G1 X12.000 Y5.000 E96.83019 F3600
+G1 X-12.000 Y5.000 E97.62459 F3600
+G1 X-12.000 Y6.000 E97.65769 F3600
+G1 X12.000 Y6.000 E98.45209 F3600
+G1 X12.000 Y7.000 E98.48519 F3600
+G1 X-12.000 Y7.000 E99.27959 F3600
+G1 X-12.000 Y8.000 E99.31269 F3600
+G1 X12.000 Y8.000 E100.10709 F3600
+G1 X12.000 Y9.000 E100.14019 F3600
+G1 X-12.000 Y9.000 E100.93459 F3600
+G1 X-12.000 Y10.000 E100.96769 F3600
+G1 X12.000 Y10.000 E101.76209 F3600
+G1 X12.000 Y11.000 E101.79519 F3600
+G1 X-12.000 Y11.000 E102.58959 F3600
+G1 X-12.000 Y12.000 E102.62269 F3600
+G1 X12.000 Y12.000 E103.41709 F3600
+;LAYER:3
+G1 Z0.80 F1200
+G1 E102.41709 F2400
+G1 X20.000 Y0.000 F9000
+G1 E103.41709 F2400
+G1 X19.924 Y1.743 E103.47484 F1800
+G1 X19.696 Y3.473 E103.53259 F1800
+G1 X19.319 Y5.176 E103.59035 F1800
+G1 X18.794 Y6.840 E103.64810 F1800
+G1 X18.126 Y8.452 E103.70585 F1800
+G1 X17.321 Y10.000 E103.76360 F1800
+G1 X16.383 Y11.472 E103.82136 F1800
+G1 X15.321 Y12.856 E103.87911 F1800
+G1 X14.142 Y14.142 E103.93686 F1800
+G1 X12.856 Y15.321 E103.99461 F1800
+G1 X11.472 Y16.383 E104.05236 F1800
+G1 X10.000 Y17.321 E104.11012 F1800
+G1 X8.452 Y18.126 E104.16787 F1800
+G1 X6.840 Y18.794 E104.22562 F1800
+G1 X5.176 Y19.319 E104.28337 F1800
+G1 X3.473 Y19.696 E104.34112 F1800
+G1 X1.743 Y19.924 E104.39888 F1800
+G1 X0.000 Y20.000 E104.45663 F1800
+G1 X-1.743 Y19.924 E104.51438 F1800
+G1 X-3.473 Y19.696 E104.57213 F1800
+G1 X-5.176 Y19.319 E104.62988 F1800
+G1 X-6.840 Y18.794 E104.68764 F1800
+G1 X-8.452 Y18.126 E104.74539 F1800
+G1 X-10.000 Y17.321 E104.80314 F1800
+G1 X-11.472 Y16.383 E104.86089 F1800
+G1 X-12.856 Y15.321 E104.91864 F1800
+G1 X-14.142 Y14.142 E104.97640 F1800
+G1 X-15.321 Y12.856 E105.03415 F1800
+G1 X-16.383 Y11.472 E105.09190 F1800
+G1 X-17.321 Y10.000 E105.14965 F1800
+G1 X-18.126 Y8.452 E105.20740 F1800
+G1 X-18.794 Y6.840 E105.26516 F1800
+G1 X-19.319 Y5.176 E105.32291 F1800
+G1 X-19.696 Y3.473 E105.38066 F1800
+G1 X-19.924 Y1.743 E105.43841 F1800
+G1 X-20.000 Y0.000 E105.49617 F1800
+G1 X-19.924 Y-1.743 E105.55392 F1800
+G1 X-19.696 Y-3.473 E105.61167 F1800
+G1 X-19.319 Y-5.176 E105.66942 F1800
+G1 X-18.794 Y-6.840 E105.72717 F1800
+G1 X-18.126 Y-8.452 E105.78493 F1800
+G1 X-17.321 Y-10.000 E105.84268 F1800
+G1 X-16.383 Y-11.472 E105.90043 F1800
+G1 X-15.321 Y-12.856 E105.95818 F1800
+G1 X-14.142 Y-14.142 E106.01593 F1800
+G1 X-12.856 Y-15.321 E106.07369 F1800
+G1 X-11.472 Y-16.383 E106.13144 F1800
+G1 X-10.000 Y-17.321 E106.18919 F1800
+G1 X-8.452 Y-18.126 E106.24694 F1800
+G1 X-6.840 Y-18.794 E106.30469 F1800
+G1 X-5.176 Y-19.319 E106.36245 F1800
+G1 X-3.473 Y-19.696 E106.42020 F1800
+G1 X-1.743 Y-19.924 E106.47795 F1800
+G1 X-0.000 Y-20.000 E106.53570 F1800
+G1 X1.743 Y-19.924 E106.59345 F1800
+G1 X3.473 Y-19.696 E106.65121 F1800
+G1 X5.176 Y-19.319 E106.70896 F1800
+G1 X6.840 Y-18.794 E106.76671 F1800
+G1 X8.452 Y-18.126 E106.82446 F1800
+G1 X10.000 Y-17.321 E106.88221 F1800
+G1 X11.472 Y-16.383 E106.93997 F1800
+G1 X12.856 Y-15.321 E106.99772 F1800
+G1 X14.142 Y-14.142 E107.05547 F1800
+G1 X15.321 Y-12.856 E107.11322 F1800
+G1 X16.383 Y-11.472 E107.17098 F1800
+G1 X17.321 Y-10.000 E107.22873 F1800
+G1 X18.126 Y-8.452 E107.28648 F1800
+G1 X18.794 Y-6.840 E107.34423 F1800
+G1 X19.319 Y-5.176 E107.40198 F1800
+G1 X19.696 Y-3.473 E107.45974 F1800
+G1 X19.924 Y-1.743 E107.51749 F1800
+G1 X20.000 Y-0.000 E107.57524 F1800
+G1 X19.525 Y1.708 E107.63392 F2400
+G1 X19.302 Y3.404 E107.69052 F2400
+G1 X18.932 Y5.073 E107.74712 F2400
+G1 X18.418 Y6.704 E107.80372 F2400
+G1 X17.764 Y8.283 E107.86031 F2400
+G1 X16.974 Y9.800 E107.91691 F2400
+G1 X16.055 Y11.242 E107.97351 F2400
+G1 X15.014 Y12.599 E108.03010 F2400
+G1 X13.859 Y13.859 E108.08670 F2400
+G1 X12.599 Y15.014 E108.14330 F2400
+G1 X11.242 Y16.055 E108.19989 F2400
+G1 X9.800 Y16.974 E108.25649 F2400
+G1 X8.283 Y17.764 E108.31309 F2400
+G1 X6.704 Y18.418 E108.36969 F2400
+G1 X5.073 Y18.932 E108.42628 F2400
+G1 X3.404 Y19.302 E108.48288 F2400
+G1 X1.708 Y19.525 E108.53948 F2400
+G1 X0.000 Y19.600 E108.59607 F2400
+G1 X-1.708 Y19.525 E108.65267 F2400
+G1 X-3.404 Y19.302 E108.70927 F2400
+G1 X-5.073 Y18.932 E108.76586 F2400
+G1 X-6.704 Y18.418 E108.82246 F2400
+G1 X-8.283 Y17.764 E108.87906 F2400
+G1 X-9.800 Y16.974 E108.93566 F2400
+G1 X-11.242 Y16.055 E108.99225 F2400
+G1 X-12.599 Y15.014 E109.04885 F2400
+G1 X-13.859 Y13.859 E109.10545 F2400
+G1 X-15.014 Y12.599 E109.16204 F2400
+G1 X-16.055 Y11.242 E109.21864 F2400
+G1 X-16.974 Y9.800 E109.27524 F2400
+G1 X-17.764 Y8.283 E109.33184 F2400
+G1 X-18.418 Y6.704 E109.38843 F2400
+G1 X-18.932 Y5.073 E109.44503 F2400
+G1 X-19.302 Y3.404 E109.50163 F2400
+G1 X-19.525 Y1.708 E109.55822 F2400
+G1 X-19.600 Y0.000 E109.61482 F2400
+G1 X-19.525 Y-1.708 E109.67142 F2400
+G1 X-19.302 Y-3.404 E109.72801 F2400
+G1 X-18.932 Y-5.073 E109.78461 F2400
+G1 X-18.418 Y-6.704 E109.84121 F2400
+G1 X-17.764 Y-8.283 E109.89781 F2400
+G1 X-16.974 Y-9.800 E109.95440 F2400
+G1 X-16.055 Y-11.242 E110.01100 F2400
+G1 X-15.014 Y-12.599 E110.06760 F2400
+G1 X-13.859 Y-13.859 E110.12419 F2400
+G1 X-12.599 Y-15.014 E110.18079 F2400
+G1 X-11.242 Y-16.055 E110.23739 F2400
+G1 X-9.800 Y-16.974 E110.29398 F2400
+G1 X-8.283 Y-17.764 E110.35058 F2400
+G1 X-6.704 Y-18.418 E110.40718 F2400
+G1 X-5.073 Y-18.932 E110.46378 F2400
+G1 X-3.404 Y-19.302 E110.52037 F2400
+G1 X-1.708 Y-19.525 E110.57697 F2400
+G1 X-0.000 Y-19.600 E110.63357 F2400
+G1 X1.708 Y-19.525 E110.69016 F2400
+G1 X3.404 Y-19.302 E110.74676 F2400
+G1 X5.073 Y-18.932 E110.80336 F2400
+G1 X6.704 Y-18.418 E110.85995 F2400
+G1 X8.283 Y-17.764 E110.91655 F2400
+G1 X9.800 Y-16.974 E110.97315 F2400
+G1 X11.242 Y-16.055 E111.02975 F2400
+G1 X12.599 Y-15.014 E111.08634 F2400
+G1 X13.859 Y-13.859 E111.14294 F2400
+G1 X15.014 Y-12.599 E111.19954 F2400
+G1 X16.055 Y-11.242 E111.25613 F2400
+G1 X16.974 Y-9.800 E111.31273 F2400
+G1 X17.764 Y-8.283 E111.36933 F2400
+G1 X18.418 Y-6.704 E111.42593 F2400
+G1 X18.932 Y-5.073 E111.48252 F2400
+G1 X19.302 Y-3.404 E111.53912 F2400
+G1 X19.525 Y-1.708 E111.59572 F2400
+G1 X19.600 Y-0.000 E111.65231 F2400
+G1 X19.127 Y1.673 E111.70987 F2400
+G1 X18.908 Y3.334 E111.76532 F2400
+G1 X18.546 Y4.969 E111.82076 F2400
+G1 X18.042 Y6.567 E111.87620 F2400
+G1 X17.401 Y8.114 E111.93164 F2400
+G1 X16.628 Y9.600 E111.98708 F2400
+G1 X15.728 Y11.013 E112.04253 F2400
+G1 X14.708 Y12.342 E112.09797 F2400
+G1 X13.576 Y13.576 E112.15341 F2400
+G1 X12.342 Y14.708 E112.20885 F2400
+G1 X11.013 Y15.728 E112.26429 F2400
+G1 X9.600 Y16.628 E112.31974 F2400
+G1 X8.114 Y17.401 E112.37518 F2400
+G1 X6.567 Y18.042 E112.43062 F2400
+G1 X4.969 Y18.546 E112.48606 F2400
+G1 X3.334 Y18.908 E112.54150 F2400
+G1 X1.673 Y19.127 E112.59695 F2400
+G1 X0.000 Y19.200 E112.65239 F2400
+G1 X-1.673 Y19.127 E112.70783 F2400
+G1 X-3.334 Y18.908 E112.76327 F2400
+G1 X-4.969 Y18.546 E112.81871 F2400
+G1 X-6.567 Y18.042 E112.87416 F2400
+G1 X-8.114 Y17.401 E112.92960 F2400
+G1 X-9.600 Y16.628 E112.98504 F2400
+G1 X-11.013 Y15.728 E113.04048 F2400
+G1 X-12.342 Y14.708 E113.09592 F2400
+G1 X-13.576 Y13.576 E113.15136 F2400
+G1 X-14.708 Y12.342 E113.20681 F2400
+G1 X-15.728 Y11.013 E113.26225 F2400
+G1 X-16.628 Y9.600 E113.31769 F2400
+G1 X-17.401 Y8.114 E113.37313 F2400
+G1 X-18.042 Y6.567 E113.42857 F2400
+G1 X-18.546 Y4.969 E113.48402 F2400
+G1 X-18.908 Y3.334 E113.53946 F2400
+G1 X-19.127 Y1.673 E113.59490 F2400
+G1 X-19.200 Y0.000 E113.65034 F2400
+G1 X-19.127 Y-1.673 E113.70578 F2400
+G1 X-18.908 Y-3.334 E113.76123 F2400
+G1 X-18.546 Y-4.969 E113.81667 F2400
+G1 X-18.042 Y-6.567 E113.87211 F2400
+G1 X-17.401 Y-8.114 E113.92755 F2400
+G1 X-16.628 Y-9.600 E113.98299 F2400
+G1 X-15.728 Y-11.013 E114.03844 F2400
+G1 X-14.708 Y-12.342 E114.09388 F2400
+G1 X-13.576 Y-13.576 E114.14932 F2400
+G1 X-12.342 Y-14.708 E114.20476 F2400
+G1 X-11.013 Y-15.728 E114.26020 F2400
+G1 X-9.600 Y-16.628 E114.31565 F2400
+G1 X-8.114 Y-17.401 E114.37109 F2400
+G1 X-6.567 Y-18.042 E114.42653 F2400
+G1 X-4.969 Y-18.546 E114.48197 F2400
+G1 X-3.334 Y-18.908 E114.53741 F2400
+G1 X-1.673 Y-19.127 E114.59286 F2400
+G1 X-0.000 Y-19.200 E114.64830 F2400
+G1 X1.673 Y-19.127 E114.70374 F2400
+G1 X3.334 Y-18.908 E114.75918 F2400
+G1 X4.969 Y-18.546 E114.81462 F2400
+G1 X6.567 Y-18.042 E114.87007 F2400
+G1 X8.114 Y-17.401 E114.92551 F2400
+G1 X9.600 Y-16.628 E114.98095 F2400
+G1 X11.013 Y-15.728 E115.03639 F2400
+G1 X12.342 Y-14.708 E115.09183 F2400
+G1 X13.576 Y-13.576 E115.14728 F2400
+G1 X14.708 Y-12.342 E115.20272 F2400
+G1 X15.728 Y-11.013 E115.25816 F2400
+G1 X16.628 Y-9.600 E115.31360 F2400
+G1 X17.401 Y-8.114 E115.36904 F2400
+G1 X18.042 Y-6.567 E115.42449 F2400
+G1 X18.546 Y-4.969 E115.47993 F2400
+G1 X18.908 Y-3.334 E115.53537 F2400
+G1 X19.127 Y-1.673 E115.59081 F2400
+G1 X19.200 Y-0.000 E115.64625 F2400
+G1 E114.64625 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E115.64625 F2400
+G1 X-12.000 Y12.000 E116.44065 F3600
+G1 X-11.200 Y12.000 E116.46713 F3600
+G1 X-11.200 Y-12.000 E117.26153 F3600
+G1 X-10.400 Y-12.000 E117.28801 F3600
+G1 X-10.400 Y12.000 E118.08241 F3600
+G1 X-9.600 Y12.000 E118.10889 F3600
+G1 X-9.600 Y-12.000 E118.90329 F3600
+G1 X-8.800 Y-12.000 E118.92977 F3600
+G1 X-8.800 Y12.000 E119.72417 F3600
+G1 X-8.000 Y12.000 E119.75065 F3600
+G1 X-8.000 Y-12.000 E120.54505 F3600
+G1 X-7.200 Y-12.000 E120.57153 F3600
+G1 X-7.200 Y12.000 E121.36593 F3600
+G1 X-6.400 Y12.000 E121.39241 F3600
+G1 X-6.400 Y-12.000 E122.18681 F3600
+G1 X-5.600 Y-12.000 E122.21329 F3600
+G1 X-5.600 Y12.000 E123.00769 F3600
+G1 X-4.800 Y12.000 E123.03417 F3600
+G1 X-4.800 Y-12.000 E123.82857 F3600
+G1 X-4.000 Y-12.000 E123.85505 F3600
+G1 X-4.000 Y12.000 E124.64945 F3600
+G1 X-3.200 Y12.000 E124.67593 F3600
+G1 X-3.200 Y-12.000 E125.47033 F3600
+G1 X-2.400 Y-12.000 E125.49681 F3600
+G1 X-2.400 Y12.000 E126.29121 F3600
+G1 X-1.600 Y12.000 E126.31769 F3600
+G1 X-1.600 Y-12.000 E127.11209 F3600
+G1 X-0.800 Y-12.000 E127.13857 F3600
+G1 X-0.800 Y12.000 E127.93297 F3600
+G1 X0.000 Y12.000 E127.95945 F3600
+G1 X0.000 Y-12.000 E128.75385 F3600
+G1 X0.800 Y-12.000 E128.78033 F3600
+G1 X0.800 Y12.000 E129.57473 F3600
+G1 X1.600 Y12.000 E129.60121 F3600
+G1 X1.600 Y-12.000 E130.39561 F3600
+G1 X2.400 Y-12.000 E130.42209 F3600
+G1 X2.400 Y12.000 E131.21649 F3600
+G1 X3.200 Y12.000 E131.24297 F3600
+G1 X3.200 Y-12.000 E132.03737 F3600
+G1 X4.000 Y-12.000 E132.06385 F3600
+G1 X4.000 Y12.000 E132.85825 F3600
+G1 X4.800 Y12.000 E132.88473 F3600
+G1 X4.800 Y-12.000 E133.67913 F3600
+G1 X5.600 Y-12.000 E133.70561 F3600
+G1 X5.600 Y12.000 E134.50001 F3600
+G1 X6.400 Y12.000 E134.52649 F3600
+G1 X6.400 Y-12.000 E135.32089 F3600
+G1 X7.200 Y-12.000 E135.34737 F3600
+G1 X7.200 Y12.000 E136.14177 F3600
+G1 X8.000 Y12.000 E136.16825 F3600
+G1 X8.000 Y-12.000 E136.96265 F3600
+G1 X8.800 Y-12.000 E136.98913 F3600
+G1 X8.800 Y12.000 E137.78353 F3600
+G1 X9.600 Y12.000 E137.81001 F3600
+G1 X9.600 Y-12.000 E138.60441 F3600
+G1 X10.400 Y-12.000 E138.63089 F3600
+G1 X10.400 Y12.000 E139.42529 F3600
+G1 X11.200 Y12.000 E139.45177 F3600
+G1 X11.200 Y-12.000 E140.24617 F3600
+G1 X12.000 Y-12.000 E140.27265 F3600
+G1 X12.000 Y12.000 E141.06705 F3600
+;LAYER:4
+G1 Z1.00 F1200
+G1 E140.06705 F2400
+G1 X20.000 Y0.000 F9000
+G1 E141.06705 F2400
+G1 X19.924 Y1.743 E141.12481 F1800
+G1 X19.696 Y3.473 E141.18256 F1800
+G1 X19.319 Y5.176 E141.24031 F1800
+G1 X18.794 Y6.840 E141.29806 F1800
+G1 X18.126 Y8.452 E141.35581 F1800
+G1 X17.321 Y10.000 E141.41357 F1800
+G1 X16.383 Y11.472 E141.47132 F1800
+G1 X15.321 Y12.856 E141.52907 F1800
+G1 X14.142 Y14.142 E141.58682 F1800
+G1 X12.856 Y15.321 E141.64458 F1800
+G1 X11.472 Y16.383 E141.70233 F1800
+G1 X10.000 Y17.321 E141.76008 F1800
+G1 X8.452 Y18.126 E141.81783 F1800
+G1 X6.840 Y18.794 E141.87558 F1800
+G1 X5.176 Y19.319 E141.93334 F1800
+G1 X3.473 Y19.696 E141.99109 F1800
+G1 X1.743 Y19.924 E142.04884 F1800
+G1 X0.000 Y20.000 E142.10659 F1800
+G1 X-1.743 Y19.924 E142.16434 F1800
+G1 X-3.473 Y19.696 E142.22210 F1800
+G1 X-5.176 Y19.319 E142.27985 F1800
+G1 X-6.840 Y18.794 E142.33760 F1800
+G1 X-8.452 Y18.126 E142.39535 F1800
+G1 X-10.000 Y17.321 E142.45310 F1800
+G1 X-11.472 Y16.383 E142.51086 F1800
+G1 X-12.856 Y15.321 E142.56861 F1800
+G1 X-14.142 Y14.142 E142.62636 F1800
+G1 X-15.321 Y12.856 E142.68411 F1800
+G1 X-16.383 Y11.472 E142.74186 F1800
+G1 X-17.321 Y10.000 E142.79962 F1800
+G1 X-18.126 Y8.452 E142.85737 F1800
+G1 X-18.794 Y6.840 E142.91512 F1800
+G1 X-19.319 Y5.176 E142.97287 F1800
+G1 X-19.696 Y3.473 E143.03062 F1800
+G1 X-19.924 Y1.743 E143.08838 F1800
+G1 X-20.000 Y0.000 E143.14613 F1800
+G1 X-19.924 Y-1.743 E143.20388 F1800
+G1 X-19.696 Y-3.473 E143.26163 F1800
+G1 X-19.319 Y-5.176 E143.31939 F1800
+G1 X-18.794 Y-6.840 E143.37714 F1800
+G1 X-18.126 Y-8.452 E143.43489 F1800
+G1 X-17.321 Y-10.000 E143.49264 F1800
+G1 X-16.383 Y-11.472 E143.55039 F1800
+G1 X-15.321 Y-12.856 E143.60815 F1800
+G1 X-14.142 Y-14.142 E143.66590 F1800
+G1 X-12.856 Y-15.321 E143.72365 F1800
+G1 X-11.472 Y-16.383 E143.78140 F1800
+G1 X-10.000 Y-17.321 E143.83915 F1800
+G1 X-8.452 Y-18.126 E143.89691 F1800
+G1 X-6.840 Y-18.794 E143.95466 F1800
+G1 X-5.176 Y-19.319 E144.01241 F1800
+G1 X-3.473 Y-19.696 E144.07016 F1800
+G1 X-1.743 Y-19.924 E144.12791 F1800
+G1 X-0.000 Y-20.000 E144.18567 F1800
+G1 X1.743 Y-19.924 E144.24342 F1800
+G1 X3.473 Y-19.696 E144.30117 F1800
+G1 X5.176 Y-19.319 E144.35892 F1800
+G1 X6.840 Y-18.794 E144.41667 F1800
+G1 X8.452 Y-18.126 E144.47443 F1800
+G1 X10.000 Y-17.321 E144.53218 F1800
+G1 X11.472 Y-16.383 E144.58993 F1800
+G1 X12.856 Y-15.321 E144.64768 F1800
+G1 X14.142 Y-14.142 E144.70543 F1800
+G1 X15.321 Y-12.856 E144.76319 F1800
+G1 X16.383 Y-11.472 E144.82094 F1800
+G1 X17.321 Y-10.000 E144.87869 F1800
+G1 X18.126 Y-8.452 E144.93644 F1800
+G1 X18.794 Y-6.840 E144.99419 F1800
+G1 X19.319 Y-5.176 E145.05195 F1800
+G1 X19.696 Y-3.473 E145.10970 F1800
+G1 X19.924 Y-1.743 E145.16745 F1800
+G1 X20.000 Y-0.000 E145.22520 F1800
+G1 X19.525 Y1.708 E145.28389 F2400
+G1 X19.302 Y3.404 E145.34048 F2400
+G1 X18.932 Y5.073 E145.39708 F2400
+G1 X18.418 Y6.704 E145.45368 F2400
+G1 X17.764 Y8.283 E145.51028 F2400
+G1 X16.974 Y9.800 E145.56687 F2400
+G1 X16.055 Y11.242 E145.62347 F2400
+G1 X15.014 Y12.599 E145.68007 F2400
+G1 X13.859 Y13.859 E145.73666 F2400
+G1 X12.599 Y15.014 E145.79326 F2400
+G1 X11.242 Y16.055 E145.84986 F2400
+G1 X9.800 Y16.974 E145.90646 F2400
+G1 X8.283 Y17.764 E145.96305 F2400
+G1 X6.704 Y18.418 E146.01965 F2400
+G1 X5.073 Y18.932 E146.07625 F2400
+G1 X3.404 Y19.302 E146.13284 F2400
+G1 X1.708 Y19.525 E146.18944 F2400
+G1 X0.000 Y19.600 E146.24604 F2400
+G1 X-1.708 Y19.525 E146.30263 F2400
+G1 X-3.404 Y19.302 E146.35923 F2400
+G1 X-5.073 Y18.932 E146.41583 F2400
+G1 X-6.704 Y18.418 E146.47243 F2400
+G1 X-8.283 Y17.764 E146.52902 F2400
+G1 X-9.800 Y16.974 E146.58562 F2400
+G1 X-11.242 Y16.055 E146.64222 F2400
+G1 X-12.599 Y15.014 E146.69881 F2400
+G1 X-13.859 Y13.859 E146.75541 F2400
+G1 X-15.014 Y12.599 E146.81201 F2400
+G1 X-16.055 Y11.242 E146.86860 F2400
+G1 X-16.974 Y9.800 E146.92520 F2400
+G1 X-17.764 Y8.283 E146.98180 F2400
+G1 X-18.418 Y6.704 E147.03840 F2400
+G1 X-18.932 Y5.073 E147.09499 F2400
+G1 X-19.302 Y3.404 E147.15159 F2400
+G1 X-19.525 Y1.708 E147.20819 F2400
+G1 X-19.600 Y0.000 E147.26478 F2400
+G1 X-19.525 Y-1.708 E147.32138 F2400
+G1 X-19.302 Y-3.404 E147.37798 F2400
+G1 X-18.932 Y-5.073 E147.43458 F2400
+G1 X-18.418 Y-6.704 E147.49117 F2400
+G1 X-17.764 Y-8.283 E147.54777 F2400
+G1 X-16.974 Y-9.800 E147.60437 F2400
+G1 X-16.055 Y-11.242 E147.66096 F2400
+G1 X-15.014 Y-12.599 E147.71756 F2400
+G1 X-13.859 Y-13.859 E147.77416 F2400
+G1 X-12.599 Y-15.014 E147.83075 F2400
+G1 X-11.242 Y-16.055 E147.88735 F2400
+G1 X-9.800 Y-16.974 E147.94395 F2400
+G1 X-8.283 Y-17.764 E148.00055 F2400
+G1 X-6.704 Y-18.418 E148.05714 F2400
+G1 X-5.073 Y-18.932 E148.11374 F2400
+G1 X-3.404 Y-19.302 E148.17034 F2400
+G1 X-1.708 Y-19.525 E148.22693 F2400
+G1 X-0.000 Y-19.600 E148.28353 F2400
+G1 X1.708 Y-19.525 E148.34013 F2400
+G1 X3.404 Y-19.302 E148.39672 F2400
+G1 X5.073 Y-18.932 E148.45332 F2400
+G1 X6.704 Y-18.418 E148.50992 F2400
+G1 X8.283 Y-17.764 E148.56652 F2400
+G1 X9.800 Y-16.974 E148.62311 F2400
+G1 X11.242 Y-16.055 E148.67971 F2400
+G1 X12.599 Y-15.014 E148.73631 F2400
+G1 X13.859 Y-13.859 E148.79290 F2400
+G1 X15.014 Y-12.599 E148.84950 F2400
+G1 X16.055 Y-11.242 E148.90610 F2400
+G1 X16.974 Y-9.800 E148.96269 F2400
+G1 X17.764 Y-8.283 E149.01929 F2400
+G1 X18.418 Y-6.704 E149.07589 F2400
+G1 X18.932 Y-5.073 E149.13249 F2400
+G1 X19.302 Y-3.404 E149.18908 F2400
+G1 X19.525 Y-1.708 E149.24568 F2400
+G1 X19.600 Y-0.000 E149.30228 F2400
+G1 X19.127 Y1.673 E149.35984 F2400
+G1 X18.908 Y3.334 E149.41528 F2400
+G1 X18.546 Y4.969 E149.47072 F2400
+G1 X18.042 Y6.567 E149.52616 F2400
+G1 X17.401 Y8.114 E149.58160 F2400
+G1 X16.628 Y9.600 E149.63705 F2400
+G1 X15.728 Y11.013 E149.69249 F2400
+G1 X14.708 Y12.342 E149.74793 F2400
+G1 X13.576 Y13.576 E149.80337 F2400
+G1 X12.342 Y14.708 E149.85881 F2400
+G1 X11.013 Y15.728 E149.91426 F2400
+G1 X9.600 Y16.628 E149.96970 F2400
+G1 X8.114 Y17.401 E150.02514 F2400
+G1 X6.567 Y18.042 E150.08058 F2400
+G1 X4.969 Y18.546 E150.13602 F2400
+G1 X3.334 Y18.908 E150.19147 F2400
+G1 X1.673 Y19.127 E150.24691 F2400
+G1 X0.000 Y19.200 E150.30235 F2400
+G1 X-1.673 Y19.127 E150.35779 F2400
+G1 X-3.334 Y18.908 E150.41323 F2400
+G1 X-4.969 Y18.546 E150.46868 F2400
+G1 X-6.567 Y18.042 E150.52412 F2400
+G1 X-8.114 Y17.401 E150.57956 F2400
+G1 X-9.600 Y16.628 E150.63500 F2400
+G1 X-11.013 Y15.728 E150.69044 F2400
+G1 X-12.342 Y14.708 E150.74589 F2400
+G1 X-13.576 Y13.576 E150.80133 F2400
+G1 X-14.708 Y12.342 E150.85677 F2400
+G1 X-15.728 Y11.013 E150.91221 F2400
+G1 X-16.628 Y9.600 E150.96765 F2400
+G1 X-17.401 Y8.114 E151.02310 F2400
+G1 X-18.042 Y6.567 E151.07854 F2400
+G1 X-18.546 Y4.969 E151.13398 F2400
+G1 X-18.908 Y3.334 E151.18942 F2400
+G1 X-19.127 Y1.673 E151.24486 F2400
+G1 X-19.200 Y0.000 E151.30031 F2400
+G1 X-19.127 Y-1.673 E151.35575 F2400
+G1 X-18.908 Y-3.334 E151.41119 F2400
+G1 X-18.546 Y-4.969 E151.46663 F2400
+G1 X-18.042 Y-6.567 E151.52207 F2400
+G1 X-17.401 Y-8.114 E151.57752 F2400
+G1 X-16.628 Y-9.600 E151.63296 F2400
+G1 X-15.728 Y-11.013 E151.68840 F2400
+G1 X-14.708 Y-12.342 E151.74384 F2400
+G1 X-13.576 Y-13.576 E151.79928 F2400
+G1 X-12.342 Y-14.708 E151.85473 F2400
+G1 X-11.013 Y-15.728 E151.91017 F2400
+G1 X-9.600 Y-16.628 E151.96561 F2400
+G1 X-8.114 Y-17.401 E152.02105 F2400
+G1 X-6.567 Y-18.042 E152.07649 F2400
+G1 X-4.969 Y-18.546 E152.13194 F2400
+G1 X-3.334 Y-18.908 E152.18738 F2400
+G1 X-1.673 Y-19.127 E152.24282 F2400
+G1 X-0.000 Y-19.200 E152.29826 F2400
+G1 X1.673 Y-19.127 E152.35370 F2400
+G1 X3.334 Y-18.908 E152.40915 F2400
+G1 X4.969 Y-18.546 E152.46459 F2400
+G1 X6.567 Y-18.042 E152.52003 F2400
+G1 X8.114 Y-17.401 E152.57547 F2400
+G1 X9.600 Y-16.628 E152.63091 F2400
+G1 X11.013 Y-15.728 E152.68636 F2400
+G1 X12.342 Y-14.708 E152.74180 F2400
+G1 X13.576 Y-13.576 E152.79724 F2400
+G1 X14.708 Y-12.342 E152.85268 F2400
+G1 X15.728 Y-11.013 E152.90812 F2400
+G1 X16.628 Y-9.600 E152.96357 F2400
+G1 X17.401 Y-8.114 E153.01901 F2400
+G1 X18.042 Y-6.567 E153.07445 F2400
+G1 X18.546 Y-4.969 E153.12989 F2400
+G1 X18.908 Y-3.334 E153.18533 F2400
+G1 X19.127 Y-1.673 E153.24078 F2400
+G1 X19.200 Y-0.000 E153.29622 F2400
+G1 E152.29622 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E153.29622 F2400
+G1 X12.000 Y-12.000 E154.09062 F3600
+G1 X12.000 Y-11.000 E154.12372 F3600
+G1 X-12.000 Y-11.000 E154.91812 F3600
+G1 X-12.000 Y-10.000 E154.95122 F3600
+G1 X12.000 Y-10.000 E155.74562 F3600
+G1 X12.000 Y-9.000 E155.77872 F3600
+G1 X-12.000 Y-9.000 E156.57312 F3600
+G1 X-12.000 Y-8.000 E156.60622 F3600
+G1 X12.000 Y-8.000 E157.40062 F3600
+G1 X12.000 Y-7.000 E157.43372 F3600
+G1 X-12.000 Y-7.000 E158.22812 F3600
+G1 X-12.000 Y-6.000 E158.26122 F3600
+G1 X12.000 Y-6.000 E159.05562 F3600
+G1 X12.000 Y-5.000 E159.08872 F3600
+G1 X-12.000 Y-5.000 E159.88312 F3600
+G1 X-12.000 Y-4.000 E159.91622 F3600
+G1 X12.000 Y-4.000 E160.71062 F3600
+G1 X12.000 Y-3.000 E160.74372 F3600
+G1 X-12.000 Y-3.000 E161.53812 F3600
+G1 X-12.000 Y-2.000 E161.57122 F3600
+G1 X12.000 Y-2.000 E162.36562 F3600
+G1 X12.000 Y-1.000 E162.39872 F3600
+G1 X-12.000 Y-1.000 E163.19312 F3600
+G1 X-12.000 Y0.000 E163.22622 F3600
+G1 X12.000 Y0.000 E164.02062 F3600
+G1 X12.000 Y1.000 E164.05372 F3600
+G1 X-12.000 Y1.000 E164.84812 F3600
+G1 X-12.000 Y2.000 E164.88122 F3600
+G1 X12.000 Y2.000 E165.67562 F3600
+G1 X12.000 Y3.000 E165.70872 F3600
+G1 X-12.000 Y3.000 E166.50312 F3600
+G1 X-12.000 Y4.000 E166.53622 F3600
+G1 X12.000 Y4.000 E167.33062 F3600
+G1 X12.000 Y5.000 E167.36372 F3600
+G1 X-12.000 Y5.000 E168.15812 F3600
+G1 X-12.000 Y6.000 E168.19122 F3600
+G1 X12.000 Y6.000 E168.98562 F3600
+G1 X12.000 Y7.000 E169.01872 F3600
+G1 X-12.000 Y7.000 E169.81312 F3600
+G1 X-12.000 Y8.000 E169.84622 F3600
+G1 X12.000 Y8.000 E170.64062 F3600
+G1 X12.000 Y9.000 E170.67372 F3600
+G1 X-12.000 Y9.000 E171.46812 F3600
+G1 X-12.000 Y10.000 E171.50122 F3600
+G1 X12.000 Y10.000 E172.29562 F3600
+G1 X12.000 Y11.000 E172.32872 F3600
+G1 X-12.000 Y11.000 E173.12312 F3600
+G1 X-12.000 Y12.000 E173.15622 F3600
+G1 X12.000 Y12.000 E173.95062 F3600
+;LAYER:5
+G1 Z1.20 F1200
+G1 E172.95062 F2400
+G1 X20.000 Y0.000 F9000
+G1 E173.95062 F2400
+G1 X19.924 Y1.743 E174.00837 F1800
+G1 X19.696 Y3.473 E174.06612 F1800
+G1 X19.319 Y5.176 E174.12387 F1800
+G1 X18.794 Y6.840 E174.18163 F1800
+G1 X18.126 Y8.452 E174.23938 F1800
+G1 X17.321 Y10.000 E174.29713 F1800
+G1 X16.383 Y11.472 E174.35488 F1800
+G1 X15.321 Y12.856 E174.41263 F1800
+G1 X14.142 Y14.142 E174.47039 F1800
+G1 X12.856 Y15.321 E174.52814 F1800
+G1 X11.472 Y16.383 E174.58589 F1800
+G1 X10.000 Y17.321 E174.64364 F1800
+G1 X8.452 Y18.126 E174.70139 F1800
+G1 X6.840 Y18.794 E174.75915 F1800
+G1 X5.176 Y19.319 E174.81690 F1800
+G1 X3.473 Y19.696 E174.87465 F1800
+G1 X1.743 Y19.924 E174.93240 F1800
+G1 X0.000 Y20.000 E174.99016 F1800
+G1 X-1.743 Y19.924 E175.04791 F1800
+G1 X-3.473 Y19.696 E175.10566 F1800
+G1 X-5.176 Y19.319 E175.16341 F1800
+G1 X-6.840 Y18.794 E175.22116 F1800
+G1 X-8.452 Y18.126 E175.27892 F1800
+G1 X-10.000 Y17.321 E175.33667 F1800
+G1 X-11.472 Y16.383 E175.39442 F1800
+G1 X-12.856 Y15.321 E175.45217 F1800
+G1 X-14.142 Y14.142 E175.50992 F1800
+G1 X-15.321 Y12.856 E175.56768 F1800
+G1 X-16.383 Y11.472 E175.62543 F1800
+G1 X-17.321 Y10.000 E175.68318 F1800
+G1 X-18.126 Y8.452 E175.74093 F1800
+G1 X-18.794 Y6.840 E175.79868 F1800
+G1 X-19.319 Y5.176 E175.85644 F1800
+G1 X-19.696 Y3.473 E175.91419 F1800
+G1 X-19.924 Y1.743 E175.97194 F1800
+G1 X-20.000 Y0.000 E176.02969 F1800
+G1 X-19.924 Y-1.743 E176.08744 F1800
+G1 X-19.696 Y-3.473 E176.14520 F1800
+G1 X-19.319 Y-5.176 E176.20295 F1800
+G1 X-18.794 Y-6.840 E176.26070 F1800
+G1 X-18.126 Y-8.452 E176.31845 F1800
+G1 X-17.321 Y-10.000 E176.37620 F1800
+G1 X-16.383 Y-11.472 E176.43396 F1800
+G1 X-15.321 Y-12.856 E176.49171 F1800
+G1 X-14.142 Y-14.142 E176.54946 F1800
+G1 X-12.856 Y-15.321 E176.60721 F1800
+G1 X-11.472 Y-16.383 E176.66497 F1800
+G1 X-10.000 Y-17.321 E176.72272 F1800
+G1 X-8.452 Y-18.126 E176.78047 F1800
+G1 X-6.840 Y-18.794 E176.83822 F1800
+G1 X-5.176 Y-19.319 E176.89597 F1800
+G1 X-3.473 Y-19.696 E176.95373 F1800
+G1 X-1.743 Y-19.924 E177.01148 F1800
+G1 X-0.000 Y-20.000 E177.06923 F1800
+G1 X1.743 Y-19.924 E177.12698 F1800
+G1 X3.473 Y-19.696 E177.18473 F1800
+G1 X5.176 Y-19.319 E177.24249 F1800
+G1 X6.840 Y-18.794 E177.30024 F1800
+G1 X8.452 Y-18.126 E177.35799 F1800
+G1 X10.000 Y-17.321 E177.41574 F1800
+G1 X11.472 Y-16.383 E177.47349 F1800
+G1 X12.856 Y-15.321 E177.53125 F1800
+G1 X14.142 Y-14.142 E177.58900 F1800
+G1 X15.321 Y-12.856 E177.64675 F1800
+G1 X16.383 Y-11.472 E177.70450 F1800
+G1 X17.321 Y-10.000 E177.76225 F1800
+G1 X18.126 Y-8.452 E177.82001 F1800
+G1 X18.794 Y-6.840 E177.87776 F1800
+G1 X19.319 Y-5.176 E177.93551 F1800
+G1 X19.696 Y-3.473 E177.99326 F1800
+G1 X19.924 Y-1.743 E178.05101 F1800
+G1 X20.000 Y-0.000 E178.10877 F1800
+G1 X19.525 Y1.708 E178.16745 F2400
+G1 X19.302 Y3.404 E178.22405 F2400
+G1 X18.932 Y5.073 E178.28065 F2400
+G1 X18.418 Y6.704 E178.33724 F2400
+G1 X17.764 Y8.283 E178.39384 F2400
+G1 X16.974 Y9.800 E178.45044 F2400
+G1 X16.055 Y11.242 E178.50703 F2400
+G1 X15.014 Y12.599 E178.56363 F2400
+G1 X13.859 Y13.859 E178.62023 F2400
+G1 X12.599 Y15.014 E178.67682 F2400
+G1 X11.242 Y16.055 E178.73342 F2400
+G1 X9.800 Y16.974 E178.79002 F2400
+G1 X8.283 Y17.764 E178.84662 F2400
+G1 X6.704 Y18.418 E178.90321 F2400
+G1 X5.073 Y18.932 E178.95981 F2400
+G1 X3.404 Y19.302 E179.01641 F2400
+G1 X1.708 Y19.525 E179.07300 F2400
+G1 X0.000 Y19.600 E179.12960 F2400
+G1 X-1.708 Y19.525 E179.18620 F2400
+G1 X-3.404 Y19.302 E179.24280 F2400
+G1 X-5.073 Y18.932 E179.29939 F2400
+G1 X-6.704 Y18.418 E179.35599 F2400
+G1 X-8.283 Y17.764 E179.41259 F2400
+G1 X-9.800 Y16.974 E179.46918 F2400
+G1 X-11.242 Y16.055 E179.52578 F2400
+G1 X-12.599 Y15.014 E179.58238 F2400
+G1 X-13.859 Y13.859 E179.63897 F2400
+G1 X-15.014 Y12.599 E179.69557 F2400
+G1 X-16.055 Y11.242 E179.75217 F2400
+G1 X-16.974 Y9.800 E179.80877 F2400
+G1 X-17.764 Y8.283 E179.86536 F2400
+G1 X-18.418 Y6.704 E179.92196 F2400
+G1 X-18.932 Y5.073 E179.97856 F2400
+G1 X-19.302 Y3.404 E180.03515 F2400
+G1 X-19.525 Y1.708 E180.09175 F2400
+G1 X-19.600 Y0.000 E180.14835 F2400
+G1 X-19.525 Y-1.708 E180.20494 F2400
+G1 X-19.302 Y-3.404 E180.26154 F2400
+G1 X-18.932 Y-5.073 E180.31814 F2400
+G1 X-18.418 Y-6.704 E180.37474 F2400
+G1 X-17.764 Y-8.283 E180.43133 F2400
+G1 X-16.974 Y-9.800 E180.48793 F2400
+G1 X-16.055 Y-11.242 E180.54453 F2400
+G1 X-15.014 Y-12.599 E180.60112 F2400
+G1 X-13.859 Y-13.859 E180.65772 F2400
+G1 X-12.599 Y-15.014 E180.71432 F2400
+G1 X-11.242 Y-16.055 E180.77091 F2400
+G1 X-9.800 Y-16.974 E180.82751 F2400
+G1 X-8.283 Y-17.764 E180.88411 F2400
+G1 X-6.704 Y-18.418 E180.94071 F2400
+G1 X-5.073 Y-18.932 E180.99730 F2400
+G1 X-3.404 Y-19.302 E181.05390 F2400
+G1 X-1.708 Y-19.525 E181.11050 F2400
+G1 X-0.000 Y-19.600 E181.16709 F2400
+G1 X1.708 Y-19.525 E181.22369 F2400
+G1 X3.404 Y-19.302 E181.28029 F2400
+G1 X5.073 Y-18.932 E181.33689 F2400
+G1 X6.704 Y-18.418 E181.39348 F2400
+G1 X8.283 Y-17.764 E181.45008 F2400
+G1 X9.800 Y-16.974 E181.50668 F2400
+G1 X11.242 Y-16.055 E181.56327 F2400
+G1 X12.599 Y-15.014 E181.61987 F2400
+G1 X13.859 Y-13.859 E181.67647 F2400
+G1 X15.014 Y-12.599 E181.73306 F2400
+G1 X16.055 Y-11.242 E181.78966 F2400
+G1 X16.974 Y-9.800 E181.84626 F2400
+G1 X17.764 Y-8.283 E181.90286 F2400
+G1 X18.418 Y-6.704 E181.95945 F2400
+G1 X18.932 Y-5.073 E182.01605 F2400
+G1 X19.302 Y-3.404 E182.07265 F2400
+G1 X19.525 Y-1.708 E182.12924 F2400
+G1 X19.600 Y-0.000 E182.18584 F2400
+G1 X19.127 Y1.673 E182.24340 F2400
+G1 X18.908 Y3.334 E182.29884 F2400
+G1 X18.546 Y4.969 E182.35428 F2400
+G1 X18.042 Y6.567 E182.40973 F2400
+G1 X17.401 Y8.114 E182.46517 F2400
+G1 X16.628 Y9.600 E182.52061 F2400
+G1 X15.728 Y11.013 E182.57605 F2400
+G1 X14.708 Y12.342 E182.63149 F2400
+G1 X13.576 Y13.576 E182.68694 F2400
+G1 X12.342 Y14.708 E182.74238 F2400
+G1 X11.013 Y15.728 E182.79782 F2400
+G1 X9.600 Y16.628 E182.85326 F2400
+G1 X8.114 Y17.401 E182.90870 F2400
+G1 X6.567 Y18.042 E182.96415 F2400
+G1 X4.969 Y18.546 E183.01959 F2400
+G1 X3.334 Y18.908 E183.07503 F2400
+G1 X1.673 Y19.127 E183.13047 F2400
+G1 X0.000 Y19.200 E183.18591 F2400
+G1 X-1.673 Y19.127 E183.24136 F2400
+G1 X-3.334 Y18.908 E183.29680 F2400
+G1 X-4.969 Y18.546 E183.35224 F2400
+G1 X-6.567 Y18.042 E183.40768 F2400
+G1 X-8.114 Y17.401 E183.46312 F2400
+G1 X-9.600 Y16.628 E183.51857 F2400
+G1 X-11.013 Y15.728 E183.57401 F2400
+G1 X-12.342 Y14.708 E183.62945 F2400
+G1 X-13.576 Y13.576 E183.68489 F2400
+G1 X-14.708 Y12.342 E183.74033 F2400
+G1 X-15.728 Y11.013 E183.79578 F2400
+G1 X-16.628 Y9.600 E183.85122 F2400
+G1 X-17.401 Y8.114 E183.90666 F2400
+G1 X-18.042 Y6.567 E183.96210 F2400
+G1 X-18.546 Y4.969 E184.01754 F2400
+G1 X-18.908 Y3.334 E184.07299 F2400
+G1 X-19.127 Y1.673 E184.12843 F2400
+G1 X-19.200 Y0.000 E184.18387 F2400
+G1 X-19.127 Y-1.673 E184.23931 F2400
+G1 X-18.908 Y-3.334 E184.29475 F2400
+G1 X-18.546 Y-4.969 E184.35020 F2400
+G1 X-18.042 Y-6.567 E184.40564 F2400
+G1 X-17.401 Y-8.114 E184.46108 F2400
+G1 X-16.628 Y-9.600 E184.51652 F2400
+G1 X-15.728 Y-11.013 E184.57196 F2400
+G1 X-14.708 Y-12.342 E184.62741 F2400
+G1 X-13.576 Y-13.576 E184.68285 F2400
+G1 X-12.342 Y-14.708 E184.73829 F2400
+G1 X-11.013 Y-15.728 E184.79373 F2400
+G1 X-9.600 Y-16.628 E184.84917 F2400
+G1 X-8.114 Y-17.401 E184.90462 F2400
+G1 X-6.567 Y-18.042 E184.96006 F2400
+G1 X-4.969 Y-18.546 E185.01550 F2400
+G1 X-3.334 Y-18.908 E185.07094 F2400
+G1 X-1.673 Y-19.127 E185.12638 F2400
+G1 X-0.000 Y-19.200 E185.18183 F2400
+G1 X1.673 Y-19.127 E185.23727 F2400
+G1 X3.334 Y-18.908 E185.29271 F2400
+G1 X4.969 Y-18.546 E185.34815 F2400
+G1 X6.567 Y-18.042 E185.40359 F2400
+G1 X8.114 Y-17.401 E185.45904 F2400
+G1 X9.600 Y-16.628 E185.51448 F2400
+G1 X11.013 Y-15.728 E185.56992 F2400
+G1 X12.342 Y-14.708 E185.62536 F2400
+G1 X13.576 Y-13.576 E185.68080 F2400
+G1 X14.708 Y-12.342 E185.73625 F2400
+G1 X15.728 Y-11.013 E185.79169 F2400
+G1 X16.628 Y-9.600 E185.84713 F2400
+G1 X17.401 Y-8.114 E185.90257 F2400
+G1 X18.042 Y-6.567 E185.95801 F2400
+G1 X18.546 Y-4.969 E186.01346 F2400
+G1 X18.908 Y-3.334 E186.06890 F2400
+G1 X19.127 Y-1.673 E186.12434 F2400
+G1 X19.200 Y-0.000 E186.17978 F2400
+G1 E185.17978 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E186.17978 F2400
+G1 X-12.000 Y12.000 E186.97418 F3600
+G1 X-11.200 Y12.000 E187.00066 F3600
+G1 X-11.200 Y-12.000 E187.79506 F3600
+G1 X-10.400 Y-12.000 E187.82154 F3600
+G1 X-10.400 Y12.000 E188.61594 F3600
+G1 X-9.600 Y12.000 E188.64242 F3600
+G1 X-9.600 Y-12.000 E189.43682 F3600
+G1 X-8.800 Y-12.000 E189.46330 F3600
+G1 X-8.800 Y12.000 E190.25770 F3600
+G1 X-8.000 Y12.000 E190.28418 F3600
+G1 X-8.000 Y-12.000 E191.07858 F3600
+G1 X-7.200 Y-12.000 E191.10506 F3600
+G1 X-7.200 Y12.000 E191.89946 F3600
+G1 X-6.400 Y12.000 E191.92594 F3600
+G1 X-6.400 Y-12.000 E192.72034 F3600
+G1 X-5.600 Y-12.000 E192.74682 F3600
+G1 X-5.600 Y12.000 E193.54122 F3600
+G1 X-4.800 Y12.000 E193.56770 F3600
+G1 X-4.800 Y-12.000 E194.36210 F3600
+G1 X-4.000 Y-12.000 E194.38858 F3600
+G1 X-4.000 Y12.000 E195.18298 F3600
+G1 X-3.200 Y12.000 E195.20946 F3600
+G1 X-3.200 Y-12.000 E196.00386 F3600
+G1 X-2.400 Y-12.000 E196.03034 F3600
+G1 X-2.400 Y12.000 E196.82474 F3600
+G1 X-1.600 Y12.000 E196.85122 F3600
+G1 X-1.600 Y-12.000 E197.64562 F3600
+G1 X-0.800 Y-12.000 E197.67210 F3600
+G1 X-0.800 Y12.000 E198.46650 F3600
+G1 X0.000 Y12.000 E198.49298 F3600
+G1 X0.000 Y-12.000 E199.28738 F3600
+G1 X0.800 Y-12.000 E199.31386 F3600
+G1 X0.800 Y12.000 E200.10826 F3600
+G1 X1.600 Y12.000 E200.13474 F3600
+G1 X1.600 Y-12.000 E200.92914 F3600
+G1 X2.400 Y-12.000 E200.95562 F3600
+G1 X2.400 Y12.000 E201.75002 F3600
+G1 X3.200 Y12.000 E201.77650 F3600
+G1 X3.200 Y-12.000 E202.57090 F3600
+G1 X4.000 Y-12.000 E202.59738 F3600
+G1 X4.000 Y12.000 E203.39178 F3600
+G1 X4.800 Y12.000 E203.41826 F3600
+G1 X4.800 Y-12.000 E204.21266 F3600
+G1 X5.600 Y-12.000 E204.23914 F3600
+G1 X5.600 Y12.000 E205.03354 F3600
+G1 X6.400 Y12.000 E205.06002 F3600
+G1 X6.400 Y-12.000 E205.85442 F3600
+G1 X7.200 Y-12.000 E205.88090 F3600
+G1 X7.200 Y12.000 E206.67530 F3600
+G1 X8.000 Y12.000 E206.70178 F3600
+G1 X8.000 Y-12.000 E207.49618 F3600
+G1 X8.800 Y-12.000 E207.52266 F3600
+G1 X8.800 Y12.000 E208.31706 F3600
+G1 X9.600 Y12.000 E208.34354 F3600
+G1 X9.600 Y-12.000 E209.13794 F3600
+G1 X10.400 Y-12.000 E209.16442 F3600
+G1 X10.400 Y12.000 E209.95882 F3600
+G1 X11.200 Y12.000 E209.98530 F3600
+G1 X11.200 Y-12.000 E210.77970 F3600
+G1 X12.000 Y-12.000 E210.80618 F3600
+G1 X12.000 Y12.000 E211.60058 F3600
+;LAYER:6
+T1
+G92 E0
+G1 Z1.40 F1200
+G1 E-1.00000 F2400
+G1 X20.000 Y0.000 F9000
+G1 E0.00000 F2400
+G1 X19.924 Y1.743 E0.05775 F1800
+G1 X19.696 Y3.473 E0.11550 F1800
+G1 X19.319 Y5.176 E0.17326 F1800
+G1 X18.794 Y6.840 E0.23101 F1800
+G1 X18.126 Y8.452 E0.28876 F1800
+G1 X17.321 Y10.000 E0.34651 F1800
+G1 X16.383 Y11.472 E0.40426 F1800
+G1 X15.321 Y12.856 E0.46202 F1800
+G1 X14.142 Y14.142 E0.51977 F1800
+G1 X12.856 Y15.321 E0.57752 F1800
+G1 X11.472 Y16.383 E0.63527 F1800
+G1 X10.000 Y17.321 E0.69302 F1800
+G1 X8.452 Y18.126 E0.75078 F1800
+G1 X6.840 Y18.794 E0.80853 F1800
+G1 X5.176 Y19.319 E0.86628 F1800
+G1 X3.473 Y19.696 E0.92403 F1800
+G1 X1.743 Y19.924 E0.98179 F1800
+G1 X0.000 Y20.000 E1.03954 F1800
+G1 X-1.743 Y19.924 E1.09729 F1800
+G1 X-3.473 Y19.696 E1.15504 F1800
+G1 X-5.176 Y19.319 E1.21279 F1800
+G1 X-6.840 Y18.794 E1.27055 F1800
+G1 X-8.452 Y18.126 E1.32830 F1800
+G1 X-10.000 Y17.321 E1.38605 F1800
+G1 X-11.472 Y16.383 E1.44380 F1800
+G1 X-12.856 Y15.321 E1.50155 F1800
+G1 X-14.142 Y14.142 E1.55931 F1800
+G1 X-15.321 Y12.856 E1.61706 F1800
+G1 X-16.383 Y11.472 E1.67481 F1800
+G1 X-17.321 Y10.000 E1.73256 F1800
+G1 X-18.126 Y8.452 E1.79031 F1800
+G1 X-18.794 Y6.840 E1.84807 F1800
+G1 X-19.319 Y5.176 E1.90582 F1800
+G1 X-19.696 Y3.473 E1.96357 F1800
+G1 X-19.924 Y1.743 E2.02132 F1800
+G1 X-20.000 Y0.000 E2.07907 F1800
+G1 X-19.924 Y-1.743 E2.13683 F1800
+G1 X-19.696 Y-3.473 E2.19458 F1800
+G1 X-19.319 Y-5.176 E2.25233 F1800
+G1 X-18.794 Y-6.840 E2.31008 F1800
+G1 X-18.126 Y-8.452 E2.36783 F1800
+G1 X-17.321 Y-10.000 E2.42559 F1800
+G1 X-16.383 Y-11.472 E2.48334 F1800
+G1 X-15.321 Y-12.856 E2.54109 F1800
+G1 X-14.142 Y-14.142 E2.59884 F1800
+G1 X-12.856 Y-15.321 E2.65660 F1800
+G1 X-11.472 Y-16.383 E2.71435 F1800
+G1 X-10.000 Y-17.321 E2.77210 F1800
+G1 X-8.452 Y-18.126 E2.82985 F1800
+G1 X-6.840 Y-18.794 E2.88760 F1800
+G1 X-5.176 Y-19.319 E2.94536 F1800
+G1 X-3.473 Y-19.696 E3.00311 F1800
+G1 X-1.743 Y-19.924 E3.06086 F1800
+G1 X-0.000 Y-20.000 E3.11861 F1800
+G1 X1.743 Y-19.924 E3.17636 F1800
+G1 X3.473 Y-19.696 E3.23412 F1800
+G1 X5.176 Y-19.319 E3.29187 F1800
+G1 X6.840 Y-18.794 E3.34962 F1800
+G1 X8.452 Y-18.126 E3.40737 F1800
+G1 X10.000 Y-17.321 E3.46512 F1800
+G1 X11.472 Y-16.383 E3.52288 F1800
+G1 X12.856 Y-15.321 E3.58063 F1800
+G1 X14.142 Y-14.142 E3.63838 F1800
+G1 X15.321 Y-12.856 E3.69613 F1800
+G1 X16.383 Y-11.472 E3.75388 F1800
+G1 X17.321 Y-10.000 E3.81164 F1800
+G1 X18.126 Y-8.452 E3.86939 F1800
+G1 X18.794 Y-6.840 E3.92714 F1800
+G1 X19.319 Y-5.176 E3.98489 F1800
+G1 X19.696 Y-3.473 E4.04264 F1800
+G1 X19.924 Y-1.743 E4.10040 F1800
+G1 X20.000 Y-0.000 E4.15815 F1800
+G1 X19.525 Y1.708 E4.21683 F2400
+G1 X19.302 Y3.404 E4.27343 F2400
+G1 X18.932 Y5.073 E4.33003 F2400
+G1 X18.418 Y6.704 E4.38662 F2400
+G1 X17.764 Y8.283 E4.44322 F2400
+G1 X16.974 Y9.800 E4.49982 F2400
+G1 X16.055 Y11.242 E4.55642 F2400
+G1 X15.014 Y12.599 E4.61301 F2400
+G1 X13.859 Y13.859 E4.66961 F2400
+G1 X12.599 Y15.014 E4.72621 F2400
+G1 X11.242 Y16.055 E4.78280 F2400
+G1 X9.800 Y16.974 E4.83940 F2400
+G1 X8.283 Y17.764 E4.89600 F2400
+G1 X6.704 Y18.418 E4.95260 F2400
+G1 X5.073 Y18.932 E5.00919 F2400
+G1 X3.404 Y19.302 E5.06579 F2400
+G1 X1.708 Y19.525 E5.12239 F2400
+G1 X0.000 Y19.600 E5.17898 F2400
+G1 X-1.708 Y19.525 E5.23558 F2400
+G1 X-3.404 Y19.302 E5.29218 F2400
+G1 X-5.073 Y18.932 E5.34877 F2400
+G1 X-6.704 Y18.418 E5.40537 F2400
+G1 X-8.283 Y17.764 E5.46197 F2400
+G1 X-9.800 Y16.974 E5.51857 F2400
+G1 X-11.242 Y16.055 E5.57516 F2400
+G1 X-12.599 Y15.014 E5.63176 F2400
+G1 X-13.859 Y13.859 E5.68836 F2400
+G1 X-15.014 Y12.599 E5.74495 F2400
+G1 X-16.055 Y11.242 E5.80155 F2400
+G1 X-16.974 Y9.800 E5.85815 F2400
+G1 X-17.764 Y8.283 E5.91474 F2400
+G1 X-18.418 Y6.704 E5.97134 F2400
+G1 X-18.932 Y5.073 E6.02794 F2400
+G1 X-19.302 Y3.404 E6.08454 F2400
+G1 X-19.525 Y1.708 E6.14113 F2400
+G1 X-19.600 Y0.000 E6.19773 F2400
+G1 X-19.525 Y-1.708 E6.25433 F2400
+G1 X-19.302 Y-3.404 E6.31092 F2400
+G1 X-18.932 Y-5.073 E6.36752 F2400
+G1 X-18.418 Y-6.704 E6.42412 F2400
+G1 X-17.764 Y-8.283 E6.48071 F2400
+G1 X-16.974 Y-9.800 E6.53731 F2400
+G1 X-16.055 Y-11.242 E6.59391 F2400
+G1 X-15.014 Y-12.599 E6.65051 F2400
+G1 X-13.859 Y-13.859 E6.70710 F2400
+G1 X-12.599 Y-15.014 E6.76370 F2400
+G1 X-11.242 Y-16.055 E6.82030 F2400
+G1 X-9.800 Y-16.974 E6.87689 F2400
+G1 X-8.283 Y-17.764 E6.93349 F2400
+G1 X-6.704 Y-18.418 E6.99009 F2400
+G1 X-5.073 Y-18.932 E7.04669 F2400
+G1 X-3.404 Y-19.302 E7.10328 F2400
+G1 X-1.708 Y-19.525 E7.15988 F2400
+G1 X-0.000 Y-19.600 E7.21648 F2400
+G1 X1.708 Y-19.525 E7.27307 F2400
+G1 X3.404 Y-19.302 E7.32967 F2400
+G1 X5.073 Y-18.932 E7.38627 F2400
+G1 X6.704 Y-18.418 E7.44286 F2400
+G1 X8.283 Y-17.764 E7.49946 F2400
+G1 X9.800 Y-16.974 E7.55606 F2400
+G1 X11.242 Y-16.055 E7.61266 F2400
+G1 X12.599 Y-15.014 E7.66925 F2400
+G1 X13.859 Y-13.859 E7.72585 F2400
+G1 X15.014 Y-12.599 E7.78245 F2400
+G1 X16.055 Y-11.242 E7.83904 F2400
+G1 X16.974 Y-9.800 E7.89564 F2400
+G1 X17.764 Y-8.283 E7.95224 F2400
+G1 X18.418 Y-6.704 E8.00883 F2400
+G1 X18.932 Y-5.073 E8.06543 F2400
+G1 X19.302 Y-3.404 E8.12203 F2400
+G1 X19.525 Y-1.708 E8.17863 F2400
+G1 X19.600 Y-0.000 E8.23522 F2400
+G1 X19.127 Y1.673 E8.29278 F2400
+G1 X18.908 Y3.334 E8.34822 F2400
+G1 X18.546 Y4.969 E8.40367 F2400
+G1 X18.042 Y6.567 E8.45911 F2400
+G1 X17.401 Y8.114 E8.51455 F2400
+G1 X16.628 Y9.600 E8.56999 F2400
+G1 X15.728 Y11.013 E8.62543 F2400
+G1 X14.708 Y12.342 E8.68088 F2400
+G1 X13.576 Y13.576 E8.73632 F2400
+G1 X12.342 Y14.708 E8.79176 F2400
+G1 X11.013 Y15.728 E8.84720 F2400
+G1 X9.600 Y16.628 E8.90264 F2400
+G1 X8.114 Y17.401 E8.95809 F2400
+G1 X6.567 Y18.042 E9.01353 F2400
+G1 X4.969 Y18.546 E9.06897 F2400
+G1 X3.334 Y18.908 E9.12441 F2400
+G1 X1.673 Y19.127 E9.17985 F2400
+G1 X0.000 Y19.200 E9.23530 F2400
+G1 X-1.673 Y19.127 E9.29074 F2400
+G1 X-3.334 Y18.908 E9.34618 F2400
+G1 X-4.969 Y18.546 E9.40162 F2400
+G1 X-6.567 Y18.042 E9.45706 F2400
+G1 X-8.114 Y17.401 E9.51251 F2400
+G1 X-9.600 Y16.628 E9.56795 F2400
+G1 X-11.013 Y15.728 E9.62339 F2400
+G1 X-12.342 Y14.708 E9.67883 F2400
+G1 X-13.576 Y13.576 E9.73427 F2400
+G1 X-14.708 Y12.342 E9.78972 F2400
+G1 X-15.728 Y11.013 E9.84516 F2400
+G1 X-16.628 Y9.600 E9.90060 F2400
+G1 X-17.401 Y8.114 E9.95604 F2400
+G1 X-18.042 Y6.567 E10.01148 F2400
+G1 X-18.546 Y4.969 E10.06693 F2400
+G1 X-18.908 Y3.334 E10.12237 F2400
+G1 X-19.127 Y1.673 E10.17781 F2400
+G1 X-19.200 Y0.000 E10.23325 F2400
+G1 X-19.127 Y-1.673 E10.28869 F2400
+G1 X-18.908 Y-3.334 E10.34414 F2400
+G1 X-18.546 Y-4.969 E10.39958 F2400
+G1 X-18.042 Y-6.567 E10.45502 F2400
+G1 X-17.401 Y-8.114 E10.51046 F2400
+G1 X-16.628 Y-9.600 E10.56590 F2400
+G1 X-15.728 Y-11.013 E10.62135 F2400
+G1 X-14.708 Y-12.342 E10.67679 F2400
+G1 X-13.576 Y-13.576 E10.73223 F2400
+G1 X-12.342 Y-14.708 E10.78767 F2400
+G1 X-11.013 Y-15.728 E10.84311 F2400
+G1 X-9.600 Y-16.628 E10.89856 F2400
+G1 X-8.114 Y-17.401 E10.95400 F2400
+G1 X-6.567 Y-18.042 E11.00944 F2400
+G1 X-4.969 Y-18.546 E11.06488 F2400
+G1 X-3.334 Y-18.908 E11.12032 F2400
+G1 X-1.673 Y-19.127 E11.17577 F2400
+G1 X-0.000 Y-19.200 E11.23121 F2400
+G1 X1.673 Y-19.127 E11.28665 F2400
+G1 X3.334 Y-18.908 E11.34209 F2400
+G1 X4.969 Y-18.546 E11.39753 F2400
+G1 X6.567 Y-18.042 E11.45298 F2400
+G1 X8.114 Y-17.401 E11.50842 F2400
+G1 X9.600 Y-16.628 E11.56386 F2400
+G1 X11.013 Y-15.728 E11.61930 F2400
+G1 X12.342 Y-14.708 E11.67474 F2400
+G1 X13.576 Y-13.576 E11.73019 F2400
+G1 X14.708 Y-12.342 E11.78563 F2400
+G1 X15.728 Y-11.013 E11.84107 F2400
+G1 X16.628 Y-9.600 E11.89651 F2400
+G1 X17.401 Y-8.114 E11.95195 F2400
+G1 X18.042 Y-6.567 E12.00740 F2400
+G1 X18.546 Y-4.969 E12.06284 F2400
+G1 X18.908 Y-3.334 E12.11828 F2400
+G1 X19.127 Y-1.673 E12.17372 F2400
+G1 X19.200 Y-0.000 E12.22916 F2400
+G1 E11.22916 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E12.22916 F2400
+G1 X12.000 Y-12.000 E13.02356 F3600
+G1 X12.000 Y-11.000 E13.05666 F3600
+G1 X-12.000 Y-11.000 E13.85106 F3600
+G1 X-12.000 Y-10.000 E13.88416 F3600
+G1 X12.000 Y-10.000 E14.67856 F3600
+G1 X12.000 Y-9.000 E14.71166 F3600
+G1 X-12.000 Y-9.000 E15.50606 F3600
+G1 X-12.000 Y-8.000 E15.53916 F3600
+G1 X12.000 Y-8.000 E16.33356 F3600
+G1 X12.000 Y-7.000 E16.36666 F3600
+G1 X-12.000 Y-7.000 E17.16106 F3600
+G1 X-12.000 Y-6.000 E17.19416 F3600
+G1 X12.000 Y-6.000 E17.98856 F3600
+G1 X12.000 Y-5.000 E18.02166 F3600
+G1 X-12.000 Y-5.000 E18.81606 F3600
+G1 X-12.000 Y-4.000 E18.84916 F3600
+G1 X12.000 Y-4.000 E19.64356 F3600
+G1 X12.000 Y-3.000 E19.67666 F3600
+G1 X-12.000 Y-3.000 E20.47106 F3600
+G1 X-12.000 Y-2.000 E20.50416 F3600
+G1 X12.000 Y-2.000 E21.29856 F3600
+G1 X12.000 Y-1.000 E21.33166 F3600
+G1 X-12.000 Y-1.000 E22.12606 F3600
+G1 X-12.000 Y0.000 E22.15916 F3600
+G1 X12.000 Y0.000 E22.95356 F3600
+G1 X12.000 Y1.000 E22.98666 F3600
+G1 X-12.000 Y1.000 E23.78106 F3600
+G1 X-12.000 Y2.000 E23.81416 F3600
+G1 X12.000 Y2.000 E24.60856 F3600
+G1 X12.000 Y3.000 E24.64166 F3600
+G1 X-12.000 Y3.000 E25.43606 F3600
+G1 X-12.000 Y4.000 E25.46916 F3600
+G1 X12.000 Y4.000 E26.26356 F3600
+G1 X12.000 Y5.000 E26.29666 F3600
+G1 X-12.000 Y5.000 E27.09106 F3600
+G1 X-12.000 Y6.000 E27.12416 F3600
+G1 X12.000 Y6.000 E27.91856 F3600
+G1 X12.000 Y7.000 E27.95166 F3600
+G1 X-12.000 Y7.000 E28.74606 F3600
+G1 X-12.000 Y8.000 E28.77916 F3600
+G1 X12.000 Y8.000 E29.57356 F3600
+G1 X12.000 Y9.000 E29.60666 F3600
+G1 X-12.000 Y9.000 E30.40106 F3600
+G1 X-12.000 Y10.000 E30.43416 F3600
+G1 X12.000 Y10.000 E31.22856 F3600
+G1 X12.000 Y11.000 E31.26166 F3600
+G1 X-12.000 Y11.000 E32.05606 F3600
+G1 X-12.000 Y12.000 E32.08916 F3600
+G1 X12.000 Y12.000 E32.88356 F3600
+;LAYER:7
+G1 Z1.60 F1200
+G1 E31.88356 F2400
+G1 X20.000 Y0.000 F9000
+G1 E32.88356 F2400
+G1 X19.924 Y1.743 E32.94132 F1800
+G1 X19.696 Y3.473 E32.99907 F1800
+G1 X19.319 Y5.176 E33.05682 F1800
+G1 X18.794 Y6.840 E33.11457 F1800
+G1 X18.126 Y8.452 E33.17232 F1800
+G1 X17.321 Y10.000 E33.23008 F1800
+G1 X16.383 Y11.472 E33.28783 F1800
+G1 X15.321 Y12.856 E33.34558 F1800
+G1 X14.142 Y14.142 E33.40333 F1800
+G1 X12.856 Y15.321 E33.46108 F1800
+G1 X11.472 Y16.383 E33.51884 F1800
+G1 X10.000 Y17.321 E33.57659 F1800
+G1 X8.452 Y18.126 E33.63434 F1800
+G1 X6.840 Y18.794 E33.69209 F1800
+G1 X5.176 Y19.319 E33.74984 F1800
+G1 X3.473 Y19.696 E33.80760 F1800
+G1 X1.743 Y19.924 E33.86535 F1800
+G1 X0.000 Y20.000 E33.92310 F1800
+G1 X-1.743 Y19.924 E33.98085 F1800
+G1 X-3.473 Y19.696 E34.03860 F1800
+G1 X-5.176 Y19.319 E34.09636 F1800
+G1 X-6.840 Y18.794 E34.15411 F1800
+G1 X-8.452 Y18.126 E34.21186 F1800
+G1 X-10.000 Y17.321 E34.26961 F1800
+G1 X-11.472 Y16.383 E34.32737 F1800
+G1 X-12.856 Y15.321 E34.38512 F1800
+G1 X-14.142 Y14.142 E34.44287 F1800
+G1 X-15.321 Y12.856 E34.50062 F1800
+G1 X-16.383 Y11.472 E34.55837 F1800
+G1 X-17.321 Y10.000 E34.61613 F1800
+G1 X-18.126 Y8.452 E34.67388 F1800
+G1 X-18.794 Y6.840 E34.73163 F1800
+G1 X-19.319 Y5.176 E34.78938 F1800
+G1 X-19.696 Y3.473 E34.84713 F1800
+G1 X-19.924 Y1.743 E34.90489 F1800
+G1 X-20.000 Y0.000 E34.96264 F1800
+G1 X-19.924 Y-1.743 E35.02039 F1800
+G1 X-19.696 Y-3.473 E35.07814 F1800
+G1 X-19.319 Y-5.176 E35.13589 F1800
+G1 X-18.794 Y-6.840 E35.19365 F1800
+G1 X-18.126 Y-8.452 E35.25140 F1800
+G1 X-17.321 Y-10.000 E35.30915 F1800
+G1 X-16.383 Y-11.472 E35.36690 F1800
+G1 X-15.321 Y-12.856 E35.42465 F1800
+G1 X-14.142 Y-14.142 E35.48241 F1800
+G1 X-12.856 Y-15.321 E35.54016 F1800
+G1 X-11.472 Y-16.383 E35.59791 F1800
+G1 X-10.000 Y-17.321 E35.65566 F1800
+G1 X-8.452 Y-18.126 E35.71341 F1800
+G1 X-6.840 Y-18.794 E35.77117 F1800
+G1 X-5.176 Y-19.319 E35.82892 F1800
+G1 X-3.473 Y-19.696 E35.88667 F1800
+G1 X-1.743 Y-19.924 E35.94442 F1800
+G1 X-0.000 Y-20.000 E36.00218 F1800
+G1 X1.743 Y-19.924 E36.05993 F1800
+G1 X3.473 Y-19.696 E36.11768 F1800
+G1 X5.176 Y-19.319 E36.17543 F1800
+G1 X6.840 Y-18.794 E36.23318 F1800
+G1 X8.452 Y-18.126 E36.29094 F1800
+G1 X10.000 Y-17.321 E36.34869 F1800
+G1 X11.472 Y-16.383 E36.40644 F1800
+G1 X12.856 Y-15.321 E36.46419 F1800
+G1 X14.142 Y-14.142 E36.52194 F1800
+G1 X15.321 Y-12.856 E36.57970 F1800
+G1 X16.383 Y-11.472 E36.63745 F1800
+G1 X17.321 Y-10.000 E36.69520 F1800
+G1 X18.126 Y-8.452 E36.75295 F1800
+G1 X18.794 Y-6.840 E36.81070 F1800
+G1 X19.319 Y-5.176 E36.86846 F1800
+G1 X19.696 Y-3.473 E36.92621 F1800
+G1 X19.924 Y-1.743 E36.98396 F1800
+G1 X20.000 Y-0.000 E37.04171 F1800
+G1 X19.525 Y1.708 E37.10040 F2400
+G1 X19.302 Y3.404 E37.15699 F2400
+G1 X18.932 Y5.073 E37.21359 F2400
+G1 X18.418 Y6.704 E37.27019 F2400
+G1 X17.764 Y8.283 E37.32679 F2400
+G1 X16.974 Y9.800 E37.38338 F2400
+G1 X16.055 Y11.242 E37.43998 F2400
+G1 X15.014 Y12.599 E37.49658 F2400
+G1 X13.859 Y13.859 E37.55317 F2400
+G1 X12.599 Y15.014 E37.60977 F2400
+G1 X11.242 Y16.055 E37.66637 F2400
+G1 X9.800 Y16.974 E37.72296 F2400
+G1 X8.283 Y17.764 E37.77956 F2400
+G1 X6.704 Y18.418 E37.83616 F2400
+G1 X5.073 Y18.932 E37.89276 F2400
+G1 X3.404 Y19.302 E37.94935 F2400
+G1 X1.708 Y19.525 E38.00595 F2400
+G1 X0.000 Y19.600 E38.06255 F2400
+G1 X-1.708 Y19.525 E38.11914 F2400
+G1 X-3.404 Y19.302 E38.17574 F2400
+G1 X-5.073 Y18.932 E38.23234 F2400
+G1 X-6.704 Y18.418 E38.28893 F2400
+G1 X-8.283 Y17.764 E38.34553 F2400
+G1 X-9.800 Y16.974 E38.40213 F2400
+G1 X-11.242 Y16.055 E38.45873 F2400
+G1 X-12.599 Y15.014 E38.51532 F2400
+G1 X-13.859 Y13.859 E38.57192 F2400
+G1 X-15.014 Y12.599 E38.62852 F2400
+G1 X-16.055 Y11.242 E38.68511 F2400
+G1 X-16.974 Y9.800 E38.74171 F2400
+G1 X-17.764 Y8.283 E38.79831 F2400
+G1 X-18.418 Y6.704 E38.85491 F2400
+G1 X-18.932 Y5.073 E38.91150 F2400
+G1 X-19.302 Y3.404 E38.96810 F2400
+G1 X-19.525 Y1.708 E39.02470 F2400
+G1 X-19.600 Y0.000 E39.08129 F2400
+G1 X-19.525 Y-1.708 E39.13789 F2400
+G1 X-19.302 Y-3.404 E39.19449 F2400
+G1 X-18.932 Y-5.073 E39.25108 F2400
+G1 X-18.418 Y-6.704 E39.30768 F2400
+G1 X-17.764 Y-8.283 E39.36428 F2400
+G1 X-16.974 Y-9.800 E39.42088 F2400
+G1 X-16.055 Y-11.242 E39.47747 F2400
+G1 X-15.014 Y-12.599 E39.53407 F2400
+G1 X-13.859 Y-13.859 E39.59067 F2400
+G1 X-12.599 Y-15.014 E39.64726 F2400
+G1 X-11.242 Y-16.055 E39.70386 F2400
+G1 X-9.800 Y-16.974 E39.76046 F2400
+G1 X-8.283 Y-17.764 E39.81705 F2400
+G1 X-6.704 Y-18.418 E39.87365 F2400
+G1 X-5.073 Y-18.932 E39.93025 F2400
+G1 X-3.404 Y-19.302 E39.98685 F2400
+G1 X-1.708 Y-19.525 E40.04344 F2400
+G1 X-0.000 Y-19.600 E40.10004 F2400
+G1 X1.708 Y-19.525 E40.15664 F2400
+G1 X3.404 Y-19.302 E40.21323 F2400
+G1 X5.073 Y-18.932 E40.26983 F2400
+G1 X6.704 Y-18.418 E40.32643 F2400
+G1 X8.283 Y-17.764 E40.38302 F2400
+G1 X9.800 Y-16.974 E40.43962 F2400
+G1 X11.242 Y-16.055 E40.49622 F2400
+G1 X12.599 Y-15.014 E40.55282 F2400
+G1 X13.859 Y-13.859 E40.60941 F2400
+G1 X15.014 Y-12.599 E40.66601 F2400
+G1 X16.055 Y-11.242 E40.72261 F2400
+G1 X16.974 Y-9.800 E40.77920 F2400
+G1 X17.764 Y-8.283 E40.83580 F2400
+G1 X18.418 Y-6.704 E40.89240 F2400
+G1 X18.932 Y-5.073 E40.94900 F2400
+G1 X19.302 Y-3.404 E41.00559 F2400
+G1 X19.525 Y-1.708 E41.06219 F2400
+G1 X19.600 Y-0.000 E41.11879 F2400
+G1 X19.127 Y1.673 E41.17635 F2400
+G1 X18.908 Y3.334 E41.23179 F2400
+G1 X18.546 Y4.969 E41.28723 F2400
+G1 X18.042 Y6.567 E41.34267 F2400
+G1 X17.401 Y8.114 E41.39811 F2400
+G1 X16.628 Y9.600 E41.45356 F2400
+G1 X15.728 Y11.013 E41.50900 F2400
+G1 X14.708 Y12.342 E41.56444 F2400
+G1 X13.576 Y13.576 E41.61988 F2400
+G1 X12.342 Y14.708 E41.67532 F2400
+G1 X11.013 Y15.728 E41.73077 F2400
+G1 X9.600 Y16.628 E41.78621 F2400
+G1 X8.114 Y17.401 E41.84165 F2400
+G1 X6.567 Y18.042 E41.89709 F2400
+G1 X4.969 Y18.546 E41.95253 F2400
+G1 X3.334 Y18.908 E42.00798 F2400
+G1 X1.673 Y19.127 E42.06342 F2400
+G1 X0.000 Y19.200 E42.11886 F2400
+G1 X-1.673 Y19.127 E42.17430 F2400
+G1 X-3.334 Y18.908 E42.22974 F2400
+G1 X-4.969 Y18.546 E42.28519 F2400
+G1 X-6.567 Y18.042 E42.34063 F2400
+G1 X-8.114 Y17.401 E42.39607 F2400
+G1 X-9.600 Y16.628 E42.45151 F2400
+G1 X-11.013 Y15.728 E42.50695 F2400
+G1 X-12.342 Y14.708 E42.56240 F2400
+G1 X-13.576 Y13.576 E42.61784 F2400
+G1 X-14.708 Y12.342 E42.67328 F2400
+G1 X-15.728 Y11.013 E42.72872 F2400
+G1 X-16.628 Y9.600 E42.78416 F2400
+G1 X-17.401 Y8.114 E42.83961 F2400
+G1 X-18.042 Y6.567 E42.89505 F2400
+G1 X-18.546 Y4.969 E42.95049 F2400
+G1 X-18.908 Y3.334 E43.00593 F2400
+G1 X-19.127 Y1.673 E43.06137 F2400
+G1 X-19.200 Y0.000 E43.11682 F2400
+G1 X-19.127 Y-1.673 E43.17226 F2400
+G1 X-18.908 Y-3.334 E43.22770 F2400
+G1 X-18.546 Y-4.969 E43.28314 F2400
+G1 X-18.042 Y-6.567 E43.33858 F2400
+G1 X-17.401 Y-8.114 E43.39403 F2400
+G1 X-16.628 Y-9.600 E43.44947 F2400
+G1 X-15.728 Y-11.013 E43.50491 F2400
+G1 X-14.708 Y-12.342 E43.56035 F2400
+G1 X-13.576 Y-13.576 E43.61579 F2400
+G1 X-12.342 Y-14.708 E43.67124 F2400
+G1 X-11.013 Y-15.728 E43.72668 F2400
+G1 X-9.600 Y-16.628 E43.78212 F2400
+G1 X-8.114 Y-17.401 E43.83756 F2400
+G1 X-6.567 Y-18.042 E43.89300 F2400
+G1 X-4.969 Y-18.546 E43.94845 F2400
+G1 X-3.334 Y-18.908 E44.00389 F2400
+G1 X-1.673 Y-19.127 E44.05933 F2400
+G1 X-0.000 Y-19.200 E44.11477 F2400
+G1 X1.673 Y-19.127 E44.17021 F2400
+G1 X3.334 Y-18.908 E44.22566 F2400
+G1 X4.969 Y-18.546 E44.28110 F2400
+G1 X6.567 Y-18.042 E44.33654 F2400
+G1 X8.114 Y-17.401 E44.39198 F2400
+G1 X9.600 Y-16.628 E44.44742 F2400
+G1 X11.013 Y-15.728 E44.50287 F2400
+G1 X12.342 Y-14.708 E44.55831 F2400
+G1 X13.576 Y-13.576 E44.61375 F2400
+G1 X14.708 Y-12.342 E44.66919 F2400
+G1 X15.728 Y-11.013 E44.72463 F2400
+G1 X16.628 Y-9.600 E44.78008 F2400
+G1 X17.401 Y-8.114 E44.83552 F2400
+G1 X18.042 Y-6.567 E44.89096 F2400
+G1 X18.546 Y-4.969 E44.94640 F2400
+G1 X18.908 Y-3.334 E45.00184 F2400
+G1 X19.127 Y-1.673 E45.05729 F2400
+G1 X19.200 Y-0.000 E45.11273 F2400
+G1 E44.11273 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E45.11273 F2400
+G1 X-12.000 Y12.000 E45.90713 F3600
+G1 X-11.200 Y12.000 E45.93361 F3600
+G1 X-11.200 Y-12.000 E46.72801 F3600
+G1 X-10.400 Y-12.000 E46.75449 F3600
+G1 X-10.400 Y12.000 E47.54889 F3600
+G1 X-9.600 Y12.000 E47.57537 F3600
+G1 X-9.600 Y-12.000 E48.36977 F3600
+G1 X-8.800 Y-12.000 E48.39625 F3600
+G1 X-8.800 Y12.000 E49.19065 F3600
+G1 X-8.000 Y12.000 E49.21713 F3600
+G1 X-8.000 Y-12.000 E50.01153 F3600
+G1 X-7.200 Y-12.000 E50.03801 F3600
+G1 X-7.200 Y12.000 E50.83241 F3600
+G1 X-6.400 Y12.000 E50.85889 F3600
+G1 X-6.400 Y-12.000 E51.65329 F3600
+G1 X-5.600 Y-12.000 E51.67977 F3600
+G1 X-5.600 Y12.000 E52.47417 F3600
+G1 X-4.800 Y12.000 E52.50065 F3600
+G1 X-4.800 Y-12.000 E53.29505 F3600
+G1 X-4.000 Y-12.000 E53.32153 F3600
+G1 X-4.000 Y12.000 E54.11593 F3600
+G1 X-3.200 Y12.000 E54.14241 F3600
+G1 X-3.200 Y-12.000 E54.93681 F3600
+G1 X-2.400 Y-12.000 E54.96329 F3600
+G1 X-2.400 Y12.000 E55.75769 F3600
+G1 X-1.600 Y12.000 E55.78417 F3600
+G1 X-1.600 Y-12.000 E56.57857 F3600
+G1 X-0.800 Y-12.000 E56.60505 F3600
+G1 X-0.800 Y12.000 E57.39945 F3600
+G1 X0.000 Y12.000 E57.42593 F3600
+G1 X0.000 Y-12.000 E58.22033 F3600
+G1 X0.800 Y-12.000 E58.24681 F3600
+G1 X0.800 Y12.000 E59.04121 F3600
+G1 X1.600 Y12.000 E59.06769 F3600
+G1 X1.600 Y-12.000 E59.86209 F3600
+G1 X2.400 Y-12.000 E59.88857 F3600
+G1 X2.400 Y12.000 E60.68297 F3600
+G1 X3.200 Y12.000 E60.70945 F3600
+G1 X3.200 Y-12.000 E61.50385 F3600
+G1 X4.000 Y-12.000 E61.53033 F3600
+G1 X4.000 Y12.000 E62.32473 F3600
+G1 X4.800 Y12.000 E62.35121 F3600
+G1 X4.800 Y-12.000 E63.14561 F3600
+G1 X5.600 Y-12.000 E63.17209 F3600
+G1 X5.600 Y12.000 E63.96649 F3600
+G1 X6.400 Y12.000 E63.99297 F3600
+G1 X6.400 Y-12.000 E64.78737 F3600
+G1 X7.200 Y-12.000 E64.81385 F3600
+G1 X7.200 Y12.000 E65.60825 F3600
+G1 X8.000 Y12.000 E65.63473 F3600
+G1 X8.000 Y-12.000 E66.42913 F3600
+G1 X8.800 Y-12.000 E66.45561 F3600
+G1 X8.800 Y12.000 E67.25001 F3600
+G1 X9.600 Y12.000 E67.27649 F3600
+G1 X9.600 Y-12.000 E68.07089 F3600
+G1 X10.400 Y-12.000 E68.09737 F3600
+G1 X10.400 Y12.000 E68.89177 F3600
+G1 X11.200 Y12.000 E68.91825 F3600
+G1 X11.200 Y-12.000 E69.71265 F3600
+G1 X12.000 Y-12.000 E69.73913 F3600
+G1 X12.000 Y12.000 E70.53353 F3600
+;LAYER:8
+G1 Z1.80 F1200
+G1 E69.53353 F2400
+G1 X20.000 Y0.000 F9000
+G1 E70.53353 F2400
+G1 X19.924 Y1.743 E70.59128 F1800
+G1 X19.696 Y3.473 E70.64903 F1800
+G1 X19.319 Y5.176 E70.70678 F1800
+G1 X18.794 Y6.840 E70.76454 F1800
+G1 X18.126 Y8.452 E70.82229 F1800
+G1 X17.321 Y10.000 E70.88004 F1800
+G1 X16.383 Y11.472 E70.93779 F1800
+G1 X15.321 Y12.856 E70.99554 F1800
+G1 X14.142 Y14.142 E71.05330 F1800
+G1 X12.856 Y15.321 E71.11105 F1800
+G1 X11.472 Y16.383 E71.16880 F1800
+G1 X10.000 Y17.321 E71.22655 F1800
+G1 X8.452 Y18.126 E71.28430 F1800
+G1 X6.840 Y18.794 E71.34206 F1800
+G1 X5.176 Y19.319 E71.39981 F1800
+G1 X3.473 Y19.696 E71.45756 F1800
+G1 X1.743 Y19.924 E71.51531 F1800
+G1 X0.000 Y20.000 E71.57306 F1800
+G1 X-1.743 Y19.924 E71.63082 F1800
+G1 X-3.473 Y19.696 E71.68857 F1800
+G1 X-5.176 Y19.319 E71.74632 F1800
+G1 X-6.840 Y18.794 E71.80407 F1800
+G1 X-8.452 Y18.126 E71.86182 F1800
+G1 X-10.000 Y17.321 E71.91958 F1800
+G1 X-11.472 Y16.383 E71.97733 F1800
+G1 X-12.856 Y15.321 E72.03508 F1800
+G1 X-14.142 Y14.142 E72.09283 F1800
+G1 X-15.321 Y12.856 E72.15059 F1800
+G1 X-16.383 Y11.472 E72.20834 F1800
+G1 X-17.321 Y10.000 E72.26609 F1800
+G1 X-18.126 Y8.452 E72.32384 F1800
+G1 X-18.794 Y6.840 E72.38159 F1800
+G1 X-19.319 Y5.176 E72.43935 F1800
+G1 X-19.696 Y3.473 E72.49710 F1800
+G1 X-19.924 Y1.743 E72.55485 F1800
+G1 X-20.000 Y0.000 E72.61260 F1800
+G1 X-19.924 Y-1.743 E72.67035 F1800
+G1 X-19.696 Y-3.473 E72.72811 F1800
+G1 X-19.319 Y-5.176 E72.78586 F1800
+G1 X-18.794 Y-6.840 E72.84361 F1800
+G1 X-18.126 Y-8.452 E72.90136 F1800
+G1 X-17.321 Y-10.000 E72.95911 F1800
+G1 X-16.383 Y-11.472 E73.01687 F1800
+G1 X-15.321 Y-12.856 E73.07462 F1800
+G1 X-14.142 Y-14.142 E73.13237 F1800
+G1 X-12.856 Y-15.321 E73.19012 F1800
+G1 X-11.472 Y-16.383 E73.24787 F1800
+G1 X-10.000 Y-17.321 E73.30563 F1800
+G1 X-8.452 Y-18.126 E73.36338 F1800
+G1 X-6.840 Y-18.794 E73.42113 F1800
+G1 X-5.176 Y-19.319 E73.47888 F1800
+G1 X-3.473 Y-19.696 E73.53663 F1800
+G1 X-1.743 Y-19.924 E73.59439 F1800
+G1 X-0.000 Y-20.000 E73.65214 F1800
+G1 X1.743 Y-19.924 E73.70989 F1800
+G1 X3.473 Y-19.696 E73.76764 F1800
+G1 X5.176 Y-19.319 E73.82540 F1800
+G1 X6.840 Y-18.794 E73.88315 F1800
+G1 X8.452 Y-18.126 E73.94090 F1800
+G1 X10.000 Y-17.321 E73.99865 F1800
+G1 X11.472 Y-16.383 E74.05640 F1800
+G1 X12.856 Y-15.321 E74.11416 F1800
+G1 X14.142 Y-14.142 E74.17191 F1800
+G1 X15.321 Y-12.856 E74.22966 F1800
+G1 X16.383 Y-11.472 E74.28741 F1800
+G1 X17.321 Y-10.000 E74.34516 F1800
+G1 X18.126 Y-8.452 E74.40292 F1800
+G1 X18.794 Y-6.840 E74.46067 F1800
+G1 X19.319 Y-5.176 E74.51842 F1800
+G1 X19.696 Y-3.473 E74.57617 F1800
+G1 X19.924 Y-1.743 E74.63392 F1800
+G1 X20.000 Y-0.000 E74.69168 F1800
+G1 X19.525 Y1.708 E74.75036 F2400
+G1 X19.302 Y3.404 E74.80696 F2400
+G1 X18.932 Y5.073 E74.86355 F2400
+G1 X18.418 Y6.704 E74.92015 F2400
+G1 X17.764 Y8.283 E74.97675 F2400
+G1 X16.974 Y9.800 E75.03335 F2400
+G1 X16.055 Y11.242 E75.08994 F2400
+G1 X15.014 Y12.599 E75.14654 F2400
+G1 X13.859 Y13.859 E75.20314 F2400
+G1 X12.599 Y15.014 E75.25973 F2400
+G1 X11.242 Y16.055 E75.31633 F2400
+G1 X9.800 Y16.974 E75.37293 F2400
+G1 X8.283 Y17.764 E75.42953 F2400
+G1 X6.704 Y18.418 E75.48612 F2400
+G1 X5.073 Y18.932 E75.54272 F2400
+G1 X3.404 Y19.302 E75.59932 F2400
+G1 X1.708 Y19.525 E75.65591 F2400
+G1 X0.000 Y19.600 E75.71251 F2400
+G1 X-1.708 Y19.525 E75.76911 F2400
+G1 X-3.404 Y19.302 E75.82570 F2400
+G1 X-5.073 Y18.932 E75.88230 F2400
+G1 X-6.704 Y18.418 E75.93890 F2400
+G1 X-8.283 Y17.764 E75.99550 F2400
+G1 X-9.800 Y16.974 E76.05209 F2400
+G1 X-11.242 Y16.055 E76.10869 F2400
+G1 X-12.599 Y15.014 E76.16529 F2400
+G1 X-13.859 Y13.859 E76.22188 F2400
+G1 X-15.014 Y12.599 E76.27848 F2400
+G1 X-16.055 Y11.242 E76.33508 F2400
+G1 X-16.974 Y9.800 E76.39167 F2400
+G1 X-17.764 Y8.283 E76.44827 F2400
+G1 X-18.418 Y6.704 E76.50487 F2400
+G1 X-18.932 Y5.073 E76.56147 F2400
+G1 X-19.302 Y3.404 E76.61806 F2400
+G1 X-19.525 Y1.708 E76.67466 F2400
+G1 X-19.600 Y0.000 E76.73126 F2400
+G1 X-19.525 Y-1.708 E76.78785 F2400
+G1 X-19.302 Y-3.404 E76.84445 F2400
+G1 X-18.932 Y-5.073 E76.90105 F2400
+G1 X-18.418 Y-6.704 E76.95764 F2400
+G1 X-17.764 Y-8.283 E77.01424 F2400
+G1 X-16.974 Y-9.800 E77.07084 F2400
+G1 X-16.055 Y-11.242 E77.12744 F2400
+G1 X-15.014 Y-12.599 E77.18403 F2400
+G1 X-13.859 Y-13.859 E77.24063 F2400
+G1 X-12.599 Y-15.014 E77.29723 F2400
+G1 X-11.242 Y-16.055 E77.35382 F2400
+G1 X-9.800 Y-16.974 E77.41042 F2400
+G1 X-8.283 Y-17.764 E77.46702 F2400
+G1 X-6.704 Y-18.418 E77.52362 F2400
+G1 X-5.073 Y-18.932 E77.58021 F2400
+G1 X-3.404 Y-19.302 E77.63681 F2400
+G1 X-1.708 Y-19.525 E77.69341 F2400
+G1 X-0.000 Y-19.600 E77.75000 F2400
+G1 X1.708 Y-19.525 E77.80660 F2400
+G1 X3.404 Y-19.302 E77.86320 F2400
+G1 X5.073 Y-18.932 E77.91979 F2400
+G1 X6.704 Y-18.418 E77.97639 F2400
+G1 X8.283 Y-17.764 E78.03299 F2400
+G1 X9.800 Y-16.974 E78.08959 F2400
+G1 X11.242 Y-16.055 E78.14618 F2400
+G1 X12.599 Y-15.014 E78.20278 F2400
+G1 X13.859 Y-13.859 E78.25938 F2400
+G1 X15.014 Y-12.599 E78.31597 F2400
+G1 X16.055 Y-11.242 E78.37257 F2400
+G1 X16.974 Y-9.800 E78.42917 F2400
+G1 X17.764 Y-8.283 E78.48576 F2400
+G1 X18.418 Y-6.704 E78.54236 F2400
+G1 X18.932 Y-5.073 E78.59896 F2400
+G1 X19.302 Y-3.404 E78.65556 F2400
+G1 X19.525 Y-1.708 E78.71215 F2400
+G1 X19.600 Y-0.000 E78.76875 F2400
+G1 X19.127 Y1.673 E78.82631 F2400
+G1 X18.908 Y3.334 E78.88175 F2400
+G1 X18.546 Y4.969 E78.93719 F2400
+G1 X18.042 Y6.567 E78.99264 F2400
+G1 X17.401 Y8.114 E79.04808 F2400
+G1 X16.628 Y9.600 E79.10352 F2400
+G1 X15.728 Y11.013 E79.15896 F2400
+G1 X14.708 Y12.342 E79.21440 F2400
+G1 X13.576 Y13.576 E79.26985 F2400
+G1 X12.342 Y14.708 E79.32529 F2400
+G1 X11.013 Y15.728 E79.38073 F2400
+G1 X9.600 Y16.628 E79.43617 F2400
+G1 X8.114 Y17.401 E79.49161 F2400
+G1 X6.567 Y18.042 E79.54706 F2400
+G1 X4.969 Y18.546 E79.60250 F2400
+G1 X3.334 Y18.908 E79.65794 F2400
+G1 X1.673 Y19.127 E79.71338 F2400
+G1 X0.000 Y19.200 E79.76882 F2400
+G1 X-1.673 Y19.127 E79.82427 F2400
+G1 X-3.334 Y18.908 E79.87971 F2400
+G1 X-4.969 Y18.546 E79.93515 F2400
+G1 X-6.567 Y18.042 E79.99059 F2400
+G1 X-8.114 Y17.401 E80.04603 F2400
+G1 X-9.600 Y16.628 E80.10148 F2400
+G1 X-11.013 Y15.728 E80.15692 F2400
+G1 X-12.342 Y14.708 E80.21236 F2400
+G1 X-13.576 Y13.576 E80.26780 F2400
+G1 X-14.708 Y12.342 E80.32324 F2400
+G1 X-15.728 Y11.013 E80.37869 F2400
+G1 X-16.628 Y9.600 E80.43413 F2400
+G1 X-17.401 Y8.114 E80.48957 F2400
+G1 X-18.042 Y6.567 E80.54501 F2400
+G1 X-18.546 Y4.969 E80.60045 F2400
+G1 X-18.908 Y3.334 E80.65590 F2400
+G1 X-19.127 Y1.673 E80.71134 F2400
+G1 X-19.200 Y0.000 E80.76678 F2400
+G1 X-19.127 Y-1.673 E80.82222 F2400
+G1 X-18.908 Y-3.334 E80.87766 F2400
+G1 X-18.546 Y-4.969 E80.93311 F2400
+G1 X-18.042 Y-6.567 E80.98855 F2400
+G1 X-17.401 Y-8.114 E81.04399 F2400
+G1 X-16.628 Y-9.600 E81.09943 F2400
+G1 X-15.728 Y-11.013 E81.15487 F2400
+G1 X-14.708 Y-12.342 E81.21032 F2400
+G1 X-13.576 Y-13.576 E81.26576 F2400
+G1 X-12.342 Y-14.708 E81.32120 F2400
+G1 X-11.013 Y-15.728 E81.37664 F2400
+G1 X-9.600 Y-16.628 E81.43208 F2400
+G1 X-8.114 Y-17.401 E81.48753 F2400
+G1 X-6.567 Y-18.042 E81.54297 F2400
+G1 X-4.969 Y-18.546 E81.59841 F2400
+G1 X-3.334 Y-18.908 E81.65385 F2400
+G1 X-1.673 Y-19.127 E81.70929 F2400
+G1 X-0.000 Y-19.200 E81.76473 F2400
+G1 X1.673 Y-19.127 E81.82018 F2400
+G1 X3.334 Y-18.908 E81.87562 F2400
+G1 X4.969 Y-18.546 E81.93106 F2400
+G1 X6.567 Y-18.042 E81.98650 F2400
+G1 X8.114 Y-17.401 E82.04194 F2400
+G1 X9.600 Y-16.628 E82.09739 F2400
+G1 X11.013 Y-15.728 E82.15283 F2400
+G1 X12.342 Y-14.708 E82.20827 F2400
+G1 X13.576 Y-13.576 E82.26371 F2400
+G1 X14.708 Y-12.342 E82.31915 F2400
+G1 X15.728 Y-11.013 E82.37460 F2400
+G1 X16.628 Y-9.600 E82.43004 F2400
+G1 X17.401 Y-8.114 E82.48548 F2400
+G1 X18.042 Y-6.567 E82.54092 F2400
+G1 X18.546 Y-4.969 E82.59636 F2400
+G1 X18.908 Y-3.334 E82.65181 F2400
+G1 X19.127 Y-1.673 E82.70725 F2400
+G1 X19.200 Y-0.000 E82.76269 F2400
+G1 E81.76269 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E82.76269 F2400
+G1 X12.000 Y-12.000 E83.55709 F3600
+G1 X12.000 Y-11.000 E83.59019 F3600
+G1 X-12.000 Y-11.000 E84.38459 F3600
+G1 X-12.000 Y-10.000 E84.41769 F3600
+G1 X12.000 Y-10.000 E85.21209 F3600
+G1 X12.000 Y-9.000 E85.24519 F3600
+G1 X-12.000 Y-9.000 E86.03959 F3600
+G1 X-12.000 Y-8.000 E86.07269 F3600
+G1 X12.000 Y-8.000 E86.86709 F3600
+G1 X12.000 Y-7.000 E86.90019 F3600
+G1 X-12.000 Y-7.000 E87.69459 F3600
+G1 X-12.000 Y-6.000 E87.72769 F3600
+G1 X12.000 Y-6.000 E88.52209 F3600
+G1 X12.000 Y-5.000 E88.55519 F3600
+G1 X-12.000 Y-5.000 E89.34959 F3600
+G1 X-12.000 Y-4.000 E89.38269 F3600
+G1 X12.000 Y-4.000 E90.17709 F3600
+G1 X12.000 Y-3.000 E90.21019 F3600
+G1 X-12.000 Y-3.000 E91.00459 F3600
+G1 X-12.000 Y-2.000 E91.03769 F3600
+G1 X12.000 Y-2.000 E91.83209 F3600
+G1 X12.000 Y-1.000 E91.86519 F3600
+G1 X-12.000 Y-1.000 E92.65959 F3600
+G1 X-12.000 Y0.000 E92.69269 F3600
+G1 X12.000 Y0.000 E93.48709 F3600
+G1 X12.000 Y1.000 E93.52019 F3600
+G1 X-12.000 Y1.000 E94.31459 F3600
+G1 X-12.000 Y2.000 E94.34769 F3600
+G1 X12.000 Y2.000 E95.14209 F3600
+G1 X12.000 Y3.000 E95.17519 F3600
+G1 X-12.000 Y3.000 E95.96959 F3600
+G1 X-12.000 Y4.000 E96.00269 F3600
+G1 X12.000 Y4.000 E96.79709 F3600
+G1 X12.000 Y5.000 E96.83019 F3600
+G1 X-12.000 Y5.000 E97.62459 F3600
+G1 X-12.000 Y6.000 E97.65769 F3600
+G1 X12.000 Y6.000 E98.45209 F3600
+G1 X12.000 Y7.000 E98.48519 F3600
+G1 X-12.000 Y7.000 E99.27959 F3600
+G1 X-12.000 Y8.000 E99.31269 F3600
+G1 X12.000 Y8.000 E100.10709 F3600
+G1 X12.000 Y9.000 E100.14019 F3600
+G1 X-12.000 Y9.000 E100.93459 F3600
+G1 X-12.000 Y10.000 E100.96769 F3600
+G1 X12.000 Y10.000 E101.76209 F3600
+G1 X12.000 Y11.000 E101.79519 F3600
+G1 X-12.000 Y11.000 E102.58959 F3600
+G1 X-12.000 Y12.000 E102.62269 F3600
+G1 X12.000 Y12.000 E103.41709 F3600
+;LAYER:9
+G1 Z2.00 F1200
+G1 E102.41709 F2400
+G1 X20.000 Y0.000 F9000
+G1 E103.41709 F2400
+G1 X19.924 Y1.743 E103.47484 F1800
+G1 X19.696 Y3.473 E103.53259 F1800
+G1 X19.319 Y5.176 E103.59035 F1800
+G1 X18.794 Y6.840 E103.64810 F1800
+G1 X18.126 Y8.452 E103.70585 F1800
+G1 X17.321 Y10.000 E103.76360 F1800
+G1 X16.383 Y11.472 E103.82136 F1800
+G1 X15.321 Y12.856 E103.87911 F1800
+G1 X14.142 Y14.142 E103.93686 F1800
+G1 X12.856 Y15.321 E103.99461 F1800
+G1 X11.472 Y16.383 E104.05236 F1800
+G1 X10.000 Y17.321 E104.11012 F1800
+G1 X8.452 Y18.126 E104.16787 F1800
+G1 X6.840 Y18.794 E104.22562 F1800
+G1 X5.176 Y19.319 E104.28337 F1800
+G1 X3.473 Y19.696 E104.34112 F1800
+G1 X1.743 Y19.924 E104.39888 F1800
+G1 X0.000 Y20.000 E104.45663 F1800
+G1 X-1.743 Y19.924 E104.51438 F1800
+G1 X-3.473 Y19.696 E104.57213 F1800
+G1 X-5.176 Y19.319 E104.62988 F1800
+G1 X-6.840 Y18.794 E104.68764 F1800
+G1 X-8.452 Y18.126 E104.74539 F1800
+G1 X-10.000 Y17.321 E104.80314 F1800
+G1 X-11.472 Y16.383 E104.86089 F1800
+G1 X-12.856 Y15.321 E104.91864 F1800
+G1 X-14.142 Y14.142 E104.97640 F1800
+G1 X-15.321 Y12.856 E105.03415 F1800
+G1 X-16.383 Y11.472 E105.09190 F1800
+G1 X-17.321 Y10.000 E105.14965 F1800
+G1 X-18.126 Y8.452 E105.20740 F1800
+G1 X-18.794 Y6.840 E105.26516 F1800
+G1 X-19.319 Y5.176 E105.32291 F1800
+G1 X-19.696 Y3.473 E105.38066 F1800
+G1 X-19.924 Y1.743 E105.43841 F1800
+G1 X-20.000 Y0.000 E105.49617 F1800
+G1 X-19.924 Y-1.743 E105.55392 F1800
+G1 X-19.696 Y-3.473 E105.61167 F1800
+G1 X-19.319 Y-5.176 E105.66942 F1800
+G1 X-18.794 Y-6.840 E105.72717 F1800
+G1 X-18.126 Y-8.452 E105.78493 F1800
+G1 X-17.321 Y-10.000 E105.84268 F1800
+G1 X-16.383 Y-11.472 E105.90043 F1800
+G1 X-15.321 Y-12.856 E105.95818 F1800
+G1 X-14.142 Y-14.142 E106.01593 F1800
+G1 X-12.856 Y-15.321 E106.07369 F1800
+G1 X-11.472 Y-16.383 E106.13144 F1800
+G1 X-10.000 Y-17.321 E106.18919 F1800
+G1 X-8.452 Y-18.126 E106.24694 F1800
+G1 X-6.840 Y-18.794 E106.30469 F1800
+G1 X-5.176 Y-19.319 E106.36245 F1800
+G1 X-3.473 Y-19.696 E106.42020 F1800
+G1 X-1.743 Y-19.924 E106.47795 F1800
+G1 X-0.000 Y-20.000 E106.53570 F1800
+G1 X1.743 Y-19.924 E106.59345 F1800
+G1 X3.473 Y-19.696 E106.65121 F1800
+G1 X5.176 Y-19.319 E106.70896 F1800
+G1 X6.840 Y-18.794 E106.76671 F1800
+G1 X8.452 Y-18.126 E106.82446 F1800
+G1 X10.000 Y-17.321 E106.88221 F1800
+G1 X11.472 Y-16.383 E106.93997 F1800
+G1 X12.856 Y-15.321 E106.99772 F1800
+G1 X14.142 Y-14.142 E107.05547 F1800
+G1 X15.321 Y-12.856 E107.11322 F1800
+G1 X16.383 Y-11.472 E107.17098 F1800
+G1 X17.321 Y-10.000 E107.22873 F1800
+G1 X18.126 Y-8.452 E107.28648 F1800
+G1 X18.794 Y-6.840 E107.34423 F1800
+G1 X19.319 Y-5.176 E107.40198 F1800
+G1 X19.696 Y-3.473 E107.45974 F1800
+G1 X19.924 Y-1.743 E107.51749 F1800
+G1 X20.000 Y-0.000 E107.57524 F1800
+G1 X19.525 Y1.708 E107.63392 F2400
+G1 X19.302 Y3.404 E107.69052 F2400
+G1 X18.932 Y5.073 E107.74712 F2400
+G1 X18.418 Y6.704 E107.80372 F2400
+G1 X17.764 Y8.283 E107.86031 F2400
+G1 X16.974 Y9.800 E107.91691 F2400
+G1 X16.055 Y11.242 E107.97351 F2400
+G1 X15.014 Y12.599 E108.03010 F2400
+G1 X13.859 Y13.859 E108.08670 F2400
+G1 X12.599 Y15.014 E108.14330 F2400
+G1 X11.242 Y16.055 E108.19989 F2400
+G1 X9.800 Y16.974 E108.25649 F2400
+G1 X8.283 Y17.764 E108.31309 F2400
+G1 X6.704 Y18.418 E108.36969 F2400
+G1 X5.073 Y18.932 E108.42628 F2400
+G1 X3.404 Y19.302 E108.48288 F2400
+G1 X1.708 Y19.525 E108.53948 F2400
+G1 X0.000 Y19.600 E108.59607 F2400
+G1 X-1.708 Y19.525 E108.65267 F2400
+G1 X-3.404 Y19.302 E108.70927 F2400
+G1 X-5.073 Y18.932 E108.76586 F2400
+G1 X-6.704 Y18.418 E108.82246 F2400
+G1 X-8.283 Y17.764 E108.87906 F2400
+G1 X-9.800 Y16.974 E108.93566 F2400
+G1 X-11.242 Y16.055 E108.99225 F2400
+G1 X-12.599 Y15.014 E109.04885 F2400
+G1 X-13.859 Y13.859 E109.10545 F2400
+G1 X-15.014 Y12.599 E109.16204 F2400
+G1 X-16.055 Y11.242 E109.21864 F2400
+G1 X-16.974 Y9.800 E109.27524 F2400
+G1 X-17.764 Y8.283 E109.33184 F2400
+G1 X-18.418 Y6.704 E109.38843 F2400
+G1 X-18.932 Y5.073 E109.44503 F2400
+G1 X-19.302 Y3.404 E109.50163 F2400
+G1 X-19.525 Y1.708 E109.55822 F2400
+G1 X-19.600 Y0.000 E109.61482 F2400
+G1 X-19.525 Y-1.708 E109.67142 F2400
+G1 X-19.302 Y-3.404 E109.72801 F2400
+G1 X-18.932 Y-5.073 E109.78461 F2400
+G1 X-18.418 Y-6.704 E109.84121 F2400
+G1 X-17.764 Y-8.283 E109.89781 F2400
+G1 X-16.974 Y-9.800 E109.95440 F2400
+G1 X-16.055 Y-11.242 E110.01100 F2400
+G1 X-15.014 Y-12.599 E110.06760 F2400
+G1 X-13.859 Y-13.859 E110.12419 F2400
+G1 X-12.599 Y-15.014 E110.18079 F2400
+G1 X-11.242 Y-16.055 E110.23739 F2400
+G1 X-9.800 Y-16.974 E110.29398 F2400
+G1 X-8.283 Y-17.764 E110.35058 F2400
+G1 X-6.704 Y-18.418 E110.40718 F2400
+G1 X-5.073 Y-18.932 E110.46378 F2400
+G1 X-3.404 Y-19.302 E110.52037 F2400
+G1 X-1.708 Y-19.525 E110.57697 F2400
+G1 X-0.000 Y-19.600 E110.63357 F2400
+G1 X1.708 Y-19.525 E110.69016 F2400
+G1 X3.404 Y-19.302 E110.74676 F2400
+G1 X5.073 Y-18.932 E110.80336 F2400
+G1 X6.704 Y-18.418 E110.85995 F2400
+G1 X8.283 Y-17.764 E110.91655 F2400
+G1 X9.800 Y-16.974 E110.97315 F2400
+G1 X11.242 Y-16.055 E111.02975 F2400
+G1 X12.599 Y-15.014 E111.08634 F2400
+G1 X13.859 Y-13.859 E111.14294 F2400
+G1 X15.014 Y-12.599 E111.19954 F2400
+G1 X16.055 Y-11.242 E111.25613 F2400
+G1 X16.974 Y-9.800 E111.31273 F2400
+G1 X17.764 Y-8.283 E111.36933 F2400
+G1 X18.418 Y-6.704 E111.42593 F2400
+G1 X18.932 Y-5.073 E111.48252 F2400
+G1 X19.302 Y-3.404 E111.53912 F2400
+G1 X19.525 Y-1.708 E111.59572 F2400
+G1 X19.600 Y-0.000 E111.65231 F2400
+G1 X19.127 Y1.673 E111.70987 F2400
+G1 X18.908 Y3.334 E111.76532 F2400
+G1 X18.546 Y4.969 E111.82076 F2400
+G1 X18.042 Y6.567 E111.87620 F2400
+G1 X17.401 Y8.114 E111.93164 F2400
+G1 X16.628 Y9.600 E111.98708 F2400
+G1 X15.728 Y11.013 E112.04253 F2400
+G1 X14.708 Y12.342 E112.09797 F2400
+G1 X13.576 Y13.576 E112.15341 F2400
+G1 X12.342 Y14.708 E112.20885 F2400
+G1 X11.013 Y15.728 E112.26429 F2400
+G1 X9.600 Y16.628 E112.31974 F2400
+G1 X8.114 Y17.401 E112.37518 F2400
+G1 X6.567 Y18.042 E112.43062 F2400
+G1 X4.969 Y18.546 E112.48606 F2400
+G1 X3.334 Y18.908 E112.54150 F2400
+G1 X1.673 Y19.127 E112.59695 F2400
+G1 X0.000 Y19.200 E112.65239 F2400
+G1 X-1.673 Y19.127 E112.70783 F2400
+G1 X-3.334 Y18.908 E112.76327 F2400
+G1 X-4.969 Y18.546 E112.81871 F2400
+G1 X-6.567 Y18.042 E112.87416 F2400
+G1 X-8.114 Y17.401 E112.92960 F2400
+G1 X-9.600 Y16.628 E112.98504 F2400
+G1 X-11.013 Y15.728 E113.04048 F2400
+G1 X-12.342 Y14.708 E113.09592 F2400
+G1 X-13.576 Y13.576 E113.15136 F2400
+G1 X-14.708 Y12.342 E113.20681 F2400
+G1 X-15.728 Y11.013 E113.26225 F2400
+G1 X-16.628 Y9.600 E113.31769 F2400
+G1 X-17.401 Y8.114 E113.37313 F2400
+G1 X-18.042 Y6.567 E113.42857 F2400
+G1 X-18.546 Y4.969 E113.48402 F2400
+G1 X-18.908 Y3.334 E113.53946 F2400
+G1 X-19.127 Y1.673 E113.59490 F2400
+G1 X-19.200 Y0.000 E113.65034 F2400
+G1 X-19.127 Y-1.673 E113.70578 F2400
+G1 X-18.908 Y-3.334 E113.76123 F2400
+G1 X-18.546 Y-4.969 E113.81667 F2400
+G1 X-18.042 Y-6.567 E113.87211 F2400
+G1 X-17.401 Y-8.114 E113.92755 F2400
+G1 X-16.628 Y-9.600 E113.98299 F2400
+G1 X-15.728 Y-11.013 E114.03844 F2400
+G1 X-14.708 Y-12.342 E114.09388 F2400
+G1 X-13.576 Y-13.576 E114.14932 F2400
+G1 X-12.342 Y-14.708 E114.20476 F2400
+G1 X-11.013 Y-15.728 E114.26020 F2400
+G1 X-9.600 Y-16.628 E114.31565 F2400
+G1 X-8.114 Y-17.401 E114.37109 F2400
+G1 X-6.567 Y-18.042 E114.42653 F2400
+G1 X-4.969 Y-18.546 E114.48197 F2400
+G1 X-3.334 Y-18.908 E114.53741 F2400
+G1 X-1.673 Y-19.127 E114.59286 F2400
+G1 X-0.000 Y-19.200 E114.64830 F2400
+G1 X1.673 Y-19.127 E114.70374 F2400
+G1 X3.334 Y-18.908 E114.75918 F2400
+G1 X4.969 Y-18.546 E114.81462 F2400
+G1 X6.567 Y-18.042 E114.87007 F2400
+G1 X8.114 Y-17.401 E114.92551 F2400
+G1 X9.600 Y-16.628 E114.98095 F2400
+G1 X11.013 Y-15.728 E115.03639 F2400
+G1 X12.342 Y-14.708 E115.09183 F2400
+G1 X13.576 Y-13.576 E115.14728 F2400
+G1 X14.708 Y-12.342 E115.20272 F2400
+G1 X15.728 Y-11.013 E115.25816 F2400
+G1 X16.628 Y-9.600 E115.31360 F2400
+G1 X17.401 Y-8.114 E115.36904 F2400
+G1 X18.042 Y-6.567 E115.42449 F2400
+G1 X18.546 Y-4.969 E115.47993 F2400
+G1 X18.908 Y-3.334 E115.53537 F2400
+G1 X19.127 Y-1.673 E115.59081 F2400
+G1 X19.200 Y-0.000 E115.64625 F2400
+G1 E114.64625 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E115.64625 F2400
+G1 X-12.000 Y12.000 E116.44065 F3600
+G1 X-11.200 Y12.000 E116.46713 F3600
+G1 X-11.200 Y-12.000 E117.26153 F3600
+G1 X-10.400 Y-12.000 E117.28801 F3600
+G1 X-10.400 Y12.000 E118.08241 F3600
+G1 X-9.600 Y12.000 E118.10889 F3600
+G1 X-9.600 Y-12.000 E118.90329 F3600
+G1 X-8.800 Y-12.000 E118.92977 F3600
+G1 X-8.800 Y12.000 E119.72417 F3600
+G1 X-8.000 Y12.000 E119.75065 F3600
+G1 X-8.000 Y-12.000 E120.54505 F3600
+G1 X-7.200 Y-12.000 E120.57153 F3600
+G1 X-7.200 Y12.000 E121.36593 F3600
+G1 X-6.400 Y12.000 E121.39241 F3600
+G1 X-6.400 Y-12.000 E122.18681 F3600
+G1 X-5.600 Y-12.000 E122.21329 F3600
+G1 X-5.600 Y12.000 E123.00769 F3600
+G1 X-4.800 Y12.000 E123.03417 F3600
+G1 X-4.800 Y-12.000 E123.82857 F3600
+G1 X-4.000 Y-12.000 E123.85505 F3600
+G1 X-4.000 Y12.000 E124.64945 F3600
+G1 X-3.200 Y12.000 E124.67593 F3600
+G1 X-3.200 Y-12.000 E125.47033 F3600
+G1 X-2.400 Y-12.000 E125.49681 F3600
+G1 X-2.400 Y12.000 E126.29121 F3600
+G1 X-1.600 Y12.000 E126.31769 F3600
+G1 X-1.600 Y-12.000 E127.11209 F3600
+G1 X-0.800 Y-12.000 E127.13857 F3600
+G1 X-0.800 Y12.000 E127.93297 F3600
+G1 X0.000 Y12.000 E127.95945 F3600
+G1 X0.000 Y-12.000 E128.75385 F3600
+G1 X0.800 Y-12.000 E128.78033 F3600
+G1 X0.800 Y12.000 E129.57473 F3600
+G1 X1.600 Y12.000 E129.60121 F3600
+G1 X1.600 Y-12.000 E130.39561 F3600
+G1 X2.400 Y-12.000 E130.42209 F3600
+G1 X2.400 Y12.000 E131.21649 F3600
+G1 X3.200 Y12.000 E131.24297 F3600
+G1 X3.200 Y-12.000 E132.03737 F3600
+G1 X4.000 Y-12.000 E132.06385 F3600
+G1 X4.000 Y12.000 E132.85825 F3600
+G1 X4.800 Y12.000 E132.88473 F3600
+G1 X4.800 Y-12.000 E133.67913 F3600
+G1 X5.600 Y-12.000 E133.70561 F3600
+G1 X5.600 Y12.000 E134.50001 F3600
+G1 X6.400 Y12.000 E134.52649 F3600
+G1 X6.400 Y-12.000 E135.32089 F3600
+G1 X7.200 Y-12.000 E135.34737 F3600
+G1 X7.200 Y12.000 E136.14177 F3600
+G1 X8.000 Y12.000 E136.16825 F3600
+G1 X8.000 Y-12.000 E136.96265 F3600
+G1 X8.800 Y-12.000 E136.98913 F3600
+G1 X8.800 Y12.000 E137.78353 F3600
+G1 X9.600 Y12.000 E137.81001 F3600
+G1 X9.600 Y-12.000 E138.60441 F3600
+G1 X10.400 Y-12.000 E138.63089 F3600
+G1 X10.400 Y12.000 E139.42529 F3600
+G1 X11.200 Y12.000 E139.45177 F3600
+G1 X11.200 Y-12.000 E140.24617 F3600
+G1 X12.000 Y-12.000 E140.27265 F3600
+G1 X12.000 Y12.000 E141.06705 F3600
+;LAYER:10
+G1 Z2.20 F1200
+G1 E140.06705 F2400
+G1 X20.000 Y0.000 F9000
+G1 E141.06705 F2400
+G1 X19.924 Y1.743 E141.12481 F1800
+G1 X19.696 Y3.473 E141.18256 F1800
+G1 X19.319 Y5.176 E141.24031 F1800
+G1 X18.794 Y6.840 E141.29806 F1800
+G1 X18.126 Y8.452 E141.35581 F1800
+G1 X17.321 Y10.000 E141.41357 F1800
+G1 X16.383 Y11.472 E141.47132 F1800
+G1 X15.321 Y12.856 E141.52907 F1800
+G1 X14.142 Y14.142 E141.58682 F1800
+G1 X12.856 Y15.321 E141.64458 F1800
+G1 X11.472 Y16.383 E141.70233 F1800
+G1 X10.000 Y17.321 E141.76008 F1800
+G1 X8.452 Y18.126 E141.81783 F1800
+G1 X6.840 Y18.794 E141.87558 F1800
+G1 X5.176 Y19.319 E141.93334 F1800
+G1 X3.473 Y19.696 E141.99109 F1800
+G1 X1.743 Y19.924 E142.04884 F1800
+G1 X0.000 Y20.000 E142.10659 F1800
+G1 X-1.743 Y19.924 E142.16434 F1800
+G1 X-3.473 Y19.696 E142.22210 F1800
+G1 X-5.176 Y19.319 E142.27985 F1800
+G1 X-6.840 Y18.794 E142.33760 F1800
+G1 X-8.452 Y18.126 E142.39535 F1800
+G1 X-10.000 Y17.321 E142.45310 F1800
+G1 X-11.472 Y16.383 E142.51086 F1800
+G1 X-12.856 Y15.321 E142.56861 F1800
+G1 X-14.142 Y14.142 E142.62636 F1800
+G1 X-15.321 Y12.856 E142.68411 F1800
+G1 X-16.383 Y11.472 E142.74186 F1800
+G1 X-17.321 Y10.000 E142.79962 F1800
+G1 X-18.126 Y8.452 E142.85737 F1800
+G1 X-18.794 Y6.840 E142.91512 F1800
+G1 X-19.319 Y5.176 E142.97287 F1800
+G1 X-19.696 Y3.473 E143.03062 F1800
+G1 X-19.924 Y1.743 E143.08838 F1800
+G1 X-20.000 Y0.000 E143.14613 F1800
+G1 X-19.924 Y-1.743 E143.20388 F1800
+G1 X-19.696 Y-3.473 E143.26163 F1800
+G1 X-19.319 Y-5.176 E143.31939 F1800
+G1 X-18.794 Y-6.840 E143.37714 F1800
+G1 X-18.126 Y-8.452 E143.43489 F1800
+G1 X-17.321 Y-10.000 E143.49264 F1800
+G1 X-16.383 Y-11.472 E143.55039 F1800
+G1 X-15.321 Y-12.856 E143.60815 F1800
+G1 X-14.142 Y-14.142 E143.66590 F1800
+G1 X-12.856 Y-15.321 E143.72365 F1800
+G1 X-11.472 Y-16.383 E143.78140 F1800
+G1 X-10.000 Y-17.321 E143.83915 F1800
+G1 X-8.452 Y-18.126 E143.89691 F1800
+G1 X-6.840 Y-18.794 E143.95466 F1800
+G1 X-5.176 Y-19.319 E144.01241 F1800
+G1 X-3.473 Y-19.696 E144.07016 F1800
+G1 X-1.743 Y-19.924 E144.12791 F1800
+G1 X-0.000 Y-20.000 E144.18567 F1800
+G1 X1.743 Y-19.924 E144.24342 F1800
+G1 X3.473 Y-19.696 E144.30117 F1800
+G1 X5.176 Y-19.319 E144.35892 F1800
+G1 X6.840 Y-18.794 E144.41667 F1800
+G1 X8.452 Y-18.126 E144.47443 F1800
+G1 X10.000 Y-17.321 E144.53218 F1800
+G1 X11.472 Y-16.383 E144.58993 F1800
+G1 X12.856 Y-15.321 E144.64768 F1800
+G1 X14.142 Y-14.142 E144.70543 F1800
+G1 X15.321 Y-12.856 E144.76319 F1800
+G1 X16.383 Y-11.472 E144.82094 F1800
+G1 X17.321 Y-10.000 E144.87869 F1800
+G1 X18.126 Y-8.452 E144.93644 F1800
+G1 X18.794 Y-6.840 E144.99419 F1800
+G1 X19.319 Y-5.176 E145.05195 F1800
+G1 X19.696 Y-3.473 E145.10970 F1800
+G1 X19.924 Y-1.743 E145.16745 F1800
+G1 X20.000 Y-0.000 E145.22520 F1800
+G1 X19.525 Y1.708 E145.28389 F2400
+G1 X19.302 Y3.404 E145.34048 F2400
+G1 X18.932 Y5.073 E145.39708 F2400
+G1 X18.418 Y6.704 E145.45368 F2400
+G1 X17.764 Y8.283 E145.51028 F2400
+G1 X16.974 Y9.800 E145.56687 F2400
+G1 X16.055 Y11.242 E145.62347 F2400
+G1 X15.014 Y12.599 E145.68007 F2400
+G1 X13.859 Y13.859 E145.73666 F2400
+G1 X12.599 Y15.014 E145.79326 F2400
+G1 X11.242 Y16.055 E145.84986 F2400
+G1 X9.800 Y16.974 E145.90646 F2400
+G1 X8.283 Y17.764 E145.96305 F2400
+G1 X6.704 Y18.418 E146.01965 F2400
+G1 X5.073 Y18.932 E146.07625 F2400
+G1 X3.404 Y19.302 E146.13284 F2400
+G1 X1.708 Y19.525 E146.18944 F2400
+G1 X0.000 Y19.600 E146.24604 F2400
+G1 X-1.708 Y19.525 E146.30263 F2400
+G1 X-3.404 Y19.302 E146.35923 F2400
+G1 X-5.073 Y18.932 E146.41583 F2400
+G1 X-6.704 Y18.418 E146.47243 F2400
+G1 X-8.283 Y17.764 E146.52902 F2400
+G1 X-9.800 Y16.974 E146.58562 F2400
+G1 X-11.242 Y16.055 E146.64222 F2400
+G1 X-12.599 Y15.014 E146.69881 F2400
+G1 X-13.859 Y13.859 E146.75541 F2400
+G1 X-15.014 Y12.599 E146.81201 F2400
+G1 X-16.055 Y11.242 E146.86860 F2400
+G1 X-16.974 Y9.800 E146.92520 F2400
+G1 X-17.764 Y8.283 E146.98180 F2400
+G1 X-18.418 Y6.704 E147.03840 F2400
+G1 X-18.932 Y5.073 E147.09499 F2400
+G1 X-19.302 Y3.404 E147.15159 F2400
+G1 X-19.525 Y1.708 E147.20819 F2400
+G1 X-19.600 Y0.000 E147.26478 F2400
+G1 X-19.525 Y-1.708 E147.32138 F2400
+G1 X-19.302 Y-3.404 E147.37798 F2400
+G1 X-18.932 Y-5.073 E147.43458 F2400
+G1 X-18.418 Y-6.704 E147.49117 F2400
+G1 X-17.764 Y-8.283 E147.54777 F2400
+G1 X-16.974 Y-9.800 E147.60437 F2400
+G1 X-16.055 Y-11.242 E147.66096 F2400
+G1 X-15.014 Y-12.599 E147.71756 F2400
+G1 X-13.859 Y-13.859 E147.77416 F2400
+G1 X-12.599 Y-15.014 E147.83075 F2400
+G1 X-11.242 Y-16.055 E147.88735 F2400
+G1 X-9.800 Y-16.974 E147.94395 F2400
+G1 X-8.283 Y-17.764 E148.00055 F2400
+G1 X-6.704 Y-18.418 E148.05714 F2400
+G1 X-5.073 Y-18.932 E148.11374 F2400
+G1 X-3.404 Y-19.302 E148.17034 F2400
+G1 X-1.708 Y-19.525 E148.22693 F2400
+G1 X-0.000 Y-19.600 E148.28353 F2400
+G1 X1.708 Y-19.525 E148.34013 F2400
+G1 X3.404 Y-19.302 E148.39672 F2400
+G1 X5.073 Y-18.932 E148.45332 F2400
+G1 X6.704 Y-18.418 E148.50992 F2400
+G1 X8.283 Y-17.764 E148.56652 F2400
+G1 X9.800 Y-16.974 E148.62311 F2400
+G1 X11.242 Y-16.055 E148.67971 F2400
+G1 X12.599 Y-15.014 E148.73631 F2400
+G1 X13.859 Y-13.859 E148.79290 F2400
+G1 X15.014 Y-12.599 E148.84950 F2400
+G1 X16.055 Y-11.242 E148.90610 F2400
+G1 X16.974 Y-9.800 E148.96269 F2400
+G1 X17.764 Y-8.283 E149.01929 F2400
+G1 X18.418 Y-6.704 E149.07589 F2400
+G1 X18.932 Y-5.073 E149.13249 F2400
+G1 X19.302 Y-3.404 E149.18908 F2400
+G1 X19.525 Y-1.708 E149.24568 F2400
+G1 X19.600 Y-0.000 E149.30228 F2400
+G1 X19.127 Y1.673 E149.35984 F2400
+G1 X18.908 Y3.334 E149.41528 F2400
+G1 X18.546 Y4.969 E149.47072 F2400
+G1 X18.042 Y6.567 E149.52616 F2400
+G1 X17.401 Y8.114 E149.58160 F2400
+G1 X16.628 Y9.600 E149.63705 F2400
+G1 X15.728 Y11.013 E149.69249 F2400
+G1 X14.708 Y12.342 E149.74793 F2400
+G1 X13.576 Y13.576 E149.80337 F2400
+G1 X12.342 Y14.708 E149.85881 F2400
+G1 X11.013 Y15.728 E149.91426 F2400
+G1 X9.600 Y16.628 E149.96970 F2400
+G1 X8.114 Y17.401 E150.02514 F2400
+G1 X6.567 Y18.042 E150.08058 F2400
+G1 X4.969 Y18.546 E150.13602 F2400
+G1 X3.334 Y18.908 E150.19147 F2400
+G1 X1.673 Y19.127 E150.24691 F2400
+G1 X0.000 Y19.200 E150.30235 F2400
+G1 X-1.673 Y19.127 E150.35779 F2400
+G1 X-3.334 Y18.908 E150.41323 F2400
+G1 X-4.969 Y18.546 E150.46868 F2400
+G1 X-6.567 Y18.042 E150.52412 F2400
+G1 X-8.114 Y17.401 E150.57956 F2400
+G1 X-9.600 Y16.628 E150.63500 F2400
+G1 X-11.013 Y15.728 E150.69044 F2400
+G1 X-12.342 Y14.708 E150.74589 F2400
+G1 X-13.576 Y13.576 E150.80133 F2400
+G1 X-14.708 Y12.342 E150.85677 F2400
+G1 X-15.728 Y11.013 E150.91221 F2400
+G1 X-16.628 Y9.600 E150.96765 F2400
+G1 X-17.401 Y8.114 E151.02310 F2400
+G1 X-18.042 Y6.567 E151.07854 F2400
+G1 X-18.546 Y4.969 E151.13398 F2400
+G1 X-18.908 Y3.334 E151.18942 F2400
+G1 X-19.127 Y1.673 E151.24486 F2400
+G1 X-19.200 Y0.000 E151.30031 F2400
+G1 X-19.127 Y-1.673 E151.35575 F2400
+G1 X-18.908 Y-3.334 E151.41119 F2400
+G1 X-18.546 Y-4.969 E151.46663 F2400
+G1 X-18.042 Y-6.567 E151.52207 F2400
+G1 X-17.401 Y-8.114 E151.57752 F2400
+G1 X-16.628 Y-9.600 E151.63296 F2400
+G1 X-15.728 Y-11.013 E151.68840 F2400
+G1 X-14.708 Y-12.342 E151.74384 F2400
+G1 X-13.576 Y-13.576 E151.79928 F2400
+G1 X-12.342 Y-14.708 E151.85473 F2400
+G1 X-11.013 Y-15.728 E151.91017 F2400
+G1 X-9.600 Y-16.628 E151.96561 F2400
+G1 X-8.114 Y-17.401 E152.02105 F2400
+G1 X-6.567 Y-18.042 E152.07649 F2400
+G1 X-4.969 Y-18.546 E152.13194 F2400
+G1 X-3.334 Y-18.908 E152.18738 F2400
+G1 X-1.673 Y-19.127 E152.24282 F2400
+G1 X-0.000 Y-19.200 E152.29826 F2400
+G1 X1.673 Y-19.127 E152.35370 F2400
+G1 X3.334 Y-18.908 E152.40915 F2400
+G1 X4.969 Y-18.546 E152.46459 F2400
+G1 X6.567 Y-18.042 E152.52003 F2400
+G1 X8.114 Y-17.401 E152.57547 F2400
+G1 X9.600 Y-16.628 E152.63091 F2400
+G1 X11.013 Y-15.728 E152.68636 F2400
+G1 X12.342 Y-14.708 E152.74180 F2400
+G1 X13.576 Y-13.576 E152.79724 F2400
+G1 X14.708 Y-12.342 E152.85268 F2400
+G1 X15.728 Y-11.013 E152.90812 F2400
+G1 X16.628 Y-9.600 E152.96357 F2400
+G1 X17.401 Y-8.114 E153.01901 F2400
+G1 X18.042 Y-6.567 E153.07445 F2400
+G1 X18.546 Y-4.969 E153.12989 F2400
+G1 X18.908 Y-3.334 E153.18533 F2400
+G1 X19.127 Y-1.673 E153.24078 F2400
+G1 X19.200 Y-0.000 E153.29622 F2400
+G1 E152.29622 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E153.29622 F2400
+G1 X12.000 Y-12.000 E154.09062 F3600
+G1 X12.000 Y-11.000 E154.12372 F3600
+G1 X-12.000 Y-11.000 E154.91812 F3600
+G1 X-12.000 Y-10.000 E154.95122 F3600
+G1 X12.000 Y-10.000 E155.74562 F3600
+G1 X12.000 Y-9.000 E155.77872 F3600
+G1 X-12.000 Y-9.000 E156.57312 F3600
+G1 X-12.000 Y-8.000 E156.60622 F3600
+G1 X12.000 Y-8.000 E157.40062 F3600
+G1 X12.000 Y-7.000 E157.43372 F3600
+G1 X-12.000 Y-7.000 E158.22812 F3600
+G1 X-12.000 Y-6.000 E158.26122 F3600
+G1 X12.000 Y-6.000 E159.05562 F3600
+G1 X12.000 Y-5.000 E159.08872 F3600
+G1 X-12.000 Y-5.000 E159.88312 F3600
+G1 X-12.000 Y-4.000 E159.91622 F3600
+G1 X12.000 Y-4.000 E160.71062 F3600
+G1 X12.000 Y-3.000 E160.74372 F3600
+G1 X-12.000 Y-3.000 E161.53812 F3600
+G1 X-12.000 Y-2.000 E161.57122 F3600
+G1 X12.000 Y-2.000 E162.36562 F3600
+G1 X12.000 Y-1.000 E162.39872 F3600
+G1 X-12.000 Y-1.000 E163.19312 F3600
+G1 X-12.000 Y0.000 E163.22622 F3600
+G1 X12.000 Y0.000 E164.02062 F3600
+G1 X12.000 Y1.000 E164.05372 F3600
+G1 X-12.000 Y1.000 E164.84812 F3600
+G1 X-12.000 Y2.000 E164.88122 F3600
+G1 X12.000 Y2.000 E165.67562 F3600
+G1 X12.000 Y3.000 E165.70872 F3600
+G1 X-12.000 Y3.000 E166.50312 F3600
+G1 X-12.000 Y4.000 E166.53622 F3600
+G1 X12.000 Y4.000 E167.33062 F3600
+G1 X12.000 Y5.000 E167.36372 F3600
+G1 X-12.000 Y5.000 E168.15812 F3600
+G1 X-12.000 Y6.000 E168.19122 F3600
+G1 X12.000 Y6.000 E168.98562 F3600
+G1 X12.000 Y7.000 E169.01872 F3600
+G1 X-12.000 Y7.000 E169.81312 F3600
+G1 X-12.000 Y8.000 E169.84622 F3600
+G1 X12.000 Y8.000 E170.64062 F3600
+G1 X12.000 Y9.000 E170.67372 F3600
+G1 X-12.000 Y9.000 E171.46812 F3600
+G1 X-12.000 Y10.000 E171.50122 F3600
+G1 X12.000 Y10.000 E172.29562 F3600
+G1 X12.000 Y11.000 E172.32872 F3600
+G1 X-12.000 Y11.000 E173.12312 F3600
+G1 X-12.000 Y12.000 E173.15622 F3600
+G1 X12.000 Y12.000 E173.95062 F3600
+;LAYER:11
+G1 Z2.40 F1200
+G1 E172.95062 F2400
+G1 X20.000 Y0.000 F9000
+G1 E173.95062 F2400
+G1 X19.924 Y1.743 E174.00837 F1800
+G1 X19.696 Y3.473 E174.06612 F1800
+G1 X19.319 Y5.176 E174.12387 F1800
+G1 X18.794 Y6.840 E174.18163 F1800
+G1 X18.126 Y8.452 E174.23938 F1800
+G1 X17.321 Y10.000 E174.29713 F1800
+G1 X16.383 Y11.472 E174.35488 F1800
+G1 X15.321 Y12.856 E174.41263 F1800
+G1 X14.142 Y14.142 E174.47039 F1800
+G1 X12.856 Y15.321 E174.52814 F1800
+G1 X11.472 Y16.383 E174.58589 F1800
+G1 X10.000 Y17.321 E174.64364 F1800
+G1 X8.452 Y18.126 E174.70139 F1800
+G1 X6.840 Y18.794 E174.75915 F1800
+G1 X5.176 Y19.319 E174.81690 F1800
+G1 X3.473 Y19.696 E174.87465 F1800
+G1 X1.743 Y19.924 E174.93240 F1800
+G1 X0.000 Y20.000 E174.99016 F1800
+G1 X-1.743 Y19.924 E175.04791 F1800
+G1 X-3.473 Y19.696 E175.10566 F1800
+G1 X-5.176 Y19.319 E175.16341 F1800
+G1 X-6.840 Y18.794 E175.22116 F1800
+G1 X-8.452 Y18.126 E175.27892 F1800
+G1 X-10.000 Y17.321 E175.33667 F1800
+G1 X-11.472 Y16.383 E175.39442 F1800
+G1 X-12.856 Y15.321 E175.45217 F1800
+G1 X-14.142 Y14.142 E175.50992 F1800
+G1 X-15.321 Y12.856 E175.56768 F1800
+G1 X-16.383 Y11.472 E175.62543 F1800
+G1 X-17.321 Y10.000 E175.68318 F1800
+G1 X-18.126 Y8.452 E175.74093 F1800
+G1 X-18.794 Y6.840 E175.79868 F1800
+G1 X-19.319 Y5.176 E175.85644 F1800
+G1 X-19.696 Y3.473 E175.91419 F1800
+G1 X-19.924 Y1.743 E175.97194 F1800
+G1 X-20.000 Y0.000 E176.02969 F1800
+G1 X-19.924 Y-1.743 E176.08744 F1800
+G1 X-19.696 Y-3.473 E176.14520 F1800
+G1 X-19.319 Y-5.176 E176.20295 F1800
+G1 X-18.794 Y-6.840 E176.26070 F1800
+G1 X-18.126 Y-8.452 E176.31845 F1800
+G1 X-17.321 Y-10.000 E176.37620 F1800
+G1 X-16.383 Y-11.472 E176.43396 F1800
+G1 X-15.321 Y-12.856 E176.49171 F1800
+G1 X-14.142 Y-14.142 E176.54946 F1800
+G1 X-12.856 Y-15.321 E176.60721 F1800
+G1 X-11.472 Y-16.383 E176.66497 F1800
+G1 X-10.000 Y-17.321 E176.72272 F1800
+G1 X-8.452 Y-18.126 E176.78047 F1800
+G1 X-6.840 Y-18.794 E176.83822 F1800
+G1 X-5.176 Y-19.319 E176.89597 F1800
+G1 X-3.473 Y-19.696 E176.95373 F1800
+G1 X-1.743 Y-19.924 E177.01148 F1800
+G1 X-0.000 Y-20.000 E177.06923 F1800
+G1 X1.743 Y-19.924 E177.12698 F1800
+G1 X3.473 Y-19.696 E177.18473 F1800
+G1 X5.176 Y-19.319 E177.24249 F1800
+G1 X6.840 Y-18.794 E177.30024 F1800
+G1 X8.452 Y-18.126 E177.35799 F1800
+G1 X10.000 Y-17.321 E177.41574 F1800
+G1 X11.472 Y-16.383 E177.47349 F1800
+G1 X12.856 Y-15.321 E177.53125 F1800
+G1 X14.142 Y-14.142 E177.58900 F1800
+G1 X15.321 Y-12.856 E177.64675 F1800
+G1 X16.383 Y-11.472 E177.70450 F1800
+G1 X17.321 Y-10.000 E177.76225 F1800
+G1 X18.126 Y-8.452 E177.82001 F1800
+G1 X18.794 Y-6.840 E177.87776 F1800
+G1 X19.319 Y-5.176 E177.93551 F1800
+G1 X19.696 Y-3.473 E177.99326 F1800
+G1 X19.924 Y-1.743 E178.05101 F1800
+G1 X20.000 Y-0.000 E178.10877 F1800
+G1 X19.525 Y1.708 E178.16745 F2400
+G1 X19.302 Y3.404 E178.22405 F2400
+G1 X18.932 Y5.073 E178.28065 F2400
+G1 X18.418 Y6.704 E178.33724 F2400
+G1 X17.764 Y8.283 E178.39384 F2400
+G1 X16.974 Y9.800 E178.45044 F2400
+G1 X16.055 Y11.242 E178.50703 F2400
+G1 X15.014 Y12.599 E178.56363 F2400
+G1 X13.859 Y13.859 E178.62023 F2400
+G1 X12.599 Y15.014 E178.67682 F2400
+G1 X11.242 Y16.055 E178.73342 F2400
+G1 X9.800 Y16.974 E178.79002 F2400
+G1 X8.283 Y17.764 E178.84662 F2400
+G1 X6.704 Y18.418 E178.90321 F2400
+G1 X5.073 Y18.932 E178.95981 F2400
+G1 X3.404 Y19.302 E179.01641 F2400
+G1 X1.708 Y19.525 E179.07300 F2400
+G1 X0.000 Y19.600 E179.12960 F2400
+G1 X-1.708 Y19.525 E179.18620 F2400
+G1 X-3.404 Y19.302 E179.24280 F2400
+G1 X-5.073 Y18.932 E179.29939 F2400
+G1 X-6.704 Y18.418 E179.35599 F2400
+G1 X-8.283 Y17.764 E179.41259 F2400
+G1 X-9.800 Y16.974 E179.46918 F2400
+G1 X-11.242 Y16.055 E179.52578 F2400
+G1 X-12.599 Y15.014 E179.58238 F2400
+G1 X-13.859 Y13.859 E179.63897 F2400
+G1 X-15.014 Y12.599 E179.69557 F2400
+G1 X-16.055 Y11.242 E179.75217 F2400
+G1 X-16.974 Y9.800 E179.80877 F2400
+G1 X-17.764 Y8.283 E179.86536 F2400
+G1 X-18.418 Y6.704 E179.92196 F2400
+G1 X-18.932 Y5.073 E179.97856 F2400
+G1 X-19.302 Y3.404 E180.03515 F2400
+G1 X-19.525 Y1.708 E180.09175 F2400
+G1 X-19.600 Y0.000 E180.14835 F2400
+G1 X-19.525 Y-1.708 E180.20494 F2400
+G1 X-19.302 Y-3.404 E180.26154 F2400
+G1 X-18.932 Y-5.073 E180.31814 F2400
+G1 X-18.418 Y-6.704 E180.37474 F2400
+G1 X-17.764 Y-8.283 E180.43133 F2400
+G1 X-16.974 Y-9.800 E180.48793 F2400
+G1 X-16.055 Y-11.242 E180.54453 F2400
+G1 X-15.014 Y-12.599 E180.60112 F2400
+G1 X-13.859 Y-13.859 E180.65772 F2400
+G1 X-12.599 Y-15.014 E180.71432 F2400
+G1 X-11.242 Y-16.055 E180.77091 F2400
+G1 X-9.800 Y-16.974 E180.82751 F2400
+G1 X-8.283 Y-17.764 E180.88411 F2400
+G1 X-6.704 Y-18.418 E180.94071 F2400
+G1 X-5.073 Y-18.932 E180.99730 F2400
+G1 X-3.404 Y-19.302 E181.05390 F2400
+G1 X-1.708 Y-19.525 E181.11050 F2400
+G1 X-0.000 Y-19.600 E181.16709 F2400
+G1 X1.708 Y-19.525 E181.22369 F2400
+G1 X3.404 Y-19.302 E181.28029 F2400
+G1 X5.073 Y-18.932 E181.33689 F2400
+G1 X6.704 Y-18.418 E181.39348 F2400
+G1 X8.283 Y-17.764 E181.45008 F2400
+G1 X9.800 Y-16.974 E181.50668 F2400
+G1 X11.242 Y-16.055 E181.56327 F2400
+G1 X12.599 Y-15.014 E181.61987 F2400
+G1 X13.859 Y-13.859 E181.67647 F2400
+G1 X15.014 Y-12.599 E181.73306 F2400
+G1 X16.055 Y-11.242 E181.78966 F2400
+G1 X16.974 Y-9.800 E181.84626 F2400
+G1 X17.764 Y-8.283 E181.90286 F2400
+G1 X18.418 Y-6.704 E181.95945 F2400
+G1 X18.932 Y-5.073 E182.01605 F2400
+G1 X19.302 Y-3.404 E182.07265 F2400
+G1 X19.525 Y-1.708 E182.12924 F2400
+G1 X19.600 Y-0.000 E182.18584 F2400
+G1 X19.127 Y1.673 E182.24340 F2400
+G1 X18.908 Y3.334 E182.29884 F2400
+G1 X18.546 Y4.969 E182.35428 F2400
+G1 X18.042 Y6.567 E182.40973 F2400
+G1 X17.401 Y8.114 E182.46517 F2400
+G1 X16.628 Y9.600 E182.52061 F2400
+G1 X15.728 Y11.013 E182.57605 F2400
+G1 X14.708 Y12.342 E182.63149 F2400
+G1 X13.576 Y13.576 E182.68694 F2400
+G1 X12.342 Y14.708 E182.74238 F2400
+G1 X11.013 Y15.728 E182.79782 F2400
+G1 X9.600 Y16.628 E182.85326 F2400
+G1 X8.114 Y17.401 E182.90870 F2400
+G1 X6.567 Y18.042 E182.96415 F2400
+G1 X4.969 Y18.546 E183.01959 F2400
+G1 X3.334 Y18.908 E183.07503 F2400
+G1 X1.673 Y19.127 E183.13047 F2400
+G1 X0.000 Y19.200 E183.18591 F2400
+G1 X-1.673 Y19.127 E183.24136 F2400
+G1 X-3.334 Y18.908 E183.29680 F2400
+G1 X-4.969 Y18.546 E183.35224 F2400
+G1 X-6.567 Y18.042 E183.40768 F2400
+G1 X-8.114 Y17.401 E183.46312 F2400
+G1 X-9.600 Y16.628 E183.51857 F2400
+G1 X-11.013 Y15.728 E183.57401 F2400
+G1 X-12.342 Y14.708 E183.62945 F2400
+G1 X-13.576 Y13.576 E183.68489 F2400
+G1 X-14.708 Y12.342 E183.74033 F2400
+G1 X-15.728 Y11.013 E183.79578 F2400
+G1 X-16.628 Y9.600 E183.85122 F2400
+G1 X-17.401 Y8.114 E183.90666 F2400
+G1 X-18.042 Y6.567 E183.96210 F2400
+G1 X-18.546 Y4.969 E184.01754 F2400
+G1 X-18.908 Y3.334 E184.07299 F2400
+G1 X-19.127 Y1.673 E184.12843 F2400
+G1 X-19.200 Y0.000 E184.18387 F2400
+G1 X-19.127 Y-1.673 E184.23931 F2400
+G1 X-18.908 Y-3.334 E184.29475 F2400
+G1 X-18.546 Y-4.969 E184.35020 F2400
+G1 X-18.042 Y-6.567 E184.40564 F2400
+G1 X-17.401 Y-8.114 E184.46108 F2400
+G1 X-16.628 Y-9.600 E184.51652 F2400
+G1 X-15.728 Y-11.013 E184.57196 F2400
+G1 X-14.708 Y-12.342 E184.62741 F2400
+G1 X-13.576 Y-13.576 E184.68285 F2400
+G1 X-12.342 Y-14.708 E184.73829 F2400
+G1 X-11.013 Y-15.728 E184.79373 F2400
+G1 X-9.600 Y-16.628 E184.84917 F2400
+G1 X-8.114 Y-17.401 E184.90462 F2400
+G1 X-6.567 Y-18.042 E184.96006 F2400
+G1 X-4.969 Y-18.546 E185.01550 F2400
+G1 X-3.334 Y-18.908 E185.07094 F2400
+G1 X-1.673 Y-19.127 E185.12638 F2400
+G1 X-0.000 Y-19.200 E185.18183 F2400
+G1 X1.673 Y-19.127 E185.23727 F2400
+G1 X3.334 Y-18.908 E185.29271 F2400
+G1 X4.969 Y-18.546 E185.34815 F2400
+G1 X6.567 Y-18.042 E185.40359 F2400
+G1 X8.114 Y-17.401 E185.45904 F2400
+G1 X9.600 Y-16.628 E185.51448 F2400
+G1 X11.013 Y-15.728 E185.56992 F2400
+G1 X12.342 Y-14.708 E185.62536 F2400
+G1 X13.576 Y-13.576 E185.68080 F2400
+G1 X14.708 Y-12.342 E185.73625 F2400
+G1 X15.728 Y-11.013 E185.79169 F2400
+G1 X16.628 Y-9.600 E185.84713 F2400
+G1 X17.401 Y-8.114 E185.90257 F2400
+G1 X18.042 Y-6.567 E185.95801 F2400
+G1 X18.546 Y-4.969 E186.01346 F2400
+G1 X18.908 Y-3.334 E186.06890 F2400
+G1 X19.127 Y-1.673 E186.12434 F2400
+G1 X19.200 Y-0.000 E186.17978 F2400
+G1 E185.17978 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E186.17978 F2400
+G1 X-12.000 Y12.000 E186.97418 F3600
+G1 X-11.200 Y12.000 E187.00066 F3600
+G1 X-11.200 Y-12.000 E187.79506 F3600
+G1 X-10.400 Y-12.000 E187.82154 F3600
+G1 X-10.400 Y12.000 E188.61594 F3600
+G1 X-9.600 Y12.000 E188.64242 F3600
+G1 X-9.600 Y-12.000 E189.43682 F3600
+G1 X-8.800 Y-12.000 E189.46330 F3600
+G1 X-8.800 Y12.000 E190.25770 F3600
+G1 X-8.000 Y12.000 E190.28418 F3600
+G1 X-8.000 Y-12.000 E191.07858 F3600
+G1 X-7.200 Y-12.000 E191.10506 F3600
+G1 X-7.200 Y12.000 E191.89946 F3600
+G1 X-6.400 Y12.000 E191.92594 F3600
+G1 X-6.400 Y-12.000 E192.72034 F3600
+G1 X-5.600 Y-12.000 E192.74682 F3600
+G1 X-5.600 Y12.000 E193.54122 F3600
+G1 X-4.800 Y12.000 E193.56770 F3600
+G1 X-4.800 Y-12.000 E194.36210 F3600
+G1 X-4.000 Y-12.000 E194.38858 F3600
+G1 X-4.000 Y12.000 E195.18298 F3600
+G1 X-3.200 Y12.000 E195.20946 F3600
+G1 X-3.200 Y-12.000 E196.00386 F3600
+G1 X-2.400 Y-12.000 E196.03034 F3600
+G1 X-2.400 Y12.000 E196.82474 F3600
+G1 X-1.600 Y12.000 E196.85122 F3600
+G1 X-1.600 Y-12.000 E197.64562 F3600
+G1 X-0.800 Y-12.000 E197.67210 F3600
+G1 X-0.800 Y12.000 E198.46650 F3600
+G1 X0.000 Y12.000 E198.49298 F3600
+G1 X0.000 Y-12.000 E199.28738 F3600
+G1 X0.800 Y-12.000 E199.31386 F3600
+G1 X0.800 Y12.000 E200.10826 F3600
+G1 X1.600 Y12.000 E200.13474 F3600
+G1 X1.600 Y-12.000 E200.92914 F3600
+G1 X2.400 Y-12.000 E200.95562 F3600
+G1 X2.400 Y12.000 E201.75002 F3600
+G1 X3.200 Y12.000 E201.77650 F3600
+G1 X3.200 Y-12.000 E202.57090 F3600
+G1 X4.000 Y-12.000 E202.59738 F3600
+G1 X4.000 Y12.000 E203.39178 F3600
+G1 X4.800 Y12.000 E203.41826 F3600
+G1 X4.800 Y-12.000 E204.21266 F3600
+G1 X5.600 Y-12.000 E204.23914 F3600
+G1 X5.600 Y12.000 E205.03354 F3600
+G1 X6.400 Y12.000 E205.06002 F3600
+G1 X6.400 Y-12.000 E205.85442 F3600
+G1 X7.200 Y-12.000 E205.88090 F3600
+G1 X7.200 Y12.000 E206.67530 F3600
+G1 X8.000 Y12.000 E206.70178 F3600
+G1 X8.000 Y-12.000 E207.49618 F3600
+G1 X8.800 Y-12.000 E207.52266 F3600
+G1 X8.800 Y12.000 E208.31706 F3600
+G1 X9.600 Y12.000 E208.34354 F3600
+G1 X9.600 Y-12.000 E209.13794 F3600
+G1 X10.400 Y-12.000 E209.16442 F3600
+G1 X10.400 Y12.000 E209.95882 F3600
+G1 X11.200 Y12.000 E209.98530 F3600
+G1 X11.200 Y-12.000 E210.77970 F3600
+G1 X12.000 Y-12.000 E210.80618 F3600
+G1 X12.000 Y12.000 E211.60058 F3600
+;LAYER:12
+T0
+G92 E0
+G1 Z2.60 F1200
+G1 E-1.00000 F2400
+G1 X20.000 Y0.000 F9000
+G1 E0.00000 F2400
+G1 X19.924 Y1.743 E0.05775 F1800
+G1 X19.696 Y3.473 E0.11550 F1800
+G1 X19.319 Y5.176 E0.17326 F1800
+G1 X18.794 Y6.840 E0.23101 F1800
+G1 X18.126 Y8.452 E0.28876 F1800
+G1 X17.321 Y10.000 E0.34651 F1800
+G1 X16.383 Y11.472 E0.40426 F1800
+G1 X15.321 Y12.856 E0.46202 F1800
+G1 X14.142 Y14.142 E0.51977 F1800
+G1 X12.856 Y15.321 E0.57752 F1800
+G1 X11.472 Y16.383 E0.63527 F1800
+G1 X10.000 Y17.321 E0.69302 F1800
+G1 X8.452 Y18.126 E0.75078 F1800
+G1 X6.840 Y18.794 E0.80853 F1800
+G1 X5.176 Y19.319 E0.86628 F1800
+G1 X3.473 Y19.696 E0.92403 F1800
+G1 X1.743 Y19.924 E0.98179 F1800
+G1 X0.000 Y20.000 E1.03954 F1800
+G1 X-1.743 Y19.924 E1.09729 F1800
+G1 X-3.473 Y19.696 E1.15504 F1800
+G1 X-5.176 Y19.319 E1.21279 F1800
+G1 X-6.840 Y18.794 E1.27055 F1800
+G1 X-8.452 Y18.126 E1.32830 F1800
+G1 X-10.000 Y17.321 E1.38605 F1800
+G1 X-11.472 Y16.383 E1.44380 F1800
+G1 X-12.856 Y15.321 E1.50155 F1800
+G1 X-14.142 Y14.142 E1.55931 F1800
+G1 X-15.321 Y12.856 E1.61706 F1800
+G1 X-16.383 Y11.472 E1.67481 F1800
+G1 X-17.321 Y10.000 E1.73256 F1800
+G1 X-18.126 Y8.452 E1.79031 F1800
+G1 X-18.794 Y6.840 E1.84807 F1800
+G1 X-19.319 Y5.176 E1.90582 F1800
+G1 X-19.696 Y3.473 E1.96357 F1800
+G1 X-19.924 Y1.743 E2.02132 F1800
+G1 X-20.000 Y0.000 E2.07907 F1800
+G1 X-19.924 Y-1.743 E2.13683 F1800
+G1 X-19.696 Y-3.473 E2.19458 F1800
+G1 X-19.319 Y-5.176 E2.25233 F1800
+G1 X-18.794 Y-6.840 E2.31008 F1800
+G1 X-18.126 Y-8.452 E2.36783 F1800
+G1 X-17.321 Y-10.000 E2.42559 F1800
+G1 X-16.383 Y-11.472 E2.48334 F1800
+G1 X-15.321 Y-12.856 E2.54109 F1800
+G1 X-14.142 Y-14.142 E2.59884 F1800
+G1 X-12.856 Y-15.321 E2.65660 F1800
+G1 X-11.472 Y-16.383 E2.71435 F1800
+G1 X-10.000 Y-17.321 E2.77210 F1800
+G1 X-8.452 Y-18.126 E2.82985 F1800
+G1 X-6.840 Y-18.794 E2.88760 F1800
+G1 X-5.176 Y-19.319 E2.94536 F1800
+G1 X-3.473 Y-19.696 E3.00311 F1800
+G1 X-1.743 Y-19.924 E3.06086 F1800
+G1 X-0.000 Y-20.000 E3.11861 F1800
+G1 X1.743 Y-19.924 E3.17636 F1800
+G1 X3.473 Y-19.696 E3.23412 F1800
+G1 X5.176 Y-19.319 E3.29187 F1800
+G1 X6.840 Y-18.794 E3.34962 F1800
+G1 X8.452 Y-18.126 E3.40737 F1800
+G1 X10.000 Y-17.321 E3.46512 F1800
+G1 X11.472 Y-16.383 E3.52288 F1800
+G1 X12.856 Y-15.321 E3.58063 F1800
+G1 X14.142 Y-14.142 E3.63838 F1800
+G1 X15.321 Y-12.856 E3.69613 F1800
+G1 X16.383 Y-11.472 E3.75388 F1800
+G1 X17.321 Y-10.000 E3.81164 F1800
+G1 X18.126 Y-8.452 E3.86939 F1800
+G1 X18.794 Y-6.840 E3.92714 F1800
+G1 X19.319 Y-5.176 E3.98489 F1800
+G1 X19.696 Y-3.473 E4.04264 F1800
+G1 X19.924 Y-1.743 E4.10040 F1800
+G1 X20.000 Y-0.000 E4.15815 F1800
+G1 X19.525 Y1.708 E4.21683 F2400
+G1 X19.302 Y3.404 E4.27343 F2400
+G1 X18.932 Y5.073 E4.33003 F2400
+G1 X18.418 Y6.704 E4.38662 F2400
+G1 X17.764 Y8.283 E4.44322 F2400
+G1 X16.974 Y9.800 E4.49982 F2400
+G1 X16.055 Y11.242 E4.55642 F2400
+G1 X15.014 Y12.599 E4.61301 F2400
+G1 X13.859 Y13.859 E4.66961 F2400
+G1 X12.599 Y15.014 E4.72621 F2400
+G1 X11.242 Y16.055 E4.78280 F2400
+G1 X9.800 Y16.974 E4.83940 F2400
+G1 X8.283 Y17.764 E4.89600 F2400
+G1 X6.704 Y18.418 E4.95260 F2400
+G1 X5.073 Y18.932 E5.00919 F2400
+G1 X3.404 Y19.302 E5.06579 F2400
+G1 X1.708 Y19.525 E5.12239 F2400
+G1 X0.000 Y19.600 E5.17898 F2400
+G1 X-1.708 Y19.525 E5.23558 F2400
+G1 X-3.404 Y19.302 E5.29218 F2400
+G1 X-5.073 Y18.932 E5.34877 F2400
+G1 X-6.704 Y18.418 E5.40537 F2400
+G1 X-8.283 Y17.764 E5.46197 F2400
+G1 X-9.800 Y16.974 E5.51857 F2400
+G1 X-11.242 Y16.055 E5.57516 F2400
+G1 X-12.599 Y15.014 E5.63176 F2400
+G1 X-13.859 Y13.859 E5.68836 F2400
+G1 X-15.014 Y12.599 E5.74495 F2400
+G1 X-16.055 Y11.242 E5.80155 F2400
+G1 X-16.974 Y9.800 E5.85815 F2400
+G1 X-17.764 Y8.283 E5.91474 F2400
+G1 X-18.418 Y6.704 E5.97134 F2400
+G1 X-18.932 Y5.073 E6.02794 F2400
+G1 X-19.302 Y3.404 E6.08454 F2400
+G1 X-19.525 Y1.708 E6.14113 F2400
+G1 X-19.600 Y0.000 E6.19773 F2400
+G1 X-19.525 Y-1.708 E6.25433 F2400
+G1 X-19.302 Y-3.404 E6.31092 F2400
+G1 X-18.932 Y-5.073 E6.36752 F2400
+G1 X-18.418 Y-6.704 E6.42412 F2400
+G1 X-17.764 Y-8.283 E6.48071 F2400
+G1 X-16.974 Y-9.800 E6.53731 F2400
+G1 X-16.055 Y-11.242 E6.59391 F2400
+G1 X-15.014 Y-12.599 E6.65051 F2400
+G1 X-13.859 Y-13.859 E6.70710 F2400
+G1 X-12.599 Y-15.014 E6.76370 F2400
+G1 X-11.242 Y-16.055 E6.82030 F2400
+G1 X-9.800 Y-16.974 E6.87689 F2400
+G1 X-8.283 Y-17.764 E6.93349 F2400
+G1 X-6.704 Y-18.418 E6.99009 F2400
+G1 X-5.073 Y-18.932 E7.04669 F2400
+G1 X-3.404 Y-19.302 E7.10328 F2400
+G1 X-1.708 Y-19.525 E7.15988 F2400
+G1 X-0.000 Y-19.600 E7.21648 F2400
+G1 X1.708 Y-19.525 E7.27307 F2400
+G1 X3.404 Y-19.302 E7.32967 F2400
+G1 X5.073 Y-18.932 E7.38627 F2400
+G1 X6.704 Y-18.418 E7.44286 F2400
+G1 X8.283 Y-17.764 E7.49946 F2400
+G1 X9.800 Y-16.974 E7.55606 F2400
+G1 X11.242 Y-16.055 E7.61266 F2400
+G1 X12.599 Y-15.014 E7.66925 F2400
+G1 X13.859 Y-13.859 E7.72585 F2400
+G1 X15.014 Y-12.599 E7.78245 F2400
+G1 X16.055 Y-11.242 E7.83904 F2400
+G1 X16.974 Y-9.800 E7.89564 F2400
+G1 X17.764 Y-8.283 E7.95224 F2400
+G1 X18.418 Y-6.704 E8.00883 F2400
+G1 X18.932 Y-5.073 E8.06543 F2400
+G1 X19.302 Y-3.404 E8.12203 F2400
+G1 X19.525 Y-1.708 E8.17863 F2400
+G1 X19.600 Y-0.000 E8.23522 F2400
+G1 X19.127 Y1.673 E8.29278 F2400
+G1 X18.908 Y3.334 E8.34822 F2400
+G1 X18.546 Y4.969 E8.40367 F2400
+G1 X18.042 Y6.567 E8.45911 F2400
+G1 X17.401 Y8.114 E8.51455 F2400
+G1 X16.628 Y9.600 E8.56999 F2400
+G1 X15.728 Y11.013 E8.62543 F2400
+G1 X14.708 Y12.342 E8.68088 F2400
+G1 X13.576 Y13.576 E8.73632 F2400
+G1 X12.342 Y14.708 E8.79176 F2400
+G1 X11.013 Y15.728 E8.84720 F2400
+G1 X9.600 Y16.628 E8.90264 F2400
+G1 X8.114 Y17.401 E8.95809 F2400
+G1 X6.567 Y18.042 E9.01353 F2400
+G1 X4.969 Y18.546 E9.06897 F2400
+G1 X3.334 Y18.908 E9.12441 F2400
+G1 X1.673 Y19.127 E9.17985 F2400
+G1 X0.000 Y19.200 E9.23530 F2400
+G1 X-1.673 Y19.127 E9.29074 F2400
+G1 X-3.334 Y18.908 E9.34618 F2400
+G1 X-4.969 Y18.546 E9.40162 F2400
+G1 X-6.567 Y18.042 E9.45706 F2400
+G1 X-8.114 Y17.401 E9.51251 F2400
+G1 X-9.600 Y16.628 E9.56795 F2400
+G1 X-11.013 Y15.728 E9.62339 F2400
+G1 X-12.342 Y14.708 E9.67883 F2400
+G1 X-13.576 Y13.576 E9.73427 F2400
+G1 X-14.708 Y12.342 E9.78972 F2400
+G1 X-15.728 Y11.013 E9.84516 F2400
+G1 X-16.628 Y9.600 E9.90060 F2400
+G1 X-17.401 Y8.114 E9.95604 F2400
+G1 X-18.042 Y6.567 E10.01148 F2400
+G1 X-18.546 Y4.969 E10.06693 F2400
+G1 X-18.908 Y3.334 E10.12237 F2400
+G1 X-19.127 Y1.673 E10.17781 F2400
+G1 X-19.200 Y0.000 E10.23325 F2400
+G1 X-19.127 Y-1.673 E10.28869 F2400
+G1 X-18.908 Y-3.334 E10.34414 F2400
+G1 X-18.546 Y-4.969 E10.39958 F2400
+G1 X-18.042 Y-6.567 E10.45502 F2400
+G1 X-17.401 Y-8.114 E10.51046 F2400
+G1 X-16.628 Y-9.600 E10.56590 F2400
+G1 X-15.728 Y-11.013 E10.62135 F2400
+G1 X-14.708 Y-12.342 E10.67679 F2400
+G1 X-13.576 Y-13.576 E10.73223 F2400
+G1 X-12.342 Y-14.708 E10.78767 F2400
+G1 X-11.013 Y-15.728 E10.84311 F2400
+G1 X-9.600 Y-16.628 E10.89856 F2400
+G1 X-8.114 Y-17.401 E10.95400 F2400
+G1 X-6.567 Y-18.042 E11.00944 F2400
+G1 X-4.969 Y-18.546 E11.06488 F2400
+G1 X-3.334 Y-18.908 E11.12032 F2400
+G1 X-1.673 Y-19.127 E11.17577 F2400
+G1 X-0.000 Y-19.200 E11.23121 F2400
+G1 X1.673 Y-19.127 E11.28665 F2400
+G1 X3.334 Y-18.908 E11.34209 F2400
+G1 X4.969 Y-18.546 E11.39753 F2400
+G1 X6.567 Y-18.042 E11.45298 F2400
+G1 X8.114 Y-17.401 E11.50842 F2400
+G1 X9.600 Y-16.628 E11.56386 F2400
+G1 X11.013 Y-15.728 E11.61930 F2400
+G1 X12.342 Y-14.708 E11.67474 F2400
+G1 X13.576 Y-13.576 E11.73019 F2400
+G1 X14.708 Y-12.342 E11.78563 F2400
+G1 X15.728 Y-11.013 E11.84107 F2400
+G1 X16.628 Y-9.600 E11.89651 F2400
+G1 X17.401 Y-8.114 E11.95195 F2400
+G1 X18.042 Y-6.567 E12.00740 F2400
+G1 X18.546 Y-4.969 E12.06284 F2400
+G1 X18.908 Y-3.334 E12.11828 F2400
+G1 X19.127 Y-1.673 E12.17372 F2400
+G1 X19.200 Y-0.000 E12.22916 F2400
+G1 E11.22916 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E12.22916 F2400
+G1 X12.000 Y-12.000 E13.02356 F3600
+G1 X12.000 Y-11.000 E13.05666 F3600
+G1 X-12.000 Y-11.000 E13.85106 F3600
+G1 X-12.000 Y-10.000 E13.88416 F3600
+G1 X12.000 Y-10.000 E14.67856 F3600
+G1 X12.000 Y-9.000 E14.71166 F3600
+G1 X-12.000 Y-9.000 E15.50606 F3600
+G1 X-12.000 Y-8.000 E15.53916 F3600
+G1 X12.000 Y-8.000 E16.33356 F3600
+G1 X12.000 Y-7.000 E16.36666 F3600
+G1 X-12.000 Y-7.000 E17.16106 F3600
+G1 X-12.000 Y-6.000 E17.19416 F3600
+G1 X12.000 Y-6.000 E17.98856 F3600
+G1 X12.000 Y-5.000 E18.02166 F3600
+G1 X-12.000 Y-5.000 E18.81606 F3600
+G1 X-12.000 Y-4.000 E18.84916 F3600
+G1 X12.000 Y-4.000 E19.64356 F3600
+G1 X12.000 Y-3.000 E19.67666 F3600
+G1 X-12.000 Y-3.000 E20.47106 F3600
+G1 X-12.000 Y-2.000 E20.50416 F3600
+G1 X12.000 Y-2.000 E21.29856 F3600
+G1 X12.000 Y-1.000 E21.33166 F3600
+G1 X-12.000 Y-1.000 E22.12606 F3600
+G1 X-12.000 Y0.000 E22.15916 F3600
+G1 X12.000 Y0.000 E22.95356 F3600
+G1 X12.000 Y1.000 E22.98666 F3600
+G1 X-12.000 Y1.000 E23.78106 F3600
+G1 X-12.000 Y2.000 E23.81416 F3600
+G1 X12.000 Y2.000 E24.60856 F3600
+G1 X12.000 Y3.000 E24.64166 F3600
+G1 X-12.000 Y3.000 E25.43606 F3600
+G1 X-12.000 Y4.000 E25.46916 F3600
+G1 X12.000 Y4.000 E26.26356 F3600
+G1 X12.000 Y5.000 E26.29666 F3600
+G1 X-12.000 Y5.000 E27.09106 F3600
+G1 X-12.000 Y6.000 E27.12416 F3600
+G1 X12.000 Y6.000 E27.91856 F3600
+G1 X12.000 Y7.000 E27.95166 F3600
+G1 X-12.000 Y7.000 E28.74606 F3600
+G1 X-12.000 Y8.000 E28.77916 F3600
+G1 X12.000 Y8.000 E29.57356 F3600
+G1 X12.000 Y9.000 E29.60666 F3600
+G1 X-12.000 Y9.000 E30.40106 F3600
+G1 X-12.000 Y10.000 E30.43416 F3600
+G1 X12.000 Y10.000 E31.22856 F3600
+G1 X12.000 Y11.000 E31.26166 F3600
+G1 X-12.000 Y11.000 E32.05606 F3600
+G1 X-12.000 Y12.000 E32.08916 F3600
+G1 X12.000 Y12.000 E32.88356 F3600
+;LAYER:13
+G1 Z2.80 F1200
+G1 E31.88356 F2400
+G1 X20.000 Y0.000 F9000
+G1 E32.88356 F2400
+G1 X19.924 Y1.743 E32.94132 F1800
+G1 X19.696 Y3.473 E32.99907 F1800
+G1 X19.319 Y5.176 E33.05682 F1800
+G1 X18.794 Y6.840 E33.11457 F1800
+G1 X18.126 Y8.452 E33.17232 F1800
+G1 X17.321 Y10.000 E33.23008 F1800
+G1 X16.383 Y11.472 E33.28783 F1800
+G1 X15.321 Y12.856 E33.34558 F1800
+G1 X14.142 Y14.142 E33.40333 F1800
+G1 X12.856 Y15.321 E33.46108 F1800
+G1 X11.472 Y16.383 E33.51884 F1800
+G1 X10.000 Y17.321 E33.57659 F1800
+G1 X8.452 Y18.126 E33.63434 F1800
+G1 X6.840 Y18.794 E33.69209 F1800
+G1 X5.176 Y19.319 E33.74984 F1800
+G1 X3.473 Y19.696 E33.80760 F1800
+G1 X1.743 Y19.924 E33.86535 F1800
+G1 X0.000 Y20.000 E33.92310 F1800
+G1 X-1.743 Y19.924 E33.98085 F1800
+G1 X-3.473 Y19.696 E34.03860 F1800
+G1 X-5.176 Y19.319 E34.09636 F1800
+G1 X-6.840 Y18.794 E34.15411 F1800
+G1 X-8.452 Y18.126 E34.21186 F1800
+G1 X-10.000 Y17.321 E34.26961 F1800
+G1 X-11.472 Y16.383 E34.32737 F1800
+G1 X-12.856 Y15.321 E34.38512 F1800
+G1 X-14.142 Y14.142 E34.44287 F1800
+G1 X-15.321 Y12.856 E34.50062 F1800
+G1 X-16.383 Y11.472 E34.55837 F1800
+G1 X-17.321 Y10.000 E34.61613 F1800
+G1 X-18.126 Y8.452 E34.67388 F1800
+G1 X-18.794 Y6.840 E34.73163 F1800
+G1 X-19.319 Y5.176 E34.78938 F1800
+G1 X-19.696 Y3.473 E34.84713 F1800
+G1 X-19.924 Y1.743 E34.90489 F1800
+G1 X-20.000 Y0.000 E34.96264 F1800
+G1 X-19.924 Y-1.743 E35.02039 F1800
+G1 X-19.696 Y-3.473 E35.07814 F1800
+G1 X-19.319 Y-5.176 E35.13589 F1800
+G1 X-18.794 Y-6.840 E35.19365 F1800
+G1 X-18.126 Y-8.452 E35.25140 F1800
+G1 X-17.321 Y-10.000 E35.30915 F1800
+G1 X-16.383 Y-11.472 E35.36690 F1800
+G1 X-15.321 Y-12.856 E35.42465 F1800
+G1 X-14.142 Y-14.142 E35.48241 F1800
+G1 X-12.856 Y-15.321 E35.54016 F1800
+G1 X-11.472 Y-16.383 E35.59791 F1800
+G1 X-10.000 Y-17.321 E35.65566 F1800
+G1 X-8.452 Y-18.126 E35.71341 F1800
+G1 X-6.840 Y-18.794 E35.77117 F1800
+G1 X-5.176 Y-19.319 E35.82892 F1800
+G1 X-3.473 Y-19.696 E35.88667 F1800
+G1 X-1.743 Y-19.924 E35.94442 F1800
+G1 X-0.000 Y-20.000 E36.00218 F1800
+G1 X1.743 Y-19.924 E36.05993 F1800
+G1 X3.473 Y-19.696 E36.11768 F1800
+G1 X5.176 Y-19.319 E36.17543 F1800
+G1 X6.840 Y-18.794 E36.23318 F1800
+G1 X8.452 Y-18.126 E36.29094 F1800
+G1 X10.000 Y-17.321 E36.34869 F1800
+G1 X11.472 Y-16.383 E36.40644 F1800
+G1 X12.856 Y-15.321 E36.46419 F1800
+G1 X14.142 Y-14.142 E36.52194 F1800
+G1 X15.321 Y-12.856 E36.57970 F1800
+G1 X16.383 Y-11.472 E36.63745 F1800
+G1 X17.321 Y-10.000 E36.69520 F1800
+G1 X18.126 Y-8.452 E36.75295 F1800
+G1 X18.794 Y-6.840 E36.81070 F1800
+G1 X19.319 Y-5.176 E36.86846 F1800
+G1 X19.696 Y-3.473 E36.92621 F1800
+G1 X19.924 Y-1.743 E36.98396 F1800
+G1 X20.000 Y-0.000 E37.04171 F1800
+G1 X19.525 Y1.708 E37.10040 F2400
+G1 X19.302 Y3.404 E37.15699 F2400
+G1 X18.932 Y5.073 E37.21359 F2400
+G1 X18.418 Y6.704 E37.27019 F2400
+G1 X17.764 Y8.283 E37.32679 F2400
+G1 X16.974 Y9.800 E37.38338 F2400
+G1 X16.055 Y11.242 E37.43998 F2400
+G1 X15.014 Y12.599 E37.49658 F2400
+G1 X13.859 Y13.859 E37.55317 F2400
+G1 X12.599 Y15.014 E37.60977 F2400
+G1 X11.242 Y16.055 E37.66637 F2400
+G1 X9.800 Y16.974 E37.72296 F2400
+G1 X8.283 Y17.764 E37.77956 F2400
+G1 X6.704 Y18.418 E37.83616 F2400
+G1 X5.073 Y18.932 E37.89276 F2400
+G1 X3.404 Y19.302 E37.94935 F2400
+G1 X1.708 Y19.525 E38.00595 F2400
+G1 X0.000 Y19.600 E38.06255 F2400
+G1 X-1.708 Y19.525 E38.11914 F2400
+G1 X-3.404 Y19.302 E38.17574 F2400
+G1 X-5.073 Y18.932 E38.23234 F2400
+G1 X-6.704 Y18.418 E38.28893 F2400
+G1 X-8.283 Y17.764 E38.34553 F2400
+G1 X-9.800 Y16.974 E38.40213 F2400
+G1 X-11.242 Y16.055 E38.45873 F2400
+G1 X-12.599 Y15.014 E38.51532 F2400
+G1 X-13.859 Y13.859 E38.57192 F2400
+G1 X-15.014 Y12.599 E38.62852 F2400
+G1 X-16.055 Y11.242 E38.68511 F2400
+G1 X-16.974 Y9.800 E38.74171 F2400
+G1 X-17.764 Y8.283 E38.79831 F2400
+G1 X-18.418 Y6.704 E38.85491 F2400
+G1 X-18.932 Y5.073 E38.91150 F2400
+G1 X-19.302 Y3.404 E38.96810 F2400
+G1 X-19.525 Y1.708 E39.02470 F2400
+G1 X-19.600 Y0.000 E39.08129 F2400
+G1 X-19.525 Y-1.708 E39.13789 F2400
+G1 X-19.302 Y-3.404 E39.19449 F2400
+G1 X-18.932 Y-5.073 E39.25108 F2400
+G1 X-18.418 Y-6.704 E39.30768 F2400
+G1 X-17.764 Y-8.283 E39.36428 F2400
+G1 X-16.974 Y-9.800 E39.42088 F2400
+G1 X-16.055 Y-11.242 E39.47747 F2400
+G1 X-15.014 Y-12.599 E39.53407 F2400
+G1 X-13.859 Y-13.859 E39.59067 F2400
+G1 X-12.599 Y-15.014 E39.64726 F2400
+G1 X-11.242 Y-16.055 E39.70386 F2400
+G1 X-9.800 Y-16.974 E39.76046 F2400
+G1 X-8.283 Y-17.764 E39.81705 F2400
+G1 X-6.704 Y-18.418 E39.87365 F2400
+G1 X-5.073 Y-18.932 E39.93025 F2400
+G1 X-3.404 Y-19.302 E39.98685 F2400
+G1 X-1.708 Y-19.525 E40.04344 F2400
+G1 X-0.000 Y-19.600 E40.10004 F2400
+G1 X1.708 Y-19.525 E40.15664 F2400
+G1 X3.404 Y-19.302 E40.21323 F2400
+G1 X5.073 Y-18.932 E40.26983 F2400
+G1 X6.704 Y-18.418 E40.32643 F2400
+G1 X8.283 Y-17.764 E40.38302 F2400
+G1 X9.800 Y-16.974 E40.43962 F2400
+G1 X11.242 Y-16.055 E40.49622 F2400
+G1 X12.599 Y-15.014 E40.55282 F2400
+G1 X13.859 Y-13.859 E40.60941 F2400
+G1 X15.014 Y-12.599 E40.66601 F2400
+G1 X16.055 Y-11.242 E40.72261 F2400
+G1 X16.974 Y-9.800 E40.77920 F2400
+G1 X17.764 Y-8.283 E40.83580 F2400
+G1 X18.418 Y-6.704 E40.89240 F2400
+G1 X18.932 Y-5.073 E40.94900 F2400
+G1 X19.302 Y-3.404 E41.00559 F2400
+G1 X19.525 Y-1.708 E41.06219 F2400
+G1 X19.600 Y-0.000 E41.11879 F2400
+G1 X19.127 Y1.673 E41.17635 F2400
+G1 X18.908 Y3.334 E41.23179 F2400
+G1 X18.546 Y4.969 E41.28723 F2400
+G1 X18.042 Y6.567 E41.34267 F2400
+G1 X17.401 Y8.114 E41.39811 F2400
+G1 X16.628 Y9.600 E41.45356 F2400
+G1 X15.728 Y11.013 E41.50900 F2400
+G1 X14.708 Y12.342 E41.56444 F2400
+G1 X13.576 Y13.576 E41.61988 F2400
+G1 X12.342 Y14.708 E41.67532 F2400
+G1 X11.013 Y15.728 E41.73077 F2400
+G1 X9.600 Y16.628 E41.78621 F2400
+G1 X8.114 Y17.401 E41.84165 F2400
+G1 X6.567 Y18.042 E41.89709 F2400
+G1 X4.969 Y18.546 E41.95253 F2400
+G1 X3.334 Y18.908 E42.00798 F2400
+G1 X1.673 Y19.127 E42.06342 F2400
+G1 X0.000 Y19.200 E42.11886 F2400
+G1 X-1.673 Y19.127 E42.17430 F2400
+G1 X-3.334 Y18.908 E42.22974 F2400
+G1 X-4.969 Y18.546 E42.28519 F2400
+G1 X-6.567 Y18.042 E42.34063 F2400
+G1 X-8.114 Y17.401 E42.39607 F2400
+G1 X-9.600 Y16.628 E42.45151 F2400
+G1 X-11.013 Y15.728 E42.50695 F2400
+G1 X-12.342 Y14.708 E42.56240 F2400
+G1 X-13.576 Y13.576 E42.61784 F2400
+G1 X-14.708 Y12.342 E42.67328 F2400
+G1 X-15.728 Y11.013 E42.72872 F2400
+G1 X-16.628 Y9.600 E42.78416 F2400
+G1 X-17.401 Y8.114 E42.83961 F2400
+G1 X-18.042 Y6.567 E42.89505 F2400
+G1 X-18.546 Y4.969 E42.95049 F2400
+G1 X-18.908 Y3.334 E43.00593 F2400
+G1 X-19.127 Y1.673 E43.06137 F2400
+G1 X-19.200 Y0.000 E43.11682 F2400
+G1 X-19.127 Y-1.673 E43.17226 F2400
+G1 X-18.908 Y-3.334 E43.22770 F2400
+G1 X-18.546 Y-4.969 E43.28314 F2400
+G1 X-18.042 Y-6.567 E43.33858 F2400
+G1 X-17.401 Y-8.114 E43.39403 F2400
+G1 X-16.628 Y-9.600 E43.44947 F2400
+G1 X-15.728 Y-11.013 E43.50491 F2400
+G1 X-14.708 Y-12.342 E43.56035 F2400
+G1 X-13.576 Y-13.576 E43.61579 F2400
+G1 X-12.342 Y-14.708 E43.67124 F2400
+G1 X-11.013 Y-15.728 E43.72668 F2400
+G1 X-9.600 Y-16.628 E43.78212 F2400
+G1 X-8.114 Y-17.401 E43.83756 F2400
+G1 X-6.567 Y-18.042 E43.89300 F2400
+G1 X-4.969 Y-18.546 E43.94845 F2400
+G1 X-3.334 Y-18.908 E44.00389 F2400
+G1 X-1.673 Y-19.127 E44.05933 F2400
+G1 X-0.000 Y-19.200 E44.11477 F2400
+G1 X1.673 Y-19.127 E44.17021 F2400
+G1 X3.334 Y-18.908 E44.22566 F2400
+G1 X4.969 Y-18.546 E44.28110 F2400
+G1 X6.567 Y-18.042 E44.33654 F2400
+G1 X8.114 Y-17.401 E44.39198 F2400
+G1 X9.600 Y-16.628 E44.44742 F2400
+G1 X11.013 Y-15.728 E44.50287 F2400
+G1 X12.342 Y-14.708 E44.55831 F2400
+G1 X13.576 Y-13.576 E44.61375 F2400
+G1 X14.708 Y-12.342 E44.66919 F2400
+G1 X15.728 Y-11.013 E44.72463 F2400
+G1 X16.628 Y-9.600 E44.78008 F2400
+G1 X17.401 Y-8.114 E44.83552 F2400
+G1 X18.042 Y-6.567 E44.89096 F2400
+G1 X18.546 Y-4.969 E44.94640 F2400
+G1 X18.908 Y-3.334 E45.00184 F2400
+G1 X19.127 Y-1.673 E45.05729 F2400
+G1 X19.200 Y-0.000 E45.11273 F2400
+G1 E44.11273 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E45.11273 F2400
+G1 X-12.000 Y12.000 E45.90713 F3600
+G1 X-11.200 Y12.000 E45.93361 F3600
+G1 X-11.200 Y-12.000 E46.72801 F3600
+G1 X-10.400 Y-12.000 E46.75449 F3600
+G1 X-10.400 Y12.000 E47.54889 F3600
+G1 X-9.600 Y12.000 E47.57537 F3600
+G1 X-9.600 Y-12.000 E48.36977 F3600
+G1 X-8.800 Y-12.000 E48.39625 F3600
+G1 X-8.800 Y12.000 E49.19065 F3600
+G1 X-8.000 Y12.000 E49.21713 F3600
+G1 X-8.000 Y-12.000 E50.01153 F3600
+G1 X-7.200 Y-12.000 E50.03801 F3600
+G1 X-7.200 Y12.000 E50.83241 F3600
+G1 X-6.400 Y12.000 E50.85889 F3600
+G1 X-6.400 Y-12.000 E51.65329 F3600
+G1 X-5.600 Y-12.000 E51.67977 F3600
+G1 X-5.600 Y12.000 E52.47417 F3600
+G1 X-4.800 Y12.000 E52.50065 F3600
+G1 X-4.800 Y-12.000 E53.29505 F3600
+G1 X-4.000 Y-12.000 E53.32153 F3600
+G1 X-4.000 Y12.000 E54.11593 F3600
+G1 X-3.200 Y12.000 E54.14241 F3600
+G1 X-3.200 Y-12.000 E54.93681 F3600
+G1 X-2.400 Y-12.000 E54.96329 F3600
+G1 X-2.400 Y12.000 E55.75769 F3600
+G1 X-1.600 Y12.000 E55.78417 F3600
+G1 X-1.600 Y-12.000 E56.57857 F3600
+G1 X-0.800 Y-12.000 E56.60505 F3600
+G1 X-0.800 Y12.000 E57.39945 F3600
+G1 X0.000 Y12.000 E57.42593 F3600
+G1 X0.000 Y-12.000 E58.22033 F3600
+G1 X0.800 Y-12.000 E58.24681 F3600
+G1 X0.800 Y12.000 E59.04121 F3600
+G1 X1.600 Y12.000 E59.06769 F3600
+G1 X1.600 Y-12.000 E59.86209 F3600
+G1 X2.400 Y-12.000 E59.88857 F3600
+G1 X2.400 Y12.000 E60.68297 F3600
+G1 X3.200 Y12.000 E60.70945 F3600
+G1 X3.200 Y-12.000 E61.50385 F3600
+G1 X4.000 Y-12.000 E61.53033 F3600
+G1 X4.000 Y12.000 E62.32473 F3600
+G1 X4.800 Y12.000 E62.35121 F3600
+G1 X4.800 Y-12.000 E63.14561 F3600
+G1 X5.600 Y-12.000 E63.17209 F3600
+G1 X5.600 Y12.000 E63.96649 F3600
+G1 X6.400 Y12.000 E63.99297 F3600
+G1 X6.400 Y-12.000 E64.78737 F3600
+G1 X7.200 Y-12.000 E64.81385 F3600
+G1 X7.200 Y12.000 E65.60825 F3600
+G1 X8.000 Y12.000 E65.63473 F3600
+G1 X8.000 Y-12.000 E66.42913 F3600
+G1 X8.800 Y-12.000 E66.45561 F3600
+G1 X8.800 Y12.000 E67.25001 F3600
+G1 X9.600 Y12.000 E67.27649 F3600
+G1 X9.600 Y-12.000 E68.07089 F3600
+G1 X10.400 Y-12.000 E68.09737 F3600
+G1 X10.400 Y12.000 E68.89177 F3600
+G1 X11.200 Y12.000 E68.91825 F3600
+G1 X11.200 Y-12.000 E69.71265 F3600
+G1 X12.000 Y-12.000 E69.73913 F3600
+G1 X12.000 Y12.000 E70.53353 F3600
+;LAYER:14
+G1 Z3.00 F1200
+G1 E69.53353 F2400
+G1 X20.000 Y0.000 F9000
+G1 E70.53353 F2400
+G1 X19.924 Y1.743 E70.59128 F1800
+G1 X19.696 Y3.473 E70.64903 F1800
+G1 X19.319 Y5.176 E70.70678 F1800
+G1 X18.794 Y6.840 E70.76454 F1800
+G1 X18.126 Y8.452 E70.82229 F1800
+G1 X17.321 Y10.000 E70.88004 F1800
+G1 X16.383 Y11.472 E70.93779 F1800
+G1 X15.321 Y12.856 E70.99554 F1800
+G1 X14.142 Y14.142 E71.05330 F1800
+G1 X12.856 Y15.321 E71.11105 F1800
+G1 X11.472 Y16.383 E71.16880 F1800
+G1 X10.000 Y17.321 E71.22655 F1800
+G1 X8.452 Y18.126 E71.28430 F1800
+G1 X6.840 Y18.794 E71.34206 F1800
+G1 X5.176 Y19.319 E71.39981 F1800
+G1 X3.473 Y19.696 E71.45756 F1800
+G1 X1.743 Y19.924 E71.51531 F1800
+G1 X0.000 Y20.000 E71.57306 F1800
+G1 X-1.743 Y19.924 E71.63082 F1800
+G1 X-3.473 Y19.696 E71.68857 F1800
+G1 X-5.176 Y19.319 E71.74632 F1800
+G1 X-6.840 Y18.794 E71.80407 F1800
+G1 X-8.452 Y18.126 E71.86182 F1800
+G1 X-10.000 Y17.321 E71.91958 F1800
+G1 X-11.472 Y16.383 E71.97733 F1800
+G1 X-12.856 Y15.321 E72.03508 F1800
+G1 X-14.142 Y14.142 E72.09283 F1800
+G1 X-15.321 Y12.856 E72.15059 F1800
+G1 X-16.383 Y11.472 E72.20834 F1800
+G1 X-17.321 Y10.000 E72.26609 F1800
+G1 X-18.126 Y8.452 E72.32384 F1800
+G1 X-18.794 Y6.840 E72.38159 F1800
+G1 X-19.319 Y5.176 E72.43935 F1800
+G1 X-19.696 Y3.473 E72.49710 F1800
+G1 X-19.924 Y1.743 E72.55485 F1800
+G1 X-20.000 Y0.000 E72.61260 F1800
+G1 X-19.924 Y-1.743 E72.67035 F1800
+G1 X-19.696 Y-3.473 E72.72811 F1800
+G1 X-19.319 Y-5.176 E72.78586 F1800
+G1 X-18.794 Y-6.840 E72.84361 F1800
+G1 X-18.126 Y-8.452 E72.90136 F1800
+G1 X-17.321 Y-10.000 E72.95911 F1800
+G1 X-16.383 Y-11.472 E73.01687 F1800
+G1 X-15.321 Y-12.856 E73.07462 F1800
+G1 X-14.142 Y-14.142 E73.13237 F1800
+G1 X-12.856 Y-15.321 E73.19012 F1800
+G1 X-11.472 Y-16.383 E73.24787 F1800
+G1 X-10.000 Y-17.321 E73.30563 F1800
+G1 X-8.452 Y-18.126 E73.36338 F1800
+G1 X-6.840 Y-18.794 E73.42113 F1800
+G1 X-5.176 Y-19.319 E73.47888 F1800
+G1 X-3.473 Y-19.696 E73.53663 F1800
+G1 X-1.743 Y-19.924 E73.59439 F1800
+G1 X-0.000 Y-20.000 E73.65214 F1800
+G1 X1.743 Y-19.924 E73.70989 F1800
+G1 X3.473 Y-19.696 E73.76764 F1800
+G1 X5.176 Y-19.319 E73.82540 F1800
+G1 X6.840 Y-18.794 E73.88315 F1800
+G1 X8.452 Y-18.126 E73.94090 F1800
+G1 X10.000 Y-17.321 E73.99865 F1800
+G1 X11.472 Y-16.383 E74.05640 F1800
+G1 X12.856 Y-15.321 E74.11416 F1800
+G1 X14.142 Y-14.142 E74.17191 F1800
+G1 X15.321 Y-12.856 E74.22966 F1800
+G1 X16.383 Y-11.472 E74.28741 F1800
+G1 X17.321 Y-10.000 E74.34516 F1800
+G1 X18.126 Y-8.452 E74.40292 F1800
+G1 X18.794 Y-6.840 E74.46067 F1800
+G1 X19.319 Y-5.176 E74.51842 F1800
+G1 X19.696 Y-3.473 E74.57617 F1800
+G1 X19.924 Y-1.743 E74.63392 F1800
+G1 X20.000 Y-0.000 E74.69168 F1800
+G1 X19.525 Y1.708 E74.75036 F2400
+G1 X19.302 Y3.404 E74.80696 F2400
+G1 X18.932 Y5.073 E74.86355 F2400
+G1 X18.418 Y6.704 E74.92015 F2400
+G1 X17.764 Y8.283 E74.97675 F2400
+G1 X16.974 Y9.800 E75.03335 F2400
+G1 X16.055 Y11.242 E75.08994 F2400
+G1 X15.014 Y12.599 E75.14654 F2400
+G1 X13.859 Y13.859 E75.20314 F2400
+G1 X12.599 Y15.014 E75.25973 F2400
+G1 X11.242 Y16.055 E75.31633 F2400
+G1 X9.800 Y16.974 E75.37293 F2400
+G1 X8.283 Y17.764 E75.42953 F2400
+G1 X6.704 Y18.418 E75.48612 F2400
+G1 X5.073 Y18.932 E75.54272 F2400
+G1 X3.404 Y19.302 E75.59932 F2400
+G1 X1.708 Y19.525 E75.65591 F2400
+G1 X0.000 Y19.600 E75.71251 F2400
+G1 X-1.708 Y19.525 E75.76911 F2400
+G1 X-3.404 Y19.302 E75.82570 F2400
+G1 X-5.073 Y18.932 E75.88230 F2400
+G1 X-6.704 Y18.418 E75.93890 F2400
+G1 X-8.283 Y17.764 E75.99550 F2400
+G1 X-9.800 Y16.974 E76.05209 F2400
+G1 X-11.242 Y16.055 E76.10869 F2400
+G1 X-12.599 Y15.014 E76.16529 F2400
+G1 X-13.859 Y13.859 E76.22188 F2400
+G1 X-15.014 Y12.599 E76.27848 F2400
+G1 X-16.055 Y11.242 E76.33508 F2400
+G1 X-16.974 Y9.800 E76.39167 F2400
+G1 X-17.764 Y8.283 E76.44827 F2400
+G1 X-18.418 Y6.704 E76.50487 F2400
+G1 X-18.932 Y5.073 E76.56147 F2400
+G1 X-19.302 Y3.404 E76.61806 F2400
+G1 X-19.525 Y1.708 E76.67466 F2400
+G1 X-19.600 Y0.000 E76.73126 F2400
+G1 X-19.525 Y-1.708 E76.78785 F2400
+G1 X-19.302 Y-3.404 E76.84445 F2400
+G1 X-18.932 Y-5.073 E76.90105 F2400
+G1 X-18.418 Y-6.704 E76.95764 F2400
+G1 X-17.764 Y-8.283 E77.01424 F2400
+G1 X-16.974 Y-9.800 E77.07084 F2400
+G1 X-16.055 Y-11.242 E77.12744 F2400
+G1 X-15.014 Y-12.599 E77.18403 F2400
+G1 X-13.859 Y-13.859 E77.24063 F2400
+G1 X-12.599 Y-15.014 E77.29723 F2400
+G1 X-11.242 Y-16.055 E77.35382 F2400
+G1 X-9.800 Y-16.974 E77.41042 F2400
+G1 X-8.283 Y-17.764 E77.46702 F2400
+G1 X-6.704 Y-18.418 E77.52362 F2400
+G1 X-5.073 Y-18.932 E77.58021 F2400
+G1 X-3.404 Y-19.302 E77.63681 F2400
+G1 X-1.708 Y-19.525 E77.69341 F2400
+G1 X-0.000 Y-19.600 E77.75000 F2400
+G1 X1.708 Y-19.525 E77.80660 F2400
+G1 X3.404 Y-19.302 E77.86320 F2400
+G1 X5.073 Y-18.932 E77.91979 F2400
+G1 X6.704 Y-18.418 E77.97639 F2400
+G1 X8.283 Y-17.764 E78.03299 F2400
+G1 X9.800 Y-16.974 E78.08959 F2400
+G1 X11.242 Y-16.055 E78.14618 F2400
+G1 X12.599 Y-15.014 E78.20278 F2400
+G1 X13.859 Y-13.859 E78.25938 F2400
+G1 X15.014 Y-12.599 E78.31597 F2400
+G1 X16.055 Y-11.242 E78.37257 F2400
+G1 X16.974 Y-9.800 E78.42917 F2400
+G1 X17.764 Y-8.283 E78.48576 F2400
+G1 X18.418 Y-6.704 E78.54236 F2400
+G1 X18.932 Y-5.073 E78.59896 F2400
+G1 X19.302 Y-3.404 E78.65556 F2400
+G1 X19.525 Y-1.708 E78.71215 F2400
+G1 X19.600 Y-0.000 E78.76875 F2400
+G1 X19.127 Y1.673 E78.82631 F2400
+G1 X18.908 Y3.334 E78.88175 F2400
+G1 X18.546 Y4.969 E78.93719 F2400
+G1 X18.042 Y6.567 E78.99264 F2400
+G1 X17.401 Y8.114 E79.04808 F2400
+G1 X16.628 Y9.600 E79.10352 F2400
+G1 X15.728 Y11.013 E79.15896 F2400
+G1 X14.708 Y12.342 E79.21440 F2400
+G1 X13.576 Y13.576 E79.26985 F2400
+G1 X12.342 Y14.708 E79.32529 F2400
+G1 X11.013 Y15.728 E79.38073 F2400
+G1 X9.600 Y16.628 E79.43617 F2400
+G1 X8.114 Y17.401 E79.49161 F2400
+G1 X6.567 Y18.042 E79.54706 F2400
+G1 X4.969 Y18.546 E79.60250 F2400
+G1 X3.334 Y18.908 E79.65794 F2400
+G1 X1.673 Y19.127 E79.71338 F2400
+G1 X0.000 Y19.200 E79.76882 F2400
+G1 X-1.673 Y19.127 E79.82427 F2400
+G1 X-3.334 Y18.908 E79.87971 F2400
+G1 X-4.969 Y18.546 E79.93515 F2400
+G1 X-6.567 Y18.042 E79.99059 F2400
+G1 X-8.114 Y17.401 E80.04603 F2400
+G1 X-9.600 Y16.628 E80.10148 F2400
+G1 X-11.013 Y15.728 E80.15692 F2400
+G1 X-12.342 Y14.708 E80.21236 F2400
+G1 X-13.576 Y13.576 E80.26780 F2400
+G1 X-14.708 Y12.342 E80.32324 F2400
+G1 X-15.728 Y11.013 E80.37869 F2400
+G1 X-16.628 Y9.600 E80.43413 F2400
+G1 X-17.401 Y8.114 E80.48957 F2400
+G1 X-18.042 Y6.567 E80.54501 F2400
+G1 X-18.546 Y4.969 E80.60045 F2400
+G1 X-18.908 Y3.334 E80.65590 F2400
+G1 X-19.127 Y1.673 E80.71134 F2400
+G1 X-19.200 Y0.000 E80.76678 F2400
+G1 X-19.127 Y-1.673 E80.82222 F2400
+G1 X-18.908 Y-3.334 E80.87766 F2400
+G1 X-18.546 Y-4.969 E80.93311 F2400
+G1 X-18.042 Y-6.567 E80.98855 F2400
+G1 X-17.401 Y-8.114 E81.04399 F2400
+G1 X-16.628 Y-9.600 E81.09943 F2400
+G1 X-15.728 Y-11.013 E81.15487 F2400
+G1 X-14.708 Y-12.342 E81.21032 F2400
+G1 X-13.576 Y-13.576 E81.26576 F2400
+G1 X-12.342 Y-14.708 E81.32120 F2400
+G1 X-11.013 Y-15.728 E81.37664 F2400
+G1 X-9.600 Y-16.628 E81.43208 F2400
+G1 X-8.114 Y-17.401 E81.48753 F2400
+G1 X-6.567 Y-18.042 E81.54297 F2400
+G1 X-4.969 Y-18.546 E81.59841 F2400
+G1 X-3.334 Y-18.908 E81.65385 F2400
+G1 X-1.673 Y-19.127 E81.70929 F2400
+G1 X-0.000 Y-19.200 E81.76473 F2400
+G1 X1.673 Y-19.127 E81.82018 F2400
+G1 X3.334 Y-18.908 E81.87562 F2400
+G1 X4.969 Y-18.546 E81.93106 F2400
+G1 X6.567 Y-18.042 E81.98650 F2400
+G1 X8.114 Y-17.401 E82.04194 F2400
+G1 X9.600 Y-16.628 E82.09739 F2400
+G1 X11.013 Y-15.728 E82.15283 F2400
+G1 X12.342 Y-14.708 E82.20827 F2400
+G1 X13.576 Y-13.576 E82.26371 F2400
+G1 X14.708 Y-12.342 E82.31915 F2400
+G1 X15.728 Y-11.013 E82.37460 F2400
+G1 X16.628 Y-9.600 E82.43004 F2400
+G1 X17.401 Y-8.114 E82.48548 F2400
+G1 X18.042 Y-6.567 E82.54092 F2400
+G1 X18.546 Y-4.969 E82.59636 F2400
+G1 X18.908 Y-3.334 E82.65181 F2400
+G1 X19.127 Y-1.673 E82.70725 F2400
+G1 X19.200 Y-0.000 E82.76269 F2400
+G1 E81.76269 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E82.76269 F2400
+G1 X12.000 Y-12.000 E83.55709 F3600
+G1 X12.000 Y-11.000 E83.59019 F3600
+G1 X-12.000 Y-11.000 E84.38459 F3600
+G1 X-12.000 Y-10.000 E84.41769 F3600
+G1 X12.000 Y-10.000 E85.21209 F3600
+G1 X12.000 Y-9.000 E85.24519 F3600
+G1 X-12.000 Y-9.000 E86.03959 F3600
+G1 X-12.000 Y-8.000 E86.07269 F3600
+G1 X12.000 Y-8.000 E86.86709 F3600
+G1 X12.000 Y-7.000 E86.90019 F3600
+G1 X-12.000 Y-7.000 E87.69459 F3600
+G1 X-12.000 Y-6.000 E87.72769 F3600
+G1 X12.000 Y-6.000 E88.52209 F3600
+G1 X12.000 Y-5.000 E88.55519 F3600
+G1 X-12.000 Y-5.000 E89.34959 F3600
+G1 X-12.000 Y-4.000 E89.38269 F3600
+G1 X12.000 Y-4.000 E90.17709 F3600
+G1 X12.000 Y-3.000 E90.21019 F3600
+G1 X-12.000 Y-3.000 E91.00459 F3600
+G1 X-12.000 Y-2.000 E91.03769 F3600
+G1 X12.000 Y-2.000 E91.83209 F3600
+G1 X12.000 Y-1.000 E91.86519 F3600
+G1 X-12.000 Y-1.000 E92.65959 F3600
+G1 X-12.000 Y0.000 E92.69269 F3600
+G1 X12.000 Y0.000 E93.48709 F3600
+G1 X12.000 Y1.000 E93.52019 F3600
+G1 X-12.000 Y1.000 E94.31459 F3600
+G1 X-12.000 Y2.000 E94.34769 F3600
+G1 X12.000 Y2.000 E95.14209 F3600
+G1 X12.000 Y3.000 E95.17519 F3600
+G1 X-12.000 Y3.000 E95.96959 F3600
+G1 X-12.000 Y4.000 E96.00269 F3600
+G1 X12.000 Y4.000 E96.79709 F3600
+G1 X12.000 Y5.000 E96.83019 F3600
+G1 X-12.000 Y5.000 E97.62459 F3600
+G1 X-12.000 Y6.000 E97.65769 F3600
+G1 X12.000 Y6.000 E98.45209 F3600
+G1 X12.000 Y7.000 E98.48519 F3600
+G1 X-12.000 Y7.000 E99.27959 F3600
+G1 X-12.000 Y8.000 E99.31269 F3600
+G1 X12.000 Y8.000 E100.10709 F3600
+G1 X12.000 Y9.000 E100.14019 F3600
+G1 X-12.000 Y9.000 E100.93459 F3600
+G1 X-12.000 Y10.000 E100.96769 F3600
+G1 X12.000 Y10.000 E101.76209 F3600
+G1 X12.000 Y11.000 E101.79519 F3600
+G1 X-12.000 Y11.000 E102.58959 F3600
+G1 X-12.000 Y12.000 E102.62269 F3600
+G1 X12.000 Y12.000 E103.41709 F3600
+;LAYER:15
+G1 Z3.20 F1200
+G1 E102.41709 F2400
+G1 X20.000 Y0.000 F9000
+G1 E103.41709 F2400
+G1 X19.924 Y1.743 E103.47484 F1800
+G1 X19.696 Y3.473 E103.53259 F1800
+G1 X19.319 Y5.176 E103.59035 F1800
+G1 X18.794 Y6.840 E103.64810 F1800
+G1 X18.126 Y8.452 E103.70585 F1800
+G1 X17.321 Y10.000 E103.76360 F1800
+G1 X16.383 Y11.472 E103.82136 F1800
+G1 X15.321 Y12.856 E103.87911 F1800
+G1 X14.142 Y14.142 E103.93686 F1800
+G1 X12.856 Y15.321 E103.99461 F1800
+G1 X11.472 Y16.383 E104.05236 F1800
+G1 X10.000 Y17.321 E104.11012 F1800
+G1 X8.452 Y18.126 E104.16787 F1800
+G1 X6.840 Y18.794 E104.22562 F1800
+G1 X5.176 Y19.319 E104.28337 F1800
+G1 X3.473 Y19.696 E104.34112 F1800
+G1 X1.743 Y19.924 E104.39888 F1800
+G1 X0.000 Y20.000 E104.45663 F1800
+G1 X-1.743 Y19.924 E104.51438 F1800
+G1 X-3.473 Y19.696 E104.57213 F1800
+G1 X-5.176 Y19.319 E104.62988 F1800
+G1 X-6.840 Y18.794 E104.68764 F1800
+G1 X-8.452 Y18.126 E104.74539 F1800
+G1 X-10.000 Y17.321 E104.80314 F1800
+G1 X-11.472 Y16.383 E104.86089 F1800
+G1 X-12.856 Y15.321 E104.91864 F1800
+G1 X-14.142 Y14.142 E104.97640 F1800
+G1 X-15.321 Y12.856 E105.03415 F1800
+G1 X-16.383 Y11.472 E105.09190 F1800
+G1 X-17.321 Y10.000 E105.14965 F1800
+G1 X-18.126 Y8.452 E105.20740 F1800
+G1 X-18.794 Y6.840 E105.26516 F1800
+G1 X-19.319 Y5.176 E105.32291 F1800
+G1 X-19.696 Y3.473 E105.38066 F1800
+G1 X-19.924 Y1.743 E105.43841 F1800
+G1 X-20.000 Y0.000 E105.49617 F1800
+G1 X-19.924 Y-1.743 E105.55392 F1800
+G1 X-19.696 Y-3.473 E105.61167 F1800
+G1 X-19.319 Y-5.176 E105.66942 F1800
+G1 X-18.794 Y-6.840 E105.72717 F1800
+G1 X-18.126 Y-8.452 E105.78493 F1800
+G1 X-17.321 Y-10.000 E105.84268 F1800
+G1 X-16.383 Y-11.472 E105.90043 F1800
+G1 X-15.321 Y-12.856 E105.95818 F1800
+G1 X-14.142 Y-14.142 E106.01593 F1800
+G1 X-12.856 Y-15.321 E106.07369 F1800
+G1 X-11.472 Y-16.383 E106.13144 F1800
+G1 X-10.000 Y-17.321 E106.18919 F1800
+G1 X-8.452 Y-18.126 E106.24694 F1800
+G1 X-6.840 Y-18.794 E106.30469 F1800
+G1 X-5.176 Y-19.319 E106.36245 F1800
+G1 X-3.473 Y-19.696 E106.42020 F1800
+G1 X-1.743 Y-19.924 E106.47795 F1800
+G1 X-0.000 Y-20.000 E106.53570 F1800
+G1 X1.743 Y-19.924 E106.59345 F1800
+G1 X3.473 Y-19.696 E106.65121 F1800
+G1 X5.176 Y-19.319 E106.70896 F1800
+G1 X6.840 Y-18.794 E106.76671 F1800
+G1 X8.452 Y-18.126 E106.82446 F1800
+G1 X10.000 Y-17.321 E106.88221 F1800
+G1 X11.472 Y-16.383 E106.93997 F1800
+G1 X12.856 Y-15.321 E106.99772 F1800
+G1 X14.142 Y-14.142 E107.05547 F1800
+G1 X15.321 Y-12.856 E107.11322 F1800
+G1 X16.383 Y-11.472 E107.17098 F1800
+G1 X17.321 Y-10.000 E107.22873 F1800
+G1 X18.126 Y-8.452 E107.28648 F1800
+G1 X18.794 Y-6.840 E107.34423 F1800
+G1 X19.319 Y-5.176 E107.40198 F1800
+G1 X19.696 Y-3.473 E107.45974 F1800
+G1 X19.924 Y-1.743 E107.51749 F1800
+G1 X20.000 Y-0.000 E107.57524 F1800
+G1 X19.525 Y1.708 E107.63392 F2400
+G1 X19.302 Y3.404 E107.69052 F2400
+G1 X18.932 Y5.073 E107.74712 F2400
+G1 X18.418 Y6.704 E107.80372 F2400
+G1 X17.764 Y8.283 E107.86031 F2400
+G1 X16.974 Y9.800 E107.91691 F2400
+G1 X16.055 Y11.242 E107.97351 F2400
+G1 X15.014 Y12.599 E108.03010 F2400
+G1 X13.859 Y13.859 E108.08670 F2400
+G1 X12.599 Y15.014 E108.14330 F2400
+G1 X11.242 Y16.055 E108.19989 F2400
+G1 X9.800 Y16.974 E108.25649 F2400
+G1 X8.283 Y17.764 E108.31309 F2400
+G1 X6.704 Y18.418 E108.36969 F2400
+G1 X5.073 Y18.932 E108.42628 F2400
+G1 X3.404 Y19.302 E108.48288 F2400
+G1 X1.708 Y19.525 E108.53948 F2400
+G1 X0.000 Y19.600 E108.59607 F2400
+G1 X-1.708 Y19.525 E108.65267 F2400
+G1 X-3.404 Y19.302 E108.70927 F2400
+G1 X-5.073 Y18.932 E108.76586 F2400
+G1 X-6.704 Y18.418 E108.82246 F2400
+G1 X-8.283 Y17.764 E108.87906 F2400
+G1 X-9.800 Y16.974 E108.93566 F2400
+G1 X-11.242 Y16.055 E108.99225 F2400
+G1 X-12.599 Y15.014 E109.04885 F2400
+G1 X-13.859 Y13.859 E109.10545 F2400
+G1 X-15.014 Y12.599 E109.16204 F2400
+G1 X-16.055 Y11.242 E109.21864 F2400
+G1 X-16.974 Y9.800 E109.27524 F2400
+G1 X-17.764 Y8.283 E109.33184 F2400
+G1 X-18.418 Y6.704 E109.38843 F2400
+G1 X-18.932 Y5.073 E109.44503 F2400
+G1 X-19.302 Y3.404 E109.50163 F2400
+G1 X-19.525 Y1.708 E109.55822 F2400
+G1 X-19.600 Y0.000 E109.61482 F2400
+G1 X-19.525 Y-1.708 E109.67142 F2400
+G1 X-19.302 Y-3.404 E109.72801 F2400
+G1 X-18.932 Y-5.073 E109.78461 F2400
+G1 X-18.418 Y-6.704 E109.84121 F2400
+G1 X-17.764 Y-8.283 E109.89781 F2400
+G1 X-16.974 Y-9.800 E109.95440 F2400
+G1 X-16.055 Y-11.242 E110.01100 F2400
+G1 X-15.014 Y-12.599 E110.06760 F2400
+G1 X-13.859 Y-13.859 E110.12419 F2400
+G1 X-12.599 Y-15.014 E110.18079 F2400
+G1 X-11.242 Y-16.055 E110.23739 F2400
+G1 X-9.800 Y-16.974 E110.29398 F2400
+G1 X-8.283 Y-17.764 E110.35058 F2400
+G1 X-6.704 Y-18.418 E110.40718 F2400
+G1 X-5.073 Y-18.932 E110.46378 F2400
+G1 X-3.404 Y-19.302 E110.52037 F2400
+G1 X-1.708 Y-19.525 E110.57697 F2400
+G1 X-0.000 Y-19.600 E110.63357 F2400
+G1 X1.708 Y-19.525 E110.69016 F2400
+G1 X3.404 Y-19.302 E110.74676 F2400
+G1 X5.073 Y-18.932 E110.80336 F2400
+G1 X6.704 Y-18.418 E110.85995 F2400
+G1 X8.283 Y-17.764 E110.91655 F2400
+G1 X9.800 Y-16.974 E110.97315 F2400
+G1 X11.242 Y-16.055 E111.02975 F2400
+G1 X12.599 Y-15.014 E111.08634 F2400
+G1 X13.859 Y-13.859 E111.14294 F2400
+G1 X15.014 Y-12.599 E111.19954 F2400
+G1 X16.055 Y-11.242 E111.25613 F2400
+G1 X16.974 Y-9.800 E111.31273 F2400
+G1 X17.764 Y-8.283 E111.36933 F2400
+G1 X18.418 Y-6.704 E111.42593 F2400
+G1 X18.932 Y-5.073 E111.48252 F2400
+G1 X19.302 Y-3.404 E111.53912 F2400
+G1 X19.525 Y-1.708 E111.59572 F2400
+G1 X19.600 Y-0.000 E111.65231 F2400
+G1 X19.127 Y1.673 E111.70987 F2400
+G1 X18.908 Y3.334 E111.76532 F2400
+G1 X18.546 Y4.969 E111.82076 F2400
+G1 X18.042 Y6.567 E111.87620 F2400
+G1 X17.401 Y8.114 E111.93164 F2400
+G1 X16.628 Y9.600 E111.98708 F2400
+G1 X15.728 Y11.013 E112.04253 F2400
+G1 X14.708 Y12.342 E112.09797 F2400
+G1 X13.576 Y13.576 E112.15341 F2400
+G1 X12.342 Y14.708 E112.20885 F2400
+G1 X11.013 Y15.728 E112.26429 F2400
+G1 X9.600 Y16.628 E112.31974 F2400
+G1 X8.114 Y17.401 E112.37518 F2400
+G1 X6.567 Y18.042 E112.43062 F2400
+G1 X4.969 Y18.546 E112.48606 F2400
+G1 X3.334 Y18.908 E112.54150 F2400
+G1 X1.673 Y19.127 E112.59695 F2400
+G1 X0.000 Y19.200 E112.65239 F2400
+G1 X-1.673 Y19.127 E112.70783 F2400
+G1 X-3.334 Y18.908 E112.76327 F2400
+G1 X-4.969 Y18.546 E112.81871 F2400
+G1 X-6.567 Y18.042 E112.87416 F2400
+G1 X-8.114 Y17.401 E112.92960 F2400
+G1 X-9.600 Y16.628 E112.98504 F2400
+G1 X-11.013 Y15.728 E113.04048 F2400
+G1 X-12.342 Y14.708 E113.09592 F2400
+G1 X-13.576 Y13.576 E113.15136 F2400
+G1 X-14.708 Y12.342 E113.20681 F2400
+G1 X-15.728 Y11.013 E113.26225 F2400
+G1 X-16.628 Y9.600 E113.31769 F2400
+G1 X-17.401 Y8.114 E113.37313 F2400
+G1 X-18.042 Y6.567 E113.42857 F2400
+G1 X-18.546 Y4.969 E113.48402 F2400
+G1 X-18.908 Y3.334 E113.53946 F2400
+G1 X-19.127 Y1.673 E113.59490 F2400
+G1 X-19.200 Y0.000 E113.65034 F2400
+G1 X-19.127 Y-1.673 E113.70578 F2400
+G1 X-18.908 Y-3.334 E113.76123 F2400
+G1 X-18.546 Y-4.969 E113.81667 F2400
+G1 X-18.042 Y-6.567 E113.87211 F2400
+G1 X-17.401 Y-8.114 E113.92755 F2400
+G1 X-16.628 Y-9.600 E113.98299 F2400
+G1 X-15.728 Y-11.013 E114.03844 F2400
+G1 X-14.708 Y-12.342 E114.09388 F2400
+G1 X-13.576 Y-13.576 E114.14932 F2400
+G1 X-12.342 Y-14.708 E114.20476 F2400
+G1 X-11.013 Y-15.728 E114.26020 F2400
+G1 X-9.600 Y-16.628 E114.31565 F2400
+G1 X-8.114 Y-17.401 E114.37109 F2400
+G1 X-6.567 Y-18.042 E114.42653 F2400
+G1 X-4.969 Y-18.546 E114.48197 F2400
+G1 X-3.334 Y-18.908 E114.53741 F2400
+G1 X-1.673 Y-19.127 E114.59286 F2400
+G1 X-0.000 Y-19.200 E114.64830 F2400
+G1 X1.673 Y-19.127 E114.70374 F2400
+G1 X3.334 Y-18.908 E114.75918 F2400
+G1 X4.969 Y-18.546 E114.81462 F2400
+G1 X6.567 Y-18.042 E114.87007 F2400
+G1 X8.114 Y-17.401 E114.92551 F2400
+G1 X9.600 Y-16.628 E114.98095 F2400
+G1 X11.013 Y-15.728 E115.03639 F2400
+G1 X12.342 Y-14.708 E115.09183 F2400
+G1 X13.576 Y-13.576 E115.14728 F2400
+G1 X14.708 Y-12.342 E115.20272 F2400
+G1 X15.728 Y-11.013 E115.25816 F2400
+G1 X16.628 Y-9.600 E115.31360 F2400
+G1 X17.401 Y-8.114 E115.36904 F2400
+G1 X18.042 Y-6.567 E115.42449 F2400
+G1 X18.546 Y-4.969 E115.47993 F2400
+G1 X18.908 Y-3.334 E115.53537 F2400
+G1 X19.127 Y-1.673 E115.59081 F2400
+G1 X19.200 Y-0.000 E115.64625 F2400
+G1 E114.64625 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E115.64625 F2400
+G1 X-12.000 Y12.000 E116.44065 F3600
+G1 X-11.200 Y12.000 E116.46713 F3600
+G1 X-11.200 Y-12.000 E117.26153 F3600
+G1 X-10.400 Y-12.000 E117.28801 F3600
+G1 X-10.400 Y12.000 E118.08241 F3600
+G1 X-9.600 Y12.000 E118.10889 F3600
+G1 X-9.600 Y-12.000 E118.90329 F3600
+G1 X-8.800 Y-12.000 E118.92977 F3600
+G1 X-8.800 Y12.000 E119.72417 F3600
+G1 X-8.000 Y12.000 E119.75065 F3600
+G1 X-8.000 Y-12.000 E120.54505 F3600
+G1 X-7.200 Y-12.000 E120.57153 F3600
+G1 X-7.200 Y12.000 E121.36593 F3600
+G1 X-6.400 Y12.000 E121.39241 F3600
+G1 X-6.400 Y-12.000 E122.18681 F3600
+G1 X-5.600 Y-12.000 E122.21329 F3600
+G1 X-5.600 Y12.000 E123.00769 F3600
+G1 X-4.800 Y12.000 E123.03417 F3600
+G1 X-4.800 Y-12.000 E123.82857 F3600
+G1 X-4.000 Y-12.000 E123.85505 F3600
+G1 X-4.000 Y12.000 E124.64945 F3600
+G1 X-3.200 Y12.000 E124.67593 F3600
+G1 X-3.200 Y-12.000 E125.47033 F3600
+G1 X-2.400 Y-12.000 E125.49681 F3600
+G1 X-2.400 Y12.000 E126.29121 F3600
+G1 X-1.600 Y12.000 E126.31769 F3600
+G1 X-1.600 Y-12.000 E127.11209 F3600
+G1 X-0.800 Y-12.000 E127.13857 F3600
+G1 X-0.800 Y12.000 E127.93297 F3600
+G1 X0.000 Y12.000 E127.95945 F3600
+G1 X0.000 Y-12.000 E128.75385 F3600
+G1 X0.800 Y-12.000 E128.78033 F3600
+G1 X0.800 Y12.000 E129.57473 F3600
+G1 X1.600 Y12.000 E129.60121 F3600
+G1 X1.600 Y-12.000 E130.39561 F3600
+G1 X2.400 Y-12.000 E130.42209 F3600
+G1 X2.400 Y12.000 E131.21649 F3600
+G1 X3.200 Y12.000 E131.24297 F3600
+G1 X3.200 Y-12.000 E132.03737 F3600
+G1 X4.000 Y-12.000 E132.06385 F3600
+G1 X4.000 Y12.000 E132.85825 F3600
+G1 X4.800 Y12.000 E132.88473 F3600
+G1 X4.800 Y-12.000 E133.67913 F3600
+G1 X5.600 Y-12.000 E133.70561 F3600
+G1 X5.600 Y12.000 E134.50001 F3600
+G1 X6.400 Y12.000 E134.52649 F3600
+G1 X6.400 Y-12.000 E135.32089 F3600
+G1 X7.200 Y-12.000 E135.34737 F3600
+G1 X7.200 Y12.000 E136.14177 F3600
+G1 X8.000 Y12.000 E136.16825 F3600
+G1 X8.000 Y-12.000 E136.96265 F3600
+G1 X8.800 Y-12.000 E136.98913 F3600
+G1 X8.800 Y12.000 E137.78353 F3600
+G1 X9.600 Y12.000 E137.81001 F3600
+G1 X9.600 Y-12.000 E138.60441 F3600
+G1 X10.400 Y-12.000 E138.63089 F3600
+G1 X10.400 Y12.000 E139.42529 F3600
+G1 X11.200 Y12.000 E139.45177 F3600
+G1 X11.200 Y-12.000 E140.24617 F3600
+G1 X12.000 Y-12.000 E140.27265 F3600
+G1 X12.000 Y12.000 E141.06705 F3600
+;LAYER:16
+G1 Z3.40 F1200
+G1 E140.06705 F2400
+G1 X20.000 Y0.000 F9000
+G1 E141.06705 F2400
+G1 X19.924 Y1.743 E141.12481 F1800
+G1 X19.696 Y3.473 E141.18256 F1800
+G1 X19.319 Y5.176 E141.24031 F1800
+G1 X18.794 Y6.840 E141.29806 F1800
+G1 X18.126 Y8.452 E141.35581 F1800
+G1 X17.321 Y10.000 E141.41357 F1800
+G1 X16.383 Y11.472 E141.47132 F1800
+G1 X15.321 Y12.856 E141.52907 F1800
+G1 X14.142 Y14.142 E141.58682 F1800
+G1 X12.856 Y15.321 E141.64458 F1800
+G1 X11.472 Y16.383 E141.70233 F1800
+G1 X10.000 Y17.321 E141.76008 F1800
+G1 X8.452 Y18.126 E141.81783 F1800
+G1 X6.840 Y18.794 E141.87558 F1800
+G1 X5.176 Y19.319 E141.93334 F1800
+G1 X3.473 Y19.696 E141.99109 F1800
+G1 X1.743 Y19.924 E142.04884 F1800
+G1 X0.000 Y20.000 E142.10659 F1800
+G1 X-1.743 Y19.924 E142.16434 F1800
+G1 X-3.473 Y19.696 E142.22210 F1800
+G1 X-5.176 Y19.319 E142.27985 F1800
+G1 X-6.840 Y18.794 E142.33760 F1800
+G1 X-8.452 Y18.126 E142.39535 F1800
+G1 X-10.000 Y17.321 E142.45310 F1800
+G1 X-11.472 Y16.383 E142.51086 F1800
+G1 X-12.856 Y15.321 E142.56861 F1800
+G1 X-14.142 Y14.142 E142.62636 F1800
+G1 X-15.321 Y12.856 E142.68411 F1800
+G1 X-16.383 Y11.472 E142.74186 F1800
+G1 X-17.321 Y10.000 E142.79962 F1800
+G1 X-18.126 Y8.452 E142.85737 F1800
+G1 X-18.794 Y6.840 E142.91512 F1800
+G1 X-19.319 Y5.176 E142.97287 F1800
+G1 X-19.696 Y3.473 E143.03062 F1800
+G1 X-19.924 Y1.743 E143.08838 F1800
+G1 X-20.000 Y0.000 E143.14613 F1800
+G1 X-19.924 Y-1.743 E143.20388 F1800
+G1 X-19.696 Y-3.473 E143.26163 F1800
+G1 X-19.319 Y-5.176 E143.31939 F1800
+G1 X-18.794 Y-6.840 E143.37714 F1800
+G1 X-18.126 Y-8.452 E143.43489 F1800
+G1 X-17.321 Y-10.000 E143.49264 F1800
+G1 X-16.383 Y-11.472 E143.55039 F1800
+G1 X-15.321 Y-12.856 E143.60815 F1800
+G1 X-14.142 Y-14.142 E143.66590 F1800
+G1 X-12.856 Y-15.321 E143.72365 F1800
+G1 X-11.472 Y-16.383 E143.78140 F1800
+G1 X-10.000 Y-17.321 E143.83915 F1800
+G1 X-8.452 Y-18.126 E143.89691 F1800
+G1 X-6.840 Y-18.794 E143.95466 F1800
+G1 X-5.176 Y-19.319 E144.01241 F1800
+G1 X-3.473 Y-19.696 E144.07016 F1800
+G1 X-1.743 Y-19.924 E144.12791 F1800
+G1 X-0.000 Y-20.000 E144.18567 F1800
+G1 X1.743 Y-19.924 E144.24342 F1800
+G1 X3.473 Y-19.696 E144.30117 F1800
+G1 X5.176 Y-19.319 E144.35892 F1800
+G1 X6.840 Y-18.794 E144.41667 F1800
+G1 X8.452 Y-18.126 E144.47443 F1800
+G1 X10.000 Y-17.321 E144.53218 F1800
+G1 X11.472 Y-16.383 E144.58993 F1800
+G1 X12.856 Y-15.321 E144.64768 F1800
+G1 X14.142 Y-14.142 E144.70543 F1800
+G1 X15.321 Y-12.856 E144.76319 F1800
+G1 X16.383 Y-11.472 E144.82094 F1800
+G1 X17.321 Y-10.000 E144.87869 F1800
+G1 X18.126 Y-8.452 E144.93644 F1800
+G1 X18.794 Y-6.840 E144.99419 F1800
+G1 X19.319 Y-5.176 E145.05195 F1800
+G1 X19.696 Y-3.473 E145.10970 F1800
+G1 X19.924 Y-1.743 E145.16745 F1800
+G1 X20.000 Y-0.000 E145.22520 F1800
+G1 X19.525 Y1.708 E145.28389 F2400
+G1 X19.302 Y3.404 E145.34048 F2400
+G1 X18.932 Y5.073 E145.39708 F2400
+G1 X18.418 Y6.704 E145.45368 F2400
+G1 X17.764 Y8.283 E145.51028 F2400
+G1 X16.974 Y9.800 E145.56687 F2400
+G1 X16.055 Y11.242 E145.62347 F2400
+G1 X15.014 Y12.599 E145.68007 F2400
+G1 X13.859 Y13.859 E145.73666 F2400
+G1 X12.599 Y15.014 E145.79326 F2400
+G1 X11.242 Y16.055 E145.84986 F2400
+G1 X9.800 Y16.974 E145.90646 F2400
+G1 X8.283 Y17.764 E145.96305 F2400
+G1 X6.704 Y18.418 E146.01965 F2400
+G1 X5.073 Y18.932 E146.07625 F2400
+G1 X3.404 Y19.302 E146.13284 F2400
+G1 X1.708 Y19.525 E146.18944 F2400
+G1 X0.000 Y19.600 E146.24604 F2400
+G1 X-1.708 Y19.525 E146.30263 F2400
+G1 X-3.404 Y19.302 E146.35923 F2400
+G1 X-5.073 Y18.932 E146.41583 F2400
+G1 X-6.704 Y18.418 E146.47243 F2400
+G1 X-8.283 Y17.764 E146.52902 F2400
+G1 X-9.800 Y16.974 E146.58562 F2400
+G1 X-11.242 Y16.055 E146.64222 F2400
+G1 X-12.599 Y15.014 E146.69881 F2400
+G1 X-13.859 Y13.859 E146.75541 F2400
+G1 X-15.014 Y12.599 E146.81201 F2400
+G1 X-16.055 Y11.242 E146.86860 F2400
+G1 X-16.974 Y9.800 E146.92520 F2400
+G1 X-17.764 Y8.283 E146.98180 F2400
+G1 X-18.418 Y6.704 E147.03840 F2400
+G1 X-18.932 Y5.073 E147.09499 F2400
+G1 X-19.302 Y3.404 E147.15159 F2400
+G1 X-19.525 Y1.708 E147.20819 F2400
+G1 X-19.600 Y0.000 E147.26478 F2400
+G1 X-19.525 Y-1.708 E147.32138 F2400
+G1 X-19.302 Y-3.404 E147.37798 F2400
+G1 X-18.932 Y-5.073 E147.43458 F2400
+G1 X-18.418 Y-6.704 E147.49117 F2400
+G1 X-17.764 Y-8.283 E147.54777 F2400
+G1 X-16.974 Y-9.800 E147.60437 F2400
+G1 X-16.055 Y-11.242 E147.66096 F2400
+G1 X-15.014 Y-12.599 E147.71756 F2400
+G1 X-13.859 Y-13.859 E147.77416 F2400
+G1 X-12.599 Y-15.014 E147.83075 F2400
+G1 X-11.242 Y-16.055 E147.88735 F2400
+G1 X-9.800 Y-16.974 E147.94395 F2400
+G1 X-8.283 Y-17.764 E148.00055 F2400
+G1 X-6.704 Y-18.418 E148.05714 F2400
+G1 X-5.073 Y-18.932 E148.11374 F2400
+G1 X-3.404 Y-19.302 E148.17034 F2400
+G1 X-1.708 Y-19.525 E148.22693 F2400
+G1 X-0.000 Y-19.600 E148.28353 F2400
+G1 X1.708 Y-19.525 E148.34013 F2400
+G1 X3.404 Y-19.302 E148.39672 F2400
+G1 X5.073 Y-18.932 E148.45332 F2400
+G1 X6.704 Y-18.418 E148.50992 F2400
+G1 X8.283 Y-17.764 E148.56652 F2400
+G1 X9.800 Y-16.974 E148.62311 F2400
+G1 X11.242 Y-16.055 E148.67971 F2400
+G1 X12.599 Y-15.014 E148.73631 F2400
+G1 X13.859 Y-13.859 E148.79290 F2400
+G1 X15.014 Y-12.599 E148.84950 F2400
+G1 X16.055 Y-11.242 E148.90610 F2400
+G1 X16.974 Y-9.800 E148.96269 F2400
+G1 X17.764 Y-8.283 E149.01929 F2400
+G1 X18.418 Y-6.704 E149.07589 F2400
+G1 X18.932 Y-5.073 E149.13249 F2400
+G1 X19.302 Y-3.404 E149.18908 F2400
+G1 X19.525 Y-1.708 E149.24568 F2400
+G1 X19.600 Y-0.000 E149.30228 F2400
+G1 X19.127 Y1.673 E149.35984 F2400
+G1 X18.908 Y3.334 E149.41528 F2400
+G1 X18.546 Y4.969 E149.47072 F2400
+G1 X18.042 Y6.567 E149.52616 F2400
+G1 X17.401 Y8.114 E149.58160 F2400
+G1 X16.628 Y9.600 E149.63705 F2400
+G1 X15.728 Y11.013 E149.69249 F2400
+G1 X14.708 Y12.342 E149.74793 F2400
+G1 X13.576 Y13.576 E149.80337 F2400
+G1 X12.342 Y14.708 E149.85881 F2400
+G1 X11.013 Y15.728 E149.91426 F2400
+G1 X9.600 Y16.628 E149.96970 F2400
+G1 X8.114 Y17.401 E150.02514 F2400
+G1 X6.567 Y18.042 E150.08058 F2400
+G1 X4.969 Y18.546 E150.13602 F2400
+G1 X3.334 Y18.908 E150.19147 F2400
+G1 X1.673 Y19.127 E150.24691 F2400
+G1 X0.000 Y19.200 E150.30235 F2400
+G1 X-1.673 Y19.127 E150.35779 F2400
+G1 X-3.334 Y18.908 E150.41323 F2400
+G1 X-4.969 Y18.546 E150.46868 F2400
+G1 X-6.567 Y18.042 E150.52412 F2400
+G1 X-8.114 Y17.401 E150.57956 F2400
+G1 X-9.600 Y16.628 E150.63500 F2400
+G1 X-11.013 Y15.728 E150.69044 F2400
+G1 X-12.342 Y14.708 E150.74589 F2400
+G1 X-13.576 Y13.576 E150.80133 F2400
+G1 X-14.708 Y12.342 E150.85677 F2400
+G1 X-15.728 Y11.013 E150.91221 F2400
+G1 X-16.628 Y9.600 E150.96765 F2400
+G1 X-17.401 Y8.114 E151.02310 F2400
+G1 X-18.042 Y6.567 E151.07854 F2400
+G1 X-18.546 Y4.969 E151.13398 F2400
+G1 X-18.908 Y3.334 E151.18942 F2400
+G1 X-19.127 Y1.673 E151.24486 F2400
+G1 X-19.200 Y0.000 E151.30031 F2400
+G1 X-19.127 Y-1.673 E151.35575 F2400
+G1 X-18.908 Y-3.334 E151.41119 F2400
+G1 X-18.546 Y-4.969 E151.46663 F2400
+G1 X-18.042 Y-6.567 E151.52207 F2400
+G1 X-17.401 Y-8.114 E151.57752 F2400
+G1 X-16.628 Y-9.600 E151.63296 F2400
+G1 X-15.728 Y-11.013 E151.68840 F2400
+G1 X-14.708 Y-12.342 E151.74384 F2400
+G1 X-13.576 Y-13.576 E151.79928 F2400
+G1 X-12.342 Y-14.708 E151.85473 F2400
+G1 X-11.013 Y-15.728 E151.91017 F2400
+G1 X-9.600 Y-16.628 E151.96561 F2400
+G1 X-8.114 Y-17.401 E152.02105 F2400
+G1 X-6.567 Y-18.042 E152.07649 F2400
+G1 X-4.969 Y-18.546 E152.13194 F2400
+G1 X-3.334 Y-18.908 E152.18738 F2400
+G1 X-1.673 Y-19.127 E152.24282 F2400
+G1 X-0.000 Y-19.200 E152.29826 F2400
+G1 X1.673 Y-19.127 E152.35370 F2400
+G1 X3.334 Y-18.908 E152.40915 F2400
+G1 X4.969 Y-18.546 E152.46459 F2400
+G1 X6.567 Y-18.042 E152.52003 F2400
+G1 X8.114 Y-17.401 E152.57547 F2400
+G1 X9.600 Y-16.628 E152.63091 F2400
+G1 X11.013 Y-15.728 E152.68636 F2400
+G1 X12.342 Y-14.708 E152.74180 F2400
+G1 X13.576 Y-13.576 E152.79724 F2400
+G1 X14.708 Y-12.342 E152.85268 F2400
+G1 X15.728 Y-11.013 E152.90812 F2400
+G1 X16.628 Y-9.600 E152.96357 F2400
+G1 X17.401 Y-8.114 E153.01901 F2400
+G1 X18.042 Y-6.567 E153.07445 F2400
+G1 X18.546 Y-4.969 E153.12989 F2400
+G1 X18.908 Y-3.334 E153.18533 F2400
+G1 X19.127 Y-1.673 E153.24078 F2400
+G1 X19.200 Y-0.000 E153.29622 F2400
+G1 E152.29622 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E153.29622 F2400
+G1 X12.000 Y-12.000 E154.09062 F3600
+G1 X12.000 Y-11.000 E154.12372 F3600
+G1 X-12.000 Y-11.000 E154.91812 F3600
+G1 X-12.000 Y-10.000 E154.95122 F3600
+G1 X12.000 Y-10.000 E155.74562 F3600
+G1 X12.000 Y-9.000 E155.77872 F3600
+G1 X-12.000 Y-9.000 E156.57312 F3600
+G1 X-12.000 Y-8.000 E156.60622 F3600
+G1 X12.000 Y-8.000 E157.40062 F3600
+G1 X12.000 Y-7.000 E157.43372 F3600
+G1 X-12.000 Y-7.000 E158.22812 F3600
+G1 X-12.000 Y-6.000 E158.26122 F3600
+G1 X12.000 Y-6.000 E159.05562 F3600
+G1 X12.000 Y-5.000 E159.08872 F3600
+G1 X-12.000 Y-5.000 E159.88312 F3600
+G1 X-12.000 Y-4.000 E159.91622 F3600
+G1 X12.000 Y-4.000 E160.71062 F3600
+G1 X12.000 Y-3.000 E160.74372 F3600
+G1 X-12.000 Y-3.000 E161.53812 F3600
+G1 X-12.000 Y-2.000 E161.57122 F3600
+G1 X12.000 Y-2.000 E162.36562 F3600
+G1 X12.000 Y-1.000 E162.39872 F3600
+G1 X-12.000 Y-1.000 E163.19312 F3600
+G1 X-12.000 Y0.000 E163.22622 F3600
+G1 X12.000 Y0.000 E164.02062 F3600
+G1 X12.000 Y1.000 E164.05372 F3600
+G1 X-12.000 Y1.000 E164.84812 F3600
+G1 X-12.000 Y2.000 E164.88122 F3600
+G1 X12.000 Y2.000 E165.67562 F3600
+G1 X12.000 Y3.000 E165.70872 F3600
+G1 X-12.000 Y3.000 E166.50312 F3600
+G1 X-12.000 Y4.000 E166.53622 F3600
+G1 X12.000 Y4.000 E167.33062 F3600
+G1 X12.000 Y5.000 E167.36372 F3600
+G1 X-12.000 Y5.000 E168.15812 F3600
+G1 X-12.000 Y6.000 E168.19122 F3600
+G1 X12.000 Y6.000 E168.98562 F3600
+G1 X12.000 Y7.000 E169.01872 F3600
+G1 X-12.000 Y7.000 E169.81312 F3600
+G1 X-12.000 Y8.000 E169.84622 F3600
+G1 X12.000 Y8.000 E170.64062 F3600
+G1 X12.000 Y9.000 E170.67372 F3600
+G1 X-12.000 Y9.000 E171.46812 F3600
+G1 X-12.000 Y10.000 E171.50122 F3600
+G1 X12.000 Y10.000 E172.29562 F3600
+G1 X12.000 Y11.000 E172.32872 F3600
+G1 X-12.000 Y11.000 E173.12312 F3600
+G1 X-12.000 Y12.000 E173.15622 F3600
+G1 X12.000 Y12.000 E173.95062 F3600
+;LAYER:17
+G1 Z3.60 F1200
+G1 E172.95062 F2400
+G1 X20.000 Y0.000 F9000
+G1 E173.95062 F2400
+G1 X19.924 Y1.743 E174.00837 F1800
+G1 X19.696 Y3.473 E174.06612 F1800
+G1 X19.319 Y5.176 E174.12387 F1800
+G1 X18.794 Y6.840 E174.18163 F1800
+G1 X18.126 Y8.452 E174.23938 F1800
+G1 X17.321 Y10.000 E174.29713 F1800
+G1 X16.383 Y11.472 E174.35488 F1800
+G1 X15.321 Y12.856 E174.41263 F1800
+G1 X14.142 Y14.142 E174.47039 F1800
+G1 X12.856 Y15.321 E174.52814 F1800
+G1 X11.472 Y16.383 E174.58589 F1800
+G1 X10.000 Y17.321 E174.64364 F1800
+G1 X8.452 Y18.126 E174.70139 F1800
+G1 X6.840 Y18.794 E174.75915 F1800
+G1 X5.176 Y19.319 E174.81690 F1800
+G1 X3.473 Y19.696 E174.87465 F1800
+G1 X1.743 Y19.924 E174.93240 F1800
+G1 X0.000 Y20.000 E174.99016 F1800
+G1 X-1.743 Y19.924 E175.04791 F1800
+G1 X-3.473 Y19.696 E175.10566 F1800
+G1 X-5.176 Y19.319 E175.16341 F1800
+G1 X-6.840 Y18.794 E175.22116 F1800
+G1 X-8.452 Y18.126 E175.27892 F1800
+G1 X-10.000 Y17.321 E175.33667 F1800
+G1 X-11.472 Y16.383 E175.39442 F1800
+G1 X-12.856 Y15.321 E175.45217 F1800
+G1 X-14.142 Y14.142 E175.50992 F1800
+G1 X-15.321 Y12.856 E175.56768 F1800
+G1 X-16.383 Y11.472 E175.62543 F1800
+G1 X-17.321 Y10.000 E175.68318 F1800
+G1 X-18.126 Y8.452 E175.74093 F1800
+G1 X-18.794 Y6.840 E175.79868 F1800
+G1 X-19.319 Y5.176 E175.85644 F1800
+G1 X-19.696 Y3.473 E175.91419 F1800
+G1 X-19.924 Y1.743 E175.97194 F1800
+G1 X-20.000 Y0.000 E176.02969 F1800
+G1 X-19.924 Y-1.743 E176.08744 F1800
+G1 X-19.696 Y-3.473 E176.14520 F1800
+G1 X-19.319 Y-5.176 E176.20295 F1800
+G1 X-18.794 Y-6.840 E176.26070 F1800
+G1 X-18.126 Y-8.452 E176.31845 F1800
+G1 X-17.321 Y-10.000 E176.37620 F1800
+G1 X-16.383 Y-11.472 E176.43396 F1800
+G1 X-15.321 Y-12.856 E176.49171 F1800
+G1 X-14.142 Y-14.142 E176.54946 F1800
+G1 X-12.856 Y-15.321 E176.60721 F1800
+G1 X-11.472 Y-16.383 E176.66497 F1800
+G1 X-10.000 Y-17.321 E176.72272 F1800
+G1 X-8.452 Y-18.126 E176.78047 F1800
+G1 X-6.840 Y-18.794 E176.83822 F1800
+G1 X-5.176 Y-19.319 E176.89597 F1800
+G1 X-3.473 Y-19.696 E176.95373 F1800
+G1 X-1.743 Y-19.924 E177.01148 F1800
+G1 X-0.000 Y-20.000 E177.06923 F1800
+G1 X1.743 Y-19.924 E177.12698 F1800
+G1 X3.473 Y-19.696 E177.18473 F1800
+G1 X5.176 Y-19.319 E177.24249 F1800
+G1 X6.840 Y-18.794 E177.30024 F1800
+G1 X8.452 Y-18.126 E177.35799 F1800
+G1 X10.000 Y-17.321 E177.41574 F1800
+G1 X11.472 Y-16.383 E177.47349 F1800
+G1 X12.856 Y-15.321 E177.53125 F1800
+G1 X14.142 Y-14.142 E177.58900 F1800
+G1 X15.321 Y-12.856 E177.64675 F1800
+G1 X16.383 Y-11.472 E177.70450 F1800
+G1 X17.321 Y-10.000 E177.76225 F1800
+G1 X18.126 Y-8.452 E177.82001 F1800
+G1 X18.794 Y-6.840 E177.87776 F1800
+G1 X19.319 Y-5.176 E177.93551 F1800
+G1 X19.696 Y-3.473 E177.99326 F1800
+G1 X19.924 Y-1.743 E178.05101 F1800
+G1 X20.000 Y-0.000 E178.10877 F1800
+G1 X19.525 Y1.708 E178.16745 F2400
+G1 X19.302 Y3.404 E178.22405 F2400
+G1 X18.932 Y5.073 E178.28065 F2400
+G1 X18.418 Y6.704 E178.33724 F2400
+G1 X17.764 Y8.283 E178.39384 F2400
+G1 X16.974 Y9.800 E178.45044 F2400
+G1 X16.055 Y11.242 E178.50703 F2400
+G1 X15.014 Y12.599 E178.56363 F2400
+G1 X13.859 Y13.859 E178.62023 F2400
+G1 X12.599 Y15.014 E178.67682 F2400
+G1 X11.242 Y16.055 E178.73342 F2400
+G1 X9.800 Y16.974 E178.79002 F2400
+G1 X8.283 Y17.764 E178.84662 F2400
+G1 X6.704 Y18.418 E178.90321 F2400
+G1 X5.073 Y18.932 E178.95981 F2400
+G1 X3.404 Y19.302 E179.01641 F2400
+G1 X1.708 Y19.525 E179.07300 F2400
+G1 X0.000 Y19.600 E179.12960 F2400
+G1 X-1.708 Y19.525 E179.18620 F2400
+G1 X-3.404 Y19.302 E179.24280 F2400
+G1 X-5.073 Y18.932 E179.29939 F2400
+G1 X-6.704 Y18.418 E179.35599 F2400
+G1 X-8.283 Y17.764 E179.41259 F2400
+G1 X-9.800 Y16.974 E179.46918 F2400
+G1 X-11.242 Y16.055 E179.52578 F2400
+G1 X-12.599 Y15.014 E179.58238 F2400
+G1 X-13.859 Y13.859 E179.63897 F2400
+G1 X-15.014 Y12.599 E179.69557 F2400
+G1 X-16.055 Y11.242 E179.75217 F2400
+G1 X-16.974 Y9.800 E179.80877 F2400
+G1 X-17.764 Y8.283 E179.86536 F2400
+G1 X-18.418 Y6.704 E179.92196 F2400
+G1 X-18.932 Y5.073 E179.97856 F2400
+G1 X-19.302 Y3.404 E180.03515 F2400
+G1 X-19.525 Y1.708 E180.09175 F2400
+G1 X-19.600 Y0.000 E180.14835 F2400
+G1 X-19.525 Y-1.708 E180.20494 F2400
+G1 X-19.302 Y-3.404 E180.26154 F2400
+G1 X-18.932 Y-5.073 E180.31814 F2400
+G1 X-18.418 Y-6.704 E180.37474 F2400
+G1 X-17.764 Y-8.283 E180.43133 F2400
+G1 X-16.974 Y-9.800 E180.48793 F2400
+G1 X-16.055 Y-11.242 E180.54453 F2400
+G1 X-15.014 Y-12.599 E180.60112 F2400
+G1 X-13.859 Y-13.859 E180.65772 F2400
+G1 X-12.599 Y-15.014 E180.71432 F2400
+G1 X-11.242 Y-16.055 E180.77091 F2400
+G1 X-9.800 Y-16.974 E180.82751 F2400
+G1 X-8.283 Y-17.764 E180.88411 F2400
+G1 X-6.704 Y-18.418 E180.94071 F2400
+G1 X-5.073 Y-18.932 E180.99730 F2400
+G1 X-3.404 Y-19.302 E181.05390 F2400
+G1 X-1.708 Y-19.525 E181.11050 F2400
+G1 X-0.000 Y-19.600 E181.16709 F2400
+G1 X1.708 Y-19.525 E181.22369 F2400
+G1 X3.404 Y-19.302 E181.28029 F2400
+G1 X5.073 Y-18.932 E181.33689 F2400
+G1 X6.704 Y-18.418 E181.39348 F2400
+G1 X8.283 Y-17.764 E181.45008 F2400
+G1 X9.800 Y-16.974 E181.50668 F2400
+G1 X11.242 Y-16.055 E181.56327 F2400
+G1 X12.599 Y-15.014 E181.61987 F2400
+G1 X13.859 Y-13.859 E181.67647 F2400
+G1 X15.014 Y-12.599 E181.73306 F2400
+G1 X16.055 Y-11.242 E181.78966 F2400
+G1 X16.974 Y-9.800 E181.84626 F2400
+G1 X17.764 Y-8.283 E181.90286 F2400
+G1 X18.418 Y-6.704 E181.95945 F2400
+G1 X18.932 Y-5.073 E182.01605 F2400
+G1 X19.302 Y-3.404 E182.07265 F2400
+G1 X19.525 Y-1.708 E182.12924 F2400
+G1 X19.600 Y-0.000 E182.18584 F2400
+G1 X19.127 Y1.673 E182.24340 F2400
+G1 X18.908 Y3.334 E182.29884 F2400
+G1 X18.546 Y4.969 E182.35428 F2400
+G1 X18.042 Y6.567 E182.40973 F2400
+G1 X17.401 Y8.114 E182.46517 F2400
+G1 X16.628 Y9.600 E182.52061 F2400
+G1 X15.728 Y11.013 E182.57605 F2400
+G1 X14.708 Y12.342 E182.63149 F2400
+G1 X13.576 Y13.576 E182.68694 F2400
+G1 X12.342 Y14.708 E182.74238 F2400
+G1 X11.013 Y15.728 E182.79782 F2400
+G1 X9.600 Y16.628 E182.85326 F2400
+G1 X8.114 Y17.401 E182.90870 F2400
+G1 X6.567 Y18.042 E182.96415 F2400
+G1 X4.969 Y18.546 E183.01959 F2400
+G1 X3.334 Y18.908 E183.07503 F2400
+G1 X1.673 Y19.127 E183.13047 F2400
+G1 X0.000 Y19.200 E183.18591 F2400
+G1 X-1.673 Y19.127 E183.24136 F2400
+G1 X-3.334 Y18.908 E183.29680 F2400
+G1 X-4.969 Y18.546 E183.35224 F2400
+G1 X-6.567 Y18.042 E183.40768 F2400
+G1 X-8.114 Y17.401 E183.46312 F2400
+G1 X-9.600 Y16.628 E183.51857 F2400
+G1 X-11.013 Y15.728 E183.57401 F2400
+G1 X-12.342 Y14.708 E183.62945 F2400
+G1 X-13.576 Y13.576 E183.68489 F2400
+G1 X-14.708 Y12.342 E183.74033 F2400
+G1 X-15.728 Y11.013 E183.79578 F2400
+G1 X-16.628 Y9.600 E183.85122 F2400
+G1 X-17.401 Y8.114 E183.90666 F2400
+G1 X-18.042 Y6.567 E183.96210 F2400
+G1 X-18.546 Y4.969 E184.01754 F2400
+G1 X-18.908 Y3.334 E184.07299 F2400
+G1 X-19.127 Y1.673 E184.12843 F2400
+G1 X-19.200 Y0.000 E184.18387 F2400
+G1 X-19.127 Y-1.673 E184.23931 F2400
+G1 X-18.908 Y-3.334 E184.29475 F2400
+G1 X-18.546 Y-4.969 E184.35020 F2400
+G1 X-18.042 Y-6.567 E184.40564 F2400
+G1 X-17.401 Y-8.114 E184.46108 F2400
+G1 X-16.628 Y-9.600 E184.51652 F2400
+G1 X-15.728 Y-11.013 E184.57196 F2400
+G1 X-14.708 Y-12.342 E184.62741 F2400
+G1 X-13.576 Y-13.576 E184.68285 F2400
+G1 X-12.342 Y-14.708 E184.73829 F2400
+G1 X-11.013 Y-15.728 E184.79373 F2400
+G1 X-9.600 Y-16.628 E184.84917 F2400
+G1 X-8.114 Y-17.401 E184.90462 F2400
+G1 X-6.567 Y-18.042 E184.96006 F2400
+G1 X-4.969 Y-18.546 E185.01550 F2400
+G1 X-3.334 Y-18.908 E185.07094 F2400
+G1 X-1.673 Y-19.127 E185.12638 F2400
+G1 X-0.000 Y-19.200 E185.18183 F2400
+G1 X1.673 Y-19.127 E185.23727 F2400
+G1 X3.334 Y-18.908 E185.29271 F2400
+G1 X4.969 Y-18.546 E185.34815 F2400
+G1 X6.567 Y-18.042 E185.40359 F2400
+G1 X8.114 Y-17.401 E185.45904 F2400
+G1 X9.600 Y-16.628 E185.51448 F2400
+G1 X11.013 Y-15.728 E185.56992 F2400
+G1 X12.342 Y-14.708 E185.62536 F2400
+G1 X13.576 Y-13.576 E185.68080 F2400
+G1 X14.708 Y-12.342 E185.73625 F2400
+G1 X15.728 Y-11.013 E185.79169 F2400
+G1 X16.628 Y-9.600 E185.84713 F2400
+G1 X17.401 Y-8.114 E185.90257 F2400
+G1 X18.042 Y-6.567 E185.95801 F2400
+G1 X18.546 Y-4.969 E186.01346 F2400
+G1 X18.908 Y-3.334 E186.06890 F2400
+G1 X19.127 Y-1.673 E186.12434 F2400
+G1 X19.200 Y-0.000 E186.17978 F2400
+G1 E185.17978 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E186.17978 F2400
+G1 X-12.000 Y12.000 E186.97418 F3600
+G1 X-11.200 Y12.000 E187.00066 F3600
+G1 X-11.200 Y-12.000 E187.79506 F3600
+G1 X-10.400 Y-12.000 E187.82154 F3600
+G1 X-10.400 Y12.000 E188.61594 F3600
+G1 X-9.600 Y12.000 E188.64242 F3600
+G1 X-9.600 Y-12.000 E189.43682 F3600
+G1 X-8.800 Y-12.000 E189.46330 F3600
+G1 X-8.800 Y12.000 E190.25770 F3600
+G1 X-8.000 Y12.000 E190.28418 F3600
+G1 X-8.000 Y-12.000 E191.07858 F3600
+G1 X-7.200 Y-12.000 E191.10506 F3600
+G1 X-7.200 Y12.000 E191.89946 F3600
+G1 X-6.400 Y12.000 E191.92594 F3600
+G1 X-6.400 Y-12.000 E192.72034 F3600
+G1 X-5.600 Y-12.000 E192.74682 F3600
+G1 X-5.600 Y12.000 E193.54122 F3600
+G1 X-4.800 Y12.000 E193.56770 F3600
+G1 X-4.800 Y-12.000 E194.36210 F3600
+G1 X-4.000 Y-12.000 E194.38858 F3600
+G1 X-4.000 Y12.000 E195.18298 F3600
+G1 X-3.200 Y12.000 E195.20946 F3600
+G1 X-3.200 Y-12.000 E196.00386 F3600
+G1 X-2.400 Y-12.000 E196.03034 F3600
+G1 X-2.400 Y12.000 E196.82474 F3600
+G1 X-1.600 Y12.000 E196.85122 F3600
+G1 X-1.600 Y-12.000 E197.64562 F3600
+G1 X-0.800 Y-12.000 E197.67210 F3600
+G1 X-0.800 Y12.000 E198.46650 F3600
+G1 X0.000 Y12.000 E198.49298 F3600
+G1 X0.000 Y-12.000 E199.28738 F3600
+G1 X0.800 Y-12.000 E199.31386 F3600
+G1 X0.800 Y12.000 E200.10826 F3600
+G1 X1.600 Y12.000 E200.13474 F3600
+G1 X1.600 Y-12.000 E200.92914 F3600
+G1 X2.400 Y-12.000 E200.95562 F3600
+G1 X2.400 Y12.000 E201.75002 F3600
+G1 X3.200 Y12.000 E201.77650 F3600
+G1 X3.200 Y-12.000 E202.57090 F3600
+G1 X4.000 Y-12.000 E202.59738 F3600
+G1 X4.000 Y12.000 E203.39178 F3600
+G1 X4.800 Y12.000 E203.41826 F3600
+G1 X4.800 Y-12.000 E204.21266 F3600
+G1 X5.600 Y-12.000 E204.23914 F3600
+G1 X5.600 Y12.000 E205.03354 F3600
+G1 X6.400 Y12.000 E205.06002 F3600
+G1 X6.400 Y-12.000 E205.85442 F3600
+G1 X7.200 Y-12.000 E205.88090 F3600
+G1 X7.200 Y12.000 E206.67530 F3600
+G1 X8.000 Y12.000 E206.70178 F3600
+G1 X8.000 Y-12.000 E207.49618 F3600
+G1 X8.800 Y-12.000 E207.52266 F3600
+G1 X8.800 Y12.000 E208.31706 F3600
+G1 X9.600 Y12.000 E208.34354 F3600
+G1 X9.600 Y-12.000 E209.13794 F3600
+G1 X10.400 Y-12.000 E209.16442 F3600
+G1 X10.400 Y12.000 E209.95882 F3600
+G1 X11.200 Y12.000 E209.98530 F3600
+G1 X11.200 Y-12.000 E210.77970 F3600
+G1 X12.000 Y-12.000 E210.80618 F3600
+G1 X12.000 Y12.000 E211.60058 F3600
+;LAYER:18
+T1
+G92 E0
+G1 Z3.80 F1200
+G1 E-1.00000 F2400
+G1 X20.000 Y0.000 F9000
+G1 E0.00000 F2400
+G1 X19.924 Y1.743 E0.05775 F1800
+G1 X19.696 Y3.473 E0.11550 F1800
+G1 X19.319 Y5.176 E0.17326 F1800
+G1 X18.794 Y6.840 E0.23101 F1800
+G1 X18.126 Y8.452 E0.28876 F1800
+G1 X17.321 Y10.000 E0.34651 F1800
+G1 X16.383 Y11.472 E0.40426 F1800
+G1 X15.321 Y12.856 E0.46202 F1800
+G1 X14.142 Y14.142 E0.51977 F1800
+G1 X12.856 Y15.321 E0.57752 F1800
+G1 X11.472 Y16.383 E0.63527 F1800
+G1 X10.000 Y17.321 E0.69302 F1800
+G1 X8.452 Y18.126 E0.75078 F1800
+G1 X6.840 Y18.794 E0.80853 F1800
+G1 X5.176 Y19.319 E0.86628 F1800
+G1 X3.473 Y19.696 E0.92403 F1800
+G1 X1.743 Y19.924 E0.98179 F1800
+G1 X0.000 Y20.000 E1.03954 F1800
+G1 X-1.743 Y19.924 E1.09729 F1800
+G1 X-3.473 Y19.696 E1.15504 F1800
+G1 X-5.176 Y19.319 E1.21279 F1800
+G1 X-6.840 Y18.794 E1.27055 F1800
+G1 X-8.452 Y18.126 E1.32830 F1800
+G1 X-10.000 Y17.321 E1.38605 F1800
+G1 X-11.472 Y16.383 E1.44380 F1800
+G1 X-12.856 Y15.321 E1.50155 F1800
+G1 X-14.142 Y14.142 E1.55931 F1800
+G1 X-15.321 Y12.856 E1.61706 F1800
+G1 X-16.383 Y11.472 E1.67481 F1800
+G1 X-17.321 Y10.000 E1.73256 F1800
+G1 X-18.126 Y8.452 E1.79031 F1800
+G1 X-18.794 Y6.840 E1.84807 F1800
+G1 X-19.319 Y5.176 E1.90582 F1800
+G1 X-19.696 Y3.473 E1.96357 F1800
+G1 X-19.924 Y1.743 E2.02132 F1800
+G1 X-20.000 Y0.000 E2.07907 F1800
+G1 X-19.924 Y-1.743 E2.13683 F1800
+G1 X-19.696 Y-3.473 E2.19458 F1800
+G1 X-19.319 Y-5.176 E2.25233 F1800
+G1 X-18.794 Y-6.840 E2.31008 F1800
+G1 X-18.126 Y-8.452 E2.36783 F1800
+G1 X-17.321 Y-10.000 E2.42559 F1800
+G1 X-16.383 Y-11.472 E2.48334 F1800
+G1 X-15.321 Y-12.856 E2.54109 F1800
+G1 X-14.142 Y-14.142 E2.59884 F1800
+G1 X-12.856 Y-15.321 E2.65660 F1800
+G1 X-11.472 Y-16.383 E2.71435 F1800
+G1 X-10.000 Y-17.321 E2.77210 F1800
+G1 X-8.452 Y-18.126 E2.82985 F1800
+G1 X-6.840 Y-18.794 E2.88760 F1800
+G1 X-5.176 Y-19.319 E2.94536 F1800
+G1 X-3.473 Y-19.696 E3.00311 F1800
+G1 X-1.743 Y-19.924 E3.06086 F1800
+G1 X-0.000 Y-20.000 E3.11861 F1800
+G1 X1.743 Y-19.924 E3.17636 F1800
+G1 X3.473 Y-19.696 E3.23412 F1800
+G1 X5.176 Y-19.319 E3.29187 F1800
+G1 X6.840 Y-18.794 E3.34962 F1800
+G1 X8.452 Y-18.126 E3.40737 F1800
+G1 X10.000 Y-17.321 E3.46512 F1800
+G1 X11.472 Y-16.383 E3.52288 F1800
+G1 X12.856 Y-15.321 E3.58063 F1800
+G1 X14.142 Y-14.142 E3.63838 F1800
+G1 X15.321 Y-12.856 E3.69613 F1800
+G1 X16.383 Y-11.472 E3.75388 F1800
+G1 X17.321 Y-10.000 E3.81164 F1800
+G1 X18.126 Y-8.452 E3.86939 F1800
+G1 X18.794 Y-6.840 E3.92714 F1800
+G1 X19.319 Y-5.176 E3.98489 F1800
+G1 X19.696 Y-3.473 E4.04264 F1800
+G1 X19.924 Y-1.743 E4.10040 F1800
+G1 X20.000 Y-0.000 E4.15815 F1800
+G1 X19.525 Y1.708 E4.21683 F2400
+G1 X19.302 Y3.404 E4.27343 F2400
+G1 X18.932 Y5.073 E4.33003 F2400
+G1 X18.418 Y6.704 E4.38662 F2400
+G1 X17.764 Y8.283 E4.44322 F2400
+G1 X16.974 Y9.800 E4.49982 F2400
+G1 X16.055 Y11.242 E4.55642 F2400
+G1 X15.014 Y12.599 E4.61301 F2400
+G1 X13.859 Y13.859 E4.66961 F2400
+G1 X12.599 Y15.014 E4.72621 F2400
+G1 X11.242 Y16.055 E4.78280 F2400
+G1 X9.800 Y16.974 E4.83940 F2400
+G1 X8.283 Y17.764 E4.89600 F2400
+G1 X6.704 Y18.418 E4.95260 F2400
+G1 X5.073 Y18.932 E5.00919 F2400
+G1 X3.404 Y19.302 E5.06579 F2400
+G1 X1.708 Y19.525 E5.12239 F2400
+G1 X0.000 Y19.600 E5.17898 F2400
+G1 X-1.708 Y19.525 E5.23558 F2400
+G1 X-3.404 Y19.302 E5.29218 F2400
+G1 X-5.073 Y18.932 E5.34877 F2400
+G1 X-6.704 Y18.418 E5.40537 F2400
+G1 X-8.283 Y17.764 E5.46197 F2400
+G1 X-9.800 Y16.974 E5.51857 F2400
+G1 X-11.242 Y16.055 E5.57516 F2400
+G1 X-12.599 Y15.014 E5.63176 F2400
+G1 X-13.859 Y13.859 E5.68836 F2400
+G1 X-15.014 Y12.599 E5.74495 F2400
+G1 X-16.055 Y11.242 E5.80155 F2400
+G1 X-16.974 Y9.800 E5.85815 F2400
+G1 X-17.764 Y8.283 E5.91474 F2400
+G1 X-18.418 Y6.704 E5.97134 F2400
+G1 X-18.932 Y5.073 E6.02794 F2400
+G1 X-19.302 Y3.404 E6.08454 F2400
+G1 X-19.525 Y1.708 E6.14113 F2400
+G1 X-19.600 Y0.000 E6.19773 F2400
+G1 X-19.525 Y-1.708 E6.25433 F2400
+G1 X-19.302 Y-3.404 E6.31092 F2400
+G1 X-18.932 Y-5.073 E6.36752 F2400
+G1 X-18.418 Y-6.704 E6.42412 F2400
+G1 X-17.764 Y-8.283 E6.48071 F2400
+G1 X-16.974 Y-9.800 E6.53731 F2400
+G1 X-16.055 Y-11.242 E6.59391 F2400
+G1 X-15.014 Y-12.599 E6.65051 F2400
+G1 X-13.859 Y-13.859 E6.70710 F2400
+G1 X-12.599 Y-15.014 E6.76370 F2400
+G1 X-11.242 Y-16.055 E6.82030 F2400
+G1 X-9.800 Y-16.974 E6.87689 F2400
+G1 X-8.283 Y-17.764 E6.93349 F2400
+G1 X-6.704 Y-18.418 E6.99009 F2400
+G1 X-5.073 Y-18.932 E7.04669 F2400
+G1 X-3.404 Y-19.302 E7.10328 F2400
+G1 X-1.708 Y-19.525 E7.15988 F2400
+G1 X-0.000 Y-19.600 E7.21648 F2400
+G1 X1.708 Y-19.525 E7.27307 F2400
+G1 X3.404 Y-19.302 E7.32967 F2400
+G1 X5.073 Y-18.932 E7.38627 F2400
+G1 X6.704 Y-18.418 E7.44286 F2400
+G1 X8.283 Y-17.764 E7.49946 F2400
+G1 X9.800 Y-16.974 E7.55606 F2400
+G1 X11.242 Y-16.055 E7.61266 F2400
+G1 X12.599 Y-15.014 E7.66925 F2400
+G1 X13.859 Y-13.859 E7.72585 F2400
+G1 X15.014 Y-12.599 E7.78245 F2400
+G1 X16.055 Y-11.242 E7.83904 F2400
+G1 X16.974 Y-9.800 E7.89564 F2400
+G1 X17.764 Y-8.283 E7.95224 F2400
+G1 X18.418 Y-6.704 E8.00883 F2400
+G1 X18.932 Y-5.073 E8.06543 F2400
+G1 X19.302 Y-3.404 E8.12203 F2400
+G1 X19.525 Y-1.708 E8.17863 F2400
+G1 X19.600 Y-0.000 E8.23522 F2400
+G1 X19.127 Y1.673 E8.29278 F2400
+G1 X18.908 Y3.334 E8.34822 F2400
+G1 X18.546 Y4.969 E8.40367 F2400
+G1 X18.042 Y6.567 E8.45911 F2400
+G1 X17.401 Y8.114 E8.51455 F2400
+G1 X16.628 Y9.600 E8.56999 F2400
+G1 X15.728 Y11.013 E8.62543 F2400
+G1 X14.708 Y12.342 E8.68088 F2400
+G1 X13.576 Y13.576 E8.73632 F2400
+G1 X12.342 Y14.708 E8.79176 F2400
+G1 X11.013 Y15.728 E8.84720 F2400
+G1 X9.600 Y16.628 E8.90264 F2400
+G1 X8.114 Y17.401 E8.95809 F2400
+G1 X6.567 Y18.042 E9.01353 F2400
+G1 X4.969 Y18.546 E9.06897 F2400
+G1 X3.334 Y18.908 E9.12441 F2400
+G1 X1.673 Y19.127 E9.17985 F2400
+G1 X0.000 Y19.200 E9.23530 F2400
+G1 X-1.673 Y19.127 E9.29074 F2400
+G1 X-3.334 Y18.908 E9.34618 F2400
+G1 X-4.969 Y18.546 E9.40162 F2400
+G1 X-6.567 Y18.042 E9.45706 F2400
+G1 X-8.114 Y17.401 E9.51251 F2400
+G1 X-9.600 Y16.628 E9.56795 F2400
+G1 X-11.013 Y15.728 E9.62339 F2400
+G1 X-12.342 Y14.708 E9.67883 F2400
+G1 X-13.576 Y13.576 E9.73427 F2400
+G1 X-14.708 Y12.342 E9.78972 F2400
+G1 X-15.728 Y11.013 E9.84516 F2400
+G1 X-16.628 Y9.600 E9.90060 F2400
+G1 X-17.401 Y8.114 E9.95604 F2400
+G1 X-18.042 Y6.567 E10.01148 F2400
+G1 X-18.546 Y4.969 E10.06693 F2400
+G1 X-18.908 Y3.334 E10.12237 F2400
+G1 X-19.127 Y1.673 E10.17781 F2400
+G1 X-19.200 Y0.000 E10.23325 F2400
+G1 X-19.127 Y-1.673 E10.28869 F2400
+G1 X-18.908 Y-3.334 E10.34414 F2400
+G1 X-18.546 Y-4.969 E10.39958 F2400
+G1 X-18.042 Y-6.567 E10.45502 F2400
+G1 X-17.401 Y-8.114 E10.51046 F2400
+G1 X-16.628 Y-9.600 E10.56590 F2400
+G1 X-15.728 Y-11.013 E10.62135 F2400
+G1 X-14.708 Y-12.342 E10.67679 F2400
+G1 X-13.576 Y-13.576 E10.73223 F2400
+G1 X-12.342 Y-14.708 E10.78767 F2400
+G1 X-11.013 Y-15.728 E10.84311 F2400
+G1 X-9.600 Y-16.628 E10.89856 F2400
+G1 X-8.114 Y-17.401 E10.95400 F2400
+G1 X-6.567 Y-18.042 E11.00944 F2400
+G1 X-4.969 Y-18.546 E11.06488 F2400
+G1 X-3.334 Y-18.908 E11.12032 F2400
+G1 X-1.673 Y-19.127 E11.17577 F2400
+G1 X-0.000 Y-19.200 E11.23121 F2400
+G1 X1.673 Y-19.127 E11.28665 F2400
+G1 X3.334 Y-18.908 E11.34209 F2400
+G1 X4.969 Y-18.546 E11.39753 F2400
+G1 X6.567 Y-18.042 E11.45298 F2400
+G1 X8.114 Y-17.401 E11.50842 F2400
+G1 X9.600 Y-16.628 E11.56386 F2400
+G1 X11.013 Y-15.728 E11.61930 F2400
+G1 X12.342 Y-14.708 E11.67474 F2400
+G1 X13.576 Y-13.576 E11.73019 F2400
+G1 X14.708 Y-12.342 E11.78563 F2400
+G1 X15.728 Y-11.013 E11.84107 F2400
+G1 X16.628 Y-9.600 E11.89651 F2400
+G1 X17.401 Y-8.114 E11.95195 F2400
+G1 X18.042 Y-6.567 E12.00740 F2400
+G1 X18.546 Y-4.969 E12.06284 F2400
+G1 X18.908 Y-3.334 E12.11828 F2400
+G1 X19.127 Y-1.673 E12.17372 F2400
+G1 X19.200 Y-0.000 E12.22916 F2400
+G1 E11.22916 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E12.22916 F2400
+G1 X12.000 Y-12.000 E13.02356 F3600
+G1 X12.000 Y-11.000 E13.05666 F3600
+G1 X-12.000 Y-11.000 E13.85106 F3600
+G1 X-12.000 Y-10.000 E13.88416 F3600
+G1 X12.000 Y-10.000 E14.67856 F3600
+G1 X12.000 Y-9.000 E14.71166 F3600
+G1 X-12.000 Y-9.000 E15.50606 F3600
+G1 X-12.000 Y-8.000 E15.53916 F3600
+G1 X12.000 Y-8.000 E16.33356 F3600
+G1 X12.000 Y-7.000 E16.36666 F3600
+G1 X-12.000 Y-7.000 E17.16106 F3600
+G1 X-12.000 Y-6.000 E17.19416 F3600
+G1 X12.000 Y-6.000 E17.98856 F3600
+G1 X12.000 Y-5.000 E18.02166 F3600
+G1 X-12.000 Y-5.000 E18.81606 F3600
+G1 X-12.000 Y-4.000 E18.84916 F3600
+G1 X12.000 Y-4.000 E19.64356 F3600
+G1 X12.000 Y-3.000 E19.67666 F3600
+G1 X-12.000 Y-3.000 E20.47106 F3600
+G1 X-12.000 Y-2.000 E20.50416 F3600
+G1 X12.000 Y-2.000 E21.29856 F3600
+G1 X12.000 Y-1.000 E21.33166 F3600
+G1 X-12.000 Y-1.000 E22.12606 F3600
+G1 X-12.000 Y0.000 E22.15916 F3600
+G1 X12.000 Y0.000 E22.95356 F3600
+G1 X12.000 Y1.000 E22.98666 F3600
+G1 X-12.000 Y1.000 E23.78106 F3600
+G1 X-12.000 Y2.000 E23.81416 F3600
+G1 X12.000 Y2.000 E24.60856 F3600
+G1 X12.000 Y3.000 E24.64166 F3600
+G1 X-12.000 Y3.000 E25.43606 F3600
+G1 X-12.000 Y4.000 E25.46916 F3600
+G1 X12.000 Y4.000 E26.26356 F3600
+G1 X12.000 Y5.000 E26.29666 F3600
+G1 X-12.000 Y5.000 E27.09106 F3600
+G1 X-12.000 Y6.000 E27.12416 F3600
+G1 X12.000 Y6.000 E27.91856 F3600
+G1 X12.000 Y7.000 E27.95166 F3600
+G1 X-12.000 Y7.000 E28.74606 F3600
+G1 X-12.000 Y8.000 E28.77916 F3600
+G1 X12.000 Y8.000 E29.57356 F3600
+G1 X12.000 Y9.000 E29.60666 F3600
+G1 X-12.000 Y9.000 E30.40106 F3600
+G1 X-12.000 Y10.000 E30.43416 F3600
+G1 X12.000 Y10.000 E31.22856 F3600
+G1 X12.000 Y11.000 E31.26166 F3600
+G1 X-12.000 Y11.000 E32.05606 F3600
+G1 X-12.000 Y12.000 E32.08916 F3600
+G1 X12.000 Y12.000 E32.88356 F3600
+;LAYER:19
+G1 Z4.00 F1200
+G1 E31.88356 F2400
+G1 X20.000 Y0.000 F9000
+G1 E32.88356 F2400
+G1 X19.924 Y1.743 E32.94132 F1800
+G1 X19.696 Y3.473 E32.99907 F1800
+G1 X19.319 Y5.176 E33.05682 F1800
+G1 X18.794 Y6.840 E33.11457 F1800
+G1 X18.126 Y8.452 E33.17232 F1800
+G1 X17.321 Y10.000 E33.23008 F1800
+G1 X16.383 Y11.472 E33.28783 F1800
+G1 X15.321 Y12.856 E33.34558 F1800
+G1 X14.142 Y14.142 E33.40333 F1800
+G1 X12.856 Y15.321 E33.46108 F1800
+G1 X11.472 Y16.383 E33.51884 F1800
+G1 X10.000 Y17.321 E33.57659 F1800
+G1 X8.452 Y18.126 E33.63434 F1800
+G1 X6.840 Y18.794 E33.69209 F1800
+G1 X5.176 Y19.319 E33.74984 F1800
+G1 X3.473 Y19.696 E33.80760 F1800
+G1 X1.743 Y19.924 E33.86535 F1800
+G1 X0.000 Y20.000 E33.92310 F1800
+G1 X-1.743 Y19.924 E33.98085 F1800
+G1 X-3.473 Y19.696 E34.03860 F1800
+G1 X-5.176 Y19.319 E34.09636 F1800
+G1 X-6.840 Y18.794 E34.15411 F1800
+G1 X-8.452 Y18.126 E34.21186 F1800
+G1 X-10.000 Y17.321 E34.26961 F1800
+G1 X-11.472 Y16.383 E34.32737 F1800
+G1 X-12.856 Y15.321 E34.38512 F1800
+G1 X-14.142 Y14.142 E34.44287 F1800
+G1 X-15.321 Y12.856 E34.50062 F1800
+G1 X-16.383 Y11.472 E34.55837 F1800
+G1 X-17.321 Y10.000 E34.61613 F1800
+G1 X-18.126 Y8.452 E34.67388 F1800
+G1 X-18.794 Y6.840 E34.73163 F1800
+G1 X-19.319 Y5.176 E34.78938 F1800
+G1 X-19.696 Y3.473 E34.84713 F1800
+G1 X-19.924 Y1.743 E34.90489 F1800
+G1 X-20.000 Y0.000 E34.96264 F1800
+G1 X-19.924 Y-1.743 E35.02039 F1800
+G1 X-19.696 Y-3.473 E35.07814 F1800
+G1 X-19.319 Y-5.176 E35.13589 F1800
+G1 X-18.794 Y-6.840 E35.19365 F1800
+G1 X-18.126 Y-8.452 E35.25140 F1800
+G1 X-17.321 Y-10.000 E35.30915 F1800
+G1 X-16.383 Y-11.472 E35.36690 F1800
+G1 X-15.321 Y-12.856 E35.42465 F1800
+G1 X-14.142 Y-14.142 E35.48241 F1800
+G1 X-12.856 Y-15.321 E35.54016 F1800
+G1 X-11.472 Y-16.383 E35.59791 F1800
+G1 X-10.000 Y-17.321 E35.65566 F1800
+G1 X-8.452 Y-18.126 E35.71341 F1800
+G1 X-6.840 Y-18.794 E35.77117 F1800
+G1 X-5.176 Y-19.319 E35.82892 F1800
+G1 X-3.473 Y-19.696 E35.88667 F1800
+G1 X-1.743 Y-19.924 E35.94442 F1800
+G1 X-0.000 Y-20.000 E36.00218 F1800
+G1 X1.743 Y-19.924 E36.05993 F1800
+G1 X3.473 Y-19.696 E36.11768 F1800
+G1 X5.176 Y-19.319 E36.17543 F1800
+G1 X6.840 Y-18.794 E36.23318 F1800
+G1 X8.452 Y-18.126 E36.29094 F1800
+G1 X10.000 Y-17.321 E36.34869 F1800
+G1 X11.472 Y-16.383 E36.40644 F1800
+G1 X12.856 Y-15.321 E36.46419 F1800
+G1 X14.142 Y-14.142 E36.52194 F1800
+G1 X15.321 Y-12.856 E36.57970 F1800
+G1 X16.383 Y-11.472 E36.63745 F1800
+G1 X17.321 Y-10.000 E36.69520 F1800
+G1 X18.126 Y-8.452 E36.75295 F1800
+G1 X18.794 Y-6.840 E36.81070 F1800
+G1 X19.319 Y-5.176 E36.86846 F1800
+G1 X19.696 Y-3.473 E36.92621 F1800
+G1 X19.924 Y-1.743 E36.98396 F1800
+G1 X20.000 Y-0.000 E37.04171 F1800
+G1 X19.525 Y1.708 E37.10040 F2400
+G1 X19.302 Y3.404 E37.15699 F2400
+G1 X18.932 Y5.073 E37.21359 F2400
+G1 X18.418 Y6.704 E37.27019 F2400
+G1 X17.764 Y8.283 E37.32679 F2400
+G1 X16.974 Y9.800 E37.38338 F2400
+G1 X16.055 Y11.242 E37.43998 F2400
+G1 X15.014 Y12.599 E37.49658 F2400
+G1 X13.859 Y13.859 E37.55317 F2400
+G1 X12.599 Y15.014 E37.60977 F2400
+G1 X11.242 Y16.055 E37.66637 F2400
+G1 X9.800 Y16.974 E37.72296 F2400
+G1 X8.283 Y17.764 E37.77956 F2400
+G1 X6.704 Y18.418 E37.83616 F2400
+G1 X5.073 Y18.932 E37.89276 F2400
+G1 X3.404 Y19.302 E37.94935 F2400
+G1 X1.708 Y19.525 E38.00595 F2400
+G1 X0.000 Y19.600 E38.06255 F2400
+G1 X-1.708 Y19.525 E38.11914 F2400
+G1 X-3.404 Y19.302 E38.17574 F2400
+G1 X-5.073 Y18.932 E38.23234 F2400
+G1 X-6.704 Y18.418 E38.28893 F2400
+G1 X-8.283 Y17.764 E38.34553 F2400
+G1 X-9.800 Y16.974 E38.40213 F2400
+G1 X-11.242 Y16.055 E38.45873 F2400
+G1 X-12.599 Y15.014 E38.51532 F2400
+G1 X-13.859 Y13.859 E38.57192 F2400
+G1 X-15.014 Y12.599 E38.62852 F2400
+G1 X-16.055 Y11.242 E38.68511 F2400
+G1 X-16.974 Y9.800 E38.74171 F2400
+G1 X-17.764 Y8.283 E38.79831 F2400
+G1 X-18.418 Y6.704 E38.85491 F2400
+G1 X-18.932 Y5.073 E38.91150 F2400
+G1 X-19.302 Y3.404 E38.96810 F2400
+G1 X-19.525 Y1.708 E39.02470 F2400
+G1 X-19.600 Y0.000 E39.08129 F2400
+G1 X-19.525 Y-1.708 E39.13789 F2400
+G1 X-19.302 Y-3.404 E39.19449 F2400
+G1 X-18.932 Y-5.073 E39.25108 F2400
+G1 X-18.418 Y-6.704 E39.30768 F2400
+G1 X-17.764 Y-8.283 E39.36428 F2400
+G1 X-16.974 Y-9.800 E39.42088 F2400
+G1 X-16.055 Y-11.242 E39.47747 F2400
+G1 X-15.014 Y-12.599 E39.53407 F2400
+G1 X-13.859 Y-13.859 E39.59067 F2400
+G1 X-12.599 Y-15.014 E39.64726 F2400
+G1 X-11.242 Y-16.055 E39.70386 F2400
+G1 X-9.800 Y-16.974 E39.76046 F2400
+G1 X-8.283 Y-17.764 E39.81705 F2400
+G1 X-6.704 Y-18.418 E39.87365 F2400
+G1 X-5.073 Y-18.932 E39.93025 F2400
+G1 X-3.404 Y-19.302 E39.98685 F2400
+G1 X-1.708 Y-19.525 E40.04344 F2400
+G1 X-0.000 Y-19.600 E40.10004 F2400
+G1 X1.708 Y-19.525 E40.15664 F2400
+G1 X3.404 Y-19.302 E40.21323 F2400
+G1 X5.073 Y-18.932 E40.26983 F2400
+G1 X6.704 Y-18.418 E40.32643 F2400
+G1 X8.283 Y-17.764 E40.38302 F2400
+G1 X9.800 Y-16.974 E40.43962 F2400
+G1 X11.242 Y-16.055 E40.49622 F2400
+G1 X12.599 Y-15.014 E40.55282 F2400
+G1 X13.859 Y-13.859 E40.60941 F2400
+G1 X15.014 Y-12.599 E40.66601 F2400
+G1 X16.055 Y-11.242 E40.72261 F2400
+G1 X16.974 Y-9.800 E40.77920 F2400
+G1 X17.764 Y-8.283 E40.83580 F2400
+G1 X18.418 Y-6.704 E40.89240 F2400
+G1 X18.932 Y-5.073 E40.94900 F2400
+G1 X19.302 Y-3.404 E41.00559 F2400
+G1 X19.525 Y-1.708 E41.06219 F2400
+G1 X19.600 Y-0.000 E41.11879 F2400
+G1 X19.127 Y1.673 E41.17635 F2400
+G1 X18.908 Y3.334 E41.23179 F2400
+G1 X18.546 Y4.969 E41.28723 F2400
+G1 X18.042 Y6.567 E41.34267 F2400
+G1 X17.401 Y8.114 E41.39811 F2400
+G1 X16.628 Y9.600 E41.45356 F2400
+G1 X15.728 Y11.013 E41.50900 F2400
+G1 X14.708 Y12.342 E41.56444 F2400
+G1 X13.576 Y13.576 E41.61988 F2400
+G1 X12.342 Y14.708 E41.67532 F2400
+G1 X11.013 Y15.728 E41.73077 F2400
+G1 X9.600 Y16.628 E41.78621 F2400
+G1 X8.114 Y17.401 E41.84165 F2400
+G1 X6.567 Y18.042 E41.89709 F2400
+G1 X4.969 Y18.546 E41.95253 F2400
+G1 X3.334 Y18.908 E42.00798 F2400
+G1 X1.673 Y19.127 E42.06342 F2400
+G1 X0.000 Y19.200 E42.11886 F2400
+G1 X-1.673 Y19.127 E42.17430 F2400
+G1 X-3.334 Y18.908 E42.22974 F2400
+G1 X-4.969 Y18.546 E42.28519 F2400
+G1 X-6.567 Y18.042 E42.34063 F2400
+G1 X-8.114 Y17.401 E42.39607 F2400
+G1 X-9.600 Y16.628 E42.45151 F2400
+G1 X-11.013 Y15.728 E42.50695 F2400
+G1 X-12.342 Y14.708 E42.56240 F2400
+G1 X-13.576 Y13.576 E42.61784 F2400
+G1 X-14.708 Y12.342 E42.67328 F2400
+G1 X-15.728 Y11.013 E42.72872 F2400
+G1 X-16.628 Y9.600 E42.78416 F2400
+G1 X-17.401 Y8.114 E42.83961 F2400
+G1 X-18.042 Y6.567 E42.89505 F2400
+G1 X-18.546 Y4.969 E42.95049 F2400
+G1 X-18.908 Y3.334 E43.00593 F2400
+G1 X-19.127 Y1.673 E43.06137 F2400
+G1 X-19.200 Y0.000 E43.11682 F2400
+G1 X-19.127 Y-1.673 E43.17226 F2400
+G1 X-18.908 Y-3.334 E43.22770 F2400
+G1 X-18.546 Y-4.969 E43.28314 F2400
+G1 X-18.042 Y-6.567 E43.33858 F2400
+G1 X-17.401 Y-8.114 E43.39403 F2400
+G1 X-16.628 Y-9.600 E43.44947 F2400
+G1 X-15.728 Y-11.013 E43.50491 F2400
+G1 X-14.708 Y-12.342 E43.56035 F2400
+G1 X-13.576 Y-13.576 E43.61579 F2400
+G1 X-12.342 Y-14.708 E43.67124 F2400
+G1 X-11.013 Y-15.728 E43.72668 F2400
+G1 X-9.600 Y-16.628 E43.78212 F2400
+G1 X-8.114 Y-17.401 E43.83756 F2400
+G1 X-6.567 Y-18.042 E43.89300 F2400
+G1 X-4.969 Y-18.546 E43.94845 F2400
+G1 X-3.334 Y-18.908 E44.00389 F2400
+G1 X-1.673 Y-19.127 E44.05933 F2400
+G1 X-0.000 Y-19.200 E44.11477 F2400
+G1 X1.673 Y-19.127 E44.17021 F2400
+G1 X3.334 Y-18.908 E44.22566 F2400
+G1 X4.969 Y-18.546 E44.28110 F2400
+G1 X6.567 Y-18.042 E44.33654 F2400
+G1 X8.114 Y-17.401 E44.39198 F2400
+G1 X9.600 Y-16.628 E44.44742 F2400
+G1 X11.013 Y-15.728 E44.50287 F2400
+G1 X12.342 Y-14.708 E44.55831 F2400
+G1 X13.576 Y-13.576 E44.61375 F2400
+G1 X14.708 Y-12.342 E44.66919 F2400
+G1 X15.728 Y-11.013 E44.72463 F2400
+G1 X16.628 Y-9.600 E44.78008 F2400
+G1 X17.401 Y-8.114 E44.83552 F2400
+G1 X18.042 Y-6.567 E44.89096 F2400
+G1 X18.546 Y-4.969 E44.94640 F2400
+G1 X18.908 Y-3.334 E45.00184 F2400
+G1 X19.127 Y-1.673 E45.05729 F2400
+G1 X19.200 Y-0.000 E45.11273 F2400
+G1 E44.11273 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E45.11273 F2400
+G1 X-12.000 Y12.000 E45.90713 F3600
+G1 X-11.200 Y12.000 E45.93361 F3600
+G1 X-11.200 Y-12.000 E46.72801 F3600
+G1 X-10.400 Y-12.000 E46.75449 F3600
+G1 X-10.400 Y12.000 E47.54889 F3600
+G1 X-9.600 Y12.000 E47.57537 F3600
+G1 X-9.600 Y-12.000 E48.36977 F3600
+G1 X-8.800 Y-12.000 E48.39625 F3600
+G1 X-8.800 Y12.000 E49.19065 F3600
+G1 X-8.000 Y12.000 E49.21713 F3600
+G1 X-8.000 Y-12.000 E50.01153 F3600
+G1 X-7.200 Y-12.000 E50.03801 F3600
+G1 X-7.200 Y12.000 E50.83241 F3600
+G1 X-6.400 Y12.000 E50.85889 F3600
+G1 X-6.400 Y-12.000 E51.65329 F3600
+G1 X-5.600 Y-12.000 E51.67977 F3600
+G1 X-5.600 Y12.000 E52.47417 F3600
+G1 X-4.800 Y12.000 E52.50065 F3600
+G1 X-4.800 Y-12.000 E53.29505 F3600
+G1 X-4.000 Y-12.000 E53.32153 F3600
+G1 X-4.000 Y12.000 E54.11593 F3600
+G1 X-3.200 Y12.000 E54.14241 F3600
+G1 X-3.200 Y-12.000 E54.93681 F3600
+G1 X-2.400 Y-12.000 E54.96329 F3600
+G1 X-2.400 Y12.000 E55.75769 F3600
+G1 X-1.600 Y12.000 E55.78417 F3600
+G1 X-1.600 Y-12.000 E56.57857 F3600
+G1 X-0.800 Y-12.000 E56.60505 F3600
+G1 X-0.800 Y12.000 E57.39945 F3600
+G1 X0.000 Y12.000 E57.42593 F3600
+G1 X0.000 Y-12.000 E58.22033 F3600
+G1 X0.800 Y-12.000 E58.24681 F3600
+G1 X0.800 Y12.000 E59.04121 F3600
+G1 X1.600 Y12.000 E59.06769 F3600
+G1 X1.600 Y-12.000 E59.86209 F3600
+G1 X2.400 Y-12.000 E59.88857 F3600
+G1 X2.400 Y12.000 E60.68297 F3600
+G1 X3.200 Y12.000 E60.70945 F3600
+G1 X3.200 Y-12.000 E61.50385 F3600
+G1 X4.000 Y-12.000 E61.53033 F3600
+G1 X4.000 Y12.000 E62.32473 F3600
+G1 X4.800 Y12.000 E62.35121 F3600
+G1 X4.800 Y-12.000 E63.14561 F3600
+G1 X5.600 Y-12.000 E63.17209 F3600
+G1 X5.600 Y12.000 E63.96649 F3600
+G1 X6.400 Y12.000 E63.99297 F3600
+G1 X6.400 Y-12.000 E64.78737 F3600
+G1 X7.200 Y-12.000 E64.81385 F3600
+G1 X7.200 Y12.000 E65.60825 F3600
+G1 X8.000 Y12.000 E65.63473 F3600
+G1 X8.000 Y-12.000 E66.42913 F3600
+G1 X8.800 Y-12.000 E66.45561 F3600
+G1 X8.800 Y12.000 E67.25001 F3600
+G1 X9.600 Y12.000 E67.27649 F3600
+G1 X9.600 Y-12.000 E68.07089 F3600
+G1 X10.400 Y-12.000 E68.09737 F3600
+G1 X10.400 Y12.000 E68.89177 F3600
+G1 X11.200 Y12.000 E68.91825 F3600
+G1 X11.200 Y-12.000 E69.71265 F3600
+G1 X12.000 Y-12.000 E69.73913 F3600
+G1 X12.000 Y12.000 E70.53353 F3600
+;LAYER:20
+G1 Z4.20 F1200
+G1 E69.53353 F2400
+G1 X20.000 Y0.000 F9000
+G1 E70.53353 F2400
+G1 X19.924 Y1.743 E70.59128 F1800
+G1 X19.696 Y3.473 E70.64903 F1800
+G1 X19.319 Y5.176 E70.70678 F1800
+G1 X18.794 Y6.840 E70.76454 F1800
+G1 X18.126 Y8.452 E70.82229 F1800
+G1 X17.321 Y10.000 E70.88004 F1800
+G1 X16.383 Y11.472 E70.93779 F1800
+G1 X15.321 Y12.856 E70.99554 F1800
+G1 X14.142 Y14.142 E71.05330 F1800
+G1 X12.856 Y15.321 E71.11105 F1800
+G1 X11.472 Y16.383 E71.16880 F1800
+G1 X10.000 Y17.321 E71.22655 F1800
+G1 X8.452 Y18.126 E71.28430 F1800
+G1 X6.840 Y18.794 E71.34206 F1800
+G1 X5.176 Y19.319 E71.39981 F1800
+G1 X3.473 Y19.696 E71.45756 F1800
+G1 X1.743 Y19.924 E71.51531 F1800
+G1 X0.000 Y20.000 E71.57306 F1800
+G1 X-1.743 Y19.924 E71.63082 F1800
+G1 X-3.473 Y19.696 E71.68857 F1800
+G1 X-5.176 Y19.319 E71.74632 F1800
+G1 X-6.840 Y18.794 E71.80407 F1800
+G1 X-8.452 Y18.126 E71.86182 F1800
+G1 X-10.000 Y17.321 E71.91958 F1800
+G1 X-11.472 Y16.383 E71.97733 F1800
+G1 X-12.856 Y15.321 E72.03508 F1800
+G1 X-14.142 Y14.142 E72.09283 F1800
+G1 X-15.321 Y12.856 E72.15059 F1800
+G1 X-16.383 Y11.472 E72.20834 F1800
+G1 X-17.321 Y10.000 E72.26609 F1800
+G1 X-18.126 Y8.452 E72.32384 F1800
+G1 X-18.794 Y6.840 E72.38159 F1800
+G1 X-19.319 Y5.176 E72.43935 F1800
+G1 X-19.696 Y3.473 E72.49710 F1800
+G1 X-19.924 Y1.743 E72.55485 F1800
+G1 X-20.000 Y0.000 E72.61260 F1800
+G1 X-19.924 Y-1.743 E72.67035 F1800
+G1 X-19.696 Y-3.473 E72.72811 F1800
+G1 X-19.319 Y-5.176 E72.78586 F1800
+G1 X-18.794 Y-6.840 E72.84361 F1800
+G1 X-18.126 Y-8.452 E72.90136 F1800
+G1 X-17.321 Y-10.000 E72.95911 F1800
+G1 X-16.383 Y-11.472 E73.01687 F1800
+G1 X-15.321 Y-12.856 E73.07462 F1800
+G1 X-14.142 Y-14.142 E73.13237 F1800
+G1 X-12.856 Y-15.321 E73.19012 F1800
+G1 X-11.472 Y-16.383 E73.24787 F1800
+G1 X-10.000 Y-17.321 E73.30563 F1800
+G1 X-8.452 Y-18.126 E73.36338 F1800
+G1 X-6.840 Y-18.794 E73.42113 F1800
+G1 X-5.176 Y-19.319 E73.47888 F1800
+G1 X-3.473 Y-19.696 E73.53663 F1800
+G1 X-1.743 Y-19.924 E73.59439 F1800
+G1 X-0.000 Y-20.000 E73.65214 F1800
+G1 X1.743 Y-19.924 E73.70989 F1800
+G1 X3.473 Y-19.696 E73.76764 F1800
+G1 X5.176 Y-19.319 E73.82540 F1800
+G1 X6.840 Y-18.794 E73.88315 F1800
+G1 X8.452 Y-18.126 E73.94090 F1800
+G1 X10.000 Y-17.321 E73.99865 F1800
+G1 X11.472 Y-16.383 E74.05640 F1800
+G1 X12.856 Y-15.321 E74.11416 F1800
+G1 X14.142 Y-14.142 E74.17191 F1800
+G1 X15.321 Y-12.856 E74.22966 F1800
+G1 X16.383 Y-11.472 E74.28741 F1800
+G1 X17.321 Y-10.000 E74.34516 F1800
+G1 X18.126 Y-8.452 E74.40292 F1800
+G1 X18.794 Y-6.840 E74.46067 F1800
+G1 X19.319 Y-5.176 E74.51842 F1800
+G1 X19.696 Y-3.473 E74.57617 F1800
+G1 X19.924 Y-1.743 E74.63392 F1800
+G1 X20.000 Y-0.000 E74.69168 F1800
+G1 X19.525 Y1.708 E74.75036 F2400
+G1 X19.302 Y3.404 E74.80696 F2400
+G1 X18.932 Y5.073 E74.86355 F2400
+G1 X18.418 Y6.704 E74.92015 F2400
+G1 X17.764 Y8.283 E74.97675 F2400
+G1 X16.974 Y9.800 E75.03335 F2400
+G1 X16.055 Y11.242 E75.08994 F2400
+G1 X15.014 Y12.599 E75.14654 F2400
+G1 X13.859 Y13.859 E75.20314 F2400
+G1 X12.599 Y15.014 E75.25973 F2400
+G1 X11.242 Y16.055 E75.31633 F2400
+G1 X9.800 Y16.974 E75.37293 F2400
+G1 X8.283 Y17.764 E75.42953 F2400
+G1 X6.704 Y18.418 E75.48612 F2400
+G1 X5.073 Y18.932 E75.54272 F2400
+G1 X3.404 Y19.302 E75.59932 F2400
+G1 X1.708 Y19.525 E75.65591 F2400
+G1 X0.000 Y19.600 E75.71251 F2400
+G1 X-1.708 Y19.525 E75.76911 F2400
+G1 X-3.404 Y19.302 E75.82570 F2400
+G1 X-5.073 Y18.932 E75.88230 F2400
+G1 X-6.704 Y18.418 E75.93890 F2400
+G1 X-8.283 Y17.764 E75.99550 F2400
+G1 X-9.800 Y16.974 E76.05209 F2400
+G1 X-11.242 Y16.055 E76.10869 F2400
+G1 X-12.599 Y15.014 E76.16529 F2400
+G1 X-13.859 Y13.859 E76.22188 F2400
+G1 X-15.014 Y12.599 E76.27848 F2400
+G1 X-16.055 Y11.242 E76.33508 F2400
+G1 X-16.974 Y9.800 E76.39167 F2400
+G1 X-17.764 Y8.283 E76.44827 F2400
+G1 X-18.418 Y6.704 E76.50487 F2400
+G1 X-18.932 Y5.073 E76.56147 F2400
+G1 X-19.302 Y3.404 E76.61806 F2400
+G1 X-19.525 Y1.708 E76.67466 F2400
+G1 X-19.600 Y0.000 E76.73126 F2400
+G1 X-19.525 Y-1.708 E76.78785 F2400
+G1 X-19.302 Y-3.404 E76.84445 F2400
+G1 X-18.932 Y-5.073 E76.90105 F2400
+G1 X-18.418 Y-6.704 E76.95764 F2400
+G1 X-17.764 Y-8.283 E77.01424 F2400
+G1 X-16.974 Y-9.800 E77.07084 F2400
+G1 X-16.055 Y-11.242 E77.12744 F2400
+G1 X-15.014 Y-12.599 E77.18403 F2400
+G1 X-13.859 Y-13.859 E77.24063 F2400
+G1 X-12.599 Y-15.014 E77.29723 F2400
+G1 X-11.242 Y-16.055 E77.35382 F2400
+G1 X-9.800 Y-16.974 E77.41042 F2400
+G1 X-8.283 Y-17.764 E77.46702 F2400
+G1 X-6.704 Y-18.418 E77.52362 F2400
+G1 X-5.073 Y-18.932 E77.58021 F2400
+G1 X-3.404 Y-19.302 E77.63681 F2400
+G1 X-1.708 Y-19.525 E77.69341 F2400
+G1 X-0.000 Y-19.600 E77.75000 F2400
+G1 X1.708 Y-19.525 E77.80660 F2400
+G1 X3.404 Y-19.302 E77.86320 F2400
+G1 X5.073 Y-18.932 E77.91979 F2400
+G1 X6.704 Y-18.418 E77.97639 F2400
+G1 X8.283 Y-17.764 E78.03299 F2400
+G1 X9.800 Y-16.974 E78.08959 F2400
+G1 X11.242 Y-16.055 E78.14618 F2400
+G1 X12.599 Y-15.014 E78.20278 F2400
+G1 X13.859 Y-13.859 E78.25938 F2400
+G1 X15.014 Y-12.599 E78.31597 F2400
+G1 X16.055 Y-11.242 E78.37257 F2400
+G1 X16.974 Y-9.800 E78.42917 F2400
+G1 X17.764 Y-8.283 E78.48576 F2400
+G1 X18.418 Y-6.704 E78.54236 F2400
+G1 X18.932 Y-5.073 E78.59896 F2400
+G1 X19.302 Y-3.404 E78.65556 F2400
+G1 X19.525 Y-1.708 E78.71215 F2400
+G1 X19.600 Y-0.000 E78.76875 F2400
+G1 X19.127 Y1.673 E78.82631 F2400
+G1 X18.908 Y3.334 E78.88175 F2400
+G1 X18.546 Y4.969 E78.93719 F2400
+G1 X18.042 Y6.567 E78.99264 F2400
+G1 X17.401 Y8.114 E79.04808 F2400
+G1 X16.628 Y9.600 E79.10352 F2400
+G1 X15.728 Y11.013 E79.15896 F2400
+G1 X14.708 Y12.342 E79.21440 F2400
+G1 X13.576 Y13.576 E79.26985 F2400
+G1 X12.342 Y14.708 E79.32529 F2400
+G1 X11.013 Y15.728 E79.38073 F2400
+G1 X9.600 Y16.628 E79.43617 F2400
+G1 X8.114 Y17.401 E79.49161 F2400
+G1 X6.567 Y18.042 E79.54706 F2400
+G1 X4.969 Y18.546 E79.60250 F2400
+G1 X3.334 Y18.908 E79.65794 F2400
+G1 X1.673 Y19.127 E79.71338 F2400
+G1 X0.000 Y19.200 E79.76882 F2400
+G1 X-1.673 Y19.127 E79.82427 F2400
+G1 X-3.334 Y18.908 E79.87971 F2400
+G1 X-4.969 Y18.546 E79.93515 F2400
+G1 X-6.567 Y18.042 E79.99059 F2400
+G1 X-8.114 Y17.401 E80.04603 F2400
+G1 X-9.600 Y16.628 E80.10148 F2400
+G1 X-11.013 Y15.728 E80.15692 F2400
+G1 X-12.342 Y14.708 E80.21236 F2400
+G1 X-13.576 Y13.576 E80.26780 F2400
+G1 X-14.708 Y12.342 E80.32324 F2400
+G1 X-15.728 Y11.013 E80.37869 F2400
+G1 X-16.628 Y9.600 E80.43413 F2400
+G1 X-17.401 Y8.114 E80.48957 F2400
+G1 X-18.042 Y6.567 E80.54501 F2400
+G1 X-18.546 Y4.969 E80.60045 F2400
+G1 X-18.908 Y3.334 E80.65590 F2400
+G1 X-19.127 Y1.673 E80.71134 F2400
+G1 X-19.200 Y0.000 E80.76678 F2400
+G1 X-19.127 Y-1.673 E80.82222 F2400
+G1 X-18.908 Y-3.334 E80.87766 F2400
+G1 X-18.546 Y-4.969 E80.93311 F2400
+G1 X-18.042 Y-6.567 E80.98855 F2400
+G1 X-17.401 Y-8.114 E81.04399 F2400
+G1 X-16.628 Y-9.600 E81.09943 F2400
+G1 X-15.728 Y-11.013 E81.15487 F2400
+G1 X-14.708 Y-12.342 E81.21032 F2400
+G1 X-13.576 Y-13.576 E81.26576 F2400
+G1 X-12.342 Y-14.708 E81.32120 F2400
+G1 X-11.013 Y-15.728 E81.37664 F2400
+G1 X-9.600 Y-16.628 E81.43208 F2400
+G1 X-8.114 Y-17.401 E81.48753 F2400
+G1 X-6.567 Y-18.042 E81.54297 F2400
+G1 X-4.969 Y-18.546 E81.59841 F2400
+G1 X-3.334 Y-18.908 E81.65385 F2400
+G1 X-1.673 Y-19.127 E81.70929 F2400
+G1 X-0.000 Y-19.200 E81.76473 F2400
+G1 X1.673 Y-19.127 E81.82018 F2400
+G1 X3.334 Y-18.908 E81.87562 F2400
+G1 X4.969 Y-18.546 E81.93106 F2400
+G1 X6.567 Y-18.042 E81.98650 F2400
+G1 X8.114 Y-17.401 E82.04194 F2400
+G1 X9.600 Y-16.628 E82.09739 F2400
+G1 X11.013 Y-15.728 E82.15283 F2400
+G1 X12.342 Y-14.708 E82.20827 F2400
+G1 X13.576 Y-13.576 E82.26371 F2400
+G1 X14.708 Y-12.342 E82.31915 F2400
+G1 X15.728 Y-11.013 E82.37460 F2400
+G1 X16.628 Y-9.600 E82.43004 F2400
+G1 X17.401 Y-8.114 E82.48548 F2400
+G1 X18.042 Y-6.567 E82.54092 F2400
+G1 X18.546 Y-4.969 E82.59636 F2400
+G1 X18.908 Y-3.334 E82.65181 F2400
+G1 X19.127 Y-1.673 E82.70725 F2400
+G1 X19.200 Y-0.000 E82.76269 F2400
+G1 E81.76269 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E82.76269 F2400
+G1 X12.000 Y-12.000 E83.55709 F3600
+G1 X12.000 Y-11.000 E83.59019 F3600
+G1 X-12.000 Y-11.000 E84.38459 F3600
+G1 X-12.000 Y-10.000 E84.41769 F3600
+G1 X12.000 Y-10.000 E85.21209 F3600
+G1 X12.000 Y-9.000 E85.24519 F3600
+G1 X-12.000 Y-9.000 E86.03959 F3600
+G1 X-12.000 Y-8.000 E86.07269 F3600
+G1 X12.000 Y-8.000 E86.86709 F3600
+G1 X12.000 Y-7.000 E86.90019 F3600
+G1 X-12.000 Y-7.000 E87.69459 F3600
+G1 X-12.000 Y-6.000 E87.72769 F3600
+G1 X12.000 Y-6.000 E88.52209 F3600
+G1 X12.000 Y-5.000 E88.55519 F3600
+G1 X-12.000 Y-5.000 E89.34959 F3600
+G1 X-12.000 Y-4.000 E89.38269 F3600
+G1 X12.000 Y-4.000 E90.17709 F3600
+G1 X12.000 Y-3.000 E90.21019 F3600
+G1 X-12.000 Y-3.000 E91.00459 F3600
+G1 X-12.000 Y-2.000 E91.03769 F3600
+G1 X12.000 Y-2.000 E91.83209 F3600
+G1 X12.000 Y-1.000 E91.86519 F3600
+G1 X-12.000 Y-1.000 E92.65959 F3600
+G1 X-12.000 Y0.000 E92.69269 F3600
+G1 X12.000 Y0.000 E93.48709 F3600
+G1 X12.000 Y1.000 E93.52019 F3600
+G1 X-12.000 Y1.000 E94.31459 F3600
+G1 X-12.000 Y2.000 E94.34769 F3600
+G1 X12.000 Y2.000 E95.14209 F3600
+G1 X12.000 Y3.000 E95.17519 F3600
+G1 X-12.000 Y3.000 E95.96959 F3600
+G1 X-12.000 Y4.000 E96.00269 F3600
+G1 X12.000 Y4.000 E96.79709 F3600
+G1 X12.000 Y5.000 E96.83019 F3600
+G1 X-12.000 Y5.000 E97.62459 F3600
+G1 X-12.000 Y6.000 E97.65769 F3600
+G1 X12.000 Y6.000 E98.45209 F3600
+G1 X12.000 Y7.000 E98.48519 F3600
+G1 X-12.000 Y7.000 E99.27959 F3600
+G1 X-12.000 Y8.000 E99.31269 F3600
+G1 X12.000 Y8.000 E100.10709 F3600
+G1 X12.000 Y9.000 E100.14019 F3600
+G1 X-12.000 Y9.000 E100.93459 F3600
+G1 X-12.000 Y10.000 E100.96769 F3600
+G1 X12.000 Y10.000 E101.76209 F3600
+G1 X12.000 Y11.000 E101.79519 F3600
+G1 X-12.000 Y11.000 E102.58959 F3600
+G1 X-12.000 Y12.000 E102.62269 F3600
+G1 X12.000 Y12.000 E103.41709 F3600
+;LAYER:21
+G1 Z4.40 F1200
+G1 E102.41709 F2400
+G1 X20.000 Y0.000 F9000
+G1 E103.41709 F2400
+G1 X19.924 Y1.743 E103.47484 F1800
+G1 X19.696 Y3.473 E103.53259 F1800
+G1 X19.319 Y5.176 E103.59035 F1800
+G1 X18.794 Y6.840 E103.64810 F1800
+G1 X18.126 Y8.452 E103.70585 F1800
+G1 X17.321 Y10.000 E103.76360 F1800
+G1 X16.383 Y11.472 E103.82136 F1800
+G1 X15.321 Y12.856 E103.87911 F1800
+G1 X14.142 Y14.142 E103.93686 F1800
+G1 X12.856 Y15.321 E103.99461 F1800
+G1 X11.472 Y16.383 E104.05236 F1800
+G1 X10.000 Y17.321 E104.11012 F1800
+G1 X8.452 Y18.126 E104.16787 F1800
+G1 X6.840 Y18.794 E104.22562 F1800
+G1 X5.176 Y19.319 E104.28337 F1800
+G1 X3.473 Y19.696 E104.34112 F1800
+G1 X1.743 Y19.924 E104.39888 F1800
+G1 X0.000 Y20.000 E104.45663 F1800
+G1 X-1.743 Y19.924 E104.51438 F1800
+G1 X-3.473 Y19.696 E104.57213 F1800
+G1 X-5.176 Y19.319 E104.62988 F1800
+G1 X-6.840 Y18.794 E104.68764 F1800
+G1 X-8.452 Y18.126 E104.74539 F1800
+G1 X-10.000 Y17.321 E104.80314 F1800
+G1 X-11.472 Y16.383 E104.86089 F1800
+G1 X-12.856 Y15.321 E104.91864 F1800
+G1 X-14.142 Y14.142 E104.97640 F1800
+G1 X-15.321 Y12.856 E105.03415 F1800
+G1 X-16.383 Y11.472 E105.09190 F1800
+G1 X-17.321 Y10.000 E105.14965 F1800
+G1 X-18.126 Y8.452 E105.20740 F1800
+G1 X-18.794 Y6.840 E105.26516 F1800
+G1 X-19.319 Y5.176 E105.32291 F1800
+G1 X-19.696 Y3.473 E105.38066 F1800
+G1 X-19.924 Y1.743 E105.43841 F1800
+G1 X-20.000 Y0.000 E105.49617 F1800
+G1 X-19.924 Y-1.743 E105.55392 F1800
+G1 X-19.696 Y-3.473 E105.61167 F1800
+G1 X-19.319 Y-5.176 E105.66942 F1800
+G1 X-18.794 Y-6.840 E105.72717 F1800
+G1 X-18.126 Y-8.452 E105.78493 F1800
+G1 X-17.321 Y-10.000 E105.84268 F1800
+G1 X-16.383 Y-11.472 E105.90043 F1800
+G1 X-15.321 Y-12.856 E105.95818 F1800
+G1 X-14.142 Y-14.142 E106.01593 F1800
+G1 X-12.856 Y-15.321 E106.07369 F1800
+G1 X-11.472 Y-16.383 E106.13144 F1800
+G1 X-10.000 Y-17.321 E106.18919 F1800
+G1 X-8.452 Y-18.126 E106.24694 F1800
+G1 X-6.840 Y-18.794 E106.30469 F1800
+G1 X-5.176 Y-19.319 E106.36245 F1800
+G1 X-3.473 Y-19.696 E106.42020 F1800
+G1 X-1.743 Y-19.924 E106.47795 F1800
+G1 X-0.000 Y-20.000 E106.53570 F1800
+G1 X1.743 Y-19.924 E106.59345 F1800
+G1 X3.473 Y-19.696 E106.65121 F1800
+G1 X5.176 Y-19.319 E106.70896 F1800
+G1 X6.840 Y-18.794 E106.76671 F1800
+G1 X8.452 Y-18.126 E106.82446 F1800
+G1 X10.000 Y-17.321 E106.88221 F1800
+G1 X11.472 Y-16.383 E106.93997 F1800
+G1 X12.856 Y-15.321 E106.99772 F1800
+G1 X14.142 Y-14.142 E107.05547 F1800
+G1 X15.321 Y-12.856 E107.11322 F1800
+G1 X16.383 Y-11.472 E107.17098 F1800
+G1 X17.321 Y-10.000 E107.22873 F1800
+G1 X18.126 Y-8.452 E107.28648 F1800
+G1 X18.794 Y-6.840 E107.34423 F1800
+G1 X19.319 Y-5.176 E107.40198 F1800
+G1 X19.696 Y-3.473 E107.45974 F1800
+G1 X19.924 Y-1.743 E107.51749 F1800
+G1 X20.000 Y-0.000 E107.57524 F1800
+G1 X19.525 Y1.708 E107.63392 F2400
+G1 X19.302 Y3.404 E107.69052 F2400
+G1 X18.932 Y5.073 E107.74712 F2400
+G1 X18.418 Y6.704 E107.80372 F2400
+G1 X17.764 Y8.283 E107.86031 F2400
+G1 X16.974 Y9.800 E107.91691 F2400
+G1 X16.055 Y11.242 E107.97351 F2400
+G1 X15.014 Y12.599 E108.03010 F2400
+G1 X13.859 Y13.859 E108.08670 F2400
+G1 X12.599 Y15.014 E108.14330 F2400
+G1 X11.242 Y16.055 E108.19989 F2400
+G1 X9.800 Y16.974 E108.25649 F2400
+G1 X8.283 Y17.764 E108.31309 F2400
+G1 X6.704 Y18.418 E108.36969 F2400
+G1 X5.073 Y18.932 E108.42628 F2400
+G1 X3.404 Y19.302 E108.48288 F2400
+G1 X1.708 Y19.525 E108.53948 F2400
+G1 X0.000 Y19.600 E108.59607 F2400
+G1 X-1.708 Y19.525 E108.65267 F2400
+G1 X-3.404 Y19.302 E108.70927 F2400
+G1 X-5.073 Y18.932 E108.76586 F2400
+G1 X-6.704 Y18.418 E108.82246 F2400
+G1 X-8.283 Y17.764 E108.87906 F2400
+G1 X-9.800 Y16.974 E108.93566 F2400
+G1 X-11.242 Y16.055 E108.99225 F2400
+G1 X-12.599 Y15.014 E109.04885 F2400
+G1 X-13.859 Y13.859 E109.10545 F2400
+G1 X-15.014 Y12.599 E109.16204 F2400
+G1 X-16.055 Y11.242 E109.21864 F2400
+G1 X-16.974 Y9.800 E109.27524 F2400
+G1 X-17.764 Y8.283 E109.33184 F2400
+G1 X-18.418 Y6.704 E109.38843 F2400
+G1 X-18.932 Y5.073 E109.44503 F2400
+G1 X-19.302 Y3.404 E109.50163 F2400
+G1 X-19.525 Y1.708 E109.55822 F2400
+G1 X-19.600 Y0.000 E109.61482 F2400
+G1 X-19.525 Y-1.708 E109.67142 F2400
+G1 X-19.302 Y-3.404 E109.72801 F2400
+G1 X-18.932 Y-5.073 E109.78461 F2400
+G1 X-18.418 Y-6.704 E109.84121 F2400
+G1 X-17.764 Y-8.283 E109.89781 F2400
+G1 X-16.974 Y-9.800 E109.95440 F2400
+G1 X-16.055 Y-11.242 E110.01100 F2400
+G1 X-15.014 Y-12.599 E110.06760 F2400
+G1 X-13.859 Y-13.859 E110.12419 F2400
+G1 X-12.599 Y-15.014 E110.18079 F2400
+G1 X-11.242 Y-16.055 E110.23739 F2400
+G1 X-9.800 Y-16.974 E110.29398 F2400
+G1 X-8.283 Y-17.764 E110.35058 F2400
+G1 X-6.704 Y-18.418 E110.40718 F2400
+G1 X-5.073 Y-18.932 E110.46378 F2400
+G1 X-3.404 Y-19.302 E110.52037 F2400
+G1 X-1.708 Y-19.525 E110.57697 F2400
+G1 X-0.000 Y-19.600 E110.63357 F2400
+G1 X1.708 Y-19.525 E110.69016 F2400
+G1 X3.404 Y-19.302 E110.74676 F2400
+G1 X5.073 Y-18.932 E110.80336 F2400
+G1 X6.704 Y-18.418 E110.85995 F2400
+G1 X8.283 Y-17.764 E110.91655 F2400
+G1 X9.800 Y-16.974 E110.97315 F2400
+G1 X11.242 Y-16.055 E111.02975 F2400
+G1 X12.599 Y-15.014 E111.08634 F2400
+G1 X13.859 Y-13.859 E111.14294 F2400
+G1 X15.014 Y-12.599 E111.19954 F2400
+G1 X16.055 Y-11.242 E111.25613 F2400
+G1 X16.974 Y-9.800 E111.31273 F2400
+G1 X17.764 Y-8.283 E111.36933 F2400
+G1 X18.418 Y-6.704 E111.42593 F2400
+G1 X18.932 Y-5.073 E111.48252 F2400
+G1 X19.302 Y-3.404 E111.53912 F2400
+G1 X19.525 Y-1.708 E111.59572 F2400
+G1 X19.600 Y-0.000 E111.65231 F2400
+G1 X19.127 Y1.673 E111.70987 F2400
+G1 X18.908 Y3.334 E111.76532 F2400
+G1 X18.546 Y4.969 E111.82076 F2400
+G1 X18.042 Y6.567 E111.87620 F2400
+G1 X17.401 Y8.114 E111.93164 F2400
+G1 X16.628 Y9.600 E111.98708 F2400
+G1 X15.728 Y11.013 E112.04253 F2400
+G1 X14.708 Y12.342 E112.09797 F2400
+G1 X13.576 Y13.576 E112.15341 F2400
+G1 X12.342 Y14.708 E112.20885 F2400
+G1 X11.013 Y15.728 E112.26429 F2400
+G1 X9.600 Y16.628 E112.31974 F2400
+G1 X8.114 Y17.401 E112.37518 F2400
+G1 X6.567 Y18.042 E112.43062 F2400
+G1 X4.969 Y18.546 E112.48606 F2400
+G1 X3.334 Y18.908 E112.54150 F2400
+G1 X1.673 Y19.127 E112.59695 F2400
+G1 X0.000 Y19.200 E112.65239 F2400
+G1 X-1.673 Y19.127 E112.70783 F2400
+G1 X-3.334 Y18.908 E112.76327 F2400
+G1 X-4.969 Y18.546 E112.81871 F2400
+G1 X-6.567 Y18.042 E112.87416 F2400
+G1 X-8.114 Y17.401 E112.92960 F2400
+G1 X-9.600 Y16.628 E112.98504 F2400
+G1 X-11.013 Y15.728 E113.04048 F2400
+G1 X-12.342 Y14.708 E113.09592 F2400
+G1 X-13.576 Y13.576 E113.15136 F2400
+G1 X-14.708 Y12.342 E113.20681 F2400
+G1 X-15.728 Y11.013 E113.26225 F2400
+G1 X-16.628 Y9.600 E113.31769 F2400
+G1 X-17.401 Y8.114 E113.37313 F2400
+G1 X-18.042 Y6.567 E113.42857 F2400
+G1 X-18.546 Y4.969 E113.48402 F2400
+G1 X-18.908 Y3.334 E113.53946 F2400
+G1 X-19.127 Y1.673 E113.59490 F2400
+G1 X-19.200 Y0.000 E113.65034 F2400
+G1 X-19.127 Y-1.673 E113.70578 F2400
+G1 X-18.908 Y-3.334 E113.76123 F2400
+G1 X-18.546 Y-4.969 E113.81667 F2400
+G1 X-18.042 Y-6.567 E113.87211 F2400
+G1 X-17.401 Y-8.114 E113.92755 F2400
+G1 X-16.628 Y-9.600 E113.98299 F2400
+G1 X-15.728 Y-11.013 E114.03844 F2400
+G1 X-14.708 Y-12.342 E114.09388 F2400
+G1 X-13.576 Y-13.576 E114.14932 F2400
+G1 X-12.342 Y-14.708 E114.20476 F2400
+G1 X-11.013 Y-15.728 E114.26020 F2400
+G1 X-9.600 Y-16.628 E114.31565 F2400
+G1 X-8.114 Y-17.401 E114.37109 F2400
+G1 X-6.567 Y-18.042 E114.42653 F2400
+G1 X-4.969 Y-18.546 E114.48197 F2400
+G1 X-3.334 Y-18.908 E114.53741 F2400
+G1 X-1.673 Y-19.127 E114.59286 F2400
+G1 X-0.000 Y-19.200 E114.64830 F2400
+G1 X1.673 Y-19.127 E114.70374 F2400
+G1 X3.334 Y-18.908 E114.75918 F2400
+G1 X4.969 Y-18.546 E114.81462 F2400
+G1 X6.567 Y-18.042 E114.87007 F2400
+G1 X8.114 Y-17.401 E114.92551 F2400
+G1 X9.600 Y-16.628 E114.98095 F2400
+G1 X11.013 Y-15.728 E115.03639 F2400
+G1 X12.342 Y-14.708 E115.09183 F2400
+G1 X13.576 Y-13.576 E115.14728 F2400
+G1 X14.708 Y-12.342 E115.20272 F2400
+G1 X15.728 Y-11.013 E115.25816 F2400
+G1 X16.628 Y-9.600 E115.31360 F2400
+G1 X17.401 Y-8.114 E115.36904 F2400
+G1 X18.042 Y-6.567 E115.42449 F2400
+G1 X18.546 Y-4.969 E115.47993 F2400
+G1 X18.908 Y-3.334 E115.53537 F2400
+G1 X19.127 Y-1.673 E115.59081 F2400
+G1 X19.200 Y-0.000 E115.64625 F2400
+G1 E114.64625 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E115.64625 F2400
+G1 X-12.000 Y12.000 E116.44065 F3600
+G1 X-11.200 Y12.000 E116.46713 F3600
+G1 X-11.200 Y-12.000 E117.26153 F3600
+G1 X-10.400 Y-12.000 E117.28801 F3600
+G1 X-10.400 Y12.000 E118.08241 F3600
+G1 X-9.600 Y12.000 E118.10889 F3600
+G1 X-9.600 Y-12.000 E118.90329 F3600
+G1 X-8.800 Y-12.000 E118.92977 F3600
+G1 X-8.800 Y12.000 E119.72417 F3600
+G1 X-8.000 Y12.000 E119.75065 F3600
+G1 X-8.000 Y-12.000 E120.54505 F3600
+G1 X-7.200 Y-12.000 E120.57153 F3600
+G1 X-7.200 Y12.000 E121.36593 F3600
+G1 X-6.400 Y12.000 E121.39241 F3600
+G1 X-6.400 Y-12.000 E122.18681 F3600
+G1 X-5.600 Y-12.000 E122.21329 F3600
+G1 X-5.600 Y12.000 E123.00769 F3600
+G1 X-4.800 Y12.000 E123.03417 F3600
+G1 X-4.800 Y-12.000 E123.82857 F3600
+G1 X-4.000 Y-12.000 E123.85505 F3600
+G1 X-4.000 Y12.000 E124.64945 F3600
+G1 X-3.200 Y12.000 E124.67593 F3600
+G1 X-3.200 Y-12.000 E125.47033 F3600
+G1 X-2.400 Y-12.000 E125.49681 F3600
+G1 X-2.400 Y12.000 E126.29121 F3600
+G1 X-1.600 Y12.000 E126.31769 F3600
+G1 X-1.600 Y-12.000 E127.11209 F3600
+G1 X-0.800 Y-12.000 E127.13857 F3600
+G1 X-0.800 Y12.000 E127.93297 F3600
+G1 X0.000 Y12.000 E127.95945 F3600
+G1 X0.000 Y-12.000 E128.75385 F3600
+G1 X0.800 Y-12.000 E128.78033 F3600
+G1 X0.800 Y12.000 E129.57473 F3600
+G1 X1.600 Y12.000 E129.60121 F3600
+G1 X1.600 Y-12.000 E130.39561 F3600
+G1 X2.400 Y-12.000 E130.42209 F3600
+G1 X2.400 Y12.000 E131.21649 F3600
+G1 X3.200 Y12.000 E131.24297 F3600
+G1 X3.200 Y-12.000 E132.03737 F3600
+G1 X4.000 Y-12.000 E132.06385 F3600
+G1 X4.000 Y12.000 E132.85825 F3600
+G1 X4.800 Y12.000 E132.88473 F3600
+G1 X4.800 Y-12.000 E133.67913 F3600
+G1 X5.600 Y-12.000 E133.70561 F3600
+G1 X5.600 Y12.000 E134.50001 F3600
+G1 X6.400 Y12.000 E134.52649 F3600
+G1 X6.400 Y-12.000 E135.32089 F3600
+G1 X7.200 Y-12.000 E135.34737 F3600
+G1 X7.200 Y12.000 E136.14177 F3600
+G1 X8.000 Y12.000 E136.16825 F3600
+G1 X8.000 Y-12.000 E136.96265 F3600
+G1 X8.800 Y-12.000 E136.98913 F3600
+G1 X8.800 Y12.000 E137.78353 F3600
+G1 X9.600 Y12.000 E137.81001 F3600
+G1 X9.600 Y-12.000 E138.60441 F3600
+G1 X10.400 Y-12.000 E138.63089 F3600
+G1 X10.400 Y12.000 E139.42529 F3600
+G1 X11.200 Y12.000 E139.45177 F3600
+G1 X11.200 Y-12.000 E140.24617 F3600
+G1 X12.000 Y-12.000 E140.27265 F3600
+G1 X12.000 Y12.000 E141.06705 F3600
+;LAYER:22
+G1 Z4.60 F1200
+G1 E140.06705 F2400
+G1 X20.000 Y0.000 F9000
+G1 E141.06705 F2400
+G1 X19.924 Y1.743 E141.12481 F1800
+G1 X19.696 Y3.473 E141.18256 F1800
+G1 X19.319 Y5.176 E141.24031 F1800
+G1 X18.794 Y6.840 E141.29806 F1800
+G1 X18.126 Y8.452 E141.35581 F1800
+G1 X17.321 Y10.000 E141.41357 F1800
+G1 X16.383 Y11.472 E141.47132 F1800
+G1 X15.321 Y12.856 E141.52907 F1800
+G1 X14.142 Y14.142 E141.58682 F1800
+G1 X12.856 Y15.321 E141.64458 F1800
+G1 X11.472 Y16.383 E141.70233 F1800
+G1 X10.000 Y17.321 E141.76008 F1800
+G1 X8.452 Y18.126 E141.81783 F1800
+G1 X6.840 Y18.794 E141.87558 F1800
+G1 X5.176 Y19.319 E141.93334 F1800
+G1 X3.473 Y19.696 E141.99109 F1800
+G1 X1.743 Y19.924 E142.04884 F1800
+G1 X0.000 Y20.000 E142.10659 F1800
+G1 X-1.743 Y19.924 E142.16434 F1800
+G1 X-3.473 Y19.696 E142.22210 F1800
+G1 X-5.176 Y19.319 E142.27985 F1800
+G1 X-6.840 Y18.794 E142.33760 F1800
+G1 X-8.452 Y18.126 E142.39535 F1800
+G1 X-10.000 Y17.321 E142.45310 F1800
+G1 X-11.472 Y16.383 E142.51086 F1800
+G1 X-12.856 Y15.321 E142.56861 F1800
+G1 X-14.142 Y14.142 E142.62636 F1800
+G1 X-15.321 Y12.856 E142.68411 F1800
+G1 X-16.383 Y11.472 E142.74186 F1800
+G1 X-17.321 Y10.000 E142.79962 F1800
+G1 X-18.126 Y8.452 E142.85737 F1800
+G1 X-18.794 Y6.840 E142.91512 F1800
+G1 X-19.319 Y5.176 E142.97287 F1800
+G1 X-19.696 Y3.473 E143.03062 F1800
+G1 X-19.924 Y1.743 E143.08838 F1800
+G1 X-20.000 Y0.000 E143.14613 F1800
+G1 X-19.924 Y-1.743 E143.20388 F1800
+G1 X-19.696 Y-3.473 E143.26163 F1800
+G1 X-19.319 Y-5.176 E143.31939 F1800
+G1 X-18.794 Y-6.840 E143.37714 F1800
+G1 X-18.126 Y-8.452 E143.43489 F1800
+G1 X-17.321 Y-10.000 E143.49264 F1800
+G1 X-16.383 Y-11.472 E143.55039 F1800
+G1 X-15.321 Y-12.856 E143.60815 F1800
+G1 X-14.142 Y-14.142 E143.66590 F1800
+G1 X-12.856 Y-15.321 E143.72365 F1800
+G1 X-11.472 Y-16.383 E143.78140 F1800
+G1 X-10.000 Y-17.321 E143.83915 F1800
+G1 X-8.452 Y-18.126 E143.89691 F1800
+G1 X-6.840 Y-18.794 E143.95466 F1800
+G1 X-5.176 Y-19.319 E144.01241 F1800
+G1 X-3.473 Y-19.696 E144.07016 F1800
+G1 X-1.743 Y-19.924 E144.12791 F1800
+G1 X-0.000 Y-20.000 E144.18567 F1800
+G1 X1.743 Y-19.924 E144.24342 F1800
+G1 X3.473 Y-19.696 E144.30117 F1800
+G1 X5.176 Y-19.319 E144.35892 F1800
+G1 X6.840 Y-18.794 E144.41667 F1800
+G1 X8.452 Y-18.126 E144.47443 F1800
+G1 X10.000 Y-17.321 E144.53218 F1800
+G1 X11.472 Y-16.383 E144.58993 F1800
+G1 X12.856 Y-15.321 E144.64768 F1800
+G1 X14.142 Y-14.142 E144.70543 F1800
+G1 X15.321 Y-12.856 E144.76319 F1800
+G1 X16.383 Y-11.472 E144.82094 F1800
+G1 X17.321 Y-10.000 E144.87869 F1800
+G1 X18.126 Y-8.452 E144.93644 F1800
+G1 X18.794 Y-6.840 E144.99419 F1800
+G1 X19.319 Y-5.176 E145.05195 F1800
+G1 X19.696 Y-3.473 E145.10970 F1800
+G1 X19.924 Y-1.743 E145.16745 F1800
+G1 X20.000 Y-0.000 E145.22520 F1800
+G1 X19.525 Y1.708 E145.28389 F2400
+G1 X19.302 Y3.404 E145.34048 F2400
+G1 X18.932 Y5.073 E145.39708 F2400
+G1 X18.418 Y6.704 E145.45368 F2400
+G1 X17.764 Y8.283 E145.51028 F2400
+G1 X16.974 Y9.800 E145.56687 F2400
+G1 X16.055 Y11.242 E145.62347 F2400
+G1 X15.014 Y12.599 E145.68007 F2400
+G1 X13.859 Y13.859 E145.73666 F2400
+G1 X12.599 Y15.014 E145.79326 F2400
+G1 X11.242 Y16.055 E145.84986 F2400
+G1 X9.800 Y16.974 E145.90646 F2400
+G1 X8.283 Y17.764 E145.96305 F2400
+G1 X6.704 Y18.418 E146.01965 F2400
+G1 X5.073 Y18.932 E146.07625 F2400
+G1 X3.404 Y19.302 E146.13284 F2400
+G1 X1.708 Y19.525 E146.18944 F2400
+G1 X0.000 Y19.600 E146.24604 F2400
+G1 X-1.708 Y19.525 E146.30263 F2400
+G1 X-3.404 Y19.302 E146.35923 F2400
+G1 X-5.073 Y18.932 E146.41583 F2400
+G1 X-6.704 Y18.418 E146.47243 F2400
+G1 X-8.283 Y17.764 E146.52902 F2400
+G1 X-9.800 Y16.974 E146.58562 F2400
+G1 X-11.242 Y16.055 E146.64222 F2400
+G1 X-12.599 Y15.014 E146.69881 F2400
+G1 X-13.859 Y13.859 E146.75541 F2400
+G1 X-15.014 Y12.599 E146.81201 F2400
+G1 X-16.055 Y11.242 E146.86860 F2400
+G1 X-16.974 Y9.800 E146.92520 F2400
+G1 X-17.764 Y8.283 E146.98180 F2400
+G1 X-18.418 Y6.704 E147.03840 F2400
+G1 X-18.932 Y5.073 E147.09499 F2400
+G1 X-19.302 Y3.404 E147.15159 F2400
+G1 X-19.525 Y1.708 E147.20819 F2400
+G1 X-19.600 Y0.000 E147.26478 F2400
+G1 X-19.525 Y-1.708 E147.32138 F2400
+G1 X-19.302 Y-3.404 E147.37798 F2400
+G1 X-18.932 Y-5.073 E147.43458 F2400
+G1 X-18.418 Y-6.704 E147.49117 F2400
+G1 X-17.764 Y-8.283 E147.54777 F2400
+G1 X-16.974 Y-9.800 E147.60437 F2400
+G1 X-16.055 Y-11.242 E147.66096 F2400
+G1 X-15.014 Y-12.599 E147.71756 F2400
+G1 X-13.859 Y-13.859 E147.77416 F2400
+G1 X-12.599 Y-15.014 E147.83075 F2400
+G1 X-11.242 Y-16.055 E147.88735 F2400
+G1 X-9.800 Y-16.974 E147.94395 F2400
+G1 X-8.283 Y-17.764 E148.00055 F2400
+G1 X-6.704 Y-18.418 E148.05714 F2400
+G1 X-5.073 Y-18.932 E148.11374 F2400
+G1 X-3.404 Y-19.302 E148.17034 F2400
+G1 X-1.708 Y-19.525 E148.22693 F2400
+G1 X-0.000 Y-19.600 E148.28353 F2400
+G1 X1.708 Y-19.525 E148.34013 F2400
+G1 X3.404 Y-19.302 E148.39672 F2400
+G1 X5.073 Y-18.932 E148.45332 F2400
+G1 X6.704 Y-18.418 E148.50992 F2400
+G1 X8.283 Y-17.764 E148.56652 F2400
+G1 X9.800 Y-16.974 E148.62311 F2400
+G1 X11.242 Y-16.055 E148.67971 F2400
+G1 X12.599 Y-15.014 E148.73631 F2400
+G1 X13.859 Y-13.859 E148.79290 F2400
+G1 X15.014 Y-12.599 E148.84950 F2400
+G1 X16.055 Y-11.242 E148.90610 F2400
+G1 X16.974 Y-9.800 E148.96269 F2400
+G1 X17.764 Y-8.283 E149.01929 F2400
+G1 X18.418 Y-6.704 E149.07589 F2400
+G1 X18.932 Y-5.073 E149.13249 F2400
+G1 X19.302 Y-3.404 E149.18908 F2400
+G1 X19.525 Y-1.708 E149.24568 F2400
+G1 X19.600 Y-0.000 E149.30228 F2400
+G1 X19.127 Y1.673 E149.35984 F2400
+G1 X18.908 Y3.334 E149.41528 F2400
+G1 X18.546 Y4.969 E149.47072 F2400
+G1 X18.042 Y6.567 E149.52616 F2400
+G1 X17.401 Y8.114 E149.58160 F2400
+G1 X16.628 Y9.600 E149.63705 F2400
+G1 X15.728 Y11.013 E149.69249 F2400
+G1 X14.708 Y12.342 E149.74793 F2400
+G1 X13.576 Y13.576 E149.80337 F2400
+G1 X12.342 Y14.708 E149.85881 F2400
+G1 X11.013 Y15.728 E149.91426 F2400
+G1 X9.600 Y16.628 E149.96970 F2400
+G1 X8.114 Y17.401 E150.02514 F2400
+G1 X6.567 Y18.042 E150.08058 F2400
+G1 X4.969 Y18.546 E150.13602 F2400
+G1 X3.334 Y18.908 E150.19147 F2400
+G1 X1.673 Y19.127 E150.24691 F2400
+G1 X0.000 Y19.200 E150.30235 F2400
+G1 X-1.673 Y19.127 E150.35779 F2400
+G1 X-3.334 Y18.908 E150.41323 F2400
+G1 X-4.969 Y18.546 E150.46868 F2400
+G1 X-6.567 Y18.042 E150.52412 F2400
+G1 X-8.114 Y17.401 E150.57956 F2400
+G1 X-9.600 Y16.628 E150.63500 F2400
+G1 X-11.013 Y15.728 E150.69044 F2400
+G1 X-12.342 Y14.708 E150.74589 F2400
+G1 X-13.576 Y13.576 E150.80133 F2400
+G1 X-14.708 Y12.342 E150.85677 F2400
+G1 X-15.728 Y11.013 E150.91221 F2400
+G1 X-16.628 Y9.600 E150.96765 F2400
+G1 X-17.401 Y8.114 E151.02310 F2400
+G1 X-18.042 Y6.567 E151.07854 F2400
+G1 X-18.546 Y4.969 E151.13398 F2400
+G1 X-18.908 Y3.334 E151.18942 F2400
+G1 X-19.127 Y1.673 E151.24486 F2400
+G1 X-19.200 Y0.000 E151.30031 F2400
+G1 X-19.127 Y-1.673 E151.35575 F2400
+G1 X-18.908 Y-3.334 E151.41119 F2400
+G1 X-18.546 Y-4.969 E151.46663 F2400
+G1 X-18.042 Y-6.567 E151.52207 F2400
+G1 X-17.401 Y-8.114 E151.57752 F2400
+G1 X-16.628 Y-9.600 E151.63296 F2400
+G1 X-15.728 Y-11.013 E151.68840 F2400
+G1 X-14.708 Y-12.342 E151.74384 F2400
+G1 X-13.576 Y-13.576 E151.79928 F2400
+G1 X-12.342 Y-14.708 E151.85473 F2400
+G1 X-11.013 Y-15.728 E151.91017 F2400
+G1 X-9.600 Y-16.628 E151.96561 F2400
+G1 X-8.114 Y-17.401 E152.02105 F2400
+G1 X-6.567 Y-18.042 E152.07649 F2400
+G1 X-4.969 Y-18.546 E152.13194 F2400
+G1 X-3.334 Y-18.908 E152.18738 F2400
+G1 X-1.673 Y-19.127 E152.24282 F2400
+G1 X-0.000 Y-19.200 E152.29826 F2400
+G1 X1.673 Y-19.127 E152.35370 F2400
+G1 X3.334 Y-18.908 E152.40915 F2400
+G1 X4.969 Y-18.546 E152.46459 F2400
+G1 X6.567 Y-18.042 E152.52003 F2400
+G1 X8.114 Y-17.401 E152.57547 F2400
+G1 X9.600 Y-16.628 E152.63091 F2400
+G1 X11.013 Y-15.728 E152.68636 F2400
+G1 X12.342 Y-14.708 E152.74180 F2400
+G1 X13.576 Y-13.576 E152.79724 F2400
+G1 X14.708 Y-12.342 E152.85268 F2400
+G1 X15.728 Y-11.013 E152.90812 F2400
+G1 X16.628 Y-9.600 E152.96357 F2400
+G1 X17.401 Y-8.114 E153.01901 F2400
+G1 X18.042 Y-6.567 E153.07445 F2400
+G1 X18.546 Y-4.969 E153.12989 F2400
+G1 X18.908 Y-3.334 E153.18533 F2400
+G1 X19.127 Y-1.673 E153.24078 F2400
+G1 X19.200 Y-0.000 E153.29622 F2400
+G1 E152.29622 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E153.29622 F2400
+G1 X12.000 Y-12.000 E154.09062 F3600
+G1 X12.000 Y-11.000 E154.12372 F3600
+G1 X-12.000 Y-11.000 E154.91812 F3600
+G1 X-12.000 Y-10.000 E154.95122 F3600
+G1 X12.000 Y-10.000 E155.74562 F3600
+G1 X12.000 Y-9.000 E155.77872 F3600
+G1 X-12.000 Y-9.000 E156.57312 F3600
+G1 X-12.000 Y-8.000 E156.60622 F3600
+G1 X12.000 Y-8.000 E157.40062 F3600
+G1 X12.000 Y-7.000 E157.43372 F3600
+G1 X-12.000 Y-7.000 E158.22812 F3600
+G1 X-12.000 Y-6.000 E158.26122 F3600
+G1 X12.000 Y-6.000 E159.05562 F3600
+G1 X12.000 Y-5.000 E159.08872 F3600
+G1 X-12.000 Y-5.000 E159.88312 F3600
+G1 X-12.000 Y-4.000 E159.91622 F3600
+G1 X12.000 Y-4.000 E160.71062 F3600
+G1 X12.000 Y-3.000 E160.74372 F3600
+G1 X-12.000 Y-3.000 E161.53812 F3600
+G1 X-12.000 Y-2.000 E161.57122 F3600
+G1 X12.000 Y-2.000 E162.36562 F3600
+G1 X12.000 Y-1.000 E162.39872 F3600
+G1 X-12.000 Y-1.000 E163.19312 F3600
+G1 X-12.000 Y0.000 E163.22622 F3600
+G1 X12.000 Y0.000 E164.02062 F3600
+G1 X12.000 Y1.000 E164.05372 F3600
+G1 X-12.000 Y1.000 E164.84812 F3600
+G1 X-12.000 Y2.000 E164.88122 F3600
+G1 X12.000 Y2.000 E165.67562 F3600
+G1 X12.000 Y3.000 E165.70872 F3600
+G1 X-12.000 Y3.000 E166.50312 F3600
+G1 X-12.000 Y4.000 E166.53622 F3600
+G1 X12.000 Y4.000 E167.33062 F3600
+G1 X12.000 Y5.000 E167.36372 F3600
+G1 X-12.000 Y5.000 E168.15812 F3600
+G1 X-12.000 Y6.000 E168.19122 F3600
+G1 X12.000 Y6.000 E168.98562 F3600
+G1 X12.000 Y7.000 E169.01872 F3600
+G1 X-12.000 Y7.000 E169.81312 F3600
+G1 X-12.000 Y8.000 E169.84622 F3600
+G1 X12.000 Y8.000 E170.64062 F3600
+G1 X12.000 Y9.000 E170.67372 F3600
+G1 X-12.000 Y9.000 E171.46812 F3600
+G1 X-12.000 Y10.000 E171.50122 F3600
+G1 X12.000 Y10.000 E172.29562 F3600
+G1 X12.000 Y11.000 E172.32872 F3600
+G1 X-12.000 Y11.000 E173.12312 F3600
+G1 X-12.000 Y12.000 E173.15622 F3600
+G1 X12.000 Y12.000 E173.95062 F3600
+;LAYER:23
+G1 Z4.80 F1200
+G1 E172.95062 F2400
+G1 X20.000 Y0.000 F9000
+G1 E173.95062 F2400
+G1 X19.924 Y1.743 E174.00837 F1800
+G1 X19.696 Y3.473 E174.06612 F1800
+G1 X19.319 Y5.176 E174.12387 F1800
+G1 X18.794 Y6.840 E174.18163 F1800
+G1 X18.126 Y8.452 E174.23938 F1800
+G1 X17.321 Y10.000 E174.29713 F1800
+G1 X16.383 Y11.472 E174.35488 F1800
+G1 X15.321 Y12.856 E174.41263 F1800
+G1 X14.142 Y14.142 E174.47039 F1800
+G1 X12.856 Y15.321 E174.52814 F1800
+G1 X11.472 Y16.383 E174.58589 F1800
+G1 X10.000 Y17.321 E174.64364 F1800
+G1 X8.452 Y18.126 E174.70139 F1800
+G1 X6.840 Y18.794 E174.75915 F1800
+G1 X5.176 Y19.319 E174.81690 F1800
+G1 X3.473 Y19.696 E174.87465 F1800
+G1 X1.743 Y19.924 E174.93240 F1800
+G1 X0.000 Y20.000 E174.99016 F1800
+G1 X-1.743 Y19.924 E175.04791 F1800
+G1 X-3.473 Y19.696 E175.10566 F1800
+G1 X-5.176 Y19.319 E175.16341 F1800
+G1 X-6.840 Y18.794 E175.22116 F1800
+G1 X-8.452 Y18.126 E175.27892 F1800
+G1 X-10.000 Y17.321 E175.33667 F1800
+G1 X-11.472 Y16.383 E175.39442 F1800
+G1 X-12.856 Y15.321 E175.45217 F1800
+G1 X-14.142 Y14.142 E175.50992 F1800
+G1 X-15.321 Y12.856 E175.56768 F1800
+G1 X-16.383 Y11.472 E175.62543 F1800
+G1 X-17.321 Y10.000 E175.68318 F1800
+G1 X-18.126 Y8.452 E175.74093 F1800
+G1 X-18.794 Y6.840 E175.79868 F1800
+G1 X-19.319 Y5.176 E175.85644 F1800
+G1 X-19.696 Y3.473 E175.91419 F1800
+G1 X-19.924 Y1.743 E175.97194 F1800
+G1 X-20.000 Y0.000 E176.02969 F1800
+G1 X-19.924 Y-1.743 E176.08744 F1800
+G1 X-19.696 Y-3.473 E176.14520 F1800
+G1 X-19.319 Y-5.176 E176.20295 F1800
+G1 X-18.794 Y-6.840 E176.26070 F1800
+G1 X-18.126 Y-8.452 E176.31845 F1800
+G1 X-17.321 Y-10.000 E176.37620 F1800
+G1 X-16.383 Y-11.472 E176.43396 F1800
+G1 X-15.321 Y-12.856 E176.49171 F1800
+G1 X-14.142 Y-14.142 E176.54946 F1800
+G1 X-12.856 Y-15.321 E176.60721 F1800
+G1 X-11.472 Y-16.383 E176.66497 F1800
+G1 X-10.000 Y-17.321 E176.72272 F1800
+G1 X-8.452 Y-18.126 E176.78047 F1800
+G1 X-6.840 Y-18.794 E176.83822 F1800
+G1 X-5.176 Y-19.319 E176.89597 F1800
+G1 X-3.473 Y-19.696 E176.95373 F1800
+G1 X-1.743 Y-19.924 E177.01148 F1800
+G1 X-0.000 Y-20.000 E177.06923 F1800
+G1 X1.743 Y-19.924 E177.12698 F1800
+G1 X3.473 Y-19.696 E177.18473 F1800
+G1 X5.176 Y-19.319 E177.24249 F1800
+G1 X6.840 Y-18.794 E177.30024 F1800
+G1 X8.452 Y-18.126 E177.35799 F1800
+G1 X10.000 Y-17.321 E177.41574 F1800
+G1 X11.472 Y-16.383 E177.47349 F1800
+G1 X12.856 Y-15.321 E177.53125 F1800
+G1 X14.142 Y-14.142 E177.58900 F1800
+G1 X15.321 Y-12.856 E177.64675 F1800
+G1 X16.383 Y-11.472 E177.70450 F1800
+G1 X17.321 Y-10.000 E177.76225 F1800
+G1 X18.126 Y-8.452 E177.82001 F1800
+G1 X18.794 Y-6.840 E177.87776 F1800
+G1 X19.319 Y-5.176 E177.93551 F1800
+G1 X19.696 Y-3.473 E177.99326 F1800
+G1 X19.924 Y-1.743 E178.05101 F1800
+G1 X20.000 Y-0.000 E178.10877 F1800
+G1 X19.525 Y1.708 E178.16745 F2400
+G1 X19.302 Y3.404 E178.22405 F2400
+G1 X18.932 Y5.073 E178.28065 F2400
+G1 X18.418 Y6.704 E178.33724 F2400
+G1 X17.764 Y8.283 E178.39384 F2400
+G1 X16.974 Y9.800 E178.45044 F2400
+G1 X16.055 Y11.242 E178.50703 F2400
+G1 X15.014 Y12.599 E178.56363 F2400
+G1 X13.859 Y13.859 E178.62023 F2400
+G1 X12.599 Y15.014 E178.67682 F2400
+G1 X11.242 Y16.055 E178.73342 F2400
+G1 X9.800 Y16.974 E178.79002 F2400
+G1 X8.283 Y17.764 E178.84662 F2400
+G1 X6.704 Y18.418 E178.90321 F2400
+G1 X5.073 Y18.932 E178.95981 F2400
+G1 X3.404 Y19.302 E179.01641 F2400
+G1 X1.708 Y19.525 E179.07300 F2400
+G1 X0.000 Y19.600 E179.12960 F2400
+G1 X-1.708 Y19.525 E179.18620 F2400
+G1 X-3.404 Y19.302 E179.24280 F2400
+G1 X-5.073 Y18.932 E179.29939 F2400
+G1 X-6.704 Y18.418 E179.35599 F2400
+G1 X-8.283 Y17.764 E179.41259 F2400
+G1 X-9.800 Y16.974 E179.46918 F2400
+G1 X-11.242 Y16.055 E179.52578 F2400
+G1 X-12.599 Y15.014 E179.58238 F2400
+G1 X-13.859 Y13.859 E179.63897 F2400
+G1 X-15.014 Y12.599 E179.69557 F2400
+G1 X-16.055 Y11.242 E179.75217 F2400
+G1 X-16.974 Y9.800 E179.80877 F2400
+G1 X-17.764 Y8.283 E179.86536 F2400
+G1 X-18.418 Y6.704 E179.92196 F2400
+G1 X-18.932 Y5.073 E179.97856 F2400
+G1 X-19.302 Y3.404 E180.03515 F2400
+G1 X-19.525 Y1.708 E180.09175 F2400
+G1 X-19.600 Y0.000 E180.14835 F2400
+G1 X-19.525 Y-1.708 E180.20494 F2400
+G1 X-19.302 Y-3.404 E180.26154 F2400
+G1 X-18.932 Y-5.073 E180.31814 F2400
+G1 X-18.418 Y-6.704 E180.37474 F2400
+G1 X-17.764 Y-8.283 E180.43133 F2400
+G1 X-16.974 Y-9.800 E180.48793 F2400
+G1 X-16.055 Y-11.242 E180.54453 F2400
+G1 X-15.014 Y-12.599 E180.60112 F2400
+G1 X-13.859 Y-13.859 E180.65772 F2400
+G1 X-12.599 Y-15.014 E180.71432 F2400
+G1 X-11.242 Y-16.055 E180.77091 F2400
+G1 X-9.800 Y-16.974 E180.82751 F2400
+G1 X-8.283 Y-17.764 E180.88411 F2400
+G1 X-6.704 Y-18.418 E180.94071 F2400
+G1 X-5.073 Y-18.932 E180.99730 F2400
+G1 X-3.404 Y-19.302 E181.05390 F2400
+G1 X-1.708 Y-19.525 E181.11050 F2400
+G1 X-0.000 Y-19.600 E181.16709 F2400
+G1 X1.708 Y-19.525 E181.22369 F2400
+G1 X3.404 Y-19.302 E181.28029 F2400
+G1 X5.073 Y-18.932 E181.33689 F2400
+G1 X6.704 Y-18.418 E181.39348 F2400
+G1 X8.283 Y-17.764 E181.45008 F2400
+G1 X9.800 Y-16.974 E181.50668 F2400
+G1 X11.242 Y-16.055 E181.56327 F2400
+G1 X12.599 Y-15.014 E181.61987 F2400
+G1 X13.859 Y-13.859 E181.67647 F2400
+G1 X15.014 Y-12.599 E181.73306 F2400
+G1 X16.055 Y-11.242 E181.78966 F2400
+G1 X16.974 Y-9.800 E181.84626 F2400
+G1 X17.764 Y-8.283 E181.90286 F2400
+G1 X18.418 Y-6.704 E181.95945 F2400
+G1 X18.932 Y-5.073 E182.01605 F2400
+G1 X19.302 Y-3.404 E182.07265 F2400
+G1 X19.525 Y-1.708 E182.12924 F2400
+G1 X19.600 Y-0.000 E182.18584 F2400
+G1 X19.127 Y1.673 E182.24340 F2400
+G1 X18.908 Y3.334 E182.29884 F2400
+G1 X18.546 Y4.969 E182.35428 F2400
+G1 X18.042 Y6.567 E182.40973 F2400
+G1 X17.401 Y8.114 E182.46517 F2400
+G1 X16.628 Y9.600 E182.52061 F2400
+G1 X15.728 Y11.013 E182.57605 F2400
+G1 X14.708 Y12.342 E182.63149 F2400
+G1 X13.576 Y13.576 E182.68694 F2400
+G1 X12.342 Y14.708 E182.74238 F2400
+G1 X11.013 Y15.728 E182.79782 F2400
+G1 X9.600 Y16.628 E182.85326 F2400
+G1 X8.114 Y17.401 E182.90870 F2400
+G1 X6.567 Y18.042 E182.96415 F2400
+G1 X4.969 Y18.546 E183.01959 F2400
+G1 X3.334 Y18.908 E183.07503 F2400
+G1 X1.673 Y19.127 E183.13047 F2400
+G1 X0.000 Y19.200 E183.18591 F2400
+G1 X-1.673 Y19.127 E183.24136 F2400
+G1 X-3.334 Y18.908 E183.29680 F2400
+G1 X-4.969 Y18.546 E183.35224 F2400
+G1 X-6.567 Y18.042 E183.40768 F2400
+G1 X-8.114 Y17.401 E183.46312 F2400
+G1 X-9.600 Y16.628 E183.51857 F2400
+G1 X-11.013 Y15.728 E183.57401 F2400
+G1 X-12.342 Y14.708 E183.62945 F2400
+G1 X-13.576 Y13.576 E183.68489 F2400
+G1 X-14.708 Y12.342 E183.74033 F2400
+G1 X-15.728 Y11.013 E183.79578 F2400
+G1 X-16.628 Y9.600 E183.85122 F2400
+G1 X-17.401 Y8.114 E183.90666 F2400
+G1 X-18.042 Y6.567 E183.96210 F2400
+G1 X-18.546 Y4.969 E184.01754 F2400
+G1 X-18.908 Y3.334 E184.07299 F2400
+G1 X-19.127 Y1.673 E184.12843 F2400
+G1 X-19.200 Y0.000 E184.18387 F2400
+G1 X-19.127 Y-1.673 E184.23931 F2400
+G1 X-18.908 Y-3.334 E184.29475 F2400
+G1 X-18.546 Y-4.969 E184.35020 F2400
+G1 X-18.042 Y-6.567 E184.40564 F2400
+G1 X-17.401 Y-8.114 E184.46108 F2400
+G1 X-16.628 Y-9.600 E184.51652 F2400
+G1 X-15.728 Y-11.013 E184.57196 F2400
+G1 X-14.708 Y-12.342 E184.62741 F2400
+G1 X-13.576 Y-13.576 E184.68285 F2400
+G1 X-12.342 Y-14.708 E184.73829 F2400
+G1 X-11.013 Y-15.728 E184.79373 F2400
+G1 X-9.600 Y-16.628 E184.84917 F2400
+G1 X-8.114 Y-17.401 E184.90462 F2400
+G1 X-6.567 Y-18.042 E184.96006 F2400
+G1 X-4.969 Y-18.546 E185.01550 F2400
+G1 X-3.334 Y-18.908 E185.07094 F2400
+G1 X-1.673 Y-19.127 E185.12638 F2400
+G1 X-0.000 Y-19.200 E185.18183 F2400
+G1 X1.673 Y-19.127 E185.23727 F2400
+G1 X3.334 Y-18.908 E185.29271 F2400
+G1 X4.969 Y-18.546 E185.34815 F2400
+G1 X6.567 Y-18.042 E185.40359 F2400
+G1 X8.114 Y-17.401 E185.45904 F2400
+G1 X9.600 Y-16.628 E185.51448 F2400
+G1 X11.013 Y-15.728 E185.56992 F2400
+G1 X12.342 Y-14.708 E185.62536 F2400
+G1 X13.576 Y-13.576 E185.68080 F2400
+G1 X14.708 Y-12.342 E185.73625 F2400
+G1 X15.728 Y-11.013 E185.79169 F2400
+G1 X16.628 Y-9.600 E185.84713 F2400
+G1 X17.401 Y-8.114 E185.90257 F2400
+G1 X18.042 Y-6.567 E185.95801 F2400
+G1 X18.546 Y-4.969 E186.01346 F2400
+G1 X18.908 Y-3.334 E186.06890 F2400
+G1 X19.127 Y-1.673 E186.12434 F2400
+G1 X19.200 Y-0.000 E186.17978 F2400
+G1 E185.17978 F2400
+G1 X-12.000 Y-12.000 F9000
+G1 E186.17978 F2400
+G1 X-12.000 Y12.000 E186.97418 F3600
+G1 X-11.200 Y12.000 E187.00066 F3600
+G1 X-11.200 Y-12.000 E187.79506 F3600
+G1 X-10.400 Y-12.000 E187.82154 F3600
+G1 X-10.400 Y12.000 E188.61594 F3600
+G1 X-9.600 Y12.000 E188.64242 F3600
+G1 X-9.600 Y-12.000 E189.43682 F3600
+G1 X-8.800 Y-12.000 E189.46330 F3600
+G1 X-8.800 Y12.000 E190.25770 F3600
+G1 X-8.000 Y12.000 E190.28418 F3600
+G1 X-8.000 Y-12.000 E191.07858 F3600
+G1 X-7.200 Y-12.000 E191.10506 F3600
+G1 X-7.200 Y12.000 E191.89946 F3600
+G1 X-6.400 Y12.000 E191.92594 F3600
+G1 X-6.400 Y-12.000 E192.72034 F3600
+G1 X-5.600 Y-12.000 E192.74682 F3600
+G1 X-5.600 Y12.000 E193.54122 F3600
+G1 X-4.800 Y12.000 E193.56770 F3600
+G1 X-4.800 Y-12.000 E194.36210 F3600
+G1 X-4.000 Y-12.000 E194.38858 F3600
+G1 X-4.000 Y12.000 E195.18298 F3600
+G1 X-3.200 Y12.000 E195.20946 F3600
+G1 X-3.200 Y-12.000 E196.00386 F3600
+G1 X-2.400 Y-12.000 E196.03034 F3600
+G1 X-2.400 Y12.000 E196.82474 F3600
+G1 X-1.600 Y12.000 E196.85122 F3600
+G1 X-1.600 Y-12.000 E197.64562 F3600
+G1 X-0.800 Y-12.000 E197.67210 F3600
+G1 X-0.800 Y12.000 E198.46650 F3600
+G1 X0.000 Y12.000 E198.49298 F3600
+G1 X0.000 Y-12.000 E199.28738 F3600
+G1 X0.800 Y-12.000 E199.31386 F3600
+G1 X0.800 Y12.000 E200.10826 F3600
+G1 X1.600 Y12.000 E200.13474 F3600
+G1 X1.600 Y-12.000 E200.92914 F3600
+G1 X2.400 Y-12.000 E200.95562 F3600
+G1 X2.400 Y12.000 E201.75002 F3600
+G1 X3.200 Y12.000 E201.77650 F3600
+G1 X3.200 Y-12.000 E202.57090 F3600
+G1 X4.000 Y-12.000 E202.59738 F3600
+G1 X4.000 Y12.000 E203.39178 F3600
+G1 X4.800 Y12.000 E203.41826 F3600
+G1 X4.800 Y-12.000 E204.21266 F3600
+G1 X5.600 Y-12.000 E204.23914 F3600
+G1 X5.600 Y12.000 E205.03354 F3600
+G1 X6.400 Y12.000 E205.06002 F3600
+G1 X6.400 Y-12.000 E205.85442 F3600
+G1 X7.200 Y-12.000 E205.88090 F3600
+G1 X7.200 Y12.000 E206.67530 F3600
+G1 X8.000 Y12.000 E206.70178 F3600
+G1 X8.000 Y-12.000 E207.49618 F3600
+G1 X8.800 Y-12.000 E207.52266 F3600
+G1 X8.800 Y12.000 E208.31706 F3600
+G1 X9.600 Y12.000 E208.34354 F3600
+G1 X9.600 Y-12.000 E209.13794 F3600
+G1 X10.400 Y-12.000 E209.16442 F3600
+G1 X10.400 Y12.000 E209.95882 F3600
+G1 X11.200 Y12.000 E209.98530 F3600
+G1 X11.200 Y-12.000 E210.77970 F3600
+G1 X12.000 Y-12.000 E210.80618 F3600
+G1 X12.000 Y12.000 E211.60058 F3600
+M107
+M104 S0 T0
+M104 S0 T1
+M140 S0
+G1 Z60 F1200
+M84
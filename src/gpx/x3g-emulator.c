@@ -0,0 +1,872 @@
+//  x3g-emulator.c
+//
+//  Pretend to be a Sailfish printer on a pseudo-terminal, so gpx -s and
+//  gpx -D can be run, and timed, without a printer
+//
+//  x3g-emulator [options] LINK [COMMAND [ARG...]]
+//
+//  LINK is made a symbolic link to the pseudo-terminal.  With a COMMAND the
+//  emulator runs it and exits with its status when it's done, otherwise it
+//  serves the first host to connect until the host closes the port.
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software Foundation,
+//  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#define _XOPEN_SOURCE 700
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "crc.h"
+
+#define FIRMWARE_VERSION 707    // Sailfish 7.7, which gpx has an eeprom map for
+#define FIRMWARE_VARIANT 0x80
+#define EEPROM_SIZE 4096
+#define BUFFER_SIZE 512         // the action buffer, as on a Replicator
+#define ACTION_MAX 1024         // most actions the buffer can hold
+#define RESPONSE_MAX 256        // most responses waiting to go out
+#define TOOL_COUNT 2
+#define AMBIENT 25.0            // degrees
+#define HEAT_RATE 2.0           // degrees per second for a nozzle
+#define PLATFORM_RATE 0.5       // and for the platform
+#define HOME_TIME 5.0           // seconds to find an axis's endstops
+
+typedef struct tHeater {
+    double temperature;     // at time
+    double time;
+    double target;
+    double rate;
+} Heater;
+
+typedef struct tAction {
+    unsigned command;
+    unsigned length;
+    double duration;        // seconds, if it doesn't wait on a heater
+    double start;
+    unsigned char packet[256];
+} Action;
+
+typedef struct tResponse {
+    double due;
+    unsigned length;
+    unsigned char frame[260];
+} Response;
+
+typedef struct tFile {
+    char name[13];
+    uint32_t length;
+} File;
+
+// options
+
+static double baudRate = 0.0;           // bytes per second, 0 for no limit
+static double latency = 0.0;            // seconds
+static double errorRate = 0.0;
+static double speed = 1.0;
+static unsigned bufferSize = BUFFER_SIZE;
+static long cancelAfter = -1;
+static FILE *record = NULL;
+static int verbose = 0;
+
+// the printer
+
+static double start;                    // host time the emulator started
+static Heater tool[TOOL_COUNT];
+static Heater platform;
+static int32_t position[5];
+static unsigned char eeprom[EEPROM_SIZE];
+static char buildName[33];
+static unsigned buildStatus = 0;
+static unsigned long buildLines = 0;
+static int cancelled = 0;
+
+static Action action[ACTION_MAX];
+static unsigned actionFirst = 0;
+static unsigned actionCount = 0;
+static unsigned actionBytes = 0;
+static double idleSince = -1.0;
+static double pausedAt = -1.0;
+
+static File files[16] = {
+    { "CALIBRAT.X3G", 51200 },
+    { "3DBENCHY.X3G", 1843200 },
+    { "TESTPART.X3G", 409600 },
+};
+static unsigned fileCount = 3;
+static unsigned fileNext = 0;
+static int capturing = -1;              // the file being captured to
+
+static Response response[RESPONSE_MAX];
+static unsigned responseFirst = 0;
+static unsigned responseCount = 0;
+static double rxLine = 0.0;             // when the line has delivered what's been read
+static double txLine = 0.0;             // when it's done sending what's been written
+
+// statistics
+
+static unsigned long packets = 0;
+static unsigned long actions = 0;
+static unsigned long queries = 0;
+static unsigned long overflows = 0;
+static unsigned long crcErrors = 0;
+static unsigned long injected = 0;
+static double idle = 0.0;
+
+static double host_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// the printer runs speed times as fast as the host's clock
+
+static double printer_time(double now)
+{
+    return (now - start) * speed;
+}
+
+static uint16_t get_16(const unsigned char *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static uint32_t get_32(const unsigned char *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static float get_float(const unsigned char *p)
+{
+    union {
+        uint32_t i;
+        float f;
+    } u;
+    u.i = get_32(p);
+    return u.f;
+}
+
+static unsigned char *put_16(unsigned char *p, unsigned value)
+{
+    *p++ = value;
+    *p++ = value >> 8;
+    return p;
+}
+
+static unsigned char *put_32(unsigned char *p, uint32_t value)
+{
+    *p++ = value;
+    *p++ = value >> 8;
+    *p++ = value >> 16;
+    *p++ = value >> 24;
+    return p;
+}
+
+// HEATERS
+
+static double heater_temperature(const Heater *heater, double time)
+{
+    double target = heater->target > 0.0 ? heater->target : AMBIENT;
+    double change = (time - heater->time) * heater->rate;
+    if(heater->temperature < target)
+        return fmin(heater->temperature + change, target);
+    return fmax(heater->temperature - change, target);
+}
+
+// when the heater reaches its target, it's always ready when it's off
+
+static double heater_ready(const Heater *heater, double time)
+{
+    if(heater->target <= 0.0) return time;
+    return time + fabs(heater->target - heater_temperature(heater, time)) / heater->rate;
+}
+
+static void heater_set(Heater *heater, double target, double time)
+{
+    heater->temperature = heater_temperature(heater, time);
+    heater->time = time;
+    heater->target = target;
+}
+
+static void heater_init(Heater *heater, double rate)
+{
+    heater->temperature = AMBIENT;
+    heater->time = 0.0;
+    heater->target = 0.0;
+    heater->rate = rate;
+}
+
+// THE ACTION BUFFER
+
+// seconds the printer takes over an action, waits are worked out when they
+// start
+
+static double action_duration(const unsigned char *packet)
+{
+    switch(packet[0]) {
+        case 131:   // find axes minimums
+        case 132: { // find axes maximums
+            unsigned axes = packet[1];
+            double time = 0.0;
+            for(; axes; axes >>= 1) {
+                if(axes & 1) time += HOME_TIME;
+            }
+            return time;
+        }
+        case 133:   // delay
+            return get_32(packet + 1) / 1000.0;
+        case 139: { // move with a DDA, the longest axis's steps at its rate
+            uint32_t longest = 0;
+            int i;
+            for(i = 0; i < 3; i++) {
+                uint32_t steps = abs((int32_t)get_32(packet + 1 + 4 * i) - position[i]);
+                if(steps > longest) longest = steps;
+            }
+            return longest * (double)get_32(packet + 21) / 1000000.0;
+        }
+        case 142:   // move with a duration
+            return get_32(packet + 21) / 1000000.0;
+        case 155: { // move with distance and feedrate
+            unsigned feedrate = get_16(packet + 26 + 4);
+            if(feedrate == 0) return 0.0;
+            return get_float(packet + 26) * 64.0 / feedrate;
+        }
+    }
+    // waits for the button are answered at once
+    return 0.0;
+}
+
+// when the action at the head of the buffer is done
+
+static double action_done(const Action *a)
+{
+    switch(a->command) {
+        case 135: { // wait for toolhead
+            unsigned id = a->packet[1];
+            double timeout = get_16(a->packet + 4);
+            if(id >= TOOL_COUNT) return a->start;
+            return fmin(heater_ready(&tool[id], a->start), a->start + timeout);
+        }
+        case 141: { // wait for platform
+            double timeout = get_16(a->packet + 4);
+            return fmin(heater_ready(&platform, a->start), a->start + timeout);
+        }
+    }
+    return a->start + a->duration;
+}
+
+static void move_to(const unsigned char *target, unsigned relative)
+{
+    int i;
+    for(i = 0; i < 5; i++) {
+        int32_t value = (int32_t)get_32(target + 4 * i);
+        if(relative & (1 << i))
+            position[i] += value;
+        else
+            position[i] = value;
+    }
+}
+
+// what an action does once it's done
+
+static void action_complete(const Action *a, double time)
+{
+    const unsigned char *packet = a->packet;
+    switch(a->command) {
+        case 136:   // tool action
+            if(packet[2] == 3 && packet[1] < TOOL_COUNT) {
+                heater_set(&tool[packet[1]], (int16_t)get_16(packet + 4), time);
+            }
+            else if(packet[2] == 31) {
+                heater_set(&platform, (int16_t)get_16(packet + 4), time);
+            }
+            break;
+        case 139:
+            move_to(packet + 1, 0);
+            break;
+        case 140:   // set extended position
+            move_to(packet + 1, 0);
+            break;
+        case 142:
+            move_to(packet + 1, packet[25]);
+            break;
+        case 155:
+            move_to(packet + 1, packet[25]);
+            break;
+        case 153:   // build start notification
+            snprintf(buildName, sizeof(buildName), "%.32s", (const char *)packet + 5);
+            buildStatus = 1;
+            buildLines = 0;
+            break;
+        case 154:   // build end notification
+            buildStatus = 2;
+            break;
+    }
+    buildLines++;
+}
+
+// run the actions that are done by now
+
+static void drain(double now)
+{
+    if(pausedAt >= 0.0) now = pausedAt;
+    while(actionCount) {
+        Action *a = &action[actionFirst];
+        double done = action_done(a);
+        if(done > now) break;
+        action_complete(a, done);
+        actionBytes -= a->length;
+        actionFirst = (actionFirst + 1) % ACTION_MAX;
+        if(--actionCount) {
+            action[actionFirst].start = done;
+            action[actionFirst].duration = action_duration(action[actionFirst].packet);
+        }
+        else {
+            idleSince = done;
+        }
+    }
+}
+
+static void clear_actions(double now)
+{
+    actionFirst = 0;
+    actionCount = 0;
+    actionBytes = 0;
+    idleSince = now;
+}
+
+// 0x81 when the action fits in the buffer, 0x82 when it doesn't
+
+static unsigned push_action(const unsigned char *packet, unsigned length, double now)
+{
+    Action *a;
+    if(actionCount == ACTION_MAX || actionBytes + length > bufferSize) {
+        overflows++;
+        return 0x82;
+    }
+    a = &action[(actionFirst + actionCount) % ACTION_MAX];
+    a->command = packet[0];
+    a->length = length;
+    memcpy(a->packet, packet, length);
+    if(actionCount++ == 0) {
+        if(idleSince >= 0.0 && buildStatus == 1) idle += now - idleSince;
+        a->start = pausedAt >= 0.0 ? pausedAt : now;
+        a->duration = action_duration(packet);
+    }
+    actionBytes += length;
+    actions++;
+    return 0x81;
+}
+
+// QUERIES
+
+static unsigned extruder_query(const unsigned char *packet, unsigned char *reply, double now)
+{
+    unsigned id = packet[1];
+    unsigned char *p = reply + 1;
+    Heater *heater = id < TOOL_COUNT ? &tool[id] : NULL;
+    switch(packet[2]) {
+        case 0:     // version
+            p = put_16(p, FIRMWARE_VERSION);
+            break;
+        case 2:     // extruder temperature
+            p = put_16(p, heater ? (int)heater_temperature(heater, now) : 0);
+            break;
+        case 22:    // is extruder ready
+            *p++ = heater ? heater_ready(heater, now) <= now : 1;
+            break;
+        case 30:    // platform temperature
+            p = put_16(p, (int)heater_temperature(&platform, now));
+            break;
+        case 32:    // extruder target temperature
+            p = put_16(p, heater ? (int)heater->target : 0);
+            break;
+        case 33:    // platform target temperature
+            p = put_16(p, (int)platform.target);
+            break;
+        case 35:    // is platform ready
+            *p++ = heater_ready(&platform, now) <= now;
+            break;
+        case 36:    // extruder status
+            *p++ = 0;
+            break;
+        case 37:    // PID state
+            memset(p, 0, 12);
+            p += 12;
+            break;
+        default:
+            reply[0] = 0x85;
+            return 1;
+    }
+    reply[0] = 0x81;
+    return p - reply;
+}
+
+static unsigned query(const unsigned char *packet, unsigned length, unsigned char *reply, double now)
+{
+    unsigned char *p = reply + 1;
+    unsigned address, count;
+    switch(packet[0]) {
+        case 0:     // version
+            p = put_16(p, FIRMWARE_VERSION);
+            break;
+        case 2:     // available buffer size
+            p = put_32(p, bufferSize - actionBytes);
+            break;
+        case 8:     // pause or resume
+            if(pausedAt < 0.0) {
+                pausedAt = now;
+            }
+            else {
+                if(actionCount) action[actionFirst].start += now - pausedAt;
+                pausedAt = -1.0;
+            }
+            break;
+        case 10:    // extruder query
+            return extruder_query(packet, reply, now);
+        case 11:    // is ready
+            *p++ = actionCount == 0;
+            break;
+        case 12:    // read from EEPROM
+            address = get_16(packet + 1);
+            count = packet[3];
+            if(address + count > EEPROM_SIZE) count = address < EEPROM_SIZE ? EEPROM_SIZE - address : 0;
+            memcpy(p, eeprom + address, count);
+            p += count;
+            break;
+        case 13:    // write to EEPROM
+            address = get_16(packet + 1);
+            count = packet[3];
+            if(count > length - 4) count = length - 4;
+            if(address + count > EEPROM_SIZE) count = address < EEPROM_SIZE ? EEPROM_SIZE - address : 0;
+            memcpy(eeprom + address, packet + 4, count);
+            *p++ = count;
+            break;
+        case 14:    // capture to file
+            if(fileCount == sizeof(files) / sizeof(files[0])) {
+                *p++ = 8;
+                break;
+            }
+            capturing = fileCount++;
+            snprintf(files[capturing].name, sizeof(files[capturing].name), "%.12s", (const char *)packet + 1);
+            files[capturing].length = 0;
+            *p++ = 0;
+            break;
+        case 15:    // end capture to file
+            p = put_32(p, capturing >= 0 ? files[capturing].length : 0);
+            capturing = -1;
+            break;
+        case 16: {  // play back capture
+            unsigned i;
+            *p = 7;
+            for(i = 0; i < fileCount; i++) {
+                if(strcmp(files[i].name, (const char *)packet + 1) == 0) {
+                    snprintf(buildName, sizeof(buildName), "%s", files[i].name);
+                    *p = 0;
+                }
+            }
+            p++;
+            break;
+        }
+        case 3:     // clear buffer
+        case 7:     // abort immediately
+        case 17:    // reset
+            clear_actions(now);
+            break;
+        case 18:    // next filename
+            if(packet[1]) fileNext = 0;
+            *p++ = 0;
+            if(fileNext < fileCount) {
+                strcpy((char *)p, files[fileNext++].name);
+                p += strlen((char *)p);
+            }
+            *p++ = 0;
+            break;
+        case 20:    // build name
+            strcpy((char *)p, buildName);
+            p += strlen(buildName) + 1;
+            break;
+        case 21: {  // extended position
+            int i;
+            for(i = 0; i < 5; i++) p = put_32(p, position[i]);
+            p = put_16(p, 0);
+            break;
+        }
+        case 22:    // extended stop
+            if(packet[1] & 0x3) clear_actions(now);
+            *p++ = 0;
+            break;
+        case 23:    // motherboard status
+            *p++ = 0;
+            break;
+        case 24: {  // build statistics
+            unsigned minutes = (unsigned)(now / 60.0);
+            *p++ = buildStatus;
+            *p++ = minutes / 60;
+            *p++ = minutes % 60;
+            p = put_32(p, buildLines);
+            p = put_32(p, 0);
+            break;
+        }
+        case 27:    // advanced version
+            p = put_16(p, FIRMWARE_VERSION);
+            p = put_16(p, 0);
+            *p++ = FIRMWARE_VARIANT;
+            *p++ = 0;
+            p = put_16(p, 0);
+            break;
+        default:
+            reply[0] = 0x85;
+            return 1;
+    }
+    reply[0] = 0x81;
+    return p - reply;
+}
+
+// RESPONSES
+
+static void respond(const unsigned char *reply, unsigned length, double arrived)
+{
+    Response *r;
+    double due = arrived + latency;
+    if(responseCount == RESPONSE_MAX) return;
+    r = &response[(responseFirst + responseCount++) % RESPONSE_MAX];
+    r->frame[0] = 0xD5;
+    r->frame[1] = length;
+    memcpy(r->frame + 2, reply, length);
+    r->frame[2 + length] = calculate_crc(reply, length);
+    r->length = length + 3;
+    if(baudRate > 0.0) {
+        if(due < txLine) due = txLine;
+        txLine = due + r->length / baudRate;
+    }
+    r->due = due;
+}
+
+static int send_responses(int port, double now)
+{
+    while(responseCount && response[responseFirst].due <= now) {
+        Response *r = &response[responseFirst];
+        if(write(port, r->frame, r->length) != r->length) return -1;
+        responseFirst = (responseFirst + 1) % RESPONSE_MAX;
+        responseCount--;
+    }
+    return 0;
+}
+
+// the packets an x3g file carries, actions and the queries that change the
+// printer rather than ask about it
+
+static int is_command(const unsigned char *packet)
+{
+    switch(packet[0]) {
+        case 3:
+        case 7:
+        case 8:
+        case 13:
+        case 17:
+        case 22:
+            return 1;
+    }
+    return (packet[0] & 0x80) && capturing < 0;
+}
+
+// a packet that came in whole
+
+static void handle_packet(const unsigned char *packet, unsigned length, double arrived)
+{
+    unsigned char reply[256];
+    unsigned replyLength = 1;
+    double now = printer_time(arrived);
+
+    packets++;
+    drain(now);
+    if(errorRate > 0.0 && rand() < errorRate * ((double)RAND_MAX + 1.0)) {
+        // as if a byte was lost on the way
+        injected++;
+        reply[0] = 0x83;
+    }
+    else if(packet[0] & 0x80) {
+        if(cancelAfter >= 0 && (long)actions >= cancelAfter && !cancelled) {
+            cancelled = 1;
+            buildStatus = 4;
+            clear_actions(now);
+        }
+        if(cancelled) {
+            reply[0] = 0x89;
+        }
+        else if(capturing >= 0) {
+            files[capturing].length += length;
+            reply[0] = 0x81;
+        }
+        else {
+            reply[0] = push_action(packet, length, now);
+        }
+    }
+    else {
+        queries++;
+        replyLength = query(packet, length, reply, now);
+    }
+    if(record && reply[0] == 0x81 && is_command(packet)) fwrite(packet, 1, length, record);
+    respond(reply, replyLength, arrived);
+}
+
+// FRAMING
+
+static unsigned char frame[258];
+static unsigned frameLength = 0;
+
+// feed a byte from the host, arrived is when the line delivered it
+
+static void receive(unsigned char c, double arrived)
+{
+    if(frameLength == 0 && c != 0xD5) return;
+    frame[frameLength++] = c;
+    if(frameLength == 2 && c == 0) {
+        frameLength = 0;
+        return;
+    }
+    if(frameLength < 3 || frameLength < (unsigned)frame[1] + 3) return;
+    frameLength = 0;
+    if(calculate_crc(frame + 2, frame[1]) != frame[frame[1] + 2]) {
+        unsigned char reply = 0x83;
+        crcErrors++;
+        respond(&reply, 1, arrived);
+        return;
+    }
+    handle_packet(frame + 2, frame[1], arrived);
+}
+
+// THE PSEUDO-TERMINAL
+
+static int open_pty(const char *link, int *slave)
+{
+    struct termios tp;
+    const char *name;
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0 || grantpt(master) < 0 || unlockpt(master) < 0 || (name = ptsname(master)) == NULL) {
+        perror("x3g-emulator: opening a pseudo-terminal");
+        return -1;
+    }
+    // hold the slave open so the port stays up between the host's opens
+    if((*slave = open(name, O_RDWR | O_NOCTTY)) < 0) {
+        perror(name);
+        return -1;
+    }
+    if(tcgetattr(*slave, &tp) == 0) {
+        cfmakeraw(&tp);
+        tcsetattr(*slave, TCSANOW, &tp);
+    }
+    unlink(link);
+    if(symlink(name, link) < 0) {
+        perror(link);
+        return -1;
+    }
+    if(verbose) fprintf(stderr, "x3g-emulator: %s is %s\n", link, name);
+    return master;
+}
+
+static pid_t run_command(char **argv, int slave, int master)
+{
+    pid_t pid = fork();
+    if(pid == 0) {
+        close(slave);
+        close(master);
+        execvp(argv[0], argv);
+        perror(argv[0]);
+        _exit(127);
+    }
+    if(pid < 0) perror("x3g-emulator: fork");
+    return pid;
+}
+
+static void statistics(double now)
+{
+    double elapsed = now - start;
+    fprintf(stderr, "x3g-emulator: %lu packets, %lu actions, %lu queries in %.3f s\n",
+            packets, actions, queries, elapsed);
+    fprintf(stderr, "x3g-emulator: %lu overflows, %lu CRC errors, %lu injected errors\n",
+            overflows, crcErrors, injected);
+    fprintf(stderr, "x3g-emulator: printer idle for %.3f s of %.3f s\n", idle, printer_time(now));
+}
+
+static void usage(void)
+{
+    fputs("Usage: x3g-emulator [-b BAUD] [-c N] [-e EEPROM] [-l MS] [-o X3G] [-q BYTES] [-r RATE]\n"
+          "                    [-s SEED] [-x FACTOR] [-v] LINK [COMMAND [ARG...]]\n"
+          "\n"
+          "\t-b\tlimit the line to BAUD bits per second\n"
+          "\t-c\tcancel the build after N actions\n"
+          "\t-e\tload the EEPROM image from a file\n"
+          "\t-l\tanswer each packet MS milliseconds after it arrives\n"
+          "\t-o\trecord the commands the printer took to an x3g file\n"
+          "\t-q\tthe size of the action buffer, 512 by default\n"
+          "\t-r\tturn away this fraction of packets as corrupt\n"
+          "\t-s\tseed the errors\n"
+          "\t-x\trun the printer FACTOR times as fast\n"
+          "\t-v\tprint statistics at the end\n", stderr);
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *link;
+    int master, slave, c, connected = 0, status = 0;
+    pid_t child = -1;
+    unsigned seed = 1;
+    unsigned i;
+
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    while((c = getopt(argc, argv, "+b:c:e:l:o:q:r:s:x:v")) != -1) {
+        switch(c) {
+            case 'b':
+                baudRate = atof(optarg) / 10.0;
+                break;
+            case 'c':
+                cancelAfter = atol(optarg);
+                break;
+            case 'e': {
+                FILE *in = fopen(optarg, "rb");
+                if(in == NULL) {
+                    perror(optarg);
+                    return 1;
+                }
+                // a short image leaves the rest of the EEPROM blank
+                if(fread(eeprom, 1, sizeof(eeprom), in) == 0 && ferror(in)) {
+                    perror(optarg);
+                    fclose(in);
+                    return 1;
+                }
+                fclose(in);
+                break;
+            }
+            case 'l':
+                latency = atof(optarg) / 1000.0;
+                break;
+            case 'o':
+                if((record = fopen(optarg, "wb")) == NULL) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            case 'q':
+                bufferSize = atoi(optarg);
+                break;
+            case 'r':
+                errorRate = atof(optarg);
+                break;
+            case 's':
+                seed = atoi(optarg);
+                break;
+            case 'x':
+                speed = atof(optarg);
+                if(speed <= 0.0) usage();
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            default:
+                usage();
+        }
+    }
+    if(optind >= argc) usage();
+    link = argv[optind++];
+    srand(seed);
+    signal(SIGPIPE, SIG_IGN);
+
+    for(i = 0; i < TOOL_COUNT; i++) heater_init(&tool[i], HEAT_RATE);
+    heater_init(&platform, PLATFORM_RATE);
+
+    if((master = open_pty(link, &slave)) < 0) return 1;
+    start = host_time();
+    if(optind < argc && (child = run_command(argv + optind, slave, master)) < 0) {
+        unlink(link);
+        return 1;
+    }
+
+    for(;;) {
+        struct pollfd pfd;
+        double now = host_time();
+        int timeout = 100;
+
+        drain(printer_time(now));
+        if(send_responses(master, now) < 0) break;
+        if(child > 0 && waitpid(child, &status, WNOHANG) == child) {
+            status = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+            break;
+        }
+
+        pfd.fd = master;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if(responseCount) {
+            double wait = response[responseFirst].due - now;
+            if(wait * 1000.0 < timeout) timeout = (int)ceil(wait * 1000.0);
+        }
+        // a line that's still delivering what was read has nothing more yet
+        if(baudRate > 0.0 && rxLine > now) {
+            double wait = rxLine - now;
+            if(wait * 1000.0 < timeout) timeout = (int)ceil(wait * 1000.0);
+            pfd.events = 0;
+        }
+        if(poll(&pfd, 1, timeout) < 0) {
+            if(errno == EINTR) continue;
+            perror("x3g-emulator: poll");
+            status = 1;
+            break;
+        }
+        if(pfd.revents & POLLIN) {
+            unsigned char buffer[4096];
+            size_t size = baudRate > 0.0 ? 64 : sizeof(buffer);
+            ssize_t n = read(master, buffer, size);
+            ssize_t j;
+            if(n <= 0) break;
+            now = host_time();
+            if(rxLine < now) rxLine = now;
+            for(j = 0; j < n; j++) {
+                if(baudRate > 0.0) rxLine += 1.0 / baudRate;
+                receive(buffer[j], baudRate > 0.0 ? rxLine : now);
+            }
+            // without a command the emulator is done when the host hangs up
+            if(!connected && child < 0) {
+                close(slave);
+                slave = -1;
+            }
+            connected = 1;
+        }
+        else if(pfd.revents & (POLLHUP | POLLERR)) {
+            if(child < 0 && connected) break;
+            usleep(10000);
+        }
+    }
+
+    if(verbose) statistics(host_time());
+    if(record) fclose(record);
+    if(slave >= 0) close(slave);
+    close(master);
+    unlink(link);
+    return status;
+}
@@ -1,4 +1,5 @@
 #include <Python.h>
+#include <pythread.h>
 
 #include <ctype.h>
 #include <fcntl.h>
@@ -16,15 +17,22 @@
 #include "eeprominfo.h"
 #include "gpx.h"
 
-// TODO at the moment the module is taking twice as much memory for Gpx as it
-// should to because gpx-main also has one. We can merge them via extern or pass
-// it one way or the other, but perhaps the best way is to drop gpx-main from
-// the module and reserve that for the CLI.  We'll need to refactor a couple of
-// things from it however
-static Gpx gpx;
-static Tio *tio;
+// Each gpx.Printer has its own converter and connection, so one process can
+// drive several printers, each from its own thread.  The lock keeps two
+// threads off the same printer, and the GIL is released while a printer
+// converts or waits on its serial port so the others can run meanwhile.
+typedef struct {
+    PyObject_HEAD
+    Gpx gpx;
+    Tio tio;
+    int connected;
+    PyThread_type_lock lock;
+} Printer;
 
-static int connected = 0;
+static PyTypeObject PrinterType;
+
+// the module level functions drive this one
+static Printer *defaultPrinter;
 
 // Some custom python exceptions
 static PyObject *pyerrCancelBuild;
@@ -32,7 +40,7 @@ static PyObject *pyerrBufferOverflow;
 static PyObject *pyerrTimeout;
 static PyObject *pyerrUnknownFirmware;
 
-static void clear_state_for_cancel(void)
+static void clear_state_for_cancel(Tio *tio)
 {
     tio_clear_state_for_cancel(tio);
     tio->cur = 0;
@@ -46,9 +54,11 @@ static void clear_state_for_cancel(void)
 #define EEPROM_LENGTH_OFFSET 8
 
 // return the translation or set the error context and return NULL if failure
-static PyObject *py_return_translation(int rval)
+static PyObject *py_return_translation(Printer *self, int rval)
 {
-    rval = gpx_return_translation(&gpx, rval);
+    Py_BEGIN_ALLOW_THREADS
+    rval = gpx_return_translation(&self->gpx, rval);
+    Py_END_ALLOW_THREADS
 
     switch (rval) {
         case SUCCESS:
@@ -100,54 +110,64 @@ static PyObject *py_return_translation(int rval)
             PyErr_SetString(PyExc_IOError, "Unknown error.");
             return NULL;
     }
-    return Py_BuildValue("s", tio->translation);
+    return Py_BuildValue("s", self->tio.translation);
 }
 
-static PyObject *py_write_string(const char *s)
+static PyObject *py_write_string(Printer *self, const char *s)
 {
-    return py_return_translation(gpx_write_string_core(&gpx, s));
+    int rval;
+
+    Py_BEGIN_ALLOW_THREADS
+    rval = gpx_write_string_core(&self->gpx, s);
+    Py_END_ALLOW_THREADS
+    return py_return_translation(self, rval);
 }
 
 // def connect(port, baudrate, inipath, logpath)
-static PyObject *py_connect(PyObject *self, PyObject *args)
+static PyObject *py_connect(Printer *self, PyObject *args)
 {
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
     const char *port = NULL;
     long baudrate = 0;
     const char *inipath = NULL;
     const char *logpath = NULL;
     int verbose = 0;
+    int rval;
 
     if (!PyArg_ParseTuple(args, "s|lssi", &port, &baudrate, &inipath, &logpath, &verbose))
         return NULL;
 
+    Py_BEGIN_ALLOW_THREADS
     tio_cleanup(tio);
-    connected = 1;
-    gpx_initialize(&gpx, 0);
-    gpx.axis.positionKnown = 0;
-    gpx.flag.M106AlwaysValve = 1;
-    gpx.flag.verboseSioMode = gpx.flag.verboseMode = verbose;
-    gpx.flag.logMessages = 1;
+    Py_END_ALLOW_THREADS
+    self->connected = 1;
+    gpx_initialize(gpx, 0);
+    gpx->axis.positionKnown = 0;
+    gpx->flag.M106AlwaysValve = 1;
+    gpx->flag.verboseSioMode = gpx->flag.verboseMode = verbose;
+    gpx->flag.logMessages = 1;
 
     // open the log file
-    if (logpath != NULL && (gpx.log = fopen(logpath, "a")) == NULL) {
+    if (logpath != NULL && (gpx->log = fopen(logpath, "a")) == NULL) {
         fprintf(stderr, "Unable to open logfile (%s) for writing\n", logpath);
     }
-    if (gpx.log == NULL)
-        gpx.log = stderr;
+    if (gpx->log == NULL)
+        gpx->log = stderr;
 #ifdef ALWAYS_USE_STDERR
-    else if (gpx.log != stderr)
+    else if (gpx->log != stderr)
     {
-        fclose(gpx.log);
-        gpx.log = stderr;
+        fclose(gpx->log);
+        gpx->log = stderr;
     }
 #endif
 
     // load the config
     if (inipath != NULL)
     {
-        int lineno = gpx_load_config(&gpx, inipath);
+        int lineno = gpx_load_config(gpx, inipath);
         if (lineno < 0) {
-            fprintf(gpx.log, "Unable to load configuration file (%s)\n", inipath);
+            fprintf(gpx->log, "Unable to load configuration file (%s)\n", inipath);
             tio_printf(tio, "Error: Unable to load configuration file (%s)\n", inipath);
         }
         if (lineno > 0) {
@@ -155,7 +175,10 @@ static PyObject *py_connect(PyObject *self, PyObject *args)
         }
     }
 
-    int rval = gpx_connect(&gpx, port, baudrate);
+    speed_t speed = speed_from_long(tio, &baudrate);
+    Py_BEGIN_ALLOW_THREADS
+    rval = gpx_connect(gpx, port, speed);
+    Py_END_ALLOW_THREADS
     switch (rval) {
         case ESIOBADBAUD:
             PyErr_SetString(PyExc_ValueError, "Unsupported baudrate");
@@ -164,7 +187,7 @@ static PyObject *py_connect(PyObject *self, PyObject *args)
             return PyErr_SetFromErrnoWithFilename(PyExc_OSError, port);
     }
 
-    return py_return_translation(rval);
+    return py_return_translation(self, rval);
 }
 
 static PyObject *PyErr_NotConnected(void)
@@ -177,9 +200,13 @@ static PyObject *PyErr_NotConnected(void)
 //  Intended to be called after connect to have the first conversation with the
 //  bot, connect merely opens the port. Separating the two allows for a pause
 //  between the calls at the python level so multithreading works.
-static PyObject *py_start(PyObject *self, PyObject *args)
+static PyObject *py_start(Printer *self, PyObject *args)
 {
-    if (!connected)
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
+    int rval;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
     if (!PyArg_ParseTuple(args, ""))
@@ -187,21 +214,24 @@ static PyObject *py_start(PyObject *self, PyObject *args)
 
     tio->cur = 0;
     tio->translation[0] = 0;
-    int rval = get_advanced_version_number(&gpx);
+    Py_BEGIN_ALLOW_THREADS
+    rval = get_advanced_version_number(gpx);
     if (rval >= 0) {
         tio->waitflag.waitForEmptyQueue = 1;
         tio_printf(tio, "\necho: gcode to x3g translation by GPX");
-        rval = gpx_write_string(&gpx, "M21");
+        rval = gpx_write_string(gpx, "M21");
     }
-    return py_return_translation(rval);
+    Py_END_ALLOW_THREADS
+    return py_return_translation(self, rval);
 }
 
 // def write(data)
-static PyObject *py_write(PyObject *self, PyObject *args)
+static PyObject *py_write(Printer *self, PyObject *args)
 {
+    Tio *tio = &self->tio;
     char *line;
 
-    if (!connected)
+    if (!self->connected)
         return PyErr_NotConnected();
 
     if (!PyArg_ParseTuple(args, "s", &line))
@@ -211,85 +241,60 @@ static PyObject *py_write(PyObject *self, PyObject *args)
     tio->translation[0] = 0;
     tio->waitflag.waitForBuffer = 0; // maybe clear this every time?
     tio->flag.okPending = !tio->waiting;
-    PyObject *rval = py_write_string(line);
+    PyObject *rval = py_write_string(self, line);
     tio->flag.okPending = 0;
     return rval;
 }
 
 // def readnext()
-static PyObject *py_readnext(PyObject *self, PyObject *args)
+static PyObject *py_readnext(Printer *self, PyObject *args)
 {
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
     int rval = SUCCESS;
 
-    if (!connected)
+    if (!self->connected)
         return PyErr_NotConnected();
 
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
 
-    if (gpx.flag.verboseMode)
-        fprintf(gpx.log, "i");
+    if (gpx->flag.verboseMode)
+        fprintf(gpx->log, "i");
     tio->cur = 0;
     tio->translation[0] = 0;
 
     if (tio->flag.listingFiles) {
-        rval = get_next_filename(&gpx, 0);
+        Py_BEGIN_ALLOW_THREADS
+        rval = get_next_filename(gpx, 0);
+        Py_END_ALLOW_THREADS
     }
     else if (tio->waiting) {
-        if (gpx.flag.verboseMode)
-            fprintf(gpx.log, "tio->waiting = %u\n", tio->waiting);
-        if (!tio->waitflag.waitForCancelSync) {
-            if (tio->waitflag.waitForUnpause)
-                rval = get_build_statistics(&gpx);
-            // if we're waiting for the queue to drain, do that before checking on
-            // anything else
-            if (rval == SUCCESS && (tio->waitflag.waitForEmptyQueue || tio->waitflag.waitForButton))
-                rval = is_ready(&gpx);
-            if (rval == SUCCESS && !tio->waitflag.waitForEmptyQueue) {
-                if (tio->waitflag.waitForStart || tio->waitflag.waitForBotCancel)
-                    rval = get_build_statistics(&gpx);
-                if (rval == SUCCESS && tio->waitflag.waitForPlatform)
-                    rval = is_build_platform_ready(&gpx, 0);
-                if (rval == SUCCESS && tio->waitflag.waitForExtruderA)
-                    rval = is_extruder_ready(&gpx, 0);
-                if (rval == SUCCESS && tio->waitflag.waitForExtruderB)
-                    rval = is_extruder_ready(&gpx, 1);
-            }
-        }
-        if (gpx.flag.verboseMode)
-            fprintf(gpx.log, "tio->waiting = %u and rval = %d\n", tio->waiting, rval);
-        if (rval == SUCCESS) {
-            if (tio->waiting) {
-                if (gpx.flag.verboseMode) {
-                    tio_printf(tio, "// echo: tio->waiting = 0x%x\n", tio->waiting);
-                    fprintf(gpx.log, "o");
-                }
-                return py_write_string("M105");
-            }
-            tio->cur = 0;
-            tio_printf(tio, "ok");
-        }
+        Py_BEGIN_ALLOW_THREADS
+        rval = gpx_do_wait(gpx);
+        Py_END_ALLOW_THREADS
     }
     else if (tio->flag.waitClearedByCancel) {
-        if(gpx.flag.verboseMode)
-            fprintf(gpx.log, "adding ok for wait cleared by cancel\n");
+        if(gpx->flag.verboseMode)
+            fprintf(gpx->log, "adding ok for wait cleared by cancel\n");
         tio->flag.waitClearedByCancel = 0;
         tio_printf(tio, "ok");
     }
-    if (gpx.flag.verboseMode)
-        fprintf(gpx.log, "o");
-    return py_return_translation(rval);
+    if (gpx->flag.verboseMode)
+        fprintf(gpx->log, "o");
+    return py_return_translation(self, rval);
 }
 
 #if !defined(_WIN32) && !defined(_WIN64)
 // def baudrate(long)
-static PyObject *py_set_baudrate(PyObject *self, PyObject *args)
+static PyObject *py_set_baudrate(Printer *self, PyObject *args)
 {
+    Tio *tio = &self->tio;
     struct termios tp;
     long baudrate;
     speed_t speed;
 
-    if (!connected)
+    if (!self->connected)
         return PyErr_NotConnected();
 
     if (!PyArg_ParseTuple(args, "l", &baudrate))
@@ -297,9 +302,11 @@ static PyObject *py_set_baudrate(PyObject *self, PyObject *args)
 
     if(tcgetattr(tio->sio.port, &tp) < 0)
         return PyErr_SetFromErrno(PyExc_IOError);
-    speed = speed_from_long(&baudrate);
-    if (speed == B0)
+    speed = speed_from_long(tio, &baudrate);
+    if (speed == B0) {
+        PyErr_SetString(PyExc_ValueError, "Unsupported baudrate");
         return NULL;
+    }
     cfsetspeed(&tp, speed);
     if(tcsetattr(tio->sio.port, TCSANOW, &tp) < 0)
         return PyErr_SetFromErrno(PyExc_IOError);
@@ -307,11 +314,11 @@ static PyObject *py_set_baudrate(PyObject *self, PyObject *args)
     return Py_BuildValue("i", 0);
 }
 #else
-static PyObject *py_set_baudrate(PyObject *self, PyObject *args)
+static PyObject *py_set_baudrate(Printer *self, PyObject *args)
 {
     long baudrate;
 
-    if (!connected)
+    if (!self->connected)
         return PyErr_NotConnected();
 
     if (!PyArg_ParseTuple(args, "l", &baudrate))
@@ -324,10 +331,12 @@ static PyObject *py_set_baudrate(PyObject *self, PyObject *args)
 #endif // _WIN32 || _WIN64
 
 // def disconnect()
-static PyObject *py_disconnect(PyObject *self, PyObject *args)
+static PyObject *py_disconnect(Printer *self, PyObject *args)
 {
-    tio_cleanup(tio);
-    connected = 0;
+    Py_BEGIN_ALLOW_THREADS
+    tio_cleanup(&self->tio);
+    Py_END_ALLOW_THREADS
+    self->connected = 0;
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
     return Py_BuildValue("i", 0);
@@ -343,7 +352,6 @@ static PyObject *py_get_machine_defaults(PyObject *self, PyObject *args)
         return NULL;
 
     Machine *machine = gpx_find_machine(machine_type_id);
-    fflush(gpx.log);
     if (machine == NULL) {
         PyErr_SetString(PyExc_ValueError, "Machine id not found");
         return NULL;
@@ -385,66 +393,367 @@ static PyObject *py_get_machine_defaults(PyObject *self, PyObject *args)
 
 }
 
+// ----- bulk conversion -----
+
+#define CONVERT_CHUNK 0x40000
+
+// a str or path-like source names a file, returns 1 with the file system
+// encoded name in path, 0 if the source isn't a name or -1 on error
+static int source_path(PyObject *source, PyObject **path)
+{
+#if PY_MAJOR_VERSION >= 3
+    if (PyUnicode_Check(source) || PyObject_HasAttrString(source, "__fspath__"))
+        return PyUnicode_FSConverter(source, path) ? 1 : -1;
+#else
+    if (PyString_Check(source)) {
+        Py_INCREF(source);
+        *path = source;
+        return 1;
+    }
+    if (PyUnicode_Check(source)) {
+        *path = PyUnicode_AsEncodedString(source, Py_FileSystemDefaultEncoding, "strict");
+        return *path != NULL ? 1 : -1;
+    }
+#endif
+    return 0;
+}
+
+// write an iterable of lines to the input file, a newline is added to each
+// line that doesn't already end with one
+static int write_lines(FILE *in, PyObject *source)
+{
+    PyObject *iterator = PyObject_GetIter(source);
+    PyObject *item;
+
+    if (iterator == NULL)
+        return ERROR;
+    while ((item = PyIter_Next(iterator)) != NULL) {
+        char *s;
+        Py_ssize_t l;
+
+        if (PyUnicode_Check(item)) {
+            PyObject *encoded = PyUnicode_AsUTF8String(item);
+            Py_DECREF(item);
+            if (encoded == NULL)
+                break;
+            item = encoded;
+        }
+        if (!PyBytes_Check(item)) {
+            PyErr_SetString(PyExc_TypeError, "convert() lines must be str or bytes");
+            Py_DECREF(item);
+            break;
+        }
+        PyBytes_AsStringAndSize(item, &s, &l);
+        if (fwrite(s, 1, l, in) != (size_t)l || ((l == 0 || s[l - 1] != '\n') && fputc('\n', in) == EOF)) {
+            PyErr_SetFromErrno(PyExc_IOError);
+            Py_DECREF(item);
+            break;
+        }
+        Py_DECREF(item);
+    }
+    Py_DECREF(iterator);
+    return PyErr_Occurred() ? ERROR : SUCCESS;
+}
+
+// the build name the command line would give the file, the leaf name without
+// its extension
+static char *path_build_name(const char *path)
+{
+    const char *leaf = strrchr(path, PATH_DELIM);
+#if defined(_WIN32) || defined(_WIN64)
+    const char *otherdelim = strrchr(path, '/');
+    if (otherdelim > leaf)
+        leaf = otherdelim;
+#endif
+    char *buildName = strdup(leaf ? leaf + 1 : path);
+    if (buildName != NULL) {
+        char *dot = strrchr(buildName, '.');
+        if (dot)
+            *dot = 0;
+    }
+    return buildName;
+}
+
+// hand the converted output to the callback a chunk at a time
+static int send_output(FILE *out, long length, PyObject *callback)
+{
+    while (length > 0) {
+        size_t l = length < CONVERT_CHUNK ? (size_t)length : CONVERT_CHUNK;
+        PyObject *chunk = PyBytes_FromStringAndSize(NULL, l);
+        size_t got;
+        if (chunk == NULL)
+            return ERROR;
+        Py_BEGIN_ALLOW_THREADS
+        got = fread(PyBytes_AS_STRING(chunk), 1, l, out);
+        Py_END_ALLOW_THREADS
+        if (got != l) {
+            Py_DECREF(chunk);
+            PyErr_SetFromErrno(PyExc_IOError);
+            return ERROR;
+        }
+        PyObject *rval = PyObject_CallFunctionObjArgs(callback, chunk, NULL);
+        Py_DECREF(chunk);
+        if (rval == NULL)
+            return ERROR;
+        Py_DECREF(rval);
+        length -= l;
+    }
+    return SUCCESS;
+}
+
+// def convert(source, machine = None, ini = None, build_name = None, callback = None, ...)
+// for example: x3g, total = convert("part.gcode", machine = "r2x")
+static PyObject *py_convert(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    static char *keywords[] = {"source", "machine", "ini", "build_name", "callback",
+        "reprap", "build_progress", "ditto", "rewrite_5d", "single_pass", "threads",
+        "scale", "offset", "filament_diameter", "verbose", NULL};
+    PyObject *source;
+    const char *machine = NULL;
+    const char *inipath = NULL;
+    const char *buildNameArg = NULL;
+    PyObject *callback = Py_None;
+    int reprap = -1;
+    int buildProgress = 0;
+    int ditto = 0;
+    int rewrite5D = 0;
+    int singlePass = 0;
+    int threads = 0;
+    double scale = 1.0;
+    double x = 0.0, y = 0.0, z = 0.0;
+    double filamentDiameter = 0.0;
+    int verbose = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|zzzOiiiiiid(ddd)di", keywords,
+            &source, &machine, &inipath, &buildNameArg, &callback,
+            &reprap, &buildProgress, &ditto, &rewrite5D, &singlePass, &threads,
+            &scale, &x, &y, &z, &filamentDiameter, &verbose))
+        return NULL;
+    if (callback != Py_None && !PyCallable_Check(callback)) {
+        PyErr_SetString(PyExc_TypeError, "convert() callback must be callable");
+        return NULL;
+    }
+
+    PyObject *path = NULL;
+    Py_buffer view;
+    int haveView = 0;
+    char *buildName = NULL;
+    Gpx *gpx = NULL;
+    FILE *in = NULL;
+    FILE *out = NULL;
+    PyObject *x3g = NULL;
+    PyObject *result = NULL;
+    int rval = SUCCESS;
+
+    // the source is a file name, the gcode itself or its lines, the reader
+    // wants a file so gcode in memory is written to a temporary one
+    int named = source_path(source, &path);
+    if (named < 0)
+        return NULL;
+    if (!named) {
+        if ((in = tmpfile()) == NULL)
+            return PyErr_SetFromErrno(PyExc_IOError);
+        if (PyObject_CheckBuffer(source)) {
+            if (PyObject_GetBuffer(source, &view, PyBUF_SIMPLE) < 0)
+                goto done;
+            haveView = 1;
+        }
+        else if (write_lines(in, source) != SUCCESS)
+            goto done;
+    }
+
+    if (buildNameArg != NULL)
+        buildName = strdup(buildNameArg);
+    else
+        buildName = named ? path_build_name(PyBytes_AS_STRING(path)) : strdup(PACKAGE_STRING);
+    if (buildName == NULL || (gpx = calloc(1, sizeof(Gpx))) == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    gpx_initialize(gpx, 1);
+    gpx->flag.verboseMode = verbose;
+    if (machine != NULL && gpx_set_property(gpx, "printer", "machine_type", (char *)machine)) {
+        PyErr_SetString(PyExc_ValueError, "Machine id not found");
+        goto done;
+    }
+    if (inipath != NULL) {
+        int lineno = gpx_load_config(gpx, inipath);
+        if (lineno < 0) {
+            PyErr_Format(PyExc_ValueError, "Unable to load configuration file (%s)", inipath);
+            goto done;
+        }
+        if (lineno > 0) {
+            PyErr_Format(PyExc_ValueError, "(line %d) Configuration syntax error in %s: unrecognized parameters", lineno, inipath);
+            goto done;
+        }
+    }
+    if (reprap >= 0)
+        gpx->flag.reprapFlavor = !!reprap;
+    gpx->flag.buildProgress = !!buildProgress;
+    gpx->flag.dittoPrinting = !!ditto;
+    gpx->flag.rewrite5D = !!rewrite5D;
+    gpx->flag.singlePass = !!singlePass;
+    gpx->threads = threads;
+    gpx->user.scale = scale;
+    gpx->user.offset.x = x;
+    gpx->user.offset.y = y;
+    gpx->user.offset.z = z;
+    if (filamentDiameter > 0.0001) {
+        gpx->override[0].actual_filament_diameter = filamentDiameter;
+        gpx->override[1].actual_filament_diameter = filamentDiameter;
+    }
+
+    // single-pass reads the output back to splice in the build progress, so
+    // it goes to a file rather than memory
+    Py_BEGIN_ALLOW_THREADS
+    if (named)
+        in = fopen(PyBytes_AS_STRING(path), "rb");
+    else if (haveView && fwrite(view.buf, 1, view.len, in) != (size_t)view.len)
+        rval = EOSERROR;
+    else if (fflush(in) || fseek(in, 0L, SEEK_SET))
+        rval = EOSERROR;
+    if (in == NULL || rval != SUCCESS || (out = tmpfile()) == NULL) {
+        rval = EOSERROR;
+    }
+    else {
+        gpx_start_convert(gpx, buildName, 0);
+        rval = gpx_convert(gpx, in, out, NULL);
+        gpx_end_convert(gpx);
+    }
+    Py_END_ALLOW_THREADS
+
+    switch (rval) {
+        case SUCCESS:
+        case END_OF_FILE:
+            break;
+        case EOSERROR:
+            if (named && in == NULL)
+                PyErr_SetFromErrnoWithFilename(PyExc_IOError, PyBytes_AS_STRING(path));
+            else
+                PyErr_SetFromErrno(PyExc_IOError);
+            goto done;
+        default:
+            PyErr_SetString(PyExc_IOError, "GPX error");
+            goto done;
+    }
+
+    long length;
+    if (fflush(out) || (length = ftell(out)) < 0 || fseek(out, 0L, SEEK_SET)) {
+        PyErr_SetFromErrno(PyExc_IOError);
+        goto done;
+    }
+    if (callback != Py_None) {
+        if (send_output(out, length, callback) != SUCCESS)
+            goto done;
+        Py_INCREF(Py_None);
+        x3g = Py_None;
+    }
+    else {
+        size_t got;
+        if ((x3g = PyBytes_FromStringAndSize(NULL, length)) == NULL)
+            goto done;
+        Py_BEGIN_ALLOW_THREADS
+        got = fread(PyBytes_AS_STRING(x3g), 1, length, out);
+        Py_END_ALLOW_THREADS
+        if (got != (size_t)length) {
+            PyErr_SetFromErrno(PyExc_IOError);
+            Py_CLEAR(x3g);
+            goto done;
+        }
+    }
+
+    result = Py_BuildValue("N{sd,sd,sk}", x3g,
+        "time", gpx->total.time,
+        "length", gpx->total.length,
+        "bytes", gpx->total.bytes);
+
+done:
+    if (in != NULL)
+        fclose(in);
+    if (out != NULL)
+        fclose(out);
+    if (gpx != NULL) {
+        free(gpx->buildName);
+        free(gpx->selectedFilename);
+        if (gpx->eepromMappingVector != NULL)
+            vector_free(gpx->eepromMappingVector);
+        if (gpx->progressMarkVector != NULL)
+            vector_free(gpx->progressMarkVector);
+        free(gpx);
+    }
+    free(buildName);
+    if (haveView)
+        PyBuffer_Release(&view);
+    Py_XDECREF(path);
+    return result;
+}
+
 // def read_ini(ini_filepath)
-static PyObject *py_read_ini(PyObject *self, PyObject *args)
+static PyObject *py_read_ini(Printer *self, PyObject *args)
 {
+    Gpx *gpx = &self->gpx;
     const char *inipath = NULL;
 
     if (!PyArg_ParseTuple(args, "s", &inipath))
         return NULL;
 
-    int lineno = gpx_load_config(&gpx, inipath);
+    int lineno = gpx_load_config(gpx, inipath);
     if (lineno == 0)
         return Py_BuildValue("i", 0); // success
 
     if (lineno < 0)
-        fprintf(gpx.log, "Unable to load configuration file (%s)\n", inipath);
+        fprintf(gpx->log, "Unable to load configuration file (%s)\n", inipath);
     if (lineno > 0)
-        fprintf(gpx.log, "(line %u) Configuration syntax error in %s: unrecognized parameters\n", lineno, inipath);
-    fflush(gpx.log);
+        fprintf(gpx->log, "(line %u) Configuration syntax error in %s: unrecognized parameters\n", lineno, inipath);
+    fflush(gpx->log);
 
     PyErr_SetString(PyExc_ValueError, "Unable to load ini file");
-    return Py_BuildValue("i", 0);
+    return NULL;
 }
 
 // def reset_ini()
 // reset settings to defaults
-static PyObject *py_reset_ini(PyObject *self, PyObject *args)
+static PyObject *py_reset_ini(Printer *self, PyObject *args)
 {
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
+
     // some state survives reset_ini
-    void *callbackHandler = gpx.callbackHandler;
-    void *resultHandler = gpx.resultHandler;
-    void *callbackData = gpx.callbackData;
-    FILE *log = gpx.log;
-    unsigned verbose = gpx.flag.verboseMode;
+    void *callbackHandler = gpx->callbackHandler;
+    void *resultHandler = gpx->resultHandler;
+    void *callbackData = gpx->callbackData;
+    FILE *log = gpx->log;
+    unsigned verbose = gpx->flag.verboseMode;
 
     // nuke it all
-    gpx_initialize(&gpx, 1);
-    gpx.axis.positionKnown = 0;
-    gpx.flag.M106AlwaysValve = 1;
+    gpx_initialize(gpx, 1);
+    gpx->axis.positionKnown = 0;
+    gpx->flag.M106AlwaysValve = 1;
 
     // restore some stuff, plus we're still in pymodule mode
-    gpx.callbackHandler = callbackHandler;
-    gpx.resultHandler = resultHandler;
-    gpx.callbackData = callbackData;
-    gpx.log = log;
-    gpx.flag.framingEnabled = 1;
-    gpx.flag.sioConnected = 1;
-    gpx.sio = &tio->sio;
-    gpx.flag.verboseMode = verbose;
-    gpx.flag.logMessages = 1;
+    gpx->callbackHandler = callbackHandler;
+    gpx->resultHandler = resultHandler;
+    gpx->callbackData = callbackData;
+    gpx->tio = tio;
+    gpx->log = log;
+    gpx->flag.framingEnabled = 1;
+    gpx->flag.sioConnected = 1;
+    gpx->sio = &tio->sio;
+    gpx->flag.verboseMode = verbose;
+    gpx->flag.logMessages = 1;
 
     return Py_BuildValue("i", 0);
 }
 
 // def waiting()
 // is the bot waiting for something?
-static PyObject *py_waiting(PyObject *self, PyObject *args)
+static PyObject *py_waiting(Printer *self, PyObject *args)
 {
-    if (!connected)
+    if (!self->connected)
         return PyErr_NotConnected();
 
-    if (tio->waiting || tio->flag.waitClearedByCancel)
+    if (self->tio.waiting || self->tio.flag.waitClearedByCancel)
         Py_RETURN_TRUE;
     else
         Py_RETURN_FALSE;
@@ -452,9 +761,9 @@ static PyObject *py_waiting(PyObject *self, PyObject *args)
 
 // def build_started()
 // are we printing a build?
-static PyObject *py_build_started(PyObject *self, PyObject *args)
+static PyObject *py_build_started(Printer *self, PyObject *args)
 {
-    if (gpx.flag.programState == RUNNING_STATE)
+    if (self->gpx.flag.programState == RUNNING_STATE)
         Py_RETURN_TRUE;
     else
         Py_RETURN_FALSE;
@@ -462,19 +771,23 @@ static PyObject *py_build_started(PyObject *self, PyObject *args)
 
 // def build_paused()
 // is the build paused on the LCD?
-static PyObject *py_build_paused(PyObject *self, PyObject *args)
+static PyObject *py_build_paused(Printer *self, PyObject *args)
 {
-    if (!connected)
+    int rval;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
-    int rval = get_build_statistics(&gpx);
+    Py_BEGIN_ALLOW_THREADS
+    rval = get_build_statistics(&self->gpx);
+    Py_END_ALLOW_THREADS
     // if we fail, is that a yes or a no?
     if (rval != SUCCESS) {
         PyErr_SetString(PyExc_IOError, "Unable to get build statistics.");
         return NULL;
     }
 
-    if (tio->waitflag.waitForUnpause)
+    if (self->tio.waitflag.waitForUnpause)
         Py_RETURN_TRUE;
     else
         Py_RETURN_FALSE;
@@ -482,29 +795,31 @@ static PyObject *py_build_paused(PyObject *self, PyObject *args)
 
 // def listing_files()
 // are we in the middle of listing files from the SD card?
-static PyObject *py_listing_files(PyObject *self, PyObject *args)
+static PyObject *py_listing_files(Printer *self, PyObject *args)
 {
-    if (!connected)
+    if (!self->connected)
         return PyErr_NotConnected();
 
-    if (tio->flag.listingFiles)
+    if (self->tio.flag.listingFiles)
         Py_RETURN_TRUE;
     else
         Py_RETURN_FALSE;
 }
 
 // def reprap_flavor(turn_on_reprap)
-static PyObject *py_reprap_flavor(PyObject *self, PyObject *args)
+static PyObject *py_reprap_flavor(Printer *self, PyObject *args)
 {
-    if (!connected)
+    Gpx *gpx = &self->gpx;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
     int reprap = 1;
     if (!PyArg_ParseTuple(args, "i", &reprap))
         return NULL;
 
-    int rval = gpx.flag.reprapFlavor;
-    gpx.flag.reprapFlavor = !!reprap;
+    int rval = gpx->flag.reprapFlavor;
+    gpx->flag.reprapFlavor = !!reprap;
     if (rval)
         Py_RETURN_TRUE;
     else
@@ -517,8 +832,9 @@ static PyObject *py_reprap_flavor(PyObject *self, PyObject *args)
 // the queue handling
 
 // helper for py_stop and py_abort for post abort state
-static PyObject *set_build_aborted_state(Gpx *gpx)
+static PyObject *set_build_aborted_state(Printer *self)
 {
+    Gpx *gpx = &self->gpx;
     int rval = SUCCESS;
 
     VERBOSE( fprintf(gpx->log, "set_build_aborted_state\n") );
@@ -526,24 +842,28 @@ static PyObject *set_build_aborted_state(Gpx *gpx)
         VERBOSE( fprintf(gpx->log, "currently RUNNING_STATE calling end_build\n") );
         gpx->flag.programState = READY_STATE;
 
+        Py_BEGIN_ALLOW_THREADS
         // wait for the bot to be back up after the abort
         int retries = 5;
         while (retries--) {
             rval = set_build_progress(gpx, 100);
-            if (rval == 0x8B)
-                return py_return_translation(rval);
             if (rval == SUCCESS || rval != ESIOTIMEOUT)
                 break;
         }
-        rval = end_build(gpx);
+        if (rval != 0x8B)
+            rval = end_build(gpx);
+        Py_END_ALLOW_THREADS
     }
-    return py_return_translation(rval);
+    return py_return_translation(self, rval);
 }
 
 // def stop(halt_steppers = True, clear_queue = True)
-static PyObject *py_stop(PyObject *self, PyObject *args)
+static PyObject *py_stop(Printer *self, PyObject *args)
 {
-    if (!connected)
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
     int halt_steppers = 1;
@@ -551,62 +871,74 @@ static PyObject *py_stop(PyObject *self, PyObject *args)
     if (!PyArg_ParseTuple(args, "|ii", &halt_steppers, &clear_queue))
         return NULL;
 
-    if (gpx.flag.verboseMode) fprintf(gpx.log, "py_stop\n");
+    if (gpx->flag.verboseMode) fprintf(gpx->log, "py_stop\n");
     if (!tio->waitflag.waitForCancelSync) {
-        if (gpx.flag.verboseMode) fprintf(gpx.log, "py_stop now waiting for @clear_cancel\n");
+        if (gpx->flag.verboseMode) fprintf(gpx->log, "py_stop now waiting for @clear_cancel\n");
         tio->flag.cancelPending = 1;
     }
 
-    clear_state_for_cancel();
+    clear_state_for_cancel(tio);
 
     int rval = SUCCESS;
 
+    Py_BEGIN_ALLOW_THREADS
     // first, ask if we are SD printing
     // delay 1ms is a queuable command that will fail if SD printing
     int sdprinting = 0;
     tio->sio.flag.retryBufferOverflow = 1;
-    rval = delay(&gpx, 1);
+    rval = delay(gpx, 1);
     tio->sio.flag.retryBufferOverflow = 0;
     if (rval == 0x8A) // SD printing
         sdprinting = 1;
     // ignore any other response
 
-    if (sdprinting && !gpx.flag.sd_paused) {
-        rval = pause_resume(&gpx);
-        if (rval != SUCCESS)
-            return py_return_translation(rval);
-        gpx.flag.sd_paused = 1;
+    rval = SUCCESS;
+    if (sdprinting && !gpx->flag.sd_paused) {
+        rval = pause_resume(gpx);
+        if (rval == SUCCESS)
+            gpx->flag.sd_paused = 1;
     }
+    Py_END_ALLOW_THREADS
+    if (rval != SUCCESS)
+        return py_return_translation(self, rval);
 
-    rval = extended_stop(&gpx, halt_steppers, clear_queue);
+    Py_BEGIN_ALLOW_THREADS
+    rval = extended_stop(gpx, halt_steppers, clear_queue);
+    Py_END_ALLOW_THREADS
 
     if (rval != 0x89)
         tio->waitflag.waitForCancelSync = 0;
 
     if (rval != SUCCESS)
-        return py_return_translation(rval);
-    gpx.flag.sd_paused = 0;
-    return set_build_aborted_state(&gpx);
+        return py_return_translation(self, rval);
+    gpx->flag.sd_paused = 0;
+    return set_build_aborted_state(self);
 }
 
 // def abort()
-static PyObject *py_abort(PyObject *self, PyObject *args)
+static PyObject *py_abort(Printer *self, PyObject *args)
 {
-    if (!connected)
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
+    int rval;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
 
-    if (gpx.flag.verboseMode) fprintf(gpx.log, "py_abort\n");
+    if (gpx->flag.verboseMode) fprintf(gpx->log, "py_abort\n");
     if (!tio->waitflag.waitForCancelSync) {
-        if (gpx.flag.verboseMode) fprintf(gpx.log, "py_abort now waiting for @clear_cancel\n");
+        if (gpx->flag.verboseMode) fprintf(gpx->log, "py_abort now waiting for @clear_cancel\n");
         tio->flag.cancelPending = 1;
     }
 
-    clear_state_for_cancel();
+    clear_state_for_cancel(tio);
 
-    int rval = abort_immediately(&gpx);
+    Py_BEGIN_ALLOW_THREADS
+    rval = abort_immediately(gpx);
+    Py_END_ALLOW_THREADS
 
     // ESIOTIMEOUT is only returned if the write succeeded, but no bytes returned
     // I think this can happen if the bot resets immediately and doesn't respond
@@ -619,82 +951,121 @@ static PyObject *py_abort(PyObject *self, PyObject *args)
         tio->waitflag.waitForCancelSync = 0;
 
     if (rval != SUCCESS) {
-        if (gpx.flag.verboseMode) fprintf(gpx.log, "abort_immediately rval = %d\n", rval);
-        return py_return_translation(rval);
+        if (gpx->flag.verboseMode) fprintf(gpx->log, "abort_immediately rval = %d\n", rval);
+        return py_return_translation(self, rval);
     }
-    gpx.flag.sd_paused = 0;
-    return set_build_aborted_state(&gpx);
+    gpx->flag.sd_paused = 0;
+    return set_build_aborted_state(self);
+}
+
+// load the eeprom map for the connected firmware if it isn't already
+static int printer_eeprom_map(Printer *self)
+{
+    int rval = SUCCESS;
+
+    if (self->gpx.eepromMap == NULL) {
+        Py_BEGIN_ALLOW_THREADS
+        rval = load_eeprom_map(&self->gpx);
+        Py_END_ALLOW_THREADS
+    }
+    if (rval != SUCCESS)
+        PyErr_SetString(pyerrUnknownFirmware, "No EEPROM map found for firmware type and/or version");
+    return rval;
 }
 
 // def read_eeprom(id)
-static PyObject *py_read_eeprom(PyObject *self, PyObject *args)
+static PyObject *py_read_eeprom(Printer *self, PyObject *args)
 {
-    if (!connected)
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
     tio->cur = 0;
     tio->translation[0] = 0;
 
-    if (gpx.eepromMap == NULL && load_eeprom_map(&gpx) != SUCCESS) {
-        PyErr_SetString(pyerrUnknownFirmware, "No EEPROM map found for firmware type and/or version");
+    if (printer_eeprom_map(self) != SUCCESS)
         return NULL;
-    }
 
     char *id;
     if (!PyArg_ParseTuple(args, "s", &id))
         return NULL;
 
-    if (gpx.flag.verboseMode) fprintf(gpx.log, "py_read_eeprom %s\n", id);
-    EepromMapping *pem = find_any_eeprom_mapping(&gpx, id);
+    if (gpx->flag.verboseMode) fprintf(gpx->log, "py_read_eeprom %s\n", id);
+    EepromMapping *pem = find_any_eeprom_mapping(gpx, id);
     if (pem == NULL) {
         PyErr_SetString(PyExc_ValueError, "EEPROM id mapping not found");
         return NULL;
     }
 
+    int rval = SUCCESS;
     unsigned char b;
     unsigned short us;
     unsigned long ul;
     float n;
+    int len;
     switch (pem->et) {
         case et_boolean:
-            if (read_eeprom_8(&gpx, gpx.sio, pem->address, &b) == SUCCESS)
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom_8(gpx, gpx->sio, pem->address, &b);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
                 return Py_BuildValue("O", b ? Py_True : Py_False);
             break;
 
         case et_bitfield:
         case et_byte:
-            if (read_eeprom_8(&gpx, gpx.sio, pem->address, &b) == SUCCESS)
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom_8(gpx, gpx->sio, pem->address, &b);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
                 return Py_BuildValue("B", b);
             break;
 
         case et_ushort:
-            if (read_eeprom_16(&gpx, gpx.sio, pem->address, &us) == SUCCESS)
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom_16(gpx, gpx->sio, pem->address, &us);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
                 return Py_BuildValue("H", us);
             break;
 
         case et_fixed:
-            if (read_eeprom_fixed_16(&gpx, gpx.sio, pem->address, &n) == SUCCESS)
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom_fixed_16(gpx, gpx->sio, pem->address, &n);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
                 return Py_BuildValue("f", n);
             break;
 
         case et_long:
         case et_ulong:
-            if (read_eeprom_32(&gpx, gpx.sio, pem->address, &ul) == SUCCESS)
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom_32(gpx, gpx->sio, pem->address, &ul);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
                 return Py_BuildValue(pem->et == et_long ? "l" : "k", ul);
             break;
 
         case et_float:
-            if (read_eeprom_float(&gpx, gpx.sio, pem->address, &n) == SUCCESS)
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom_float(gpx, gpx->sio, pem->address, &n);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
                 return Py_BuildValue("f", n);
             break;
 
         case et_string:
-            memset(gpx.sio->response.eeprom.buffer, 0, sizeof(gpx.sio->response.eeprom.buffer));
-            int len = pem->len;
-            if (len > sizeof(gpx.sio->response.eeprom.buffer))
-                len = sizeof(gpx.sio->response.eeprom.buffer);
-            if (read_eeprom(&gpx, pem->address, len) == SUCCESS)
-                return Py_BuildValue("s", gpx.sio->response.eeprom.buffer);
+            memset(gpx->sio->response.eeprom.buffer, 0, sizeof(gpx->sio->response.eeprom.buffer));
+            len = pem->len;
+            if (len > sizeof(gpx->sio->response.eeprom.buffer))
+                len = sizeof(gpx->sio->response.eeprom.buffer);
+            Py_BEGIN_ALLOW_THREADS
+            rval = read_eeprom(gpx, pem->address, len);
+            Py_END_ALLOW_THREADS
+            if (rval == SUCCESS)
+                return Py_BuildValue("s", gpx->sio->response.eeprom.buffer);
             break;
 
         default:
@@ -706,9 +1077,12 @@ static PyObject *py_read_eeprom(PyObject *self, PyObject *args)
 }
 
 // def write_eeprom(id, value)
-static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
+static PyObject *py_write_eeprom(Printer *self, PyObject *args)
 {
-    if (!connected)
+    Gpx *gpx = &self->gpx;
+    Tio *tio = &self->tio;
+
+    if (!self->connected)
         return PyErr_NotConnected();
 
     tio->cur = 0;
@@ -719,16 +1093,14 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
 
     if (!PyArg_ParseTuple(args, "sO", &id, &value))
         return NULL;
-    PyObject_Print(value, gpx.log, 0);
-    fprintf(gpx.log, " <- \n");
+    PyObject_Print(value, gpx->log, 0);
+    fprintf(gpx->log, " <- \n");
 
-    if (gpx.flag.verboseMode) fprintf(gpx.log, "py_write_eeprom\n");
-    if (gpx.eepromMap == NULL && load_eeprom_map(&gpx) != SUCCESS) {
-        PyErr_SetString(pyerrUnknownFirmware, "No EEPROM map found for firmware type and/or version");
+    if (gpx->flag.verboseMode) fprintf(gpx->log, "py_write_eeprom\n");
+    if (printer_eeprom_map(self) != SUCCESS)
         return NULL;
-    }
 
-    EepromMapping *pem = find_any_eeprom_mapping(&gpx, id);
+    EepromMapping *pem = find_any_eeprom_mapping(gpx, id);
     if (pem == NULL) {
         PyErr_SetString(PyExc_ValueError, "EEPROM id mapping not found");
         return NULL;
@@ -746,33 +1118,39 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
         case et_boolean:
             if (!PyArg_Parse(value, "B", &b))
                 return NULL;
-            gcodeResult(&gpx, "write_eeprom_8(%u) to address %u", (unsigned)!!b, pem->address);
-            rval = write_eeprom_8(&gpx, gpx.sio, pem->address, !!b);
+            gcodeResult(gpx, "write_eeprom_8(%u) to address %u", (unsigned)!!b, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_8(gpx, gpx->sio, pem->address, !!b);
+            Py_END_ALLOW_THREADS
             break;
 
         case et_bitfield:
         case et_byte:
-            value = PyNumber_Int(value);
+            value = PyNumber_Long(value);
             if (value == NULL)
                 return NULL;
             f = PyArg_Parse(value, "B", &b);
             Py_DECREF(value);
             if (!f)
                 return NULL;
-            gcodeResult(&gpx, "write_eeprom_8(%u) to address %u", (unsigned)b, pem->address);
-            rval = write_eeprom_8(&gpx, gpx.sio, pem->address, b);
+            gcodeResult(gpx, "write_eeprom_8(%u) to address %u", (unsigned)b, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_8(gpx, gpx->sio, pem->address, b);
+            Py_END_ALLOW_THREADS
             break;
 
         case et_ushort:
-            value = PyNumber_Int(value);
+            value = PyNumber_Long(value);
             if (value == NULL)
                 return NULL;
             f = PyArg_Parse(value, "H", &us);
             Py_DECREF(value);
             if (!f)
                 return NULL;
-            gcodeResult(&gpx, "write_eeprom_16(%u) to address %u", us, pem->address);
-            rval = write_eeprom_16(&gpx, gpx.sio, pem->address, us);
+            gcodeResult(gpx, "write_eeprom_16(%u) to address %u", us, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_16(gpx, gpx->sio, pem->address, us);
+            Py_END_ALLOW_THREADS
             break;
 
         case et_fixed:
@@ -783,8 +1161,10 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
             Py_DECREF(value);
             if (!f)
                 return NULL;
-            rval = write_eeprom_fixed_16(&gpx, gpx.sio, pem->address, n);
-            gcodeResult(&gpx, "write_eeprom_fixed_16(%f) to address %u", n, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_fixed_16(gpx, gpx->sio, pem->address, n);
+            Py_END_ALLOW_THREADS
+            gcodeResult(gpx, "write_eeprom_fixed_16(%f) to address %u", n, pem->address);
             break;
 
         case et_long:
@@ -795,20 +1175,24 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
             Py_DECREF(value);
             if (!f)
                 return NULL;
-            rval = write_eeprom_32(&gpx, gpx.sio, pem->address, ul);
-            gcodeResult(&gpx, "write_eeprom_32(%lu) to address %u", ul, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_32(gpx, gpx->sio, pem->address, ul);
+            Py_END_ALLOW_THREADS
+            gcodeResult(gpx, "write_eeprom_32(%lu) to address %u", ul, pem->address);
             break;
 
         case et_ulong:
             value = PyNumber_Long(value);
             if (value == NULL)
                 return NULL;
-            f = PyArg_Parse(value, "L", &ul);
+            f = PyArg_Parse(value, "k", &ul);
             Py_DECREF(value);
             if (!f)
                 return NULL;
-            rval = write_eeprom_32(&gpx, gpx.sio, pem->address, ul);
-            gcodeResult(&gpx, "write_eeprom_32(%lu) to address %u", ul, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_32(gpx, gpx->sio, pem->address, ul);
+            Py_END_ALLOW_THREADS
+            gcodeResult(gpx, "write_eeprom_32(%lu) to address %u", ul, pem->address);
             break;
 
         case et_float:
@@ -819,8 +1203,10 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
             Py_DECREF(value);
             if (!f)
                 return NULL;
-            rval = write_eeprom_float(&gpx, gpx.sio, pem->address, n);
-            gcodeResult(&gpx, "write_eeprom_float(%f) to address %u", n, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom_float(gpx, gpx->sio, pem->address, n);
+            Py_END_ALLOW_THREADS
+            gcodeResult(gpx, "write_eeprom_float(%f) to address %u", n, pem->address);
             break;
 
         case et_string:
@@ -831,8 +1217,10 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
                 PyErr_SetString(PyExc_ValueError, "String value too long for indicated EEPROM entry");
                 return NULL;
             }
-            rval = write_eeprom(&gpx, pem->address, s, len + 1);
-            gcodeResult(&gpx, "write_eeprom(%s) to address %u", s, pem->address);
+            Py_BEGIN_ALLOW_THREADS
+            rval = write_eeprom(gpx, pem->address, s, len + 1);
+            Py_END_ALLOW_THREADS
+            gcodeResult(gpx, "write_eeprom(%s) to address %u", s, pem->address);
             break;
 
         default:
@@ -840,41 +1228,136 @@ static PyObject *py_write_eeprom(PyObject *self, PyObject *args)
             return NULL;
     }
 
-    return py_return_translation(rval);
+    return py_return_translation(self, rval);
 }
 
+// ----- gpx.Printer -----
+
+// one call at a time on a printer, waiting for it without holding up the
+// other threads
+static void printer_lock(Printer *self)
+{
+    if (!PyThread_acquire_lock(self->lock, NOWAIT_LOCK)) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock(self->lock, WAIT_LOCK);
+        Py_END_ALLOW_THREADS
+    }
+}
+
+// printer_<name> is the gpx.Printer method, module_<name> is the module
+// function that calls it on the default printer
+#define PRINTER_METHOD(name) \
+    static PyObject *printer_##name(Printer *self, PyObject *args) \
+    { \
+        printer_lock(self); \
+        PyObject *result = py_##name(self, args); \
+        PyThread_release_lock(self->lock); \
+        return result; \
+    } \
+    static PyObject *module_##name(PyObject *module, PyObject *args) \
+    { \
+        return printer_##name(defaultPrinter, args); \
+    }
+
+PRINTER_METHOD(connect)
+PRINTER_METHOD(disconnect)
+PRINTER_METHOD(write)
+PRINTER_METHOD(readnext)
+PRINTER_METHOD(set_baudrate)
+PRINTER_METHOD(read_ini)
+PRINTER_METHOD(reset_ini)
+PRINTER_METHOD(waiting)
+PRINTER_METHOD(reprap_flavor)
+PRINTER_METHOD(start)
+PRINTER_METHOD(stop)
+PRINTER_METHOD(abort)
+PRINTER_METHOD(read_eeprom)
+PRINTER_METHOD(write_eeprom)
+PRINTER_METHOD(build_started)
+PRINTER_METHOD(build_paused)
+PRINTER_METHOD(listing_files)
+
+static PyObject *printer_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    Printer *self = (Printer *)type->tp_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+
+    if ((self->lock = PyThread_allocate_lock()) == NULL) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    gpx_initialize(&self->gpx, 1);
+    tio_initialize(&self->tio, &self->gpx);
+    self->connected = 0;
+    return (PyObject *)self;
+}
+
+static void printer_dealloc(Printer *self)
+{
+    if (self->lock != NULL) {
+        tio_release(&self->tio);
+        free(self->gpx.buildName);
+        free(self->gpx.selectedFilename);
+        free(self->gpx.eepromMappingVector);
+        PyThread_free_lock(self->lock);
+    }
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+#define METHOD(prefix, name, doc) {#name, (PyCFunction)prefix##name, METH_VARARGS, doc}
+#define METHODS(prefix) \
+    METHOD(prefix, connect, "connect(port, baud = 0, inifilepath = None, logfilepath = None) Open the serial port to the printer and initialize the channel"), \
+    METHOD(prefix, disconnect, "disconnect() Close the serial port and clean up."), \
+    METHOD(prefix, write, "write(string) Translate g-code into x3g and send."), \
+    METHOD(prefix, readnext, "readnext() read next response if any"), \
+    METHOD(prefix, set_baudrate, "set_baudrate(long) Set the current baudrate for the connection to the printer."), \
+    METHOD(prefix, read_ini, "read_ini(string) Parse indicated ini file for gpx settings and macros and update current converter state. Loading ini files is additive. They just build on the ini's that have been read before. Use reset_ini to start from a clean state again."), \
+    METHOD(prefix, reset_ini, "reset_ini() Reset configuration state to default"), \
+    METHOD(prefix, waiting, "waiting() Returns True if the bot reports it is waiting for a temperature, pause or prompt"), \
+    METHOD(prefix, reprap_flavor, "reprap_flavor(boolean) Sets the expected gcode flavor (true = reprap, false = makerbot), returns the previous setting"), \
+    METHOD(prefix, start, "start() Call after connect and a printer specific pause (2 seconds for most) to start the serial communication"), \
+    METHOD(prefix, stop, "stop(halt_steppers, clear_queue) Tells the bot to either stop the steppers, clear the queue or both"), \
+    METHOD(prefix, abort, "abort() Tells the bot to clear the queue and stop all motors and heaters"), \
+    METHOD(prefix, read_eeprom, "read_eeprom(id) Read the value identified by id from the eeprom"), \
+    METHOD(prefix, write_eeprom, "write_eeprom(id, value) Write 'value' to the eeprom location identified by 'id'"), \
+    METHOD(prefix, build_started, "build_started() Returns True if a build has been started, but not yet ended"), \
+    METHOD(prefix, build_paused, "build_paused() Returns true if build is paused"), \
+    METHOD(prefix, listing_files, "listing_files() Returns true if there are still filenames to be returned of an SD card enumeration")
 
 // method table describes what is exposed to python
+static PyMethodDef PrinterMethods[] = {
+    METHODS(printer_),
+    {NULL, NULL, 0, NULL} // sentinel
+};
+
 static PyMethodDef GpxMethods[] = {
-    {"connect", py_connect, METH_VARARGS, "connect(port, baud = 0, inifilepath = None, logfilepath = None) Open the serial port to the printer and initialize the channel"},
-    {"disconnect", py_disconnect, METH_VARARGS, "disconnect() Close the serial port and clean up."},
-    {"write", py_write, METH_VARARGS, "write(string) Translate g-code into x3g and send."},
-    {"readnext", py_readnext, METH_VARARGS, "readnext() read next response if any"},
-    {"set_baudrate", py_set_baudrate, METH_VARARGS, "set_baudrate(long) Set the current baudrate for the connection to the printer."},
+    METHODS(module_),
     {"get_machine_defaults", py_get_machine_defaults, METH_VARARGS, "get_machine_defaults(string) Return a dict with the default settings for the indicated machine type."},
-    {"read_ini", py_read_ini, METH_VARARGS, "read_ini(string) Parse indicated ini file for gpx settings and macros and update current converter state. Loading ini files is additive. They just build on the ini's that have been read before. Use reset_ini to start from a clean state again."},
-    {"reset_ini", py_reset_ini, METH_VARARGS, "reset_ini() Reset configuration state to default"},
-    {"waiting", py_waiting, METH_VARARGS, "waiting() Returns True if the bot reports it is waiting for a temperature, pause or prompt"},
-    {"reprap_flavor", py_reprap_flavor, METH_VARARGS, "reprap_flavor(boolean) Sets the expected gcode flavor (true = reprap, false = makerbot), returns the previous setting"},
-    {"start", py_start, METH_VARARGS, "start() Call after connect and a printer specific pause (2 seconds for most) to start the serial communication"},
-    {"stop", py_stop, METH_VARARGS, "stop(halt_steppers, clear_queue) Tells the bot to either stop the steppers, clear the queue or both"},
-    {"abort", py_abort, METH_VARARGS, "abort() Tells the bot to clear the queue and stop all motors and heaters"},
-    {"read_eeprom", py_read_eeprom, METH_VARARGS, "read_eeprom(id) Read the value identified by id from the eeprom"},
-    {"write_eeprom", py_write_eeprom, METH_VARARGS, "write_eeprom(id, value) Write 'value' to the eeprom location identified by 'id'"},
-    {"build_started", py_build_started, METH_VARARGS, "build_started() Returns True if a build has been started, but not yet ended"},
-    {"build_paused", py_build_paused, METH_VARARGS, "build_paused() Returns true if build is paused"},
-    {"listing_files", py_listing_files, METH_VARARGS, "listing_files() Returns true if there are still filenames to be returned of an SD card enumeration"},
+    {"convert", (PyCFunction)py_convert, METH_VARARGS | METH_KEYWORDS, "convert(source, machine = None, ini = None, build_name = None, callback = None, reprap = None, build_progress = False, ditto = False, rewrite_5d = False, single_pass = False, threads = 0, scale = 1.0, offset = (0, 0, 0), filament_diameter = 0, verbose = False) Convert gcode to x3g. The source is a file name, the gcode as bytes or an iterable of lines. Returns (x3g, total) where total is a dict of the estimated time, the filament length and the size of the x3g. With a callback the x3g is passed to it in chunks and None is returned in its place."},
     {NULL, NULL, 0, NULL} // sentinel
 };
 
-__attribute__ ((visibility ("default"))) PyMODINIT_FUNC initgpx(void);
-
-// python calls init<modulename> when the module is loaded
-PyMODINIT_FUNC initgpx(void)
+static PyObject *module_init(PyObject *m)
 {
-    PyObject *m = Py_InitModule("gpx", GpxMethods);
     if (m == NULL)
-        return;
+        return NULL;
+
+#if PY_VERSION_HEX < 0x03070000
+    PyEval_InitThreads();
+#endif
+
+    PrinterType.tp_name = "gpx.Printer";
+    PrinterType.tp_basicsize = sizeof(Printer);
+    PrinterType.tp_flags = Py_TPFLAGS_DEFAULT;
+    PrinterType.tp_doc = "Printer() A printer connection with its own gcode to x3g translation state";
+    PrinterType.tp_new = printer_new;
+    PrinterType.tp_dealloc = (destructor)printer_dealloc;
+    PrinterType.tp_methods = PrinterMethods;
+    if (PyType_Ready(&PrinterType) < 0)
+        return NULL;
+    Py_INCREF(&PrinterType);
+    PyModule_AddObject(m, "Printer", (PyObject *)&PrinterType);
 
     pyerrCancelBuild = PyErr_NewException("gpx.CancelBuild", NULL, NULL);
     Py_INCREF(pyerrCancelBuild);
@@ -892,6 +1375,30 @@ PyMODINIT_FUNC initgpx(void)
     Py_INCREF(pyerrUnknownFirmware);
     PyModule_AddObject(m, "UnknownFirmware", pyerrUnknownFirmware);
 
-    gpx_initialize(&gpx, 1);
-    tio = tio_initialize(&gpx);
+    defaultPrinter = (Printer *)printer_new(&PrinterType, NULL, NULL);
+    if (defaultPrinter == NULL)
+        return NULL;
+    return m;
 }
+
+#if PY_MAJOR_VERSION >= 3
+static struct PyModuleDef GpxModule = {
+    PyModuleDef_HEAD_INIT, "gpx", NULL, -1, GpxMethods
+};
+
+__attribute__ ((visibility ("default"))) PyMODINIT_FUNC PyInit_gpx(void);
+
+// python calls PyInit_<modulename> when the module is loaded
+PyMODINIT_FUNC PyInit_gpx(void)
+{
+    return module_init(PyModule_Create(&GpxModule));
+}
+#else
+__attribute__ ((visibility ("default"))) PyMODINIT_FUNC initgpx(void);
+
+// python calls init<modulename> when the module is loaded
+PyMODINIT_FUNC initgpx(void)
+{
+    module_init(Py_InitModule("gpx", GpxMethods));
+}
+#endif
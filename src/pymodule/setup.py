@@ -7,8 +7,14 @@ sources = [
 	'gpxmodule.c',
 	'../shared/machine_config.c',
 	'../shared/opt.c',
+	'../shared/crc.c',
 	'../gpx/gpx.c',
 	'../gpx/gpx-main.c',
+	'../gpx/gpxresp.c',
+	'../gpx/vector.c',
+	'../gpx/decimal.c',
+	'../gpx/planner.c',
+	'../gpx/cache.c',
 	]
 if sys.platform == 'win32':
 	sources.append('../gpx/winsio.c')
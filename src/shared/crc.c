@@ -0,0 +1,141 @@
+/*  crc.c
+ *
+ *  8-bit iButton/Maxim/Dallas CRC used to frame x3g packets on the wire
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software Foundation,
+ *  Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "crc.h"
+
+/* crc_table[0][v] is the CRC of the byte v and crc_table[k][v] is the CRC of v
+ * followed by k zero bytes, the CRC is linear and only a byte wide, so the CRC
+ * of four bytes is the xor of one lookup for each of them */
+
+static const unsigned char crc_table[4][256] = {
+    {
+        0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20,
+        0xA3, 0xFD, 0x1F, 0x41, 0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E,
+        0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC, 0x23, 0x7D, 0x9F, 0xC1,
+        0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
+        0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E,
+        0x1D, 0x43, 0xA1, 0xFF, 0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5,
+        0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07, 0xDB, 0x85, 0x67, 0x39,
+        0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
+        0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45,
+        0xC6, 0x98, 0x7A, 0x24, 0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B,
+        0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9, 0x8C, 0xD2, 0x30, 0x6E,
+        0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
+        0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31,
+        0xB2, 0xEC, 0x0E, 0x50, 0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C,
+        0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE, 0x32, 0x6C, 0x8E, 0xD0,
+        0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
+        0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA,
+        0x69, 0x37, 0xD5, 0x8B, 0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4,
+        0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16, 0xE9, 0xB7, 0x55, 0x0B,
+        0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
+        0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54,
+        0xD7, 0x89, 0x6B, 0x35
+    },
+    {
+        0x00, 0xC4, 0x91, 0x55, 0x3B, 0xFF, 0xAA, 0x6E, 0x76, 0xB2, 0xE7, 0x23,
+        0x4D, 0x89, 0xDC, 0x18, 0xEC, 0x28, 0x7D, 0xB9, 0xD7, 0x13, 0x46, 0x82,
+        0x9A, 0x5E, 0x0B, 0xCF, 0xA1, 0x65, 0x30, 0xF4, 0xC1, 0x05, 0x50, 0x94,
+        0xFA, 0x3E, 0x6B, 0xAF, 0xB7, 0x73, 0x26, 0xE2, 0x8C, 0x48, 0x1D, 0xD9,
+        0x2D, 0xE9, 0xBC, 0x78, 0x16, 0xD2, 0x87, 0x43, 0x5B, 0x9F, 0xCA, 0x0E,
+        0x60, 0xA4, 0xF1, 0x35, 0x9B, 0x5F, 0x0A, 0xCE, 0xA0, 0x64, 0x31, 0xF5,
+        0xED, 0x29, 0x7C, 0xB8, 0xD6, 0x12, 0x47, 0x83, 0x77, 0xB3, 0xE6, 0x22,
+        0x4C, 0x88, 0xDD, 0x19, 0x01, 0xC5, 0x90, 0x54, 0x3A, 0xFE, 0xAB, 0x6F,
+        0x5A, 0x9E, 0xCB, 0x0F, 0x61, 0xA5, 0xF0, 0x34, 0x2C, 0xE8, 0xBD, 0x79,
+        0x17, 0xD3, 0x86, 0x42, 0xB6, 0x72, 0x27, 0xE3, 0x8D, 0x49, 0x1C, 0xD8,
+        0xC0, 0x04, 0x51, 0x95, 0xFB, 0x3F, 0x6A, 0xAE, 0x2F, 0xEB, 0xBE, 0x7A,
+        0x14, 0xD0, 0x85, 0x41, 0x59, 0x9D, 0xC8, 0x0C, 0x62, 0xA6, 0xF3, 0x37,
+        0xC3, 0x07, 0x52, 0x96, 0xF8, 0x3C, 0x69, 0xAD, 0xB5, 0x71, 0x24, 0xE0,
+        0x8E, 0x4A, 0x1F, 0xDB, 0xEE, 0x2A, 0x7F, 0xBB, 0xD5, 0x11, 0x44, 0x80,
+        0x98, 0x5C, 0x09, 0xCD, 0xA3, 0x67, 0x32, 0xF6, 0x02, 0xC6, 0x93, 0x57,
+        0x39, 0xFD, 0xA8, 0x6C, 0x74, 0xB0, 0xE5, 0x21, 0x4F, 0x8B, 0xDE, 0x1A,
+        0xB4, 0x70, 0x25, 0xE1, 0x8F, 0x4B, 0x1E, 0xDA, 0xC2, 0x06, 0x53, 0x97,
+        0xF9, 0x3D, 0x68, 0xAC, 0x58, 0x9C, 0xC9, 0x0D, 0x63, 0xA7, 0xF2, 0x36,
+        0x2E, 0xEA, 0xBF, 0x7B, 0x15, 0xD1, 0x84, 0x40, 0x75, 0xB1, 0xE4, 0x20,
+        0x4E, 0x8A, 0xDF, 0x1B, 0x03, 0xC7, 0x92, 0x56, 0x38, 0xFC, 0xA9, 0x6D,
+        0x99, 0x5D, 0x08, 0xCC, 0xA2, 0x66, 0x33, 0xF7, 0xEF, 0x2B, 0x7E, 0xBA,
+        0xD4, 0x10, 0x45, 0x81
+    },
+    {
+        0x00, 0xAB, 0x4F, 0xE4, 0x9E, 0x35, 0xD1, 0x7A, 0x25, 0x8E, 0x6A, 0xC1,
+        0xBB, 0x10, 0xF4, 0x5F, 0x4A, 0xE1, 0x05, 0xAE, 0xD4, 0x7F, 0x9B, 0x30,
+        0x6F, 0xC4, 0x20, 0x8B, 0xF1, 0x5A, 0xBE, 0x15, 0x94, 0x3F, 0xDB, 0x70,
+        0x0A, 0xA1, 0x45, 0xEE, 0xB1, 0x1A, 0xFE, 0x55, 0x2F, 0x84, 0x60, 0xCB,
+        0xDE, 0x75, 0x91, 0x3A, 0x40, 0xEB, 0x0F, 0xA4, 0xFB, 0x50, 0xB4, 0x1F,
+        0x65, 0xCE, 0x2A, 0x81, 0x31, 0x9A, 0x7E, 0xD5, 0xAF, 0x04, 0xE0, 0x4B,
+        0x14, 0xBF, 0x5B, 0xF0, 0x8A, 0x21, 0xC5, 0x6E, 0x7B, 0xD0, 0x34, 0x9F,
+        0xE5, 0x4E, 0xAA, 0x01, 0x5E, 0xF5, 0x11, 0xBA, 0xC0, 0x6B, 0x8F, 0x24,
+        0xA5, 0x0E, 0xEA, 0x41, 0x3B, 0x90, 0x74, 0xDF, 0x80, 0x2B, 0xCF, 0x64,
+        0x1E, 0xB5, 0x51, 0xFA, 0xEF, 0x44, 0xA0, 0x0B, 0x71, 0xDA, 0x3E, 0x95,
+        0xCA, 0x61, 0x85, 0x2E, 0x54, 0xFF, 0x1B, 0xB0, 0x62, 0xC9, 0x2D, 0x86,
+        0xFC, 0x57, 0xB3, 0x18, 0x47, 0xEC, 0x08, 0xA3, 0xD9, 0x72, 0x96, 0x3D,
+        0x28, 0x83, 0x67, 0xCC, 0xB6, 0x1D, 0xF9, 0x52, 0x0D, 0xA6, 0x42, 0xE9,
+        0x93, 0x38, 0xDC, 0x77, 0xF6, 0x5D, 0xB9, 0x12, 0x68, 0xC3, 0x27, 0x8C,
+        0xD3, 0x78, 0x9C, 0x37, 0x4D, 0xE6, 0x02, 0xA9, 0xBC, 0x17, 0xF3, 0x58,
+        0x22, 0x89, 0x6D, 0xC6, 0x99, 0x32, 0xD6, 0x7D, 0x07, 0xAC, 0x48, 0xE3,
+        0x53, 0xF8, 0x1C, 0xB7, 0xCD, 0x66, 0x82, 0x29, 0x76, 0xDD, 0x39, 0x92,
+        0xE8, 0x43, 0xA7, 0x0C, 0x19, 0xB2, 0x56, 0xFD, 0x87, 0x2C, 0xC8, 0x63,
+        0x3C, 0x97, 0x73, 0xD8, 0xA2, 0x09, 0xED, 0x46, 0xC7, 0x6C, 0x88, 0x23,
+        0x59, 0xF2, 0x16, 0xBD, 0xE2, 0x49, 0xAD, 0x06, 0x7C, 0xD7, 0x33, 0x98,
+        0x8D, 0x26, 0xC2, 0x69, 0x13, 0xB8, 0x5C, 0xF7, 0xA8, 0x03, 0xE7, 0x4C,
+        0x36, 0x9D, 0x79, 0xD2
+    },
+    {
+        0x00, 0x8F, 0x07, 0x88, 0x0E, 0x81, 0x09, 0x86, 0x1C, 0x93, 0x1B, 0x94,
+        0x12, 0x9D, 0x15, 0x9A, 0x38, 0xB7, 0x3F, 0xB0, 0x36, 0xB9, 0x31, 0xBE,
+        0x24, 0xAB, 0x23, 0xAC, 0x2A, 0xA5, 0x2D, 0xA2, 0x70, 0xFF, 0x77, 0xF8,
+        0x7E, 0xF1, 0x79, 0xF6, 0x6C, 0xE3, 0x6B, 0xE4, 0x62, 0xED, 0x65, 0xEA,
+        0x48, 0xC7, 0x4F, 0xC0, 0x46, 0xC9, 0x41, 0xCE, 0x54, 0xDB, 0x53, 0xDC,
+        0x5A, 0xD5, 0x5D, 0xD2, 0xE0, 0x6F, 0xE7, 0x68, 0xEE, 0x61, 0xE9, 0x66,
+        0xFC, 0x73, 0xFB, 0x74, 0xF2, 0x7D, 0xF5, 0x7A, 0xD8, 0x57, 0xDF, 0x50,
+        0xD6, 0x59, 0xD1, 0x5E, 0xC4, 0x4B, 0xC3, 0x4C, 0xCA, 0x45, 0xCD, 0x42,
+        0x90, 0x1F, 0x97, 0x18, 0x9E, 0x11, 0x99, 0x16, 0x8C, 0x03, 0x8B, 0x04,
+        0x82, 0x0D, 0x85, 0x0A, 0xA8, 0x27, 0xAF, 0x20, 0xA6, 0x29, 0xA1, 0x2E,
+        0xB4, 0x3B, 0xB3, 0x3C, 0xBA, 0x35, 0xBD, 0x32, 0xD9, 0x56, 0xDE, 0x51,
+        0xD7, 0x58, 0xD0, 0x5F, 0xC5, 0x4A, 0xC2, 0x4D, 0xCB, 0x44, 0xCC, 0x43,
+        0xE1, 0x6E, 0xE6, 0x69, 0xEF, 0x60, 0xE8, 0x67, 0xFD, 0x72, 0xFA, 0x75,
+        0xF3, 0x7C, 0xF4, 0x7B, 0xA9, 0x26, 0xAE, 0x21, 0xA7, 0x28, 0xA0, 0x2F,
+        0xB5, 0x3A, 0xB2, 0x3D, 0xBB, 0x34, 0xBC, 0x33, 0x91, 0x1E, 0x96, 0x19,
+        0x9F, 0x10, 0x98, 0x17, 0x8D, 0x02, 0x8A, 0x05, 0x83, 0x0C, 0x84, 0x0B,
+        0x39, 0xB6, 0x3E, 0xB1, 0x37, 0xB8, 0x30, 0xBF, 0x25, 0xAA, 0x22, 0xAD,
+        0x2B, 0xA4, 0x2C, 0xA3, 0x01, 0x8E, 0x06, 0x89, 0x0F, 0x80, 0x08, 0x87,
+        0x1D, 0x92, 0x1A, 0x95, 0x13, 0x9C, 0x14, 0x9B, 0x49, 0xC6, 0x4E, 0xC1,
+        0x47, 0xC8, 0x40, 0xCF, 0x55, 0xDA, 0x52, 0xDD, 0x5B, 0xD4, 0x5C, 0xD3,
+        0x71, 0xFE, 0x76, 0xF9, 0x7F, 0xF0, 0x78, 0xF7, 0x6D, 0xE2, 0x6A, 0xE5,
+        0x63, 0xEC, 0x64, 0xEB
+    }
+};
+
+unsigned char calculate_crc(const unsigned char *addr, long len)
+{
+    unsigned char crc = 0;
+
+    /* slicing-by-4 for the longer payloads, eeprom writes, sd captures and
+     * the like */
+    while(len >= 4) {
+        crc = crc_table[3][crc ^ addr[0]] ^ crc_table[2][addr[1]]
+            ^ crc_table[1][addr[2]] ^ crc_table[0][addr[3]];
+        addr += 4;
+        len -= 4;
+    }
+    while(len-- > 0) {
+        crc = crc_table[0][crc ^ *addr++];
+    }
+    return crc;
+}
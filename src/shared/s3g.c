@@ -30,8 +30,10 @@
 #include <fcntl.h>
 
 #include "portable_endian.h"
+#include "crc.h"
 #include "s3g_private.h"
 #include "s3g_stdio.h"
+#include "s3g_mmap.h"
 #include "s3g.h"
 
 typedef struct {
@@ -58,196 +60,116 @@ typedef struct {
      const char *cmd_desc;
 } s3g_command_info_t;
 
-static const s3g_command_info_t command_table_raw[] = {
-     /*   0 */  {HOST_CMD_VERSION, 0, 0, "version"},
-     /*   1 */  {HOST_CMD_INIT, 0, -1, "initialize"},
-     /*   2 */  {HOST_CMD_GET_BUFFER_SIZE, 0, 0, "get buffer size"},
-     /*   3 */  {HOST_CMD_CLEAR_BUFFER, 0, 0, "clear buffer"},
-     /*   4 */  {HOST_CMD_GET_POSITION, 0, -1, "get position"},
+// Indexed by command id, unrecognized commands have no description
+
+static const s3g_command_info_t command_table[256] = {
+     /*   0 */  [HOST_CMD_VERSION] = {HOST_CMD_VERSION, 2, 0, "version"},
+     /*   1 */  [HOST_CMD_INIT] = {HOST_CMD_INIT, 0, -1, "initialize"},
+     /*   2 */  [HOST_CMD_GET_BUFFER_SIZE] = {HOST_CMD_GET_BUFFER_SIZE, 0, 0, "get buffer size"},
+     /*   3 */  [HOST_CMD_CLEAR_BUFFER] = {HOST_CMD_CLEAR_BUFFER, 0, 0, "clear buffer"},
+     /*   4 */  [HOST_CMD_GET_POSITION] = {HOST_CMD_GET_POSITION, 0, -1, "get position"},
      /* 5,6 */  // DO NOT EXIST
-     /*   7 */  {HOST_CMD_ABORT, 0, -1, "abort"},
-     /*   8 */  {HOST_CMD_PAUSE, 0, -1, "Pause"},
-     /*   9 */  {HOST_CMD_PROBE, 0, -1, "probe"},
-     /*  10 */  {HOST_CMD_TOOL_QUERY, 0, 0, "tool query"},
-     /*  11 */  {HOST_CMD_IS_FINISHED, 0, -1, "is finished?"},
-     /*  12 */  {HOST_CMD_READ_EEPROM, 0, 0, "read EEPROM"},
-     /*  13 */  {HOST_CMD_WRITE_EEPROM, 0, 0, "write EEPROM"},
-     /*  14 */  {HOST_CMD_CAPTURE_TO_FILE, 0, -1, "capture to file"},
-     /*  15 */  {HOST_CMD_END_CAPTURE, 0, -1, "end capture"},
-     /*  16 */  {HOST_CMD_PLAYBACK_CAPTURE, 0, -1, "playback capture"},
-     /*  17 */  {HOST_CMD_RESET, 0, -1, "software reset"},
-     /*  18 */  {HOST_CMD_NEXT_FILENAME, 0, -1, "next SD card filename"},
-     /*  19 */  {HOST_CMD_GET_DBG_REG, 0, 0, "get debug register"},
-     /*  20 */  {HOST_CMD_GET_BUILD_NAME, 0, 0, "get build name"},
-     /*  21 */  {HOST_CMD_GET_POSITION_EXT, 0, -1, "get position extended"},
-     /*  22 */  {HOST_CMD_EXTENDED_STOP, 0, -1, "extended stop"},
-     /*  23 */  {HOST_CMD_BOARD_STATUS, 0, 0, "get board status"},
-     /*  24 */  {HOST_CMD_GET_BUILD_STATS, 0, -1, "get build statistics"},
+     /*   7 */  [HOST_CMD_ABORT] = {HOST_CMD_ABORT, 0, -1, "abort"},
+     /*   8 */  [HOST_CMD_PAUSE] = {HOST_CMD_PAUSE, 0, -1, "Pause"},
+     /*   9 */  [HOST_CMD_PROBE] = {HOST_CMD_PROBE, 0, -1, "probe"},
+     /*  10 */  [HOST_CMD_TOOL_QUERY] = {HOST_CMD_TOOL_QUERY, 0, 0, "tool query"},
+     /*  11 */  [HOST_CMD_IS_FINISHED] = {HOST_CMD_IS_FINISHED, 0, -1, "is finished?"},
+     /*  12 */  [HOST_CMD_READ_EEPROM] = {HOST_CMD_READ_EEPROM, 3, 0, "read EEPROM"},
+     /*  13 */  [HOST_CMD_WRITE_EEPROM] = {HOST_CMD_WRITE_EEPROM, 0, 0, "write EEPROM"},
+     /*  14 */  [HOST_CMD_CAPTURE_TO_FILE] = {HOST_CMD_CAPTURE_TO_FILE, 0, -1, "capture to file"},
+     /*  15 */  [HOST_CMD_END_CAPTURE] = {HOST_CMD_END_CAPTURE, 0, -1, "end capture"},
+     /*  16 */  [HOST_CMD_PLAYBACK_CAPTURE] = {HOST_CMD_PLAYBACK_CAPTURE, 0, -1, "playback capture"},
+     /*  17 */  [HOST_CMD_RESET] = {HOST_CMD_RESET, 0, -1, "software reset"},
+     /*  18 */  [HOST_CMD_NEXT_FILENAME] = {HOST_CMD_NEXT_FILENAME, 1, -1, "next SD card filename"},
+     /*  19 */  [HOST_CMD_GET_DBG_REG] = {HOST_CMD_GET_DBG_REG, 0, 0, "get debug register"},
+     /*  20 */  [HOST_CMD_GET_BUILD_NAME] = {HOST_CMD_GET_BUILD_NAME, 0, 0, "get build name"},
+     /*  21 */  [HOST_CMD_GET_POSITION_EXT] = {HOST_CMD_GET_POSITION_EXT, 0, -1, "get position extended"},
+     /*  22 */  [HOST_CMD_EXTENDED_STOP] = {HOST_CMD_EXTENDED_STOP, 1, -1, "extended stop"},
+     /*  23 */  [HOST_CMD_BOARD_STATUS] = {HOST_CMD_BOARD_STATUS, 0, 0, "get board status"},
+     /*  24 */  [HOST_CMD_GET_BUILD_STATS] = {HOST_CMD_GET_BUILD_STATS, 0, -1, "get build statistics"},
      /* 25-6*/  // DO NOT EXIST
-     /*  27 */  {HOST_CMD_ADVANCED_VERSION, 0, 0, "advanced version"},
+     /*  27 */  [HOST_CMD_ADVANCED_VERSION] = {HOST_CMD_ADVANCED_VERSION, 2, 0, "advanced version"},
      /* ... */  // DO NOT EXIST
-     /* 112 */  {HOST_CMD_DEBUG_ECHO, 0, -1, "debug echo"},
+     /* 112 */  [HOST_CMD_DEBUG_ECHO] = {HOST_CMD_DEBUG_ECHO, 0, -1, "debug echo"},
      /* ... */  // DO NOT EXIST
-     /* 131 */  {HOST_CMD_FIND_AXES_MINIMUM, 7, -1, "find axes minimum"},
-     /* 132 */  {HOST_CMD_FIND_AXES_MAXIMUM, 7, -1, "find axes maximum"},
-     /* 133 */  {HOST_CMD_DELAY, 4, -1, "delay"},
-     /* 134 */  {HOST_CMD_CHANGE_TOOL, 1, -1, "change tool"},
-     /* 135 */  {HOST_CMD_WAIT_FOR_TOOL, 5, -1, "wait for tool ready"},
-     /* 136 */  {HOST_CMD_TOOL_COMMAND, 0xffffffff, 0, "tool action"},
-     /* 137 */  {HOST_CMD_ENABLE_AXES, 1, -1, "enable/disable axes"},
-     /* 138 */  // DOES NOT EXIST
-     /* 139 */  {HOST_CMD_QUEUE_POINT_EXT, 24, -1, "queue point extended"},
-     /* 140 */  {HOST_CMD_SET_POSITION_EXT, 20, -1, "set position extended"},
-     /* 141 */  {HOST_CMD_WAIT_FOR_PLATFORM, 5, -1, "wait for platform ready"},
-     /* 142 */  {HOST_CMD_QUEUE_POINT_NEW, 25, -1, "queue new point"},
-     /* 143 */  {HOST_CMD_STORE_HOME_POSITION, 1, -1, "store home position"},
-     /* 144 */  {HOST_CMD_RECALL_HOME_POSITION, 1, -1, "recall home position"},
-     /* 145 */  {HOST_CMD_SET_POT_VALUE, 2, -1, "digital potentiometer"},
-     /* 146 */  {HOST_CMD_SET_RGB_LED, 5, -1, "RGB LED"},
-     /* 147 */  {HOST_CMD_SET_BEEP, 5, -1, "buzzer beep"},
-     /* 148 */  {HOST_CMD_PAUSE_FOR_BUTTON, 4, -1, "pause for button"},
-     /* 149 */  {HOST_CMD_DISPLAY_MESSAGE, -1, -1, "display message"},
-     /* 150 */  {HOST_CMD_SET_BUILD_PERCENT, 2, 0, "build percentage"},
-     /* 151 */  {HOST_CMD_QUEUE_SONG, 1, -1, "queue song"},
-     /* 152 */  {HOST_CMD_RESET_TO_FACTORY, 1, -1, "restore to factory settings"},
-     /* 153 */  {HOST_CMD_BUILD_START_NOTIFICATION, 4, -1, "build start notification"},
-     /* 154 */  {HOST_CMD_BUILD_END_NOTIFICATION, 1, -1, "build end notification"},
-     /* 155 */  {HOST_CMD_QUEUE_POINT_NEW_EXT, 31, 0, "queue point new extended"},
-     /* 156 */  {HOST_CMD_SET_ACCELERATION_TOGGLE, 1, -1, "set segment acceleration"},
-     /* 157 */  {HOST_CMD_STREAM_VERSION, 20, 0, "stream version"},
-     /* 158 */  {HOST_CMD_PAUSE_AT_ZPOS, 4, 0, "pause at Z position"}
+     /* 129 */  [HOST_CMD_QUEUE_POINT_ABS] = {HOST_CMD_QUEUE_POINT_ABS, 16, -1, "queue point absolute"},
+     /* 130 */  [HOST_CMD_SET_POSITION] = {HOST_CMD_SET_POSITION, 12, -1, "set position"},
+     /* 131 */  [HOST_CMD_FIND_AXES_MINIMUM] = {HOST_CMD_FIND_AXES_MINIMUM, 7, -1, "find axes minimum"},
+     /* 132 */  [HOST_CMD_FIND_AXES_MAXIMUM] = {HOST_CMD_FIND_AXES_MAXIMUM, 7, -1, "find axes maximum"},
+     /* 133 */  [HOST_CMD_DELAY] = {HOST_CMD_DELAY, 4, -1, "delay"},
+     /* 134 */  [HOST_CMD_CHANGE_TOOL] = {HOST_CMD_CHANGE_TOOL, 1, -1, "change tool"},
+     /* 135 */  [HOST_CMD_WAIT_FOR_TOOL] = {HOST_CMD_WAIT_FOR_TOOL, 5, -1, "wait for tool ready"},
+     /* 136 */  [HOST_CMD_TOOL_COMMAND] = {HOST_CMD_TOOL_COMMAND, 0xffffffff, 0, "tool action"},
+     /* 137 */  [HOST_CMD_ENABLE_AXES] = {HOST_CMD_ENABLE_AXES, 1, -1, "enable/disable axes"},
+     /* 138 */  [HOST_CMD_WAIT_FOR_BUTTON] = {HOST_CMD_WAIT_FOR_BUTTON, 2, -1, "wait on user response"},
+     /* 139 */  [HOST_CMD_QUEUE_POINT_EXT] = {HOST_CMD_QUEUE_POINT_EXT, 24, -1, "queue point extended"},
+     /* 140 */  [HOST_CMD_SET_POSITION_EXT] = {HOST_CMD_SET_POSITION_EXT, 20, -1, "set position extended"},
+     /* 141 */  [HOST_CMD_WAIT_FOR_PLATFORM] = {HOST_CMD_WAIT_FOR_PLATFORM, 5, -1, "wait for platform ready"},
+     /* 142 */  [HOST_CMD_QUEUE_POINT_NEW] = {HOST_CMD_QUEUE_POINT_NEW, 25, -1, "queue new point"},
+     /* 143 */  [HOST_CMD_STORE_HOME_POSITION] = {HOST_CMD_STORE_HOME_POSITION, 1, -1, "store home position"},
+     /* 144 */  [HOST_CMD_RECALL_HOME_POSITION] = {HOST_CMD_RECALL_HOME_POSITION, 1, -1, "recall home position"},
+     /* 145 */  [HOST_CMD_SET_POT_VALUE] = {HOST_CMD_SET_POT_VALUE, 2, -1, "digital potentiometer"},
+     /* 146 */  [HOST_CMD_SET_RGB_LED] = {HOST_CMD_SET_RGB_LED, 5, -1, "RGB LED"},
+     /* 147 */  [HOST_CMD_SET_BEEP] = {HOST_CMD_SET_BEEP, 5, -1, "buzzer beep"},
+     /* 148 */  [HOST_CMD_PAUSE_FOR_BUTTON] = {HOST_CMD_PAUSE_FOR_BUTTON, 4, -1, "pause for button"},
+     /* 149 */  [HOST_CMD_DISPLAY_MESSAGE] = {HOST_CMD_DISPLAY_MESSAGE, -1, -1, "display message"},
+     /* 150 */  [HOST_CMD_SET_BUILD_PERCENT] = {HOST_CMD_SET_BUILD_PERCENT, 2, 0, "build percentage"},
+     /* 151 */  [HOST_CMD_QUEUE_SONG] = {HOST_CMD_QUEUE_SONG, 1, -1, "queue song"},
+     /* 152 */  [HOST_CMD_RESET_TO_FACTORY] = {HOST_CMD_RESET_TO_FACTORY, 1, -1, "restore to factory settings"},
+     /* 153 */  [HOST_CMD_BUILD_START_NOTIFICATION] = {HOST_CMD_BUILD_START_NOTIFICATION, 4, -1, "build start notification"},
+     /* 154 */  [HOST_CMD_BUILD_END_NOTIFICATION] = {HOST_CMD_BUILD_END_NOTIFICATION, 1, -1, "build end notification"},
+     /* 155 */  [HOST_CMD_QUEUE_POINT_NEW_EXT] = {HOST_CMD_QUEUE_POINT_NEW_EXT, 31, 0, "queue point new extended"},
+     /* 156 */  [HOST_CMD_SET_ACCELERATION_TOGGLE] = {HOST_CMD_SET_ACCELERATION_TOGGLE, 1, -1, "set segment acceleration"},
+     /* 157 */  [HOST_CMD_STREAM_VERSION] = {HOST_CMD_STREAM_VERSION, 20, 0, "stream version"},
+     /* 158 */  [HOST_CMD_PAUSE_AT_ZPOS] = {HOST_CMD_PAUSE_AT_ZPOS, 4, 0, "pause at Z position"}
      /* ... */  // DO NOT EXIST
 };
 
-static const s3g_command_info_t tool_command_table_raw[] = {
-     /*   0 */  {TOOL_CMD_VERSION, 0, 0, "version"},
-     /*   1 */  {TOOL_CMD_INIT, 0, -1, "initialize"},
-     /*   2 */  {TOOL_CMD_GET_TEMP, 0, 0, "query current extruder temperature"},
-     /*   3 */  {TOOL_CMD_SET_TEMP, 0, 0, "set extruder target temperature"},
-     /*   4 */  {TOOL_CMD_SET_MOTOR_1_PWM, 0, -1, "set motor 1 speed (PWM)"},
-     /*   5 */  {TOOL_CMD_SET_MOTOR_2_PWM, 0, -1, "set motor 2 speed (PWM)"},
-     /*   6 */  {TOOL_CMD_SET_MOTOR_1_RPM, 0, -1, "set motor 1 speed (RPM)"},
-     /*   7 */  {TOOL_CMD_SET_MOTOR_2_RPM, 0, -1, "set motor 2 speed (RPM)"},
-     /*   8 */  {TOOL_CMD_SET_MOTOR_1_DIR, 0, -1, "set motor 1 direction"},
-     /*   9 */  {TOOL_CMD_SET_MOTOR_2_DIR, 0, -1, "set motor 2 direction"},
-     /*  10 */  {TOOL_CMD_TOGGLE_MOTOR_1, 0, -1, "set motor 1 state"},
-     /*  11 */  {TOOL_CMD_TOGGLE_MOTOR_2, 0, -1, "set motor 2 state"},
-     /*  12 */  {TOOL_CMD_TOGGLE_FAN, 0, 0, "set heatsink cooling fan state"},
-     /*  13 */  {TOOL_CMD_TOGGLE_VALVE, 0, 0, "set print cooling fan state"},
-     /*  14 */  {TOOL_CMD_SET_SERVO_1_POS, 0, -1, "set servo 1 position"},
-     /*  15 */  {TOOL_CMD_SET_SERVO_2_POS, 0, -1, "set servo 2 position"},
-     /*  16 */  {TOOL_CMD_FILAMENT_STATUS, 0, 0, "query filament status"},
-     /*  17 */  {TOOL_CMD_GET_MOTOR_1_RPM, 0, 0, "query motor 1 speed (RPM)"},
-     /*  18 */  {TOOL_CMD_GET_MOTOR_2_RPM, 0, 0, "query motor 2 speed (RPM)"},
-     /*  19 */  {TOOL_CMD_GET_MOTOR_1_PWM, 0, 0, "query motor 1 speed (PWM)"},
-     /*  20 */  {TOOL_CMD_GET_MOTOR_2_PWM, 0, 0, "query motor 2 speed (PWM)"},
-     /*  21 */  {TOOL_CMD_SELECT_TOOL, 0, -1, "switch tool"},
-     /*  22 */  {TOOL_CMD_IS_TOOL_READY, 0, -1, "query tool ready"},
-     /*  23 */  {TOOL_CMD_PAUSE_UNPAUSE, 0, -1, "toggle pause state"},
-     /*  24 */  {TOOL_CMD_ABORT, 0, -1, "abort"},
-     /*  25 */  {TOOL_CMD_READ_FROM_EEPROM, 0, 0, "read EEPROM"},
-     /*  26 */  {TOOL_CMD_WRITE_TO_EEPROM, 0, 0, "write EEPROM"},
-     /*  30 */  {TOOL_CMD_GET_PLATFORM_TEMP, 0, 0, "query current platform temperature"},
-     /*  31 */  {TOOL_CMD_SET_PLATFORM_TEMP, 0, 0, "set platform target temperature"},
-     /*  32 */  {TOOL_CMD_GET_SP, 0, 0, "query extruder target temperature"},
-     /*  33 */  {TOOL_CMD_GET_PLATFORM_SP, 0, 0, "query platform target temperature"},
-     /*  34 */  {TOOL_CMD_GET_BUILD_NAME, 0, 0, "query build name"},
-     /*  35 */  {TOOL_CMD_IS_PLATFORM_READY, 0, -1, "query platform ready"},
-     /*  36 */  {TOOL_CMD_GET_TOOL_STATUS, 0, 0, "query tool status"},
-     /*  37 */  {TOOL_CMD_GET_PID_STATE, 0, 0, "query PID state"},
-     /*  40 */  {TOOL_CMD_LIGHT_INDICATOR_LED, 0, -1, "set LED state"}
+static const s3g_command_info_t tool_command_table[256] = {
+     /*   0 */  [TOOL_CMD_VERSION] = {TOOL_CMD_VERSION, 0, 0, "version"},
+     /*   1 */  [TOOL_CMD_INIT] = {TOOL_CMD_INIT, 0, -1, "initialize"},
+     /*   2 */  [TOOL_CMD_GET_TEMP] = {TOOL_CMD_GET_TEMP, 0, 0, "query current extruder temperature"},
+     /*   3 */  [TOOL_CMD_SET_TEMP] = {TOOL_CMD_SET_TEMP, 0, 0, "set extruder target temperature"},
+     /*   4 */  [TOOL_CMD_SET_MOTOR_1_PWM] = {TOOL_CMD_SET_MOTOR_1_PWM, 0, -1, "set motor 1 speed (PWM)"},
+     /*   5 */  [TOOL_CMD_SET_MOTOR_2_PWM] = {TOOL_CMD_SET_MOTOR_2_PWM, 0, -1, "set motor 2 speed (PWM)"},
+     /*   6 */  [TOOL_CMD_SET_MOTOR_1_RPM] = {TOOL_CMD_SET_MOTOR_1_RPM, 0, -1, "set motor 1 speed (RPM)"},
+     /*   7 */  [TOOL_CMD_SET_MOTOR_2_RPM] = {TOOL_CMD_SET_MOTOR_2_RPM, 0, -1, "set motor 2 speed (RPM)"},
+     /*   8 */  [TOOL_CMD_SET_MOTOR_1_DIR] = {TOOL_CMD_SET_MOTOR_1_DIR, 0, -1, "set motor 1 direction"},
+     /*   9 */  [TOOL_CMD_SET_MOTOR_2_DIR] = {TOOL_CMD_SET_MOTOR_2_DIR, 0, -1, "set motor 2 direction"},
+     /*  10 */  [TOOL_CMD_TOGGLE_MOTOR_1] = {TOOL_CMD_TOGGLE_MOTOR_1, 0, -1, "set motor 1 state"},
+     /*  11 */  [TOOL_CMD_TOGGLE_MOTOR_2] = {TOOL_CMD_TOGGLE_MOTOR_2, 0, -1, "set motor 2 state"},
+     /*  12 */  [TOOL_CMD_TOGGLE_FAN] = {TOOL_CMD_TOGGLE_FAN, 0, 0, "set heatsink cooling fan state"},
+     /*  13 */  [TOOL_CMD_TOGGLE_VALVE] = {TOOL_CMD_TOGGLE_VALVE, 0, 0, "set print cooling fan state"},
+     /*  14 */  [TOOL_CMD_SET_SERVO_1_POS] = {TOOL_CMD_SET_SERVO_1_POS, 0, -1, "set servo 1 position"},
+     /*  15 */  [TOOL_CMD_SET_SERVO_2_POS] = {TOOL_CMD_SET_SERVO_2_POS, 0, -1, "set servo 2 position"},
+     /*  16 */  [TOOL_CMD_FILAMENT_STATUS] = {TOOL_CMD_FILAMENT_STATUS, 0, 0, "query filament status"},
+     /*  17 */  [TOOL_CMD_GET_MOTOR_1_RPM] = {TOOL_CMD_GET_MOTOR_1_RPM, 0, 0, "query motor 1 speed (RPM)"},
+     /*  18 */  [TOOL_CMD_GET_MOTOR_2_RPM] = {TOOL_CMD_GET_MOTOR_2_RPM, 0, 0, "query motor 2 speed (RPM)"},
+     /*  19 */  [TOOL_CMD_GET_MOTOR_1_PWM] = {TOOL_CMD_GET_MOTOR_1_PWM, 0, 0, "query motor 1 speed (PWM)"},
+     /*  20 */  [TOOL_CMD_GET_MOTOR_2_PWM] = {TOOL_CMD_GET_MOTOR_2_PWM, 0, 0, "query motor 2 speed (PWM)"},
+     /*  21 */  [TOOL_CMD_SELECT_TOOL] = {TOOL_CMD_SELECT_TOOL, 0, -1, "switch tool"},
+     /*  22 */  [TOOL_CMD_IS_TOOL_READY] = {TOOL_CMD_IS_TOOL_READY, 0, -1, "query tool ready"},
+     /*  23 */  [TOOL_CMD_PAUSE_UNPAUSE] = {TOOL_CMD_PAUSE_UNPAUSE, 0, -1, "toggle pause state"},
+     /*  24 */  [TOOL_CMD_ABORT] = {TOOL_CMD_ABORT, 0, -1, "abort"},
+     /*  25 */  [TOOL_CMD_READ_FROM_EEPROM] = {TOOL_CMD_READ_FROM_EEPROM, 0, 0, "read EEPROM"},
+     /*  26 */  [TOOL_CMD_WRITE_TO_EEPROM] = {TOOL_CMD_WRITE_TO_EEPROM, 0, 0, "write EEPROM"},
+     /*  27 */  [TOOL_CMD_TOGGLE_ABP] = {TOOL_CMD_TOGGLE_ABP, 0, -1, "toggle automated build platform"},
+     /*  30 */  [TOOL_CMD_GET_PLATFORM_TEMP] = {TOOL_CMD_GET_PLATFORM_TEMP, 0, 0, "query current platform temperature"},
+     /*  31 */  [TOOL_CMD_SET_PLATFORM_TEMP] = {TOOL_CMD_SET_PLATFORM_TEMP, 0, 0, "set platform target temperature"},
+     /*  32 */  [TOOL_CMD_GET_SP] = {TOOL_CMD_GET_SP, 0, 0, "query extruder target temperature"},
+     /*  33 */  [TOOL_CMD_GET_PLATFORM_SP] = {TOOL_CMD_GET_PLATFORM_SP, 0, 0, "query platform target temperature"},
+     /*  34 */  [TOOL_CMD_GET_BUILD_NAME] = {TOOL_CMD_GET_BUILD_NAME, 0, 0, "query build name"},
+     /*  35 */  [TOOL_CMD_IS_PLATFORM_READY] = {TOOL_CMD_IS_PLATFORM_READY, 0, -1, "query platform ready"},
+     /*  36 */  [TOOL_CMD_GET_TOOL_STATUS] = {TOOL_CMD_GET_TOOL_STATUS, 0, 0, "query tool status"},
+     /*  37 */  [TOOL_CMD_GET_PID_STATE] = {TOOL_CMD_GET_PID_STATE, 0, 0, "query PID state"},
+     /*  40 */  [TOOL_CMD_LIGHT_INDICATOR_LED] = {TOOL_CMD_LIGHT_INDICATOR_LED, 0, -1, "set LED state"},
+     /* 129 */  [TOOL_CMD_QUEUE_POINT_ABS] = {TOOL_CMD_QUEUE_POINT_ABS, 0, -1, "queue point absolute"}
 };
 
-static s3g_command_info_t command_table[256];
-static s3g_command_info_t tool_command_table[256];
-
-// Not thread safe
-
-static int tables_initialized = 0;
-
-static int s3g_init(void)
-{
-     int i, istat;
-     const s3g_command_info_t *p;
-
-     if (tables_initialized != 0)
-	  return(0);
-
-     // Initialize the indexed command tables
-     memset(command_table,      0, sizeof(command_table));
-     memset(tool_command_table, 0, sizeof(tool_command_table));
-
-     // Force all unrecognized commands to be blocking
-     for (i = 0; i < 256; i++)
-     {
-	  command_table[i].cmd_blocking      = -1;
-	  tool_command_table[i].cmd_blocking = -1;
-     }
-
-     istat = 0;
-     p = command_table_raw;
-
-     // Load the indexed command table, looking for conflicts
-     for (i = 0; i < sizeof(command_table_raw) / sizeof(s3g_command_info_t); i++, p++)
-     {
-	  if ((command_table[p->cmd_id].cmd_len != 0 ||
-	       command_table[p->cmd_id].cmd_desc != NULL))
-	  {
-	       // Table already has an entry for this command id
-	       // Make sure that the lengths don't conflict
-	       if (command_table[p->cmd_id].cmd_len != p->cmd_len)
-	       {
-		    fprintf(stderr,
-			    "s3g_init(%d): Two commands with identical ids (%d) but "
-			    "different lengths encountered; ignoring \"%s\"\n",
-			    __LINE__, p->cmd_id, p->cmd_desc ? p->cmd_desc : "<no name>");
-		    istat = -1;
-		    continue;
-	       }
-	  }
-	  command_table[p->cmd_id].cmd_id       = p->cmd_id;
-	  command_table[p->cmd_id].cmd_len      = p->cmd_len;
-	  command_table[p->cmd_id].cmd_desc     = p->cmd_desc;
-	  command_table[p->cmd_id].cmd_blocking = p->cmd_blocking;
-     }
-
-     p = tool_command_table_raw;
-
-     // Load the indexed command table, looking for conflicts
-     for (i = 0; i < sizeof(tool_command_table_raw) / sizeof(s3g_command_info_t); i++, p++)
-     {
-	  if ((tool_command_table[p->cmd_id].cmd_len != 0 ||
-	       tool_command_table[p->cmd_id].cmd_desc != NULL))
-	  {
-	       // Table already has an entry for this command id
-	       // Make sure that the lengths don't conflict
-	       if (tool_command_table[p->cmd_id].cmd_len != p->cmd_len)
-	       {
-		    fprintf(stderr,
-			    "s3g_init(%d): Two tool commands with identical ids (%d) but "
-			    "different lengths encountered; ignoring \"%s\"\n",
-			    __LINE__, p->cmd_id, p->cmd_desc ? p->cmd_desc : "<no description>");
-		    istat = -1;
-		    continue;
-	       }
-	  }
-	  tool_command_table[p->cmd_id].cmd_id       = p->cmd_id;
-	  tool_command_table[p->cmd_id].cmd_len      = p->cmd_len;
-	  tool_command_table[p->cmd_id].cmd_desc     = p->cmd_desc;
-	  tool_command_table[p->cmd_id].cmd_blocking = p->cmd_blocking;
-     }
-
-     tables_initialized = -1;
-
-     return(istat);
-}
-
-
 s3g_context_t *s3g_open(int type, const char *src, int flags, int mode)
 {
      s3g_context_t *ctx;
-
-     (void)type; // Only type is a file
+     int iret;
 
      ctx = (s3g_context_t *)calloc(1, sizeof(s3g_context_t));
      if (!ctx)
@@ -257,8 +179,16 @@ s3g_context_t *s3g_open(int type, const char *src, int flags, int mode)
 	  return(NULL);
      }
 
-     if (s3g_stdio_open(ctx, src, flags, mode))
+     if (type == S3G_INPUT_TYPE_MMAP)
+	  iret = s3g_mmap_open(ctx, src, flags, mode);
+     else
+	  iret = s3g_stdio_open(ctx, src, flags, mode);
+
+     if (iret)
+     {
+	  free(ctx);
 	  return(NULL);
+     }
 
      return(ctx);
 }
@@ -273,6 +203,8 @@ int s3g_close(s3g_context_t *ctx)
 
      iret = (ctx->close != NULL) ? (*ctx->close)(ctx->r_ctx) : 0;
 
+     if (ctx->buf)
+	  free(ctx->buf);
      free(ctx);
 
      return(iret);
@@ -280,152 +212,134 @@ int s3g_close(s3g_context_t *ctx)
 
 int s3g_command_isblocking(s3g_command_t *cmd)
 {
+     const s3g_command_info_t *ct;
+
      if (!cmd)
 	  // Bad call: claim the worst case which is blocking true;
 	  return(-1);
 
      if (cmd->cmd_id != HOST_CMD_TOOL_COMMAND)
-	  return (command_table[cmd->cmd_id].cmd_blocking);
+	  ct = command_table + cmd->cmd_id;
      else
-	  return(tool_command_table[cmd->t.tool.subcmd_id].cmd_blocking);
+	  ct = tool_command_table + cmd->t.tool.subcmd_id;
 
+     // Force all unrecognized commands to be blocking
+     return(ct->cmd_desc ? ct->cmd_blocking : -1);
 }
 
-int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
-			 unsigned char *buf, size_t maxbuf, size_t *buflen)
+// Start byte of an on-wire packet: 0xD5, payload length, payload, CRC
+#define S3G_FRAME_START 0xD5
+
+// Size of the read buffer used when the input isn't mapped into memory,
+// it must hold the longest command
+#define S3G_READ_BUFFER 0x10000
+
+// s3g_command_decode
+//
+// Decode the command at the start of the avail bytes at p.  Nothing is
+// copied, the caller's bytes are only read.
+//
+// Return values:
+//
+//    0 -- Success; *len is the length of the command in bytes
+//    1 -- The command runs past the avail bytes
+//
+
+static int s3g_command_decode(s3g_command_t *cmd, const unsigned char *p,
+			      size_t avail, size_t *len)
 {
-     unsigned char *buf0 = buf;
-     ssize_t bytes_expected, bytes_read;
-     s3g_command_info_t *ct;
-     s3g_command_t dummy;
+     const unsigned char *q, *cmd0;
+     const s3g_command_info_t *ct;
      foo_16_t f16;
      foo_32_t f32;
-     int iret;
-     uint8_t ui8arg;
+     size_t n;
 
-     iret = -1;
+     cmd->cmd_framed  = 0;
+     cmd->cmd_crc_err = 0;
 
-     if (buflen)
-	  *buflen = 0;
+#define NEED(n) \
+	  if ((size_t)(q - p) + (size_t)(n) > avail) return(1)
 
-     // We have to have a read context
-     // We don't need a command context to return the command in
-     if (!ctx || !buf || maxbuf == 0)
-     {
-	  fprintf(stderr, "s3g_command_get(%d): Invalid call; ctx=%p, buf=%p, "
-		  "maxbuf=%lu\n", __LINE__, (void *)ctx, (void *)buf, (unsigned long)maxbuf);
-	  errno = EINVAL;
-	  return(-1);
-     }
-     else if (!ctx->read)
-     {
-	  fprintf(stderr, "s3g_command_get(%d): Invalid context; "
-		  "ctx->read=NULL\n", __LINE__);
-	  errno = EINVAL;
-	  return(-1);
-     }
-     else if (!buf || maxbuf == 0)
-     {
-	  fprintf(stderr, "s3g_command_get(%d): Invalid context; "
-		  "ctx->read=NULL\n", __LINE__);
-	  errno = EINVAL;
-	  return(-1);
-     }
-
-     // Initialize command table
-     s3g_init();
+     q = p;
+     NEED(1);
 
-     if (1 != (bytes_expected = (*ctx->read)(ctx->r_ctx, buf0, maxbuf, 1)))
+     // An on-wire packet, as written by gpx -F: step over the start byte and
+     // the length to the command, its CRC gets checked once it's read
+     if (q[0] == S3G_FRAME_START)
      {
-	  // End of file condition?
-	  if (bytes_expected == 0)
-	       return(1); // EOF
-
-	  fprintf(stderr,
-		  "s3g_command_get(%d): Error while reading from the s3g file; "
-		  "%s (%d)\n",
-		  __LINE__, strerror(errno), errno);
-	  return(-1);
+	  NEED(3);
+	  cmd->cmd_framed = 1;
+	  q += 2;
      }
+     cmd0 = q;
 
-     ct = command_table + buf0[0];  // &command_table[buf0[0]]
-
-     buf    += 1;
-     maxbuf -= 1;
-
-     if (!cmd)
-	  cmd = &dummy;
+     ct = command_table + cmd0[0];  // &command_table[cmd0[0]]
+     q += 1;
 
-     cmd->cmd_id      = ct->cmd_id;
-     cmd->cmd_desc    = ct->cmd_desc;
-     cmd->cmd_len     = ct->cmd_len;
-     cmd->cmd_raw_len = 0;
+     cmd->cmd_id   = cmd0[0];
+     cmd->cmd_desc = ct->cmd_desc;
+     cmd->cmd_len  = ct->cmd_len;
 
+     // Unrecognized command: hand back just the id and let the caller
+     // decide whether to carry on with the next byte
      if (ct->cmd_desc == NULL)
      {
-	  fprintf(stderr,
-		  "s3g_command_get(%d): Unrecognized command, %d\n",
-		  __LINE__, buf0[0]);
-	  goto done;
+	  *len = (size_t)(q - p);
+	  return(0);
      }
 
 #define GET_INT32(v) \
-	  if (maxbuf < 4) goto trunc; \
-	  if (4 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 4))) \
-	       goto io_error; \
-	  memcpy(&f32.u.c, buf, 4); \
-	  buf    += bytes_read; \
-	  maxbuf -= bytes_read; \
+	  NEED(4); \
+	  memcpy(&f32.u.c, q, 4); \
+	  q += 4; \
 	  f32.u.u = le32toh(f32.u.u); \
 	  cmd->t.v = f32.u.i
 
 #define GET_UINT32(v) \
-	  if (maxbuf < 4) goto trunc; \
-	  if (4 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 4))) \
-	       goto io_error; \
-	  memcpy(&f32.u.c, buf, 4); \
-	  buf    += bytes_read; \
-	  maxbuf -= bytes_read; \
+	  NEED(4); \
+	  memcpy(&f32.u.c, q, 4); \
+	  q += 4; \
 	  cmd->t.v = le32toh(f32.u.u)
 
 #define GET_FLOAT32(v) \
-	  if (maxbuf < 4) goto trunc; \
-	  if (4 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 4))) \
-	       goto io_error; \
-	  memcpy(&f32.u.c, buf, 4); \
-	  buf    += bytes_read; \
-	  maxbuf -= bytes_read; \
+	  NEED(4); \
+	  memcpy(&f32.u.c, q, 4); \
+	  q += 4; \
 	  f32.u.u = le32toh(f32.u.u); \
 	  cmd->t.v = f32.u.f;
 
 #define GET_UINT8(v) \
-	  if (maxbuf < 1) goto trunc; \
-	  if (1 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 1))) \
-	       goto io_error; \
-	  ui8arg = buf[0]; \
-	  buf    += bytes_read; \
-	  maxbuf -= bytes_read; \
-	  cmd->t.v = ui8arg
+	  NEED(1); \
+	  cmd->t.v = *q++
 
 #define GET_INT16(v) \
-	  if (maxbuf < 2) goto trunc; \
-	  if (2 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 2))) \
-	       goto io_error; \
-	  memcpy(&f16.u.c, buf, 2); \
-	  buf    += bytes_read; \
-	  maxbuf -= bytes_read; \
+	  NEED(2); \
+	  memcpy(&f16.u.c, q, 2); \
+	  q += 2; \
 	  f16.u.u = le16toh(f16.u.u); \
 	  cmd->t.v = f16.u.i
 
 #define GET_UINT16(v) \
-	  if (maxbuf < 2) goto trunc; \
-	  if (2 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 2))) \
-	       goto io_error; \
-	  memcpy(&f16.u.c, buf, 2); \
-	  buf    += bytes_read; \
-	  maxbuf -= bytes_read; \
+	  NEED(2); \
+	  memcpy(&f16.u.c, q, 2); \
+	  q += 2; \
 	  cmd->t.v = le16toh(f16.u.u)
 
+// Message strings end at a NUL, keep as much as fits
+#define GET_STRING(v) \
+	  cmd->t.v ## _len = 0; \
+	  for (;;) \
+	  { \
+	       NEED(1); \
+	       if (*q == '\0') \
+		    break; \
+	       if (cmd->t.v ## _len < (sizeof(cmd->t.v) - 1)) \
+		    cmd->t.v[cmd->t.v ## _len++] = *q; \
+	       ++q; \
+	  } \
+	  ++q; \
+	  cmd->t.v[cmd->t.v ## _len] = '\0'
+
 #define ZERO(v,c) cmd->t.v = (c)0
 
      switch(cmd->cmd_id)
@@ -461,40 +375,100 @@ int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
 	  GET_UINT8(recall_home_position.axes);
 	  break;
 
-     default :
-	  // Just read the data
-	  bytes_expected = (ssize_t)(ct->cmd_len & 0x7fffffff);
-	  if ((bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf,
-					 ct->cmd_len)) != bytes_expected)
-	       goto io_error;
+     case HOST_CMD_VERSION :
+     case HOST_CMD_ADVANCED_VERSION :
+	  GET_UINT16(version.host_version);
+	  break;
+
+     case HOST_CMD_READ_EEPROM :
+	  GET_UINT16(read_eeprom.offset);
+	  GET_UINT8(read_eeprom.count);
+	  break;
+
+     case HOST_CMD_NEXT_FILENAME :
+	  GET_UINT8(next_filename.restart);
+	  break;
+
+     case HOST_CMD_EXTENDED_STOP :
+	  GET_UINT8(extended_stop.flags);
+	  break;
+
+     case HOST_CMD_WAIT_FOR_BUTTON :
+	  GET_UINT16(wait_for_button.options);
+	  break;
+
+     case HOST_CMD_QUEUE_POINT_ABS :
+	  // x4, y4, z4, dda4 = 16 bytes
+	  GET_INT32(queue_point_abs.x);
+	  GET_INT32(queue_point_abs.y);
+	  GET_INT32(queue_point_abs.z);
+	  GET_INT32(queue_point_abs.dda);
+	  ZERO(queue_point_abs.dummy_a, int32_t);
+	  ZERO(queue_point_abs.dummy_b, int32_t);
+	  ZERO(queue_point_abs.dummy_rel, uint8_t);
+	  ZERO(queue_point_abs.dummy_distance, float);
+	  ZERO(queue_point_abs.dummy_feedrate_mult_64, uint16_t);
+	  break;
+
+     case HOST_CMD_SET_POSITION :
+	  // x4, y4, z4 = 12 bytes
+	  GET_INT32(set_position.x);
+	  GET_INT32(set_position.y);
+	  GET_INT32(set_position.z);
+	  break;
+
+     case HOST_CMD_TOOL_QUERY :
+	  // Tool index, query and a payload for the two queries that take one
+	  GET_UINT8(tool.index);
+	  GET_UINT8(tool.subcmd_id);
+	  if (cmd->t.tool.subcmd_id == TOOL_CMD_VERSION)
+	       n = 2;
+	  else if (cmd->t.tool.subcmd_id == TOOL_CMD_READ_FROM_EEPROM)
+	       n = 3;
+	  else
+	       n = 0;
+	  NEED(n);
+	  cmd->t.tool.subcmd_len   = n;
+	  cmd->t.tool.subcmd_value = (n >= 2) ?
+	       (uint32_t)q[0] | ((uint32_t)q[1] << 8) : 0;
+	  memcpy(cmd->t.tool.subcmd_data, q, n);
+	  q += n;
+	  cmd->t.tool.subcmd_desc = tool_command_table[cmd->t.tool.subcmd_id].cmd_desc;
+	  if (cmd->t.tool.subcmd_desc == NULL)
+	       cmd->t.tool.subcmd_desc = "unknown tool query";
+	  break;
 
-	  buf    += bytes_read;
-	  maxbuf -= bytes_read;
+     default :
+	  // Just step over the data
+	  n = ct->cmd_len & 0x7fffffff;
+	  NEED(n);
+	  q += n;
 	  break;
 
      case HOST_CMD_TOOL_COMMAND :
 	  // This command is VERY MBI specific
-	  if ((ssize_t)3 != (*ctx->read)(ctx->r_ctx, buf, maxbuf, 3))
-	       goto io_error;
-	  if (cmd)
-	       cmd->cmd_len = (size_t)buf[2];
-	  cmd->t.tool.subcmd_id  = buf[1];
-	  cmd->t.tool.index      = buf[0];
-	  cmd->t.tool.subcmd_len = bytes_expected = (ssize_t)buf[2];
-	  if ((bytes_read = (*ctx->read)(ctx->r_ctx, buf + 3, maxbuf - 3,
-					 (size_t)buf[2])) != bytes_expected)
-	       goto io_error;
-
-	  if (cmd->t.tool.subcmd_len == 1)
-	       cmd->t.tool.subcmd_value = (uint16_t)buf[3];
-	  else if (cmd->t.tool.subcmd_len > 1) {
-	       memcpy((void *)&cmd->t.tool.subcmd_value, buf + 3, sizeof(uint16_t));
-	       cmd->t.tool.subcmd_value = le16toh(cmd->t.tool.subcmd_value);
+	  NEED(3);
+	  cmd->t.tool.index      = q[0];
+	  cmd->t.tool.subcmd_id  = q[1];
+	  cmd->t.tool.subcmd_len = n = (size_t)q[2];
+	  cmd->cmd_len = n;
+	  q += 3;
+	  NEED(n);
+
+	  if (n == 1)
+	       cmd->t.tool.subcmd_value = (uint32_t)q[0];
+	  else if (n == 4) {
+	       memcpy(&f32.u.c, q, 4);
+	       cmd->t.tool.subcmd_value = le32toh(f32.u.u);
+	  } else if (n > 1) {
+	       memcpy(&f16.u.c, q, 2);
+	       cmd->t.tool.subcmd_value = le16toh(f16.u.u);
 	  } else
 	       cmd->t.tool.subcmd_value = 0;
-
-	  maxbuf -= 3 + bytes_read;
-	  buf    += 3 + bytes_read;
+	  memcpy(cmd->t.tool.subcmd_data, q,
+		 (n < sizeof(cmd->t.tool.subcmd_data)) ?
+		 n : sizeof(cmd->t.tool.subcmd_data));
+	  q += n;
 
 	  cmd->t.tool.subcmd_desc = tool_command_table[cmd->t.tool.subcmd_id].cmd_desc;
 	  if (cmd->t.tool.subcmd_desc == NULL)
@@ -579,23 +553,7 @@ int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
 	  GET_UINT8(display_message.x);
 	  GET_UINT8(display_message.y);
 	  GET_UINT8(display_message.timeout);
-	  cmd->t.display_message.message_len = 0;
-	  if (maxbuf < 1) goto trunc;
-	  for (;;)
-	  {
-	       unsigned char uc;
-	       if (1 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 1)))
-		    goto io_error;
-	       uc = buf[0];
-	       ++buf;
-	       --maxbuf;
-	       if (uc == '\0')
-		    break;
-	       if (cmd->t.display_message.message_len < (sizeof(cmd->t.display_message.message) - 1))
-		    cmd->t.display_message.message[cmd->t.display_message.message_len++] = uc;
-	       if (maxbuf < 1) goto trunc;
-	  }
-	  cmd->t.display_message.message[cmd->t.display_message.message_len] = '\0';
+	  GET_STRING(display_message.message);
 	  break;
 
      case HOST_CMD_SET_BUILD_PERCENT :
@@ -613,22 +571,7 @@ int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
 
      case HOST_CMD_BUILD_START_NOTIFICATION :
 	  GET_INT32(build_start.steps);
-	  cmd->t.build_start.message_len = 0;
-	  if (maxbuf < 1) goto trunc;
-	  for (;;)
-	  {
-	       unsigned char uc;
-	       if (1 != (bytes_read = (*ctx->read)(ctx->r_ctx, buf, maxbuf, 1)))
-		    goto io_error;
-	       uc = buf[0];
-	       ++buf;
-	       --maxbuf;
-	       if (uc == '\0')
-		    break;
-	       if (cmd->t.build_start.message_len < (sizeof(cmd->t.build_start.message) - 1))
-		    cmd->t.build_start.message[cmd->t.build_start.message_len++] = uc;
-	  }
-	  cmd->t.build_start.message[cmd->t.build_start.message_len] = '\0';
+	  GET_STRING(build_start.message);
 	  break;
 
      case HOST_CMD_BUILD_END_NOTIFICATION :
@@ -664,31 +607,172 @@ int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
 	  break;
      }
 
+     // Check the packet's CRC, which follows the command
+     if (cmd->cmd_framed)
+     {
+	  NEED(1);
+	  cmd->cmd_crc_err = *q != calculate_crc(cmd0, (long)(q - cmd0));
+	  ++q;
+     }
+
 #undef ZERO
+#undef GET_STRING
+#undef GET_UINT16
+#undef GET_INT16
 #undef GET_UINT8
+#undef GET_FLOAT32
+#undef GET_UINT32
 #undef GET_INT32
+#undef NEED
+
+     *len = (size_t)(q - p);
+     return(0);
+}
+
+// s3g_fill
+//
+// Buffered reads for a driver which doesn't map its input: move what's left
+// unread to the front of the buffer and read more after it.
+//
+// Return values:
+//
+//  > 0 -- Number of bytes added
+//    0 -- End of file, or the input is mapped and there's no more of it
+//   -1 -- Read error; check errno
+
+static ssize_t s3g_fill(s3g_context_t *ctx)
+{
+     size_t left;
+     ssize_t n;
+
+     if (!ctx->read)
+	  return(0);
+
+     if (!ctx->buf)
+     {
+	  if (!(ctx->buf = (unsigned char *)malloc(S3G_READ_BUFFER)))
+	  {
+	       fprintf(stderr, "s3g_fill(%d): Unable to allocate VM; %s (%d)\n",
+		       __LINE__, strerror(errno), errno);
+	       return(-1);
+	  }
+	  ctx->next = ctx->end = ctx->buf;
+     }
+
+     left = (size_t)(ctx->end - ctx->next);
+     if (ctx->next != ctx->buf)
+     {
+	  memmove(ctx->buf, ctx->next, left);
+	  ctx->next = ctx->buf;
+	  ctx->end  = ctx->buf + left;
+     }
+
+     if (left == S3G_READ_BUFFER)
+     {
+	  errno = EFBIG;
+	  return(-1);
+     }
+
+     n = (*ctx->read)(ctx->r_ctx, ctx->buf + left, S3G_READ_BUFFER - left,
+		      S3G_READ_BUFFER - left);
+     if (n > 0)
+	  ctx->end += n;
+
+     return(n);
+}
+
+int s3g_command_next(s3g_context_t *ctx, s3g_command_t *cmd,
+		     const unsigned char **raw, size_t *rawlen)
+{
+     s3g_command_t dummy;
+     ssize_t n;
+     size_t len;
+
+     if (rawlen)
+	  *rawlen = 0;
+
+     // We have to have a read context
+     // We don't need a command context to return the command in
+     if (!ctx || (!ctx->read && !ctx->next))
+     {
+	  fprintf(stderr, "s3g_command_next(%d): Invalid call; ctx=%p\n",
+		  __LINE__, (void *)ctx);
+	  errno = EINVAL;
+	  return(-1);
+     }
+
+     if (!cmd)
+	  cmd = &dummy;
+
+     for (;;)
+     {
+	  if (ctx->next != ctx->end &&
+	      !s3g_command_decode(cmd, ctx->next, (size_t)(ctx->end - ctx->next), &len))
+	       break;
+
+	  // Out of data or part way through a command: read some more
+	  if ((n = s3g_fill(ctx)) > 0)
+	       continue;
+
+	  if (n == 0 && ctx->next == ctx->end)
+	       return(1); // EOF
+
+	  if (n == 0)
+	       fprintf(stderr,
+		       "s3g_command_next(%d): The s3g file appears to be "
+		       "truncated\n", __LINE__);
+	  else
+	       fprintf(stderr,
+		       "s3g_command_next(%d): Error while reading from the s3g "
+		       "file; %s (%d)\n", __LINE__, strerror(errno), errno);
+	  return(-1);
+     }
+
+     cmd->cmd_raw_len = len;
+     if (raw)
+	  *raw = ctx->next;
+     if (rawlen)
+	  *rawlen = len;
+
+     ctx->next  += len;
+     ctx->nread += len;
+
+     return(0);
+}
+
+int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
+			 unsigned char *buf, size_t maxbuf, size_t *buflen)
+{
+     const unsigned char *raw;
+     size_t len;
+     int iret;
 
-     iret = 0;
-     goto done;
-
-io_error:
-     fprintf(stderr,
-	     "s3g_command_get(%d): Error while reading from the s3g file; "
-	     "%s (%d)\n",
-	     __LINE__, strerror(errno), errno);
-     iret = -1;
-     goto done;
-
-trunc:
-     fprintf(stderr,
-	     "s3g_command_get(%d): Caller supplied read buffer is too small",
-	     __LINE__);
-     iret = -1;
-
-done:
-     cmd->cmd_raw_len = (size_t)(buf - buf0);
      if (buflen)
-	  *buflen = cmd->cmd_raw_len;
+	  *buflen = 0;
+
+     if (!buf || maxbuf == 0)
+     {
+	  fprintf(stderr, "s3g_command_get(%d): Invalid call; ctx=%p, buf=%p, "
+		  "maxbuf=%lu\n", __LINE__, (void *)ctx, (void *)buf, (unsigned long)maxbuf);
+	  errno = EINVAL;
+	  return(-1);
+     }
+
+     if ((iret = s3g_command_next(ctx, cmd, &raw, &len)))
+	  return(iret);
+
+     if (len > maxbuf)
+     {
+	  fprintf(stderr,
+		  "s3g_command_get(%d): Caller supplied read buffer is too small\n",
+		  __LINE__);
+	  len = maxbuf;
+	  iret = -1;
+     }
+
+     memcpy(buf, raw, len);
+     if (buflen)
+	  *buflen = len;
 
      return(iret);
 }
@@ -717,31 +801,11 @@ int s3g_command_read(s3g_context_t *ctx, s3g_command_t *cmd)
 	  return(s3g_command_read_ext(ctx, cmd, cmd->cmd_raw, sizeof(cmd->cmd_raw), NULL));
      else
      {
-	  unsigned char buf[128];
+	  unsigned char buf[MAX_S3G_CMD_LEN];
 	  return(s3g_command_read_ext(ctx, cmd, buf, sizeof(buf), NULL));
      }
 }
 
-static const char *bot_type(uint16_t btype, char *buf, size_t maxbuf)
-{
-    char tmpbuf[32];
-
-    if (!buf || !maxbuf)
-    {
-	buf = tmpbuf;
-	maxbuf = sizeof(tmpbuf);
-    }
-
-    if (btype == 0xD314)
-	snprintf(buf, maxbuf, "Replicator 1");
-    else if (btype == 0xB015)
-	snprintf(buf, maxbuf, "Replicator 2");
-    else
-	snprintf(buf, maxbuf, "Unknown");
-
-    return(buf);
-}
-
 static const char *axes_mask(uint8_t flags, char *buf, size_t maxbuf,
 			     int isEnable)
 {
@@ -757,16 +821,12 @@ static const char *axes_mask(uint8_t flags, char *buf, size_t maxbuf,
 
 	if (isEnable) strncat(buf, (flags & 0x80) ? "+" : "-", maxbuf);
 
-	if (flags != (uint8_t)0)
-	{
-	     if (flags & 0x01) CAT("X");
-	     if (flags & 0x02) CAT("Y");
-	     if (flags & 0x04) CAT("Z");
-	     if (flags & 0x08) CAT("A");
-	     if (flags & 0x10) CAT("B");
-	}
-	else
-	     strncat(buf, "<NO AXES>", maxbuf);
+	// No axes is an empty list, as the decompiler script has it
+	if (flags & 0x01) CAT("X");
+	if (flags & 0x02) CAT("Y");
+	if (flags & 0x04) CAT("Z");
+	if (flags & 0x08) CAT("A");
+	if (flags & 0x10) CAT("B");
 
 	return(buf);
 
@@ -780,7 +840,7 @@ static const char *axes_names(uint8_t axis, char *buf, size_t maxbuf)
      if (!buf || !maxbuf)
 	  return(NULL);
 
-     if (axis <= (sizeof(names)/sizeof(const char *)))
+     if (axis < (sizeof(names)/sizeof(const char *)))
 	  strncpy(buf, names[axis], maxbuf);
      else
 	  snprintf(buf, maxbuf, "unknown %hhu", axis);
@@ -799,28 +859,215 @@ int s3g_add_writer(s3g_context_t *ctx, s3g_write_proc_t *wproc, void *wctx)
 	return(0);
 }
 
+// s3g_command_display() writes the same text for a command as
+// scripts/s3g-decompiler.py does, so that the two can be used
+// interchangeably.  Commands the script doesn't know are "not recognized"
+// and the script's wording, quirks included, is kept for the ones it does.
+
+static void tool_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
+{
+     const unsigned char *p = cmd->t.tool.subcmd_data;
+     size_t len;
+     const char *fmt;
+
+#define LE32(q) ((uint32_t)(q)[0] | ((uint32_t)(q)[1] << 8) | \
+		 ((uint32_t)(q)[2] << 16) | ((uint32_t)(q)[3] << 24))
+
+     writef(ctx, "(136) Tool %hhu: ", cmd->t.tool.index);
+
+     switch (cmd->t.tool.subcmd_id)
+     {
+     case TOOL_CMD_INIT :
+	  len = 0; fmt = "(1) Initialize firmware to boot state\n"; break;
+     case TOOL_CMD_SET_TEMP :
+	  len = 2; fmt = "(3) Set target temperature to %u C\n"; break;
+     case TOOL_CMD_SET_MOTOR_1_PWM :
+	  len = 1; fmt = "(4) Set Motor 1 speed (PWM) to %u\n"; break;
+     case TOOL_CMD_SET_MOTOR_2_PWM :
+	  len = 1; fmt = "(5) Set Motor 2 speed (PWM) to %u\n"; break;
+     case TOOL_CMD_SET_MOTOR_1_RPM :
+	  len = 4; fmt = "(6) Set Motor 1 set speed (RPM) to %u\n"; break;
+     case TOOL_CMD_SET_MOTOR_2_RPM :
+	  len = 4; fmt = "(7) Set Motor 2 speed (RPM) to %u\n"; break;
+     case TOOL_CMD_SET_MOTOR_1_DIR :
+	  len = 4; fmt = "(8) Set Motor 1 direction to %u\n"; break;
+     case TOOL_CMD_SET_MOTOR_2_DIR :
+	  len = 4; fmt = "(9) Set Motor 2 direction to %u\n"; break;
+     case TOOL_CMD_TOGGLE_MOTOR_1 :
+	  len = 1; fmt = "(10) Toggle Motor 1 to %u\n"; break;
+     case TOOL_CMD_TOGGLE_MOTOR_2 :
+	  len = 1; fmt = "(11) Toggle Motor 2 to %u\n"; break;
+     case TOOL_CMD_TOGGLE_FAN :
+	  len = 1; fmt = "(12) Toggle cooling fan %u\n"; break;
+     case TOOL_CMD_TOGGLE_VALVE :
+	  len = 1; fmt = "(13) Toggle blower fan %u\n"; break;
+     case TOOL_CMD_SET_SERVO_1_POS :
+	  len = 1; fmt = "(14) Set Servo 1 angle to %u\n"; break;
+     case TOOL_CMD_SET_SERVO_2_POS :
+	  len = 1; fmt = "(15) Set Servo 2 angle to %u\n"; break;
+     case TOOL_CMD_TOGGLE_ABP :
+	  len = 1; fmt = "(27) Automated build platform: toggle %u\n"; break;
+     case TOOL_CMD_SET_PLATFORM_TEMP :
+	  len = 2; fmt = "(31) Set build platform temperature to %u C\n"; break;
+     case TOOL_CMD_QUEUE_POINT_ABS :
+	  len = 16; fmt = NULL; break;
+     default :
+	  len = 0; fmt = NULL; break;
+     }
+
+     if (len != cmd->t.tool.subcmd_len)
+	  // The script gives up on these; say what we can
+	  writef(ctx, "(%hhu) Tool command %hhu for tool %hhu, value %u\n",
+		 cmd->t.tool.subcmd_id, cmd->t.tool.subcmd_id,
+		 cmd->t.tool.index, cmd->t.tool.subcmd_value);
+     else if (fmt)
+	  writef(ctx, fmt, cmd->t.tool.subcmd_value);
+     else
+	  writef(ctx, "(129) Absolute move to (%d, %d, %d) with DDA %u\n",
+		 (int32_t)LE32(p), (int32_t)LE32(p + 4), (int32_t)LE32(p + 8),
+		 LE32(p + 12));
+
+#undef LE32
+}
+
+static void tool_query_display(s3g_context_t *ctx, s3g_command_t *cmd)
+{
+     const char *desc;
+
+     switch (cmd->t.tool.subcmd_id)
+     {
+     case TOOL_CMD_VERSION :
+	  writef(ctx, "(10) Tool %hhu: (0) Get version, Host Version %u\n",
+		 cmd->t.tool.index, cmd->t.tool.subcmd_value);
+	  return;
+
+     case TOOL_CMD_READ_FROM_EEPROM :
+	  writef(ctx, "(10) Tool %hhu: (25) Read from EEPROM offset %u, "
+		 "%hhu bytes\n",
+		 cmd->t.tool.index, cmd->t.tool.subcmd_value,
+		 cmd->t.tool.subcmd_data[2]);
+	  return;
+
+     case TOOL_CMD_GET_TEMP :           desc = "Get toolhead temperature"; break;
+     case TOOL_CMD_GET_MOTOR_2_PWM :    desc = "Unknown tool query"; break;
+     case TOOL_CMD_IS_TOOL_READY :      desc = "Is tool ready?"; break;
+     case TOOL_CMD_GET_PLATFORM_TEMP :  desc = "Get build platform temperature"; break;
+     case TOOL_CMD_GET_SP :             desc = "Get toolhead target temperature"; break;
+     case TOOL_CMD_GET_PLATFORM_SP :    desc = "Get build platform target temperature"; break;
+     case TOOL_CMD_IS_PLATFORM_READY :  desc = "Is build platform ready?"; break;
+     case TOOL_CMD_GET_TOOL_STATUS :    desc = "Get tool status"; break;
+     case TOOL_CMD_GET_PID_STATE :      desc = "Get PID state"; break;
+
+     default :
+	  // The script reports these twice, once while reading and again
+	  // while printing
+	  writef(ctx, "Tool query not recognized %hhu\n"
+		 "(10) Tool %hhu:Tool query not recognized %hhu\n",
+		 cmd->t.tool.subcmd_id, cmd->t.tool.index,
+		 cmd->t.tool.subcmd_id);
+	  return;
+     }
+
+     writef(ctx, "(10) Tool %hhu: (%hhu) %s\n",
+	    cmd->t.tool.index, cmd->t.tool.subcmd_id, desc);
+}
+
 void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 {
      char buf[64];
-     const char *fmt;
 
 #define F(v) (cmd->t.v)
 
-     writef(ctx, "(%d) ", cmd->cmd_id);
-
-     switch(cmd->cmd_id)
+     // Unrecognized commands have no description
+     switch(cmd->cmd_desc ? cmd->cmd_id : -1)
      {
      default :
-	  writef(ctx, "%s", cmd->cmd_desc);
+	  writef(ctx, "Command not recognized %d\n", cmd->cmd_id);
+	  break;
+
+     case HOST_CMD_VERSION :
+	  writef(ctx, "(0) Get version, Host Version %hu\n",
+		 F(version.host_version));
+	  break;
+
+     case HOST_CMD_INIT :
+	  writef(ctx, "(1) Unknown\n");
+	  break;
+
+     case HOST_CMD_CLEAR_BUFFER :
+	  writef(ctx, "(3) Clear buffer\n");
+	  break;
+
+     case HOST_CMD_ABORT :
+	  writef(ctx, "(7) Abort immediately\n");
+	  break;
+
+     case HOST_CMD_PAUSE :
+	  writef(ctx, "(8) Pause\n");
+	  break;
+
+     case HOST_CMD_TOOL_QUERY :
+	  tool_query_display(ctx, cmd);
+	  break;
+
+     case HOST_CMD_IS_FINISHED :
+	  writef(ctx, "(11) Is finished?\n");
+	  break;
+
+     case HOST_CMD_READ_EEPROM :
+	  writef(ctx, "(12) Read from EEPROM, offset %hu, count %hhu\n",
+		 F(read_eeprom.offset), F(read_eeprom.count));
+	  break;
+
+     case HOST_CMD_NEXT_FILENAME :
+	  writef(ctx, "(18) Get next filename, restart %hhu\n",
+		 F(next_filename.restart));
+	  break;
+
+     case HOST_CMD_GET_BUILD_NAME :
+	  writef(ctx, "(20) Get build name\n");
+	  break;
+
+     case HOST_CMD_GET_POSITION_EXT :
+	  writef(ctx, "(21) Get extended position\n");
+	  break;
+
+     case HOST_CMD_EXTENDED_STOP :
+	  writef(ctx, "(22) Extended stop, bitfield is 0x%02hhx\n",
+		 F(extended_stop.flags));
+	  break;
+
+     case HOST_CMD_GET_BUILD_STATS :
+	  writef(ctx, "(24) Get build statistics\n");
+	  break;
+
+     case HOST_CMD_ADVANCED_VERSION :
+	  writef(ctx, "(27) Get advanced version number, Host Version %hu\n",
+		 F(version.host_version));
+	  break;
+
+     case HOST_CMD_QUEUE_POINT_ABS :
+	  writef(ctx, "(129) Absolute move to (%d, %d, %d) with DDA %u\n",
+		 F(queue_point_abs.x),
+		 F(queue_point_abs.y),
+		 F(queue_point_abs.z),
+		 (uint32_t)F(queue_point_abs.dda));
+	  break;
+
+     case HOST_CMD_SET_POSITION :
+	  writef(ctx, "(130) Define position as (%d, %d, %d)\n",
+		 F(set_position.x),
+		 F(set_position.y),
+		 F(set_position.z));
 	  break;
 
      case HOST_CMD_DELAY :
-	  writef(ctx, "Dwell for %u milliseconds\n", F(delay.millis));
+	  writef(ctx, "(133) Dwell for %u milliseconds\n", F(delay.millis));
 	  break;
 
      case HOST_CMD_FIND_AXES_MINIMUM :
 	  writef(ctx, 
-		 "Home minimum on %s, feedrate %u us/step, timeout %hu s\n",
+		 "(131) Home minimum on %s, feedrate %u us/step, timeout %hu s\n",
 		 axes_mask(F(find_axes_minmax.flags), buf, sizeof(buf), 0),
 		 F(find_axes_minmax.feedrate),
 		 F(find_axes_minmax.timeout));
@@ -828,14 +1075,14 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 
      case HOST_CMD_FIND_AXES_MAXIMUM :
 	  writef(ctx, 
-		 "Home maximum on %s, feedrate %u us/step, timeout %hu s\n",
+		 "(132) Home maximum on %s, feedrate %u us/step, timeout %hu s\n",
 		 axes_mask(F(find_axes_minmax.flags), buf, sizeof(buf), 0),
 		 F(find_axes_minmax.feedrate),
 		 F(find_axes_minmax.timeout));
 	  break;
 
      case HOST_CMD_WAIT_FOR_TOOL :
-	  writef(ctx, "Wait until Tool %hhu is ready, %hu ms between polls, "
+	  writef(ctx, "(135) Wait until Tool %hhu is ready, %hu ms between polls, "
 		 "%hu s timeout\n",
 		 F(wait_for_tool.index),
 		 F(wait_for_tool.ping_delay),
@@ -844,63 +1091,29 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 
      case HOST_CMD_WAIT_FOR_PLATFORM :
 	  writef(ctx,
-		 "Wait until platform %hhu is ready, %hu ms between polls, "
+		 "(141) Wait until platform %hhu is ready, %hu ms between polls, "
 		 "%hu s timeout\n",
-		 F(wait_for_tool.index),
-		 F(wait_for_tool.ping_delay),
-		 F(wait_for_tool.timeout));
+		 F(wait_for_platform.index),
+		 F(wait_for_platform.ping_delay),
+		 F(wait_for_platform.timeout));
 	  break;
 
      case HOST_CMD_STORE_HOME_POSITION :
-	  writef(ctx, "Store home position for %s\n",
+	  writef(ctx, "(143) Store home position for %s\n",
 		 axes_mask(F(store_home_position.axes), buf, sizeof(buf), 0));
 	  break;
 
      case HOST_CMD_RECALL_HOME_POSITION :
-	  writef(ctx, "Recall home position for %s\n",
+	  writef(ctx, "(144) Recall home position for %s\n",
 		 axes_mask(F(recall_home_position.axes), buf, sizeof(buf), 0));
 	  break;
 
      case HOST_CMD_TOOL_COMMAND :
-	  switch (cmd->t.tool.subcmd_id)
-	  {
-	  case TOOL_CMD_SET_TEMP :
-	       fmt = "Set target temperature to %hu C\n";
-	       break;
-
-	  case TOOL_CMD_SET_PLATFORM_TEMP :
-	       fmt = "Set build platform temperature to %hu C\n";
-	       break;
-
-	  case TOOL_CMD_SET_MOTOR_1_PWM :
-	       fmt = "Set Motor 1 speed (PWM) to %hu\n";
-	       break;
-
-	  case TOOL_CMD_TOGGLE_MOTOR_1 :
-	       fmt = "Toggle Motor 1 to %hu\n";
-	       break;
-
-	  case TOOL_CMD_TOGGLE_VALVE :
-	       fmt = "Toggle blower fan %hu\n";
-	       break;
-
-	  default :
-	       fmt = NULL;
-	       break;
-	  }
-	  writef(ctx, "Tool %hhu: (%hhu) ",
-		 cmd->t.tool.index, cmd->t.tool.subcmd_id);
-	  if (fmt)
-	       writef(ctx, fmt, cmd->t.tool.subcmd_value);
-	  else
-	       writef(ctx, "Tool command %hhu for tool %hhu, value %hu\n",
-		      cmd->t.tool.subcmd_id,
-		      cmd->t.tool.index,
-		      cmd->t.tool.subcmd_value);
+	  tool_command_display(ctx, cmd);
 	  break;
 
      case HOST_CMD_SET_POSITION_EXT :
-	  writef(ctx, "Define position as (%d, %d, %d, %d, %d)\n",
+	  writef(ctx, "(140) Define position as (%d, %d, %d, %d, %d)\n",
 		 F(set_position_ext.x),
 		 F(set_position_ext.y),
 		 F(set_position_ext.z),
@@ -909,48 +1122,48 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 	  break;
 
      case HOST_CMD_QUEUE_POINT_EXT :
-	  writef(ctx, "Absolute move to (%d, %d, %d, %d, %d) with DDA %d\n",
+	  writef(ctx, "(139) Absolute move to (%d, %d, %d, %d, %d) with DDA %u\n",
 		 F(queue_point_ext.x),
 		 F(queue_point_ext.y),
 		 F(queue_point_ext.z),
 		 F(queue_point_ext.a),
 		 F(queue_point_ext.b),
-		 F(queue_point_ext.dda));
+		 (uint32_t)F(queue_point_ext.dda));
 	  break;
 
      case HOST_CMD_QUEUE_POINT_NEW :
-	  writef(ctx, "Move to (%d, %d, %d, %d, %d) in %d us, %s relative\n",
+	  writef(ctx, "(142) Move to (%d, %d, %d, %d, %d) in %u us, %s relative\n",
 		 F(queue_point_new.x),
 		 F(queue_point_new.y),
 		 F(queue_point_new.z),
 		 F(queue_point_new.a),
 		 F(queue_point_new.b),
-		 F(queue_point_new.us),
+		 (uint32_t)F(queue_point_new.us),
 		 axes_mask(F(queue_point_new.rel), buf, sizeof(buf), 0));
 	  break;
 
      case HOST_CMD_QUEUE_POINT_NEW_EXT :
-	  writef(ctx, "Move to (%d, %d, %d, %d, %d), DDA rate %d, %s relative, "
+	  writef(ctx, "(155) Move to (%d, %d, %d, %d, %d), DDA rate %u, %s relative, "
 		 "distance %f mm, feedrate*64 %d steps/s\n",
 		 F(queue_point_new_ext.x),
 		 F(queue_point_new_ext.y),
 		 F(queue_point_new_ext.z),
 		 F(queue_point_new_ext.a),
 		 F(queue_point_new_ext.b),
-		 F(queue_point_new_ext.dda_rate),
+		 (uint32_t)F(queue_point_new_ext.dda_rate),
 		 axes_mask(F(queue_point_new_ext.rel), buf, sizeof(buf), 0),
 		 F(queue_point_new_ext.distance),
-		 F(queue_point_new_ext.feedrate_mult_64));
+		 (int16_t)F(queue_point_new_ext.feedrate_mult_64));
 	  break;
 
      case HOST_CMD_SET_POT_VALUE :
-	  writef(ctx, "Set %s axis digipot to %hhu\n",
+	  writef(ctx, "(145) Set %s axis digipot to %hhu\n",
 		 axes_names(F(digi_pot.axis), buf, sizeof(buf)),
 		 F(digi_pot.value));
 	  break;
 
      case HOST_CMD_SET_RGB_LED :
-	  writef(ctx, "Set RGB LED (0x%02hhx, 0x%02hhx, 0x%02hhx), "
+	  writef(ctx, "(146) Set RGB LED (0x%02hhx, 0x%02hhx, 0x%02hhx), "
 		 "blink rate %hhu, effect %hhu\n",
 		 F(rgb_led.red),
 		 F(rgb_led.green),
@@ -960,7 +1173,7 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 	  break;
 
      case HOST_CMD_SET_BEEP :
-	  writef(ctx, "Set buzzer frequency %hu, duration %hu ms, "
+	  writef(ctx, "(147) Set buzzer frequency %hu, duration %hu ms, "
 		 "effect %hhu\n",
 		 F(beep.frequency),
 		 F(beep.duration),
@@ -968,7 +1181,7 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 	  break;
 
      case HOST_CMD_PAUSE_FOR_BUTTON :
-	  writef(ctx, "Pause for button 0x%02hhx, timeout %hu s, "
+	  writef(ctx, "(148) Pause for button 0x%02hhx, timeout %hu s, "
 		 "timeout behavior %hhu\n",
 		 F(button_pause.mask),
 		 F(button_pause.timeout),
@@ -976,7 +1189,7 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 	  break;
 
      case HOST_CMD_DISPLAY_MESSAGE :
-	  writef(ctx, "Display message, options 0x%02x, position "
+	  writef(ctx, "(149) Display message, options 0x%02x, position "
 		 "(%hhu, %hhu), timeout %hhu s, message \"%.*s\"\n",
 		 F(display_message.options),
 		 F(display_message.x),
@@ -987,58 +1200,72 @@ void s3g_command_display(s3g_context_t *ctx, s3g_command_t *cmd)
 	  break;
 
      case HOST_CMD_SET_BUILD_PERCENT :
-	  writef(ctx, "Set build percentage %hhu%%, reserved %hhu\n",
+	  writef(ctx, "(150) Set build percentage %hhu%%, reserved %hhu\n",
 		 F(build_percentage.percentage),
 		 F(build_percentage.reserved));
 	  break;
 
      case HOST_CMD_QUEUE_SONG :
-	  writef(ctx, "Queue song %hhu\n", F(queue_song.song_id));
+	  writef(ctx, "(151) Queue song %hhu\n", F(queue_song.song_id));
 	  break;
 
      case HOST_CMD_RESET_TO_FACTORY :
-	  writef(ctx, "Restore factory defaults, options 0x%02hhx\n",
+	  writef(ctx, "(152) Restore factory defaults, options 0x%02hhx\n",
 		 F(factory_reset.options));
 	  break;
 
      case HOST_CMD_BUILD_START_NOTIFICATION :
-	  writef(ctx, "Start build notification, steps %d, name \"%.*s\"\n",
-		 F(build_start.steps),
+	  writef(ctx, "(153) Start build notification, steps %d, name \"%.*s\"\n",
+		 (int32_t)F(build_start.steps),
 		 F(build_start.message_len),
 		 F(build_start.message));
 	  break;
 
      case HOST_CMD_BUILD_END_NOTIFICATION :
-	  writef(ctx, "End build notification, options 0x%02hhx\n",
+	  writef(ctx, "(154) End build notification, options 0x%02hhx\n",
 		 F(build_end.flags));
 	  break;
 
      case HOST_CMD_CHANGE_TOOL :
-	  writef(ctx, "Switch to Tool %hhu\n", F(change_tool.index));
+	  writef(ctx, "(134) Switch to Tool %hhu\n", F(change_tool.index));
           break;
 
      case HOST_CMD_ENABLE_AXES :
-	  writef(ctx, "%s %s stepper motors\n",
+	  writef(ctx, "(137) %s %s stepper motors\n",
 		 (F(enable_axes.axes) & 0x80) ? "Enable" : "Disable",
 		 axes_mask(F(enable_axes.axes), buf, sizeof(buf), 0));
           break;
 
+     case HOST_CMD_WAIT_FOR_BUTTON :
+	  writef(ctx, "(138) Wait on user response, option %hu\n",
+		 F(wait_for_button.options));
+	  break;
+
      case HOST_CMD_SET_ACCELERATION_TOGGLE:
-	  writef(ctx, "Set segment acceleration %s\n",
+	  writef(ctx, "(156) Set segment acceleration %s\n",
 		 (F(set_segment_acceleration.s)) ? "on" : "off");
 	  break;
 
      case HOST_CMD_STREAM_VERSION:
-	  writef(ctx, "Stream version %hhu.%hhu, bot type %s (0x%04hx)\n",
+	  writef(ctx, "(157) Stream version %hhu.%hhu, %hhu, %u, %hu, %hu, "
+		 "%u, %u, %hhu\n",
 		 F(x3g_version.version_high), F(x3g_version.version_low),
-		 bot_type(F(x3g_version.bot_type), buf, sizeof(buf)),
-		 F(x3g_version.bot_type));
+		 F(x3g_version.reserved1), F(x3g_version.reserved2),
+		 F(x3g_version.bot_type), F(x3g_version.reserved3),
+		 F(x3g_version.reserved4), F(x3g_version.reserved5),
+		 F(x3g_version.reserved6));
 	  break;
 
      case HOST_CMD_PAUSE_AT_ZPOS:
-	  writef(ctx, "Pause @ Z position %f\n", F(pause_at_zpos.zpos));
+	  writef(ctx, "(158) Pause @ Z position %f\n", F(pause_at_zpos.zpos));
 	  break;
      }
+
+     if (cmd->cmd_crc_err)
+	  writef(ctx, "*** The CRC fails to match the data in the previous "
+		 "command ***\n");
+
+#undef F
 }
 
 int s3g_command_write(s3g_context_t *ctx, s3g_command_t *cmd)
@@ -146,11 +146,19 @@ typedef struct {
 } s3g_recall_home_position;
 
 typedef struct {
-     uint8_t     index;
-     uint8_t     subcmd_id;
-     size_t      subcmd_len;
-     const char *subcmd_desc;
-     uint16_t    subcmd_value;
+     uint16_t options;
+} s3g_wait_for_button;
+
+// Tool commands and tool queries; subcmd_value is the payload read as a
+// little endian integer when it is 1, 2 or 4 bytes long and the first
+// 16 bits of it otherwise.  subcmd_data holds the start of the payload.
+typedef struct {
+     uint8_t       index;
+     uint8_t       subcmd_id;
+     size_t        subcmd_len;
+     const char   *subcmd_desc;
+     uint32_t      subcmd_value;
+     unsigned char subcmd_data[16];
 } s3g_tool;
 
 typedef struct {
@@ -264,7 +272,7 @@ typedef struct {
      uint8_t       y;
      uint8_t       timeout;
      uint8_t       message_len;
-     unsigned char message[64];
+     unsigned char message[256];
 } s3g_display_message;
 
 typedef struct {
@@ -283,7 +291,7 @@ typedef struct {
 typedef struct {
      uint32_t      steps;
      uint8_t       message_len;
-     unsigned char message[64];
+     unsigned char message[256];
 } s3g_build_start_notification;
 
 typedef struct {
@@ -306,12 +314,29 @@ typedef struct {
     float zpos;
 } s3g_pause_at_zpos;
 
+typedef struct {
+     uint16_t host_version;
+} s3g_version;
+
+typedef struct {
+     uint16_t offset;
+     uint8_t  count;
+} s3g_read_eeprom;
+
+typedef struct {
+     uint8_t restart;
+} s3g_next_filename;
+
+typedef struct {
+     uint8_t flags;
+} s3g_extended_stop;
+
 // s3g_command_t
 // An individual command read from a .s3g file is stored in
 // this data structure.  You need to know from the command id
 // which member of the union to look at.
 
-#define MAX_S3G_CMD_LEN 32
+#define MAX_S3G_CMD_LEN 512
 
 // #define constants from the command ids are available in Commands.hh
 
@@ -321,6 +346,8 @@ typedef struct {
      const char    *cmd_desc;
      size_t         cmd_raw_len;
      unsigned char  cmd_raw[MAX_S3G_CMD_LEN];
+     int            cmd_framed;   // read from an on-wire packet, 0xD5 ...
+     int            cmd_crc_err;  // and the packet's CRC was wrong
      union {
 	  s3g_queue_point_abs          queue_point_abs;
 	  s3g_queue_point_ext          queue_point_ext;
@@ -363,10 +390,17 @@ typedef struct {
 	  s3g_build_end_notification   build_end;
 	  s3g_stream_version           x3g_version;
 	  s3g_pause_at_zpos            pause_at_zpos;
+	  s3g_wait_for_button          wait_for_button;
+	  s3g_version                  version;
+	  s3g_read_eeprom              read_eeprom;
+	  s3g_next_filename            next_filename;
+	  s3g_extended_stop            extended_stop;
      } t;
 } s3g_command_t;
 
 #define S3G_INPUT_TYPE_FILE 0  // stdin or a named disk file
+#define S3G_INPUT_TYPE_MMAP 1  // a named disk file mapped into memory, read
+                               //   as a FILE when it can't be mapped
 
 // Obtain an s3g_context for an input source of type S3G_INPUT_TYPE_.
 // The context returned must be disposed of by calling s3g_close().
@@ -377,11 +411,13 @@ typedef struct {
 //      Input source type.  Must be one of
 //
 //         S3G_INPUT_TYPE_FILE
+//         S3G_INPUT_TYPE_MMAP
 //
 //   void *src
 //      Input source information for the selected input type
 //
 //         S3G_INPUT_TYPE_FILE -- const char *filename or NULL for stdin
+//         S3G_INPUT_TYPE_MMAP -- as for S3G_INPUT_TYPE_FILE
 //
 //   Return values:
 //
@@ -406,8 +442,9 @@ s3g_context_t *s3g_open(int type, const char *src, int create_file, int mode);
 //
 //  Return values:
 //
-//    0 -- Success
-//    1 -- Unrecognized command encountered; not possible to read further
+//    0 -- Success; cmd_desc is NULL when the command id isn't recognized,
+//           in which case only the id byte was read
+//    1 -- End of file
 //   -1 -- Read error; check errno
 
 int s3g_command_read(s3g_context_t *ctx, s3g_command_t *cmd);
@@ -416,6 +453,17 @@ int s3g_command_read_ext(s3g_context_t *ctx, s3g_command_t *cmd,
 			 unsigned char *rawbuf, size_t maxbuf, size_t *len);
 
 
+// Decode the next command without copying it.  Returns the same values as
+// s3g_command_read().  *raw is pointed at the command's bytes in the mapped
+// file, where they stay until s3g_close(), or in the context's read buffer,
+// where they stay only until the next call.  cmd_raw isn't filled in.  The
+// command tables are constant so separate contexts may be decoded from
+// separate threads at the same time.
+
+int s3g_command_next(s3g_context_t *ctx, s3g_command_t *cmd,
+		     const unsigned char **raw, size_t *rawlen);
+
+
 // Close the s3g input source, releasing any resources
 //
 // Call arguments:
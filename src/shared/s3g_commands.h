@@ -55,6 +55,8 @@ extern "C" {
 #define HOST_CMD_GET_BUILD_STATS		24
 #define HOST_CMD_ADVANCED_VERSION		27
 #define HOST_CMD_DEBUG_ECHO			112
+#define HOST_CMD_QUEUE_POINT_ABS		129
+#define HOST_CMD_SET_POSITION			130
 #define HOST_CMD_FIND_AXES_MINIMUM		131
 #define HOST_CMD_FIND_AXES_MAXIMUM		132
 #define HOST_CMD_DELAY				133
@@ -62,6 +64,7 @@ extern "C" {
 #define HOST_CMD_WAIT_FOR_TOOL			135
 #define HOST_CMD_TOOL_COMMAND			136
 #define HOST_CMD_ENABLE_AXES			137
+#define HOST_CMD_WAIT_FOR_BUTTON		138
 #define HOST_CMD_QUEUE_POINT_EXT		139
 #define HOST_CMD_SET_POSITION_EXT		140
 #define HOST_CMD_WAIT_FOR_PLATFORM		141
@@ -110,6 +113,7 @@ extern "C" {
 #define TOOL_CMD_ABORT				24
 #define TOOL_CMD_READ_FROM_EEPROM		25
 #define TOOL_CMD_WRITE_TO_EEPROM		26
+#define TOOL_CMD_TOGGLE_ABP			27
 #define TOOL_CMD_GET_PLATFORM_TEMP		30
 #define TOOL_CMD_SET_PLATFORM_TEMP		31
 #define TOOL_CMD_GET_SP				32
@@ -119,6 +123,7 @@ extern "C" {
 #define TOOL_CMD_GET_TOOL_STATUS		36
 #define TOOL_CMD_GET_PID_STATE			37
 #define TOOL_CMD_LIGHT_INDICATOR_LED		40
+#define TOOL_CMD_QUEUE_POINT_ABS		129
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,177 @@
+/*  Copyright (c) 2015, Dan Newman <dan(dot)newman(at)mtbaldy(dot)us>
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *  1. Redistributions of source code must retain the above copyright notice, this
+ *     list of conditions and the following disclaimer. 
+ *  2. Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/mman.h>
+#endif
+
+#include "s3g_mmap.h"
+#include "s3g_stdio.h"
+
+// This driver maps a disk file into memory and hands the whole of it to
+// the s3g context to decode in place, there's no read procedure.  Input
+// which can't be mapped -- stdin, pipes, empty files and anything being
+// written -- is passed on to the stdio driver to be read through a buffer.
+
+#if !defined(_WIN32) && !defined(_WIN64)
+
+// This driver's private context
+
+typedef struct {
+     void   *addr;  // Start of the mapping
+     size_t  len;   // Length of the mapping
+} s3g_mmap_ctx_t;
+
+
+// mmap_close
+//
+// Unmap the file and release the allocated driver context
+//
+// Call arguments:
+//
+//   void *ctx
+//     Private driver context allocated by s3g_mmap_open().
+//
+// Return values:
+//
+//   0 -- Success
+//  -1 -- Error; check errno
+
+static s3g_close_proc_t mmap_close;
+static int mmap_close(void *ctx)
+{
+     s3g_mmap_ctx_t *myctx = (s3g_mmap_ctx_t *)ctx;
+     int iret;
+
+     // Sanity check
+     if (!myctx)
+     {
+	  errno = EINVAL;
+	  return(-1);
+     }
+
+     iret = munmap(myctx->addr, myctx->len);
+     free(myctx);
+
+     return(iret);
+}
+
+#endif
+
+// s3g_mmap_open
+// Our public open routine.  This is the only public routine for the driver.
+//
+// Call arguments are those of s3g_stdio_open().  When the source can't be
+// mapped, the context is set up by s3g_stdio_open() instead.
+//
+// Return values:
+//
+//   0 -- Success
+//  -1 -- Error; check errno
+
+int s3g_mmap_open(s3g_context_t *ctx, const char *src, int create_file, int mode)
+{
+#if !defined(_WIN32) && !defined(_WIN64)
+     s3g_mmap_ctx_t *tmp;
+     struct stat st;
+     void *addr;
+     int fd, oflag;
+
+     // Sanity check
+     if (!ctx)
+     {
+	  fprintf(stderr, "s3g_mmap_open(%d): Invalid call; ctx=NULL\n",
+		  __LINE__);
+	  errno = EINVAL;
+	  return(-1);
+     }
+
+     // Only a named file being read can be mapped
+     if (src == NULL || create_file)
+	  return(s3g_stdio_open(ctx, src, create_file, mode));
+
+     oflag = O_RDONLY;
+#ifdef O_BINARY
+     oflag |= O_BINARY;
+#endif
+     fd = open(src, oflag);
+     if (fd < 0)
+     {
+	  fprintf(stderr, "s3g_open(%d): Unable to open the file \"%s\"; "
+		  "%s (%d)\n",
+		  __LINE__, src, strerror(errno), errno);
+	  return(-1);
+     }
+
+     // Named pipes, devices and empty files get read the ordinary way
+     if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+	 (addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+		      fd, 0)) == MAP_FAILED)
+     {
+	  close(fd);
+	  return(s3g_stdio_open(ctx, src, create_file, mode));
+     }
+
+     // The mapping outlives the descriptor
+     close(fd);
+
+#ifdef MADV_SEQUENTIAL
+     madvise(addr, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+
+     // Allocate memory for our "driver" context
+     tmp = (s3g_mmap_ctx_t *)calloc(1, sizeof(s3g_mmap_ctx_t));
+     if (tmp == NULL)
+     {
+	  fprintf(stderr, "s3g_open(%d): Unable to allocate VM; %s (%d)\n",
+		  __LINE__, strerror(errno), errno);
+	  munmap(addr, (size_t)st.st_size);
+	  return(-1);
+     }
+     tmp->addr = addr;
+     tmp->len  = (size_t)st.st_size;
+
+     // All finished and happy
+     ctx->close  = mmap_close;
+     ctx->read   = NULL;
+     ctx->r_ctx  = tmp;
+     ctx->write  = NULL;
+     ctx->w_ctx  = NULL;
+     ctx->next   = (const unsigned char *)addr;
+     ctx->end    = (const unsigned char *)addr + tmp->len;
+
+     return(0);
+#else
+     return(s3g_stdio_open(ctx, src, create_file, mode));
+#endif
+}
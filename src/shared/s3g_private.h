@@ -50,6 +50,9 @@ typedef struct {
      void             *w_ctx;    // File driver private context
      size_t            nread;    // Bytes read
      size_t            nwritten; // Bytes written
+     const unsigned char *next;  // Unread input, mapped or in buf
+     const unsigned char *end;   // End of the unread input
+     unsigned char    *buf;      // Read buffer when the input isn't mapped
 } s3g_context_t;
 #endif
 
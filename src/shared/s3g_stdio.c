@@ -153,11 +153,14 @@ static ssize_t stdio_read_retry(int fd, void *buf, size_t nbytes)
      nread = 0;
      for (;;)
      {
-	  if ((n = read(fd, buf, nbytes)) <= 0 && FD_TEMPORARY_ERR())
+	  if ((n = read(fd, buf, nbytes)) < 0 && FD_TEMPORARY_ERR())
 	       continue;
 	  if (n == 0)
 	       // EOF reached
 	       return(nread);
+	  if (n < 0)
+	       // Permanent error; report what was read before it
+	       return(nread ? nread : (ssize_t)-1);
 	  nread  += n;
 	  nbytes -= n;
 	  if (nbytes == 0)
@@ -29,6 +29,8 @@
 // or
 //
 //     s3gdump < filename
+//
+// The output is the same as that of scripts/s3g-decompiler.py, -o included
 
 #include <stdio.h>
 #include <string.h>
@@ -44,21 +46,24 @@ static void usage(FILE *f, const char *prog)
 	  f = stderr;
 
      fprintf(f,
-"Usage: %s -hE [file]\n"
+"Usage: %s -ho [file]\n"
 "   file  -- The .s3g file to dump.  If not supplied then stdin is dumped\n"
-"  ?, -h  -- This help message\n",
+"  ?, -h  -- This help message\n"
+"     -o  -- Display the byte offset into the file for each command\n",
 	     prog ? prog : "s3gdump");
 }
 
 int main(int argc, const char *argv[])
 {
-     int c;
+     int c, iret;
      s3g_context_t *ctx;
      s3g_command_t cmd;
-     int lineno, simple;
+     int lineno, offsets, simple;
+     unsigned long offset;
 
+     offsets = 0;
      simple = 0;
-     while ((c = getopt(argc, (char **)argv, ":h?")) != GETOPTS_END)
+     while ((c = getopt(argc, (char **)argv, ":ho?")) != GETOPTS_END)
      {
 	  switch(c)
 	  {
@@ -73,6 +78,10 @@ int main(int argc, const char *argv[])
 	  case '?' :
 	       usage(stdout, argv[0]);
 	       return(0);
+
+	  case 'o' :
+	       offsets = -1;
+	       break;
 	  }
      }
 
@@ -81,27 +90,41 @@ int main(int argc, const char *argv[])
      argv += optind;
 
      if (argc == 0)
-	  ctx = s3g_open(0, NULL, 0, 0);
+	  ctx = s3g_open(S3G_INPUT_TYPE_MMAP, NULL, 0, 0);
      else
-	  ctx = s3g_open(0, (void *)argv[0], 0, 0);
+	  ctx = s3g_open(S3G_INPUT_TYPE_MMAP, (void *)argv[0], 0, 0);
 
      if (!ctx)
 	  // Assume that s3g_open() has logged the problem to stderr
 	  return(1);
 
-     fprintf(stdout, "Command count: (Command ID) Command description\n");
+     fprintf(stdout, "Command count%s: (Command ID) Command description\n",
+	     offsets ? " [File byte offset]" : "");
 
      lineno = 0;
-     while (!s3g_command_read(ctx, &cmd))
+     offset = 0;
+     while (!(iret = s3g_command_next(ctx, &cmd, NULL, NULL)))
      {
-	  fprintf(stdout, "%d: ", ++lineno);
+	  if (offsets)
+	       fprintf(stdout, "%d [%lu]: ", ++lineno, offset);
+	  else
+	       fprintf(stdout, "%d: ", ++lineno);
+	  offset += (unsigned long)cmd.cmd_raw_len;
 	  if (simple)
-	       fprintf(stdout, "(%d) %s\n", cmd.cmd_id, cmd.cmd_desc);
+	       fprintf(stdout, "(%d) %s\n", cmd.cmd_id,
+		       cmd.cmd_desc ? cmd.cmd_desc : "unrecognized");
 	  else
 	       s3g_command_display(ctx, &cmd);
      }
 
-     fprintf(stdout, "\nEOF\n");
+     // s3g_command_next() has logged any read error to stderr
+     if (iret < 0)
+     {
+	  s3g_close(ctx);
+	  return(1);
+     }
+
+     fprintf(stdout, "EOF\n");
      
      s3g_close(ctx);
 
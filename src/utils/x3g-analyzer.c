@@ -0,0 +1,654 @@
+/*  Copyright (c) 2015, Dan Newman <dan(dot)newman(at)mtbaldy(dot)us>
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *  1. Redistributions of source code must retain the above copyright notice, this
+ *     list of conditions and the following disclaimer. 
+ *  2. Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Run a .s3g or .x3g file against a machine definition and report as JSON
+// how long it takes, how long each layer takes, the extents of the print,
+// the filament each tool uses, the fastest move and the heater waits
+//
+//     x3g-analyzer [-m machine] [-c config.ini] filename
+//
+// Moves are timed by the same simulation of the firmware's planner that
+// gpx uses for its estimate, heaters warm up at gpx's rates
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <errno.h>
+
+#include "s3g.h"
+#include "opt.h"
+#include "machine_config.h"
+#include "planner.h"
+
+#define GETOPTS_END -1
+
+// gpx's heating estimate, seconds per degree C, see gpx.h
+#define NOZZLE_TIME 0.6
+#define HBP_TIME 6
+#define AMBIENT_TEMP 24
+
+typedef struct {
+     double target;  // C
+     double from;    // C when the target was set
+     double t_set;   // s when the target was set
+     double rate;    // s per C
+} heater_t;
+
+typedef struct {
+     unsigned long offset;  // File byte offset of the wait command
+     int    tool;
+     int    platform;
+     double target;         // C
+     double start;          // s
+     double wait;           // s
+} heater_wait_t;
+
+typedef struct {
+     double z;     // mm
+     double time;  // s
+} layer_t;
+
+typedef struct {
+     int    set;
+     double min[3];
+     double max[3];
+} bounds_t;
+
+typedef struct {
+     const Machine *machine;
+     double         steps_per_mm[PLANNER_AXES];
+     Planner        planner;
+     int            tag[PLANNER_LOOKAHEAD];  // Layer of each planned move
+     int32_t        pos[PLANNER_AXES];       // Steps
+     double         time;                    // s
+     double         setup_time;              // s before the first layer
+     double         max_feedrate;            // mm/s
+     double         filament[2];             // mm
+     bounds_t       print, travel;
+     heater_t       nozzle[2], platform[2];
+     heater_wait_t *waits;
+     size_t         nwaits, maxwaits;
+     layer_t       *layers;
+     size_t         nlayers, maxlayers;
+     int            layer;                   // Current layer, -1 before the first
+     int32_t        layer_z;                 // Steps
+     unsigned long  offset, commands, moves, unrecognized, crc_errors;
+} analysis_t;
+
+static void usage(FILE *f, const char *prog)
+{
+     if (f == NULL)
+	  f = stderr;
+
+     fprintf(f,
+"Usage: %s [-h] [-m machine] [-c config] file\n"
+"   file  -- The .s3g or .x3g file to analyze.  If not supplied then stdin\n"
+"              is analyzed\n"
+"  ?, -h  -- This help message\n"
+"     -c  -- Machine definition .ini file, on top of the -m machine\n"
+"     -m  -- Machine type, default r2\n",
+	     prog ? prog : "x3g-analyzer");
+}
+
+// Charge time to the layer it's spent in
+
+static void charge(analysis_t *a, int layer, double t)
+{
+     a->time += t;
+     if (layer < 0)
+	  a->setup_time += t;
+     else
+	  a->layers[layer].time += t;
+}
+
+// Time the oldest planned move
+
+static void retire(analysis_t *a)
+{
+     charge(a, a->tag[0], planner_retire(&a->planner));
+     memmove(a->tag, a->tag + 1, a->planner.count * sizeof(int));
+}
+
+static void plan(analysis_t *a, const double *delta, double distance,
+		 double speed)
+{
+     if (a->planner.count == PLANNER_LOOKAHEAD)
+	  retire(a);
+     planner_add(&a->planner, a->machine, delta, distance, speed);
+     a->tag[a->planner.count - 1] = a->layer;
+     if (speed > a->max_feedrate)
+	  a->max_feedrate = speed;
+}
+
+// The firmware drains its planner before anything which isn't a planned move
+
+static void stop(analysis_t *a)
+{
+     while (a->planner.count)
+	  retire(a);
+     planner_stop(&a->planner);
+}
+
+// Temperature of a heater now, warming at a steady rate and cooling at once
+
+static double heater_temp(const analysis_t *a, const heater_t *h)
+{
+     double t;
+
+     if (h->target <= h->from)
+	  return(h->target);
+     t = h->from + (a->time - h->t_set) / h->rate;
+     return((t < h->target) ? t : h->target);
+}
+
+static void heater_set(analysis_t *a, heater_t *h, double target)
+{
+     h->from   = heater_temp(a, h);
+     h->t_set  = a->time;
+     h->target = target;
+}
+
+static int heater_wait(analysis_t *a, heater_t *h, int tool, int platform,
+		       unsigned timeout)
+{
+     heater_wait_t *w;
+     double wait;
+
+     stop(a);
+
+     wait = (h->target - heater_temp(a, h)) * h->rate;
+     if (wait < 0.0)
+	  wait = 0.0;
+     // The firmware carries on once the wait times out
+     if (timeout && wait > (double)timeout)
+	  wait = (double)timeout;
+
+     if (a->nwaits == a->maxwaits)
+     {
+	  size_t n = a->maxwaits ? 2 * a->maxwaits : 16;
+	  w = (heater_wait_t *)realloc(a->waits, n * sizeof(heater_wait_t));
+	  if (!w)
+	       return(-1);
+	  a->waits = w;
+	  a->maxwaits = n;
+     }
+     w = a->waits + a->nwaits++;
+     w->offset   = a->offset;
+     w->tool     = tool;
+     w->platform = platform;
+     w->target   = h->target;
+     w->start    = a->time;
+     w->wait     = wait;
+
+     charge(a, a->layer, wait);
+
+     return(0);
+}
+
+static int layer_start(analysis_t *a, int32_t z)
+{
+     if (a->nlayers == a->maxlayers)
+     {
+	  size_t n = a->maxlayers ? 2 * a->maxlayers : 256;
+	  layer_t *l = (layer_t *)realloc(a->layers, n * sizeof(layer_t));
+	  if (!l)
+	       return(-1);
+	  a->layers = l;
+	  a->maxlayers = n;
+     }
+     a->layers[a->nlayers].z    = (double)z / a->steps_per_mm[2];
+     a->layers[a->nlayers].time = 0.0;
+     a->layer   = (int)a->nlayers++;
+     a->layer_z = z;
+
+     return(0);
+}
+
+static void bounds_add(bounds_t *b, const int32_t *pos, const double *steps_per_mm)
+{
+     int i;
+
+     for (i = 0; i < 3; i++)
+     {
+	  double mm = (double)pos[i] / steps_per_mm[i];
+	  if (!b->set || mm < b->min[i])
+	       b->min[i] = mm;
+	  if (!b->set || mm > b->max[i])
+	       b->max[i] = mm;
+     }
+     b->set = 1;
+}
+
+// move
+//
+// Account for a move to target.  The bits of rel flag the axes whose target
+// is relative.  Moves given a distance and speed are planned, those given
+// only as a step rate are not.  The extruders step backwards so they extrude
+// on negative steps.
+//
+// Call arguments:
+//
+//   const int32_t *target
+//     Steps on x, y, z, a and b.
+//
+//   unsigned rel
+//     Bit mask of the relative axes.
+//
+//   double distance, speed
+//     Distance in mm and speed in mm/s for a planned move, otherwise 0.
+//
+//   double seconds
+//     Time taken by an unplanned move.
+//
+// Return values:
+//
+//   0 -- Success
+//  -1 -- Unable to allocate VM
+
+static int move(analysis_t *a, const int32_t *target, unsigned rel,
+		double distance, double speed, double seconds)
+{
+     double delta[PLANNER_AXES];
+     int32_t end[PLANNER_AXES];
+     int i, extruding;
+
+     for (i = 0; i < PLANNER_AXES; i++)
+     {
+	  end[i] = (rel & (1 << i)) ? a->pos[i] + target[i] : target[i];
+	  delta[i] = (double)(end[i] - a->pos[i]) / a->steps_per_mm[i];
+     }
+     delta[3] = -delta[3];
+     delta[4] = -delta[4];
+
+     // Printing is extruding while moving across the bed
+     extruding = (delta[3] > 0.0 || delta[4] > 0.0) &&
+	  (end[0] != a->pos[0] || end[1] != a->pos[1]);
+
+     if (extruding && (a->layer < 0 || end[2] != a->layer_z))
+	  if (layer_start(a, end[2]))
+	       return(-1);
+
+     if (speed > 0.0 && distance > 0.0)
+	  plan(a, delta, distance, speed);
+     else if (seconds > 0.0)
+     {
+	  stop(a);
+	  charge(a, a->layer, seconds);
+	  distance = sqrt(delta[0] * delta[0] + delta[1] * delta[1] +
+			  delta[2] * delta[2]);
+	  if (distance / seconds > a->max_feedrate)
+	       a->max_feedrate = distance / seconds;
+     }
+
+     a->moves++;
+     a->filament[0] += delta[3];
+     a->filament[1] += delta[4];
+     if (extruding)
+     {
+	  bounds_add(&a->print, a->pos, a->steps_per_mm);
+	  bounds_add(&a->print, end, a->steps_per_mm);
+     }
+     bounds_add(&a->travel, end, a->steps_per_mm);
+     memcpy(a->pos, end, sizeof(end));
+
+     return(0);
+}
+
+// Time for the longest axis to step at dda microseconds a step
+
+static double dda_seconds(const analysis_t *a, const int32_t *target,
+			  unsigned rel, double dda)
+{
+     int32_t n, longest = 0;
+     int i;
+
+     for (i = 0; i < PLANNER_AXES; i++)
+     {
+	  n = (rel & (1 << i)) ? target[i] : target[i] - a->pos[i];
+	  if (n < 0)
+	       n = -n;
+	  if (n > longest)
+	       longest = n;
+     }
+     return((double)longest * dda / 1000000.0);
+}
+
+static int analyze(analysis_t *a, s3g_command_t *cmd)
+{
+     int32_t target[PLANNER_AXES];
+     double distance, us;
+     int i;
+
+     switch(cmd->cmd_id)
+     {
+     case HOST_CMD_QUEUE_POINT_NEW_EXT :
+	  target[0] = cmd->t.queue_point_new_ext.x;
+	  target[1] = cmd->t.queue_point_new_ext.y;
+	  target[2] = cmd->t.queue_point_new_ext.z;
+	  target[3] = cmd->t.queue_point_new_ext.a;
+	  target[4] = cmd->t.queue_point_new_ext.b;
+	  // Without a distance the firmware falls back to the step rate
+	  if (cmd->t.queue_point_new_ext.distance > 0.0f &&
+	      cmd->t.queue_point_new_ext.feedrate_mult_64 > 0)
+	       return(move(a, target, cmd->t.queue_point_new_ext.rel,
+			   (double)cmd->t.queue_point_new_ext.distance,
+			   cmd->t.queue_point_new_ext.feedrate_mult_64 / 64.0,
+			   0.0));
+	  return(move(a, target, cmd->t.queue_point_new_ext.rel, 0.0, 0.0,
+		      (cmd->t.queue_point_new_ext.dda_rate > 0) ?
+		      dda_seconds(a, target, cmd->t.queue_point_new_ext.rel,
+				  1000000.0 / cmd->t.queue_point_new_ext.dda_rate) : 0.0));
+
+     case HOST_CMD_QUEUE_POINT_NEW :
+	  // The distance is across the bed, or of the extruders alone
+	  target[0] = cmd->t.queue_point_new.x;
+	  target[1] = cmd->t.queue_point_new.y;
+	  target[2] = cmd->t.queue_point_new.z;
+	  target[3] = cmd->t.queue_point_new.a;
+	  target[4] = cmd->t.queue_point_new.b;
+	  {
+	       double d[PLANNER_AXES];
+	       for (i = 0; i < PLANNER_AXES; i++)
+		    d[i] = (double)((cmd->t.queue_point_new.rel & (1 << i)) ?
+				    target[i] : target[i] - a->pos[i]) /
+			 a->steps_per_mm[i];
+	       distance = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+	       if (distance == 0.0)
+		    distance = (fabs(d[3]) > fabs(d[4])) ? fabs(d[3]) : fabs(d[4]);
+	  }
+	  us = (double)cmd->t.queue_point_new.us;
+	  return(move(a, target, cmd->t.queue_point_new.rel, distance,
+		      (us > 0.0) ? distance * 1000000.0 / us : 0.0, 0.0));
+
+     case HOST_CMD_QUEUE_POINT_EXT :
+	  // Moves given as a DDA aren't planned
+	  target[0] = cmd->t.queue_point_ext.x;
+	  target[1] = cmd->t.queue_point_ext.y;
+	  target[2] = cmd->t.queue_point_ext.z;
+	  target[3] = cmd->t.queue_point_ext.a;
+	  target[4] = cmd->t.queue_point_ext.b;
+	  return(move(a, target, 0, 0.0, 0.0,
+		      dda_seconds(a, target, 0, (double)cmd->t.queue_point_ext.dda)));
+
+     case HOST_CMD_QUEUE_POINT_ABS :
+	  target[0] = cmd->t.queue_point_abs.x;
+	  target[1] = cmd->t.queue_point_abs.y;
+	  target[2] = cmd->t.queue_point_abs.z;
+	  target[3] = a->pos[3];
+	  target[4] = a->pos[4];
+	  return(move(a, target, 0, 0.0, 0.0,
+		      dda_seconds(a, target, 0, (double)cmd->t.queue_point_abs.dda)));
+
+     case HOST_CMD_SET_POSITION_EXT :
+	  stop(a);
+	  a->pos[0] = cmd->t.set_position_ext.x;
+	  a->pos[1] = cmd->t.set_position_ext.y;
+	  a->pos[2] = cmd->t.set_position_ext.z;
+	  a->pos[3] = cmd->t.set_position_ext.a;
+	  a->pos[4] = cmd->t.set_position_ext.b;
+	  break;
+
+     case HOST_CMD_SET_POSITION :
+	  stop(a);
+	  a->pos[0] = cmd->t.set_position.x;
+	  a->pos[1] = cmd->t.set_position.y;
+	  a->pos[2] = cmd->t.set_position.z;
+	  break;
+
+     case HOST_CMD_FIND_AXES_MINIMUM :
+     case HOST_CMD_FIND_AXES_MAXIMUM :
+	  // How far the axes travel to their endstops isn't known, so as gpx
+	  // does charge the time to move a mm on each axis at the homing rate
+	  {
+	       double longest = 0.0;
+
+	       stop(a);
+	       for (i = 0; i < 3; i++)
+		    if (cmd->t.find_axes_minmax.flags & (1 << i))
+		    if (a->steps_per_mm[i] > longest)
+			 longest = a->steps_per_mm[i];
+	       charge(a, a->layer, (double)cmd->t.find_axes_minmax.feedrate *
+		      longest / 1000000.0);
+	  }
+	  break;
+
+     case HOST_CMD_DELAY :
+	  stop(a);
+	  charge(a, a->layer, cmd->t.delay.millis / 1000.0);
+	  break;
+
+     case HOST_CMD_WAIT_FOR_TOOL :
+	  return(heater_wait(a, &a->nozzle[cmd->t.wait_for_tool.index & 1],
+			     cmd->t.wait_for_tool.index, 0,
+			     cmd->t.wait_for_tool.timeout));
+
+     case HOST_CMD_WAIT_FOR_PLATFORM :
+	  return(heater_wait(a, &a->platform[cmd->t.wait_for_platform.index & 1],
+			     cmd->t.wait_for_platform.index, 1,
+			     cmd->t.wait_for_platform.timeout));
+
+     case HOST_CMD_TOOL_COMMAND :
+	  if (cmd->t.tool.subcmd_id == TOOL_CMD_SET_TEMP)
+	       heater_set(a, &a->nozzle[cmd->t.tool.index & 1],
+			  (double)cmd->t.tool.subcmd_value);
+	  else if (cmd->t.tool.subcmd_id == TOOL_CMD_SET_PLATFORM_TEMP)
+	       heater_set(a, &a->platform[cmd->t.tool.index & 1],
+			  (double)cmd->t.tool.subcmd_value);
+	  break;
+
+     default :
+	  if (cmd->cmd_desc == NULL)
+	       a->unrecognized++;
+	  break;
+     }
+
+     return(0);
+}
+
+static void json_string(FILE *f, const char *s)
+{
+     fputc('"', f);
+     for (; *s; s++)
+     {
+	  if (*s == '"' || *s == '\\')
+	       fprintf(f, "\\%c", *s);
+	  else if ((unsigned char)*s < 0x20)
+	       fprintf(f, "\\u%04x", (unsigned char)*s);
+	  else
+	       fputc(*s, f);
+     }
+     fputc('"', f);
+}
+
+static void json_bounds(FILE *f, const char *name, const bounds_t *b)
+{
+     fprintf(f, "  \"%s\": ", name);
+     if (!b->set)
+	  fprintf(f, "null,\n");
+     else
+	  fprintf(f, "{\"min\": [%.3f, %.3f, %.3f], \"max\": [%.3f, %.3f, %.3f]},\n",
+		  b->min[0], b->min[1], b->min[2], b->max[0], b->max[1], b->max[2]);
+}
+
+static void report(FILE *f, const analysis_t *a, const char *fname)
+{
+     size_t i;
+
+     fprintf(f, "{\n  \"file\": ");
+     if (fname)
+	  json_string(f, fname);
+     else
+	  fprintf(f, "null");
+     fprintf(f, ",\n  \"machine\": ");
+     json_string(f, a->machine->type ? a->machine->type : "");
+     fprintf(f, ",\n  \"bytes\": %lu,\n", a->offset);
+     fprintf(f, "  \"commands\": %lu,\n", a->commands);
+     fprintf(f, "  \"unrecognized_commands\": %lu,\n", a->unrecognized);
+     fprintf(f, "  \"crc_errors\": %lu,\n", a->crc_errors);
+     fprintf(f, "  \"moves\": %lu,\n", a->moves);
+     fprintf(f, "  \"time_s\": %.3f,\n", a->time);
+     fprintf(f, "  \"setup_time_s\": %.3f,\n", a->setup_time);
+     fprintf(f, "  \"max_feedrate_mm_s\": %.3f,\n", a->max_feedrate);
+     fprintf(f, "  \"filament_mm\": [%.3f, %.3f],\n",
+	     a->filament[0], a->filament[1]);
+     json_bounds(f, "bounds_mm", &a->print);
+     json_bounds(f, "travel_bounds_mm", &a->travel);
+
+     fprintf(f, "  \"heater_waits\": [");
+     for (i = 0; i < a->nwaits; i++)
+	  fprintf(f, "%s\n    {\"offset\": %lu, \"tool\": %d, \"heater\": \"%s\", "
+		  "\"target_c\": %.0f, \"start_s\": %.3f, \"wait_s\": %.3f}",
+		  i ? "," : "", a->waits[i].offset, a->waits[i].tool,
+		  a->waits[i].platform ? "platform" : "extruder",
+		  a->waits[i].target, a->waits[i].start, a->waits[i].wait);
+     fprintf(f, "%s],\n", a->nwaits ? "\n  " : "");
+
+     fprintf(f, "  \"layers\": [");
+     for (i = 0; i < a->nlayers; i++)
+	  fprintf(f, "%s\n    {\"z_mm\": %.3f, \"time_s\": %.3f}",
+		  i ? "," : "", a->layers[i].z, a->layers[i].time);
+     fprintf(f, "%s]\n}\n", a->nlayers ? "\n  " : "");
+}
+
+int main(int argc, const char *argv[])
+{
+     int c, i, iret, lineno;
+     s3g_context_t *ctx;
+     s3g_command_t cmd;
+     size_t len;
+     const char *config, *type;
+     const Machine *def;
+     Machine machine;
+     analysis_t a;
+
+     config = NULL;
+     type = "r2";
+     while ((c = getopt(argc, (char **)argv, ":c:hm:?")) != GETOPTS_END)
+     {
+	  switch(c)
+	  {
+	  // Unknown switch
+	  case ':' :
+	  default :
+	       usage(stderr, argv[0]);
+	       return(1);
+
+	  // Explicit help request
+	  case 'h' :
+	  case '?' :
+	       usage(stdout, argv[0]);
+	       return(0);
+
+	  case 'c' :
+	       config = optarg;
+	       break;
+
+	  case 'm' :
+	       type = optarg;
+	       break;
+	  }
+     }
+
+     argc -= optind;
+     argv += optind;
+
+     if (!(def = config_get_machine(type)))
+     {
+	  fprintf(stderr, "Unknown machine type \"%s\"\n", type);
+	  return(1);
+     }
+     memcpy(&machine, def, sizeof(Machine));
+
+     if (config)
+     {
+	  if ((iret = opt_loadfile(config, &lineno)) ||
+	      (iret = config_machine(&machine, def, NULL)))
+	  {
+	       fprintf(stderr, "Unable to load the machine definition \"%s\"",
+		       config);
+	       if (lineno)
+		    fprintf(stderr, " at line %d", lineno);
+	       fprintf(stderr, "; %s\n", opt_strerror(iret));
+	       opt_dispose();
+	       return(1);
+	  }
+	  opt_dispose();
+     }
+
+     memset(&a, 0, sizeof(a));
+     a.machine = &machine;
+     a.steps_per_mm[0] = machine.x.steps_per_mm;
+     a.steps_per_mm[1] = machine.y.steps_per_mm;
+     a.steps_per_mm[2] = machine.z.steps_per_mm;
+     a.steps_per_mm[3] = machine.a.steps_per_mm;
+     a.steps_per_mm[4] = machine.b.steps_per_mm;
+     for (i = 0; i < PLANNER_AXES; i++)
+	  if (a.steps_per_mm[i] <= 0.0)
+	       a.steps_per_mm[i] = 1.0;
+     for (i = 0; i < 2; i++)
+     {
+	  a.nozzle[i].target   = a.nozzle[i].from   = AMBIENT_TEMP;
+	  a.platform[i].target = a.platform[i].from = AMBIENT_TEMP;
+	  a.nozzle[i].rate   = NOZZLE_TIME;
+	  a.platform[i].rate = HBP_TIME;
+     }
+     a.layer = -1;
+     planner_reset(&a.planner);
+
+     ctx = s3g_open(S3G_INPUT_TYPE_MMAP, argc ? argv[0] : NULL, 0, 0);
+     if (!ctx)
+	  // Assume that s3g_open() has logged the problem to stderr
+	  return(1);
+
+     while (!(iret = s3g_command_next(ctx, &cmd, NULL, &len)))
+     {
+	  a.commands++;
+	  if (cmd.cmd_crc_err)
+	       a.crc_errors++;
+	  else if (analyze(&a, &cmd))
+	  {
+	       fprintf(stderr, "x3g-analyzer: Unable to allocate VM; %s (%d)\n",
+		       strerror(errno), errno);
+	       iret = -1;
+	       break;
+	  }
+	  a.offset += len;
+     }
+     stop(&a);
+
+     s3g_close(ctx);
+
+     // s3g_command_next() has logged any read error to stderr
+     if (iret < 0)
+	  return(1);
+
+     report(stdout, &a, argc ? argv[0] : NULL);
+
+     free(a.waits);
+     free(a.layers);
+
+     return(0);
+}